@@ -0,0 +1,137 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2015, Michael Droettboom All rights reserved.
+
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in
+#    the documentation and/or other materials provided with the
+#    distribution.
+
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+# The views and conclusions contained in the software and
+# documentation are those of the authors and should not be interpreted
+# as representing official policies, either expressed or implied, of
+# the FreeBSD Project.
+
+from __future__ import print_function, unicode_literals, absolute_import
+
+BitmapCache__init__ = """
+|freetypy| A bounded cache of rendered glyph bitmaps.
+
+Rendering text usually draws the same few glyphs over and over.  A
+`BitmapCache` keeps each rendered `Bitmap` around, so that a glyph is
+only loaded and rasterized once for each size, render mode and
+subpixel position.
+
+When the cache grows beyond `max_bytes`, the least-recently used
+bitmaps are discarded.
+
+A single cache may be shared by any number of faces.
+
+Parameters
+----------
+max_bytes : int, optional
+    The approximate maximum amount of memory used by the cache, in
+    bytes.  Default is 16 MB.
+
+subpixels : int, optional
+    The number of distinct subpixel positions, in each direction, to
+    render glyphs at.  The fractional part of the origin passed to
+    `render` is rounded to the nearest of these.  Must be in the range
+    1-64.  Default is 4.
+
+Notes
+-----
+The cache holds a reference to each face that has glyphs in it.  Call
+`clear` to release them.
+
+The LCD filter is not part of the cache key, so the cache should be
+cleared after changing it.
+"""
+
+BitmapCache_clear = """
+Remove all bitmaps from the cache.
+
+The `hits` and `misses` counters are not reset.
+"""
+
+BitmapCache_count = """
+The number of bitmaps in the cache.
+"""
+
+BitmapCache_hits = """
+The number of times a bitmap was found in the cache.
+"""
+
+BitmapCache_max_bytes = """
+The approximate maximum amount of memory used by the cache, in bytes.
+Setting it to a smaller value immediately evicts bitmaps to fit.
+"""
+
+BitmapCache_misses = """
+The number of times a glyph had to be loaded and rendered.
+"""
+
+BitmapCache_nbytes = """
+The approximate amount of memory currently used by the cache, in
+bytes.
+"""
+
+BitmapCache_render = """
+Render a glyph, using the cached bitmap if there is one.
+
+This is equivalent to loading the glyph with `Face.load_glyph` and
+calling `Glyph.render`, except that the origin is rounded to the
+nearest subpixel position.
+
+Parameters
+----------
+face : Face
+    The face to load the glyph from.
+
+glyph_index : int
+    The index of the glyph in the font file.
+
+load_flags : `LOAD` flags, optional
+    Any glyph load flags
+
+render_mode : int, optional
+    See `RENDER_MODE` for the available options.
+
+origin : 2-sequence of floats, optional
+    The (x, y) origin to translate the glyph image before rendering,
+    in pixels.
+
+Returns
+-------
+bitmap, left, top : Bitmap, int, int
+    The rendered bitmap, and the position of its top-left corner
+    relative to the pen position, with y increasing upward.  The
+    whole-pixel part of the origin is included in ``left`` and
+    ``top``.
+
+    The same `Bitmap` object is returned every time the glyph is
+    found in the cache, so it must not be modified.
+"""
+
+BitmapCache_subpixels = """
+The number of subpixel positions glyphs are rendered at.
+"""
@@ -0,0 +1,104 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2015, Michael Droettboom All rights reserved.
+
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in
+#    the documentation and/or other materials provided with the
+#    distribution.
+
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+# The views and conclusions contained in the software and
+# documentation are those of the authors and should not be interpreted
+# as representing official policies, either expressed or implied, of
+# the FreeBSD Project.
+
+from __future__ import print_function, unicode_literals, absolute_import
+
+
+Coverage__init__ = """
+|freetypy| The set of Unicode characters a `Face` has glyphs for.
+
+Coverage is computed once from the face's Unicode `CharMap` by
+`Face.coverage`.  It is stored as a sorted list of 256-character
+blocks, each with a bitmap of the characters it contains, so that
+lookups are cheap even for faces covering many scripts.
+
+Supports the ``in`` operator for a single character or code point,
+and ``len`` for the number of characters covered.
+
+Supports the buffer interface.  The buffer is an array of unsigned
+32-bit integers of shape (*n*, 9), with one row for each block
+that has any characters.  The first column is the block number (the
+code point shifted right by 8), and the remaining 8 are the bitmap
+of the block, least significant bit first.
+"""
+
+Coverage_has_all = """
+Whether every character of a string is covered.
+
+Parameters
+----------
+text : str
+    The characters to check.
+
+Returns
+-------
+has_all : bool
+"""
+
+Coverage_has_char = """
+Whether a single character is covered.
+
+Parameters
+----------
+char : str or int
+    A single character, or a Unicode code point.
+
+Returns
+-------
+has_char : bool
+"""
+
+Coverage_missing = """
+Get the characters of a string that are not covered.
+
+Parameters
+----------
+text : str
+    The characters to check.
+
+Returns
+-------
+missing : str
+    Each character of *text* that is not covered, once, in the order
+    they first appear.  Empty if the face covers all of *text*.
+"""
+
+Coverage_ranges = """
+Get the covered characters as ranges of code points.
+
+Returns
+-------
+ranges : list of (int, int) tuples
+    The first and last code points of each run of consecutive
+    covered characters, inclusive, in order.
+"""
@@ -38,16 +38,47 @@ Models a given typeface, in a given style.
 
 Parameters
 ----------
-file : path, or readable file-like object
-    The file containing the face data.
+file : path, buffer, or readable file-like object
+    The file containing the face data.  Where the platform allows, a
+    file given by path is memory-mapped rather than read, so its pages
+    are shared between processes using the same font.
+
+    Any object supporting the buffer protocol other than `bytes`
+    (which is taken as a path), such as a `bytearray`, `memoryview` or
+    `mmap.mmap`, is read directly without copying.  The face keeps the
+    buffer exported for as long as it exists.
 
 face_index : int, optional
     The index of the face within the font.  The first face has index
     0.
 
+own_library : bool, optional
+    |freetypy| When `True`, the face is given its own private FreeType
+    library instance, rather than the one shared by all other faces.
+    FreeType does not allow a single library instance to be used by
+    several threads at the same time, so this is useful for faces
+    that are created and used by different threads.  Library-level
+    settings (see `set_lcd_filter`) are copied from the shared library
+    when the face is created, and afterward may be changed for this
+    face alone with `Face.set_lcd_filter`.
+
 Returns
 -------
 face : Face instance
+
+Notes
+-----
+Loading, hinting and rendering glyphs release the GIL, so different
+`Face` objects may be used from different threads in parallel.  Calls
+on a single `Face` (and on the `Glyph` objects loaded from it) are
+serialized by a lock held by the `Face`.
+
+A memory-mapped font file must not be truncated or rewritten in place
+while a face using it exists.  The face would read the changed data,
+or the process could be killed with ``SIGBUS`` when it loads a glyph.
+Replace font files by writing a new file and renaming it over the old
+one.  Alternatively, pass an open file object, which is read in the
+usual way.
 """
 
 Face_ascender = """
@@ -65,7 +96,7 @@ object. For example, you can attach an AFM file that comes with a Type
 
 Parameters
 ----------
-file : path, or readable file-like object
+file : path, buffer, or readable file-like object
     The file containing the data to attach.
 """
 
@@ -92,6 +123,21 @@ Face_charmaps = """
 A list of `CharMap` objects.
 """
 
+Face_coverage = """
+|freetypy| Get the set of Unicode characters the face has glyphs for.
+
+The `Coverage` is computed from the face's Unicode `CharMap` the first
+time it is requested, and the same object is returned afterward.  The
+selected `CharMap` is not changed.
+
+|freetypy| This is a freetypy-specific function.
+
+Returns
+-------
+coverage : Coverage
+    Empty if the face has no Unicode `CharMap`.
+"""
+
 Face_descender = """
 The typographic descender of the face, expressed in font units. For
 font formats not having this information, it is set to
@@ -173,6 +219,46 @@ created at index 0 and whatever was there will be moved to the last
 index -- Type 42 fonts are considered invalid under this condition.
 """
 
+Face_get_char_indices = """
+|freetypy| Get the glyph indices of many characters at once.
+
+For long runs of text, a lookup table for the Basic Multilingual Plane
+is built for the selected `CharMap` and kept with the face, so that
+later calls are a single pass over the text.
+
+|freetypy| This is a freetypy-specific function.
+
+Parameters
+----------
+text : str, or sequence or buffer of int
+    The characters to map.  A str may only be mapped with a Unicode
+    `CharMap`.  Integers are char codes in the encoding of the
+    selected `CharMap`, as for `get_char_index`.
+
+Returns
+-------
+glyph_indices : buffer
+    A buffer of unsigned 32-bit glyph indices.  0 means ‘undefined char
+    code’.
+"""
+
+Face_get_char_map_arrays = """
+|freetypy| Get all of the char codes in the current charmap at once.
+
+This is equivalent to `get_chars`, but the whole charmap is read in a
+single pass without creating a Python object for each entry.
+
+|freetypy| This is a freetypy-specific function.
+
+Returns
+-------
+charcodes, glyph_indices : buffer, buffer
+    Two buffers of unsigned 32-bit integers of the same length.  The
+    char codes are in increasing order, and each has the glyph index
+    at the same position in *glyph_indices*.  Both are empty if no
+    charmap is selected.
+"""
+
 Face_get_char_name = """
 |freetypy| Get the glyph name of the given unicode code point.
 
@@ -291,6 +377,32 @@ of the scope of this API function -- they can be implemented through
 format-specific interfaces.
 """
 
+Face_get_kerning_batch = """
+Get the kerning vectors between many pairs of glyphs at once.
+
+The kerning for each size and mode is cached on the face: the pairs
+of printable ASCII glyphs are computed together the first time, and
+other pairs are looked up as they are needed.
+
+Parameters
+----------
+left_glyphs : sequence or buffer of int
+    The indices of the left glyphs of the kern pairs.
+
+right_glyphs : sequence or buffer of int
+    The indices of the right glyphs of the kern pairs.  Must be the
+    same length as *left_glyphs*.
+
+kern_mode : int, optional
+    A `KERNING` mode.
+
+Returns
+-------
+kerning : buffer
+    A 2-dimensional buffer of doubles, with one row of ``(x, y)`` per
+    pair, in the same units as `get_kerning`.
+"""
+
 Face_get_name_index = """
 Get the glyph index of a given glyph name.
 
@@ -399,6 +511,49 @@ It is always positive. Only relevant for scalable formats.
 If you want the global glyph height, use `ascender` - `descender`.
 """
 
+Face_layout_many = """
+|freetypy| Lay out many strings at once, such as the tick labels of a
+plot.
+
+Each string is laid out exactly as a `Layout` of it would be, but all
+of them are laid out in one call, with the GIL released, and the
+results are packed into a few arrays rather than one `Layout` object
+per string.  Glyph metrics and kerning are cached on the face, so
+glyphs that appear in more than one string are only loaded once.
+
+Parameters
+----------
+strings : sequence of unicode
+    The strings to lay out.
+
+load_flags : `LOAD` flags, optional
+    Any glyph load flags
+
+Returns
+-------
+offsets : `Array` of int
+    The glyphs of string *i* are at ``offsets[i]:offsets[i + 1]`` in
+    ``glyph_indices`` and ``xys``.  There is one more offset than
+    there are strings.
+
+glyph_indices : `Array` of int
+    The glyph index of each glyph.
+
+xys : `Array` of float
+    The position of each glyph, of shape (*n*, 2), relative to the
+    start of its own string, in pixels.
+
+layout_bboxes, ink_bboxes : `Array` of float
+    The logical and ink bounding boxes of each string, of shape
+    (*count*, 4), as in `BBox`, in pixels.
+
+Notes
+-----
+A face can only be used from one thread at a time, so the strings are
+laid out in sequence.  Since the GIL is released, other Python
+threads may lay out text with other faces at the same time.
+"""
+
 Face_load_char = """
 Load a single glyph, according to its char code.
 
@@ -527,6 +682,36 @@ face. This can be used to make word wrapping computations faster. Only
 relevant for scalable formats.
 """
 
+Face_measure_text = """
+|freetypy| Measure a string of text, without building a `Layout`.
+
+The result is the same as the `Layout.layout_bbox` and
+`Layout.ink_bbox` of a `Layout` of the same text, but no `Layout`
+object or per-glyph data is created.  Glyph metrics are cached on the
+face, so measuring the same glyphs again does not load them again.
+
+Parameters
+----------
+text : unicode
+    The text to measure.
+
+load_flags : `LOAD` flags, optional
+    Any glyph load flags
+
+ink : bool, optional
+    When `False`, only the layout bounding box is computed.  When
+    glyphs are unhinted (`LOAD.NO_HINTING`), their advances can then
+    be read directly from the font without loading the glyphs at all,
+    which is much faster for glyphs that aren't already cached.
+    Default is `True`.
+
+Returns
+-------
+layout_bbox, ink_bbox : BBox, BBox or None
+    The logical and ink bounding boxes of the text, in pixels.
+    ``ink_bbox`` is `None` when ``ink`` is `False`.
+"""
+
 Face_num_faces = """
 The number of faces in the font file. Some font formats can have
 multiple faces in a font file.
@@ -547,6 +732,45 @@ For CID-keyed fonts, this value gives the highest CID used in the
 font.
 """
 
+Face_render_glyphs = """
+|freetypy| Render many glyphs at once into a single atlas.
+
+All of the loading and rendering happens in C, without creating any
+intermediate Python objects, so this is much faster than calling
+`load_glyph` and `Glyph.render` for each glyph.
+
+Parameters
+----------
+glyph_indices : sequence or buffer of ints
+    The indices of the glyphs to render.  Each distinct glyph is only
+    rendered once.
+
+render_mode : int, optional
+    See `RENDER_MODE` for the available options.  The LCD modes are
+    not supported.
+
+load_flags : `LOAD` flags, optional
+    Any glyph load flags
+
+Returns
+-------
+atlas, metrics : Array, Array
+    ``atlas`` is a 2-dimensional array of bytes containing all of the
+    rendered glyphs, packed into rows.  Monochrome bitmaps are
+    converted to 8-bit grayscale.  For the LCD render modes, each
+    pixel is 3 bytes wide (or tall).
+
+    ``metrics`` has one row of 6 integers for each entry in
+    ``glyph_indices``: ``(x, y, width, rows, left, top)``.  ``x``,
+    ``y``, ``width`` and ``rows`` locate the glyph's bitmap within
+    ``atlas``, and ``left`` and ``top`` are the bitmap's offset from
+    the pen position, as in `Glyph.bitmap_left` and
+    `Glyph.bitmap_top`.
+
+    Both support the buffer protocol, so can be converted to Numpy
+    arrays without copying.
+"""
+
 Face_request_size = """
 Resize the scale of the active `Size` object in a face.
 
@@ -646,6 +870,37 @@ equal to the other value. If both resolution values are zero, they are
 set to 72dpi.
 """
 
+Face_set_lcd_filter = """
+|freetypy| Apply color filtering to LCD decimated bitmaps rendered
+from this face.
+
+Parameters
+----------
+filter : `LCD_FILTER` constant
+
+Notes
+-----
+LCD filtering is a setting of the FreeType library instance.  If the
+face was created with ``own_library=True``, this only affects this
+face.  Otherwise, it affects all faces using the shared library, just
+like `freetypy.set_lcd_filter`.
+"""
+
+Face_set_lcd_filter_weights = """
+|freetypy| Enable LCD filter with custom weights for bitmaps rendered
+from this face.
+
+Parameters
+----------
+a, b, c, d, e : int
+    The filter weights
+
+Notes
+-----
+See `Face.set_lcd_filter` for how this setting is shared between
+faces.
+"""
+
 Face_set_charmap = """
 Select a charmap for char code to glyph index mapping.
 
@@ -1048,6 +1303,11 @@ This usually means: TrueType fonts, OpenType fonts, as well as
 SFNT-based embedded bitmap fonts.
 """
 
+Face_own_library = """
+|freetypy| `True` if the face has its own private FreeType library
+instance.  See `Face`.
+"""
+
 Face_is_fixed_width = """
 Contains fixed-width (or ‘monospace’) glyphs.
 """
@@ -0,0 +1,117 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2015, Michael Droettboom All rights reserved.
+
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in
+#    the documentation and/or other materials provided with the
+#    distribution.
+
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+# The views and conclusions contained in the software and
+# documentation are those of the authors and should not be interpreted
+# as representing official policies, either expressed or implied, of
+# the FreeBSD Project.
+
+from __future__ import print_function, unicode_literals, absolute_import
+
+
+FallbackLayout__init__ = """
+|freetypy| Lays out left-to-right text using a list of faces.
+
+The text is split into runs of characters, each of which is laid out
+with the first face that has glyphs for all of it, so that text in
+many scripts can be laid out in one call.  Characters that none of
+the faces cover are laid out with the first face.
+
+Which characters each face covers is found with `Face.coverage`, and
+kept with the face for later layouts.
+
+Parameters
+----------
+faces : sequence of Face
+    The faces to use, in order of preference.  Each must have a
+    Unicode `CharMap` selected.
+
+text : unicode
+    The text to display in the layout.
+
+load_flags : `LOAD` flags, optional
+    Any glyph load flags.  `LOAD.VERTICAL_LAYOUT` lays out the text
+    vertically, as for `Layout`.
+"""
+
+FallbackLayout_draw = """
+Render the text into an image.
+
+Each run is rendered with its own face.  Where glyphs overlap each
+other or existing content, the maximum value is kept.
+
+Parameters
+----------
+buffer : writable buffer
+    A 2-dimensional array of bytes, such as a Numpy array of type
+    ``uint8``, with rows running from top to bottom.
+
+x, y : float, optional
+    The position of the layout's origin (the start of the baseline)
+    in the image, in pixels.
+
+render_mode : int, optional
+    See `RENDER_MODE` for the available options.  The LCD modes are
+    not supported.
+"""
+
+FallbackLayout_face_ids = """
+A buffer of unsigned 32-bit integers giving, for each glyph, the index
+in `faces` of the face it comes from.
+"""
+
+FallbackLayout_faces = """
+The faces of the layout, as a tuple.
+"""
+
+FallbackLayout_ink_bbox = """
+The tight bounding box (`BBox`) of the physical characters in the
+layout.  The origin is at (0, 0).  The result is in pixels.
+"""
+
+FallbackLayout_layout_bbox = """
+The logical bounding box (`BBox`) of the layout.  Vertically, it
+includes the ascender and descender of every face used.  The result
+is in pixels.
+"""
+
+FallbackLayout_layout = """
+Returns a list of tuples describing the layout.
+
+Each tuple is of the form:
+
+  - `Face`: The `Face` object containing the glyph
+  - `glyph_index`: The glyph index within the `Face`
+  - `(x, y)`: The x, y position of the glyph
+"""
+
+FallbackLayout_runs = """
+Returns a list of ``(face_id, start, end)`` tuples, one for each run
+of glyphs laid out with the same face, in order.  *face_id* is an
+index into `faces`, and the run covers glyphs *start* to *end - 1*.
+"""
@@ -0,0 +1,114 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2015, Michael Droettboom All rights reserved.
+
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in
+#    the documentation and/or other materials provided with the
+#    distribution.
+
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+# The views and conclusions contained in the software and
+# documentation are those of the authors and should not be interpreted
+# as representing official policies, either expressed or implied, of
+# the FreeBSD Project.
+
+from __future__ import print_function, unicode_literals, absolute_import
+
+GlyphCache__init__ = """
+|freetypy| A bounded cache of loaded glyphs.
+
+Loading a glyph from a `Face` reads it from the font file and hints
+it every time.  A `GlyphCache` keeps the loaded glyphs around, so
+that code that draws the same glyphs over and over only pays for this
+once.
+
+Glyphs are keyed on the face, its current size and transform, the
+load flags and the glyph index.  When the cache grows beyond
+`max_bytes`, the least-recently used glyphs are discarded.
+
+A single cache may be shared by any number of faces.
+
+Parameters
+----------
+max_bytes : int, optional
+    The approximate maximum amount of memory used by the cache, in
+    bytes.  Default is 16 MB.
+
+Notes
+-----
+The cache holds a reference to each face that has glyphs in it.  Call
+`clear` to release them.
+
+The `Glyph.subglyphs` of cached glyphs are always empty.
+"""
+
+GlyphCache_clear = """
+Remove all glyphs from the cache.
+
+The `hits` and `misses` counters are not reset.
+"""
+
+GlyphCache_count = """
+The number of glyphs in the cache.
+"""
+
+GlyphCache_hits = """
+The number of times a glyph was found in the cache.
+"""
+
+GlyphCache_load_glyph = """
+Load a glyph, using the cached copy if there is one.
+
+This is equivalent to `Face.load_glyph`, except that the glyph is not
+necessarily loaded into `Face.glyph`.
+
+Parameters
+----------
+face : Face
+    The face to load the glyph from.
+
+glyph_index : int
+    The index of the glyph in the font file.
+
+load_flags : `LOAD` flags, optional
+    Any glyph load flags
+
+Returns
+-------
+glyph : Glyph
+    A new `Glyph` object.  It is a copy of the cached glyph, so it may
+    be freely rendered.
+"""
+
+GlyphCache_max_bytes = """
+The approximate maximum amount of memory used by the cache, in bytes.
+Setting it to a smaller value immediately evicts glyphs to fit.
+"""
+
+GlyphCache_misses = """
+The number of times a glyph had to be loaded from the face.
+"""
+
+GlyphCache_nbytes = """
+The approximate amount of memory currently used by the cache, in
+bytes.
+"""
@@ -37,6 +37,9 @@ from __future__ import print_function, unicode_literals, absolute_import
 Layout__init__ = """
 |freetypy| Manages very simple layout of left-to-right text.
 
+The text may be edited afterward with `insert`, `delete` and
+`replace`, which only lay out the changed part of the text again.
+
 Parameters
 ----------
 face : Face
@@ -46,7 +49,101 @@ text : unicode
     The text to display in the layout.
 
 load_flags : `LOAD` flags, optional
-    Any glyph load flags
+    Any glyph load flags.  With `LOAD.VERTICAL_LAYOUT`, the text runs
+    from top to bottom, using the glyphs' vertical metrics.  The
+    origin of the layout is then at the top of the line, which is
+    centered on x = 0.
+"""
+
+Layout_delete = """
+Delete part of the text.
+
+Only the glyphs next to the deleted text are laid out again.  Those
+after it are moved.
+
+Parameters
+----------
+start, end : int
+    The range of characters to delete, as in ``text[start:end]``.
+"""
+
+Layout_draw = """
+Render the text into an image.
+
+Every glyph is loaded, rendered and composited in C.  Where glyphs
+overlap each other or existing content, the maximum value is kept.
+
+Parameters
+----------
+buffer : writable buffer
+    A 2-dimensional array of bytes, such as a Numpy array of type
+    ``uint8``, with rows running from top to bottom.
+
+x, y : float, optional
+    The position of the layout's origin (the start of the baseline)
+    in the image, in pixels.  Glyphs are rendered at subpixel
+    positions.  Anything outside of the image is clipped.
+
+render_mode : int, optional
+    See `RENDER_MODE` for the available options.  The LCD modes are
+    not supported.
+
+Notes
+-----
+The glyphs are rendered using the face's current size, and the load
+flags the layout was created with.
+"""
+
+Layout_get_transformed = """
+Transform the layout by a matrix.
+
+The glyph positions and the bounding box of their outlines are
+transformed in C, using outlines cached on the face, so the result is
+exact without rendering or loading each glyph from Python.
+
+Parameters
+----------
+matrix : 2x2 tuple of tuples of floats
+    The transformation matrix, as ``((xx, xy), (yx, yy))``.
+
+offset : 2-tuple of floats, optional
+    Added to the positions after they are transformed, in pixels.
+
+Returns
+-------
+xys : `Array` of float
+    The transformed position of each glyph, of shape (*n*, 2).
+
+ink_bbox : `BBox`
+    The tight bounding box of the transformed glyphs, in pixels.
+
+Notes
+-----
+The layout itself is left unchanged, so it may be transformed several
+times.  Any transform set on the face with `Face.set_transform` is not
+applied to the glyphs here.
+"""
+
+Layout_insert = """
+Insert text into the layout.
+
+Only the new glyphs and their neighbors are laid out, using the face's
+current size.  The glyphs after them are moved.
+
+Parameters
+----------
+index : int
+    The position of the new text, as a character index.
+
+text : unicode
+    The text to insert.
+"""
+
+Layout_glyph_indices = """
+A `memoryview` of the glyph index of each glyph in the layout.
+
+The view shares memory with the layout, so nothing is copied.  The
+layout can not be edited while the view is in use.
 """
 
 Layout_ink_bbox = """
@@ -68,4 +165,51 @@ Each tuple is of the form:
   - `Face`: The `Face` object containing the glyph
   - `glyph_index`: The glyph index within the `Face`
   - `(x, y)`: The x, y position of the glyph
+
+A new list is built every time.  `glyph_indices` and `xys` give the
+same information without copying it.
+"""
+
+Layout_replace = """
+Replace part of the text.
+
+Only the new glyphs and their neighbors are laid out, using the face's
+current size.  The glyphs after them are moved.
+
+Parameters
+----------
+start, end : int
+    The range of characters to replace, as in ``text[start:end]``.
+
+text : unicode
+    The replacement text.
+"""
+
+Layout_text = """
+The text of the layout, including any edits.
+"""
+
+Layout_to_points_and_codes = """
+|freetypy| Convert the outlines of all of the glyphs in the layout to
+a single pair of arrays (points, codes), as `Outline.to_points_and_codes`
+does for a single glyph.
+
+Each glyph is moved to its position in the layout, so the result can
+be drawn as one path by a vector backend.  The whole conversion is
+done in C, using outlines cached on the face.  Glyphs that have no
+outline, such as bitmap glyphs, are left out.
+
+Returns
+-------
+arrays : tuple
+    A (points, codes) pair.  points is an *N*x2 `Array` of floats, in
+    pixels, and codes is a length *N* `Array` of `CODES` constants.
+"""
+
+Layout_xys = """
+A `memoryview` of the position of each glyph in the layout.  Each
+entry is an (x, y) pair, in pixels.
+
+The view shares memory with the layout, so nothing is copied.  The
+layout can not be edited while the view is in use.
 """
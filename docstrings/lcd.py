@@ -49,6 +49,10 @@ This feature is always disabled by default. Clients must make an
 explicit call to this function with a `filter` value other than
 `LCD_FILTER.NONE` in order to enable it.
 
+This changes the library instance shared by all faces.  Faces created
+with ``own_library=True`` afterward inherit this setting.  Use
+`Face.set_lcd_filter` to change the setting of those faces.
+
 Due to PATENTS covering subpixel rendering, this function doesn't do
 anything except raising `NotImplementedError` if the configuration
 macro ``FT_CONFIG_OPTION_SUBPIXEL_RENDERING`` is not defined in your
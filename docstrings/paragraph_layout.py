@@ -0,0 +1,119 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2015, Michael Droettboom All rights reserved.
+
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in
+#    the documentation and/or other materials provided with the
+#    distribution.
+
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+# The views and conclusions contained in the software and
+# documentation are those of the authors and should not be interpreted
+# as representing official policies, either expressed or implied, of
+# the FreeBSD Project.
+
+from __future__ import print_function, unicode_literals, absolute_import
+
+
+ParagraphLayout__init__ = """
+|freetypy| Lays out left-to-right text as a paragraph of lines.
+
+The text is broken into lines no wider than *width* where possible.
+Lines may be broken after spaces, after hyphens and between
+ideographs, and are always broken at newlines, following a subset of
+the rules in `UAX #14 <http://www.unicode.org/reports/tr14/>`_.
+Spaces at the end of a line are not counted in its width.  A word
+that is wider than *width* by itself is left to overflow its line.
+
+Parameters
+----------
+face : Face
+    The face for the layout.
+
+text : unicode
+    The text to display in the layout.
+
+width : float
+    The maximum width of a line, in pixels.
+
+line_spacing : float, optional
+    The distance between baselines, as a multiple of the face's
+    line height (see `Size_Metrics.height`).
+
+load_flags : `LOAD` flags, optional
+    Any glyph load flags.  `LOAD.VERTICAL_LAYOUT` is not supported.
+"""
+
+ParagraphLayout_draw = """
+Render the text into an image.
+
+Parameters
+----------
+buffer : writable buffer
+    A 2-dimensional array of bytes, such as a Numpy array of type
+    ``uint8``, with rows running from top to bottom.
+
+x, y : float, optional
+    The position of the layout's origin (the start of the first
+    line's baseline) in the image, in pixels.
+
+render_mode : int, optional
+    See `RENDER_MODE` for the available options.  The LCD modes are
+    not supported.
+"""
+
+ParagraphLayout_ink_bbox = """
+The tight bounding box (`BBox`) of the physical characters in the
+layout.  The origin is at (0, 0), at the start of the first line's
+baseline.  The result is in pixels.
+"""
+
+ParagraphLayout_layout_bbox = """
+The logical bounding box (`BBox`) of the layout, from the ascender of
+the first line to the descender of the last, and as wide as the
+widest line.  The result is in pixels.
+"""
+
+ParagraphLayout_layout = """
+Returns a list of tuples describing the layout.
+
+Each tuple is of the form:
+
+  - `Face`: The `Face` object containing the glyph
+  - `glyph_index`: The glyph index within the `Face`
+  - `(x, y)`: The x, y position of the glyph.  *y* is the baseline
+    of the glyph's line.
+"""
+
+ParagraphLayout_lines = """
+Returns a list of tuples describing each line.
+
+Each tuple is of the form:
+
+  - `start`, `end`: The range of glyphs (and characters) on the line,
+    including any trailing spaces and newline
+  - `baseline`: The y position of the line's baseline, in pixels.
+    This is 0 for the first line and negative for later lines.
+  - `layout_bbox`: The logical bounding box (`BBox`) of the line,
+    without trailing spaces
+  - `ink_bbox`: The tight bounding box (`BBox`) of the line's ink
+"""
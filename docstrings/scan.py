@@ -0,0 +1,86 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2015, Michael Droettboom All rights reserved.
+
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in
+#    the documentation and/or other materials provided with the
+#    distribution.
+
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+# The views and conclusions contained in the software and
+# documentation are those of the authors and should not be interpreted
+# as representing official policies, either expressed or implied, of
+# the FreeBSD Project.
+
+from __future__ import print_function, unicode_literals, absolute_import
+
+scan_fonts = """
+|freetypy| Read the properties of every face in many font files.
+
+This is much faster than creating a `Face` for each face of each file
+when building a catalogue of fonts.  Each file is read once, and the
+files are scanned by a pool of threads with the GIL released.
+
+|freetypy| This is a freetypy-specific function.
+
+Parameters
+----------
+paths : sequence of paths
+    The font files to scan.  Files that can not be opened as fonts are
+    skipped.
+
+fields : sequence of str, optional
+    The properties to return for each face, from:
+
+    - ``path``: The path, as given in *paths*
+    - ``face_index``: The index of the face within the file
+    - ``family_name``: See `Face.family_name`
+    - ``style_name``: See `Face.style_name`
+    - ``postscript_name``: See `Face.get_postscript_name`
+    - ``face_flags``: See `Face.face_flags`
+    - ``style_flags``: See `Face.style_flags`
+    - ``num_glyphs``: See `Face.num_glyphs`
+    - ``weight_class``: See `TT_OS2.weight_class`, or `None` if the
+      face has no OS/2 table
+    - ``width_class``: See `TT_OS2.width_class`, or `None` if the face
+      has no OS/2 table
+    - ``sfnt_names``: A list of ``(platform_id, encoding_id,
+      language_id, name_id, string_bytes)`` tuples for the entries of
+      the face's name table
+    - ``coverage``: The Unicode characters the face covers, as `bytes`
+      holding a sparse bitmap.  It is a sorted list of leaves, each of
+      nine native-endian uint32s: the codepoint divided by 256,
+      followed by a 256-bit bitmap of the characters in that block.
+      See `font_cache.FaceRecord.has_char`.
+
+    The default is all of these but ``postscript_name``,
+    ``num_glyphs``, ``sfnt_names`` and ``coverage``.
+
+threads : int, optional
+    The number of threads to use.  By default, the number of CPUs.
+
+Returns
+-------
+records : list of tuple
+    One tuple per face, holding the requested *fields* in order.  Faces
+    are in the order of *paths*, and then of face index.
+"""
@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# -----------------------------------------------------------------------------
+#
+# Copyright (c) 2015, Michael Droettboom
+# All rights reserved.
+
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+# ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+# (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+# ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# The views and conclusions contained in the software and documentation are those
+# of the authors and should not be interpreted as representing official policies,
+# either expressed or implied, of the FreeBSD Project.
+
+# -----------------------------------------------------------------------------
+'''
+Benchmarks glyph loading and rendering from multiple threads.
+
+Each thread gets its own `Face`, so the threads can run in parallel:
+`Face.load_glyph` and `Glyph.render` release the GIL while FreeType
+is doing its work.  The throughput should grow with the number of
+threads, up to the number of available cores.
+'''
+from __future__ import print_function, unicode_literals, absolute_import
+
+import argparse
+import threading
+import time
+
+import freetypy as ft
+import freetypy.util as ft_util
+
+
+def render_glyphs(filename, size, iterations, own_library):
+    face = ft.Face(filename, own_library=own_library)
+    face.set_char_size(size)
+    num_glyphs = face.num_glyphs
+    for i in range(iterations):
+        glyph = face.load_glyph(i % num_glyphs)
+        glyph.render()
+
+
+def benchmark(filename, size, iterations, nthreads, own_library):
+    threads = [
+        threading.Thread(
+            target=render_glyphs,
+            args=(filename, size, iterations, own_library))
+        for i in range(nthreads)]
+
+    start = time.time()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    elapsed = time.time() - start
+
+    return (iterations * nthreads) / elapsed
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description='Benchmarks multi-threaded glyph rendering.')
+    parser.add_argument(
+        'filename', type=str, nargs='?', default=ft_util.vera_path(),
+        help='The font to render')
+    parser.add_argument(
+        '--size', type=float, default=48.0,
+        help='The size of the glyphs, in points')
+    parser.add_argument(
+        '--iterations', type=int, default=5000,
+        help='The number of glyphs rendered by each thread')
+    parser.add_argument(
+        '--threads', type=int, default=8,
+        help='The maximum number of threads')
+    parser.add_argument(
+        '--own-library', action='store_true',
+        help='Give each Face its own FreeType library')
+    args = parser.parse_args()
+
+    print("threads   glyphs/s   speedup")
+    base = None
+    for nthreads in range(1, args.threads + 1):
+        rate = benchmark(args.filename, args.size, args.iterations, nthreads,
+                         args.own_library)
+        if base is None:
+            base = rate
+        print("{0:7d} {1:10.0f} {2:9.2f}".format(nthreads, rate, rate / base))
@@ -0,0 +1,352 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2015, Michael Droettboom All rights reserved.
+
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in
+#    the documentation and/or other materials provided with the
+#    distribution.
+
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+# The views and conclusions contained in the software and
+# documentation are those of the authors and should not be interpreted
+# as representing official policies, either expressed or implied, of
+
+"""
+A persistent cache of font metadata, so that a catalogue of fonts can
+be built at startup without opening any fonts that haven't changed.
+"""
+
+from __future__ import absolute_import, division, unicode_literals, print_function
+
+
+__all__ = ['FontCache', 'FaceRecord']
+
+
+import array
+import bisect
+import os
+import struct
+import sys
+import tempfile
+
+
+from freetypy import scan_fonts, __freetype_version__
+
+
+# Bump this whenever the file format or the meaning of any field
+# changes
+CACHE_VERSION = 1
+MAGIC_NUMBER = b'FTPYFONT'
+
+FIELDS = ('face_index', 'family_name', 'style_name', 'postscript_name',
+          'face_flags', 'style_flags', 'weight_class', 'width_class',
+          'coverage')
+
+COVERAGE_LEAF_WORDS = 9
+
+
+class FaceRecord(object):
+    """
+    The metadata of a single face in a font file.
+
+    Attributes
+    ----------
+    path : str
+        The path to the font file.
+    face_index : int
+        The index of the face within the file.
+    family_name, style_name, postscript_name : str or None
+        The names of the face.
+    face_flags, style_flags : int
+        See `Face.face_flags` and `Face.style_flags`.
+    weight_class, width_class : int or None
+        The weight and width from the OS/2 table, or `None` if the face
+        doesn't have one.
+    coverage : bytes
+        The Unicode characters covered by the face, as returned by
+        `scan_fonts`.  Use `has_char` to query it.
+    """
+    __slots__ = ('path',) + FIELDS + ('_leaves', '_index')
+
+    def __init__(self, path, face_index, family_name, style_name,
+                 postscript_name, face_flags, style_flags, weight_class,
+                 width_class, coverage):
+        self.path = path
+        self.face_index = face_index
+        self.family_name = family_name
+        self.style_name = style_name
+        self.postscript_name = postscript_name
+        self.face_flags = int(face_flags)
+        self.style_flags = int(style_flags)
+        self.weight_class = weight_class
+        self.width_class = width_class
+        self.coverage = coverage
+        self._leaves = None
+        self._index = None
+
+    def __repr__(self):
+        return '<FaceRecord {0!r} {1} {2!r} {3!r}>'.format(
+            self.path, self.face_index, self.family_name, self.style_name)
+
+    def has_char(self, codepoint):
+        """
+        Returns `True` if the face covers the given Unicode character,
+        given as an int or a length-1 string.
+        """
+        if not isinstance(codepoint, int):
+            codepoint = ord(codepoint)
+
+        if self._leaves is None:
+            self._leaves = array.array(str('I'), self.coverage)
+            self._index = self._leaves[0::COVERAGE_LEAF_WORDS]
+
+        leaf = codepoint >> 8
+        i = bisect.bisect_left(self._index, leaf)
+        if i == len(self._index) or self._index[i] != leaf:
+            return False
+        word = self._leaves[
+            i * COVERAGE_LEAF_WORDS + 1 + ((codepoint & 0xff) >> 5)]
+        return bool((word >> (codepoint & 0x1f)) & 1)
+
+
+class _Reader(object):
+    def __init__(self, data):
+        self._data = data
+        self._pos = 0
+
+    def unpack(self, fmt):
+        fmt = str('<' + fmt)
+        values = struct.unpack_from(fmt, self._data, self._pos)
+        self._pos += struct.calcsize(fmt)
+        return values
+
+    def read_bytes(self):
+        length, = self.unpack('I')
+        if length == 0xffffffff:
+            return None
+        if self._pos + length > len(self._data):
+            raise ValueError("Truncated font cache")
+        result = self._data[self._pos:self._pos + length]
+        self._pos += length
+        return result
+
+    def read_str(self):
+        value = self.read_bytes()
+        if value is None:
+            return None
+        return value.decode('utf-8', 'surrogateescape')
+
+
+class _Writer(object):
+    def __init__(self):
+        self._chunks = []
+
+    def pack(self, fmt, *values):
+        self._chunks.append(struct.pack(str('<' + fmt), *values))
+
+    def write_bytes(self, value):
+        if value is None:
+            self.pack('I', 0xffffffff)
+        else:
+            self.pack('I', len(value))
+            self._chunks.append(value)
+
+    def write_str(self, value):
+        if value is None:
+            self.write_bytes(None)
+        else:
+            self.write_bytes(value.encode('utf-8', 'surrogateescape'))
+
+    def getvalue(self):
+        return b''.join(self._chunks)
+
+
+def _stat_key(path):
+    st = os.stat(path)
+    mtime = getattr(st, 'st_mtime_ns', None)
+    if mtime is None:
+        mtime = int(st.st_mtime * 1e9)
+    return st.st_size, mtime
+
+
+class FontCache(object):
+    """
+    A persistent cache of the metadata of the faces in a set of font
+    files.
+
+    The cache is stored in a single binary file.  Each font file's
+    entry is keyed by its path, size and modification time, so only
+    files that have been added or changed since the cache was written
+    are opened.  The whole cache is discarded if it was written by a
+    different version of the format, of FreeType, or on a machine with
+    a different byte order.
+
+    Parameters
+    ----------
+    cache_path : str
+        The path to the cache file.  It doesn't need to exist yet.
+    """
+    def __init__(self, cache_path):
+        self.cache_path = cache_path
+        self._files = None
+
+    def _header(self):
+        writer = _Writer()
+        writer.pack('8sIB', MAGIC_NUMBER, CACHE_VERSION,
+                    sys.byteorder == 'little')
+        writer.write_str(__freetype_version__)
+        return writer.getvalue()
+
+    def _load(self):
+        try:
+            with open(self.cache_path, 'rb') as fd:
+                data = fd.read()
+        except (IOError, OSError):
+            return {}
+
+        header = self._header()
+        if not data.startswith(header):
+            return {}
+
+        files = {}
+        reader = _Reader(data)
+        reader._pos = len(header)
+        try:
+            nfiles, = reader.unpack('I')
+            for i in range(nfiles):
+                path = reader.read_str()
+                size, mtime, nfaces = reader.unpack('QqI')
+                records = []
+                for j in range(nfaces):
+                    face_index, face_flags, style_flags, weight_class, \
+                        width_class = reader.unpack('iqqii')
+                    family_name = reader.read_str()
+                    style_name = reader.read_str()
+                    postscript_name = reader.read_str()
+                    coverage = reader.read_bytes()
+                    records.append(FaceRecord(
+                        path, face_index, family_name, style_name,
+                        postscript_name, face_flags, style_flags,
+                        None if weight_class < 0 else weight_class,
+                        None if width_class < 0 else width_class,
+                        coverage))
+                files[path] = ((size, mtime), records)
+        except (struct.error, ValueError, UnicodeDecodeError):
+            return {}
+
+        return files
+
+    def _save(self):
+        writer = _Writer()
+        writer.pack('I', len(self._files))
+        for path, (key, records) in sorted(self._files.items()):
+            writer.write_str(path)
+            writer.pack('QqI', key[0], key[1], len(records))
+            for record in records:
+                writer.pack(
+                    'iqqii', record.face_index, record.face_flags,
+                    record.style_flags,
+                    -1 if record.weight_class is None else record.weight_class,
+                    -1 if record.width_class is None else record.width_class)
+                writer.write_str(record.family_name)
+                writer.write_str(record.style_name)
+                writer.write_str(record.postscript_name)
+                writer.write_bytes(record.coverage)
+
+        # Write to a temporary file and rename it, so readers never
+        # see a partially written cache
+        dirname = os.path.dirname(os.path.abspath(self.cache_path))
+        fd, tmp_path = tempfile.mkstemp(dir=dirname)
+        try:
+            with os.fdopen(fd, 'wb') as tmp:
+                tmp.write(self._header())
+                tmp.write(writer.getvalue())
+            if hasattr(os, 'replace'):
+                os.replace(tmp_path, self.cache_path)
+            else:
+                os.rename(tmp_path, self.cache_path)
+        except:
+            os.unlink(tmp_path)
+            raise
+
+    def scan(self, paths, threads=0):
+        """
+        Get the metadata of every face in the given font files.
+
+        Files that are already in the cache and unchanged are not
+        opened.  The rest are read with `scan_fonts`, and the cache
+        file is rewritten if anything changed.  Files that are no
+        longer in *paths* are dropped from the cache.
+
+        Parameters
+        ----------
+        paths : sequence of str
+            The font files.  Files that don't exist or can't be opened
+            as fonts are skipped.
+        threads : int, optional
+            The number of threads to scan changed files with.  See
+            `scan_fonts`.
+
+        Returns
+        -------
+        records : list of FaceRecord
+            The faces, in the order of *paths* and then face index.
+        """
+        if self._files is None:
+            self._files = self._load()
+
+        files = {}
+        changed = []
+        modified = False
+        for path in paths:
+            if path in files:
+                continue
+            try:
+                key = _stat_key(path)
+            except (IOError, OSError):
+                continue
+            entry = self._files.get(path)
+            if entry is not None and entry[0] == key:
+                files[path] = entry
+            else:
+                files[path] = (key, [])
+                changed.append(path)
+
+        if changed:
+            modified = True
+            for fields in scan_fonts(changed, ('path',) + FIELDS, threads):
+                files[fields[0]][1].append(FaceRecord(*fields))
+
+        if set(files) != set(self._files):
+            modified = True
+
+        self._files = files
+        if modified:
+            self._save()
+
+        records = []
+        seen = set()
+        for path in paths:
+            if path in files and path not in seen:
+                seen.add(path)
+                records.extend(files[path][1])
+        return records
@@ -0,0 +1,132 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2015, Michael Droettboom
+# All rights reserved.
+
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+# ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+# (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+# ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# The views and conclusions contained in the software and documentation are those
+# of the authors and should not be interpreted as representing official policies,
+# either expressed or implied, of the FreeBSD Project.
+
+from __future__ import print_function, unicode_literals, absolute_import
+
+import struct
+
+import freetypy as ft
+from .util import *
+
+
+def _make_face():
+    face = ft.Face(vera_path())
+    face.set_charmap(0)
+    face.set_char_size(12, 12, 300, 300)
+    return face
+
+
+def test_bitmap_cache():
+    face = _make_face()
+    cache = ft.BitmapCache()
+    index = face.get_char_index(ord('A'))
+
+    bitmap, left, top = cache.render(face, index)
+    assert cache.misses == 1
+    assert cache.count == 1
+    assert cache.nbytes > bitmap.rows * bitmap.pitch
+
+    bitmap2, left2, top2 = cache.render(face, index)
+    assert cache.hits == 1
+    assert bitmap2 is bitmap
+    assert (left2, top2) == (left, top)
+    assert memoryview(bitmap).readonly
+
+    expected = face.load_glyph(index).render()
+    assert bitmap.buffer == expected.buffer
+    assert (bitmap.rows, bitmap.width) == (expected.rows, expected.width)
+
+    cache.render(face, index, render_mode=ft.RENDER_MODE.LCD)
+    assert cache.misses == 2
+
+    cache.clear()
+    assert cache.count == 0
+    assert cache.nbytes == 0
+
+
+def test_bitmap_cache_subpixels():
+    face = _make_face()
+    cache = ft.BitmapCache(subpixels=4)
+    index = face.get_char_index(ord('A'))
+    assert cache.subpixels == 4
+
+    bitmap, left, top = cache.render(face, index)
+
+    # Rounds to the same subpixel position, offset by whole pixels
+    bitmap2, left2, top2 = cache.render(face, index, origin=(3.05, -2.0))
+    assert bitmap2 is bitmap
+    assert (left2, top2) == (left + 3, top - 2)
+
+    # Rounds up to the next whole pixel
+    bitmap3, left3, top3 = cache.render(face, index, origin=(0.9, 0))
+    assert bitmap3 is bitmap
+    assert left3 == left + 1
+    assert cache.misses == 1
+
+    bitmap4, left4, top4 = cache.render(face, index, origin=(1.25, 0))
+    assert cache.misses == 2
+    expected = face.load_glyph(index).render(origin=(0.25, 0))
+    assert bitmap4.buffer == expected.buffer
+
+    cache = ft.BitmapCache(subpixels=1)
+    cache.render(face, index, origin=(0.25, 0))
+    cache.render(face, index, origin=(0.75, 0))
+    assert cache.misses == 1
+
+
+def test_bitmap_cache_eviction():
+    face = _make_face()
+    cache = ft.BitmapCache()
+
+    bitmaps = [cache.render(face, face.get_char_index(ord(c)))[0]
+               for c in 'ABCDEFGHIJ']
+    assert cache.count == 10
+
+    cache.max_bytes = cache.nbytes // 2
+    assert cache.nbytes <= cache.max_bytes
+    assert 0 < cache.count < 10
+
+    cache.max_bytes = 0
+    assert cache.count == 0
+
+    # Evicted bitmaps are still usable
+    assert all(len(b.buffer) == b.rows * b.pitch for b in bitmaps)
+
+
+@raises(TypeError)
+def test_bitmap_cache_read_only():
+    face = _make_face()
+    cache = ft.BitmapCache()
+    bitmap, left, top = cache.render(face, face.get_char_index(ord('A')))
+    struct.pack_into('B', bitmap, 10, 7)
+
+
+@raises(ValueError)
+def test_bitmap_cache_invalid_subpixels():
+    ft.BitmapCache(subpixels=0)
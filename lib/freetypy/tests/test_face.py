@@ -33,6 +33,11 @@
 
 from __future__ import print_function, unicode_literals, absolute_import
 
+import os
+import shutil
+import struct
+import tempfile
+
 import freetypy as ft
 from .util import *
 
@@ -97,6 +102,118 @@ def test_face_from_file_like():
     _test_face(face)
 
 
+def test_face_from_buffer():
+    import mmap
+
+    with open(vera_path(), 'rb') as fd:
+        data = bytearray(fd.read())
+
+        face = ft.Face(data)
+        _test_face(face)
+
+        # The face reads directly from the buffer, which can't be
+        # resized from under it
+        try:
+            data.append(0)
+        except BufferError:
+            pass
+        else:
+            assert False
+        del face
+        data.append(0)
+
+        face = ft.Face(memoryview(data)[:-1])
+        _test_face(face)
+
+        mapped = mmap.mmap(fd.fileno(), 0, access=mmap.ACCESS_READ)
+        face = ft.Face(mapped)
+        _test_face(face)
+        del face
+        mapped.close()
+
+
+def _mapped_paths():
+    with open('/proc/self/maps') as fd:
+        return [line.split()[-1] for line in fd if len(line.split()) == 6]
+
+
+@skip_if(not os.path.exists('/proc/self/maps'))
+def test_face_mmap():
+    # A private copy, so that faces held elsewhere don't map it
+    tmpdir = tempfile.mkdtemp()
+    try:
+        path = os.path.realpath(os.path.join(tmpdir, 'Vera.ttf'))
+        shutil.copy(vera_path(), path)
+        assert path not in _mapped_paths()
+
+        face = ft.Face(path)
+        _test_face(face)
+        assert path in _mapped_paths()
+
+        # Bytes paths are mapped too
+        face2 = ft.Face(path.encode('utf-8'))
+        _test_face(face2)
+
+        del face, face2
+        assert path not in _mapped_paths()
+    finally:
+        shutil.rmtree(tmpdir)
+
+
+def test_face_shared_blob():
+    # A copy, so that no Face from another test shares its blob
+    tmpdir = tempfile.mkdtemp()
+    try:
+        path = os.path.join(tmpdir, 'Vera.ttf')
+        shutil.copy(vera_path(), path)
+        count, nbytes = ft.font_blob_usage()
+        size = os.path.getsize(path)
+
+        faces = [ft.Face(path) for i in range(10)]
+        faces[0].set_char_size(12)
+        faces[1].set_char_size(24)
+        assert ft.font_blob_usage() == (count + 1, nbytes + size)
+
+        # Faces from file objects or buffers aren't shared
+        with open(path, 'rb') as fd:
+            faces.append(ft.Face(fd))
+            assert ft.font_blob_usage() == (count + 1, nbytes + size)
+            del faces
+
+        assert ft.font_blob_usage() == (count, nbytes)
+    finally:
+        shutil.rmtree(tmpdir)
+
+
+def test_face_shared_blob_replaced():
+    tmpdir = tempfile.mkdtemp()
+    try:
+        path = os.path.join(tmpdir, 'Vera.ttf')
+        shutil.copy(vera_path(), path)
+        st = os.stat(path)
+        count, nbytes = ft.font_blob_usage()
+
+        face = ft.Face(path)
+        assert ft.font_blob_usage()[0] == count + 1
+
+        # A file of the same size and modification time that replaces
+        # it is still a different file
+        new_path = os.path.join(tmpdir, 'Vera.new')
+        shutil.copy(vera_path(), new_path)
+        os.utime(new_path, (st.st_atime, st.st_mtime))
+        os.rename(new_path, path)
+
+        face2 = ft.Face(path)
+        assert ft.font_blob_usage()[0] == count + 2
+        _test_face(face)
+        _test_face(face2)
+
+        del face, face2
+        assert ft.font_blob_usage() == (count, nbytes)
+    finally:
+        shutil.rmtree(tmpdir)
+
+
 def test_face_set_transform():
     face = ft.Face(vera_path())
     face.set_transform([[2, 0], [0, 2]], [20, 20])
@@ -112,6 +229,98 @@ def test_face_set_transform():
     assert y == 0
 
 
+def test_coverage():
+    face = ft.Face(vera_path())
+    face.set_charmap(0)
+    coverage = face.coverage()
+
+    # The selected charmap is left alone, and the result is kept
+    assert face.charmap.encoding != ft.ENCODING.UNICODE
+    assert face.coverage() is coverage
+
+    face.select_charmap(ft.ENCODING.UNICODE)
+    expected = set(c for c in range(0x10000) if face.get_char_index(c))
+    assert len(coverage) == len(expected)
+    assert set(c for c in range(0x10000) if coverage.has_char(c)) == expected
+    assert 'A' in coverage
+    assert 0x1f600 not in coverage
+
+    ranges = coverage.ranges()
+    assert set(c for first, last in ranges
+               for c in range(first, last + 1)) == expected
+    assert all(ranges[i][1] + 1 < ranges[i + 1][0]
+               for i in range(len(ranges) - 1))
+
+    leaves = memoryview(coverage)
+    assert leaves.format == 'I'
+    assert leaves.shape[1] == 9
+    assert leaves.shape[0] == len(set(c >> 8 for c in expected))
+
+
+@raises(TypeError)
+def test_coverage_read_only():
+    face = ft.Face(vera_path())
+    struct.pack_into('I', face.coverage(), 0, 0)
+
+
+def test_coverage_text():
+    face = ft.Face(vera_path())
+    coverage = face.coverage()
+
+    assert coverage.has_all("Hello, world")
+    assert coverage.has_all("")
+    assert not coverage.has_all("Hello 世界")
+    assert coverage.missing("Hello, world") == ""
+    assert coverage.missing(
+        "世Hello 界😀世") == "世界😀"
+    assert coverage.missing("\ufeffA") == "\ufeff"
+    assert "😀" not in coverage
+    assert "A" in coverage
+
+
+def test_get_char_indices():
+    face = ft.Face(vera_path())
+
+    for i, charmap in enumerate(face.charmaps):
+        face.set_charmap(i)
+        charcodes = list(range(0x300)) + [0xfb01, 0xfffd, 0x1f600]
+        expected = [face.get_char_index(c) for c in charcodes]
+
+        # Short runs are mapped directly, long ones build the table
+        assert memoryview(face.get_char_indices(charcodes[:10])).tolist() == \
+            expected[:10]
+        assert memoryview(face.get_char_indices(charcodes)).tolist() == expected
+        assert memoryview(face.get_char_indices(charcodes[:10])).tolist() == \
+            expected[:10]
+
+    face.select_charmap(ft.ENCODING.UNICODE)
+    text = "Hello, world \u00e9\U0001f600"
+    indices = face.get_char_indices(text * 100)
+    assert memoryview(indices).format == 'I'
+    assert memoryview(indices).tolist() == \
+        [face.get_char_index(ord(c)) for c in text] * 100
+
+
+@raises(ValueError)
+def test_get_char_indices_wrong_encoding():
+    face = ft.Face(vera_path())
+    face.set_charmap(0)
+    face.get_char_indices("Hello")
+
+
+def test_get_char_map_arrays():
+    face = ft.Face(vera_path())
+
+    for i, charmap in enumerate(face.charmaps):
+        face.set_charmap(i)
+        charcodes, glyph_indices = face.get_char_map_arrays()
+        assert memoryview(charcodes).format == 'I'
+        assert memoryview(glyph_indices).format == 'I'
+        assert list(zip(memoryview(charcodes).tolist(),
+                        memoryview(glyph_indices).tolist())) == \
+            list(face.get_chars())
+
+
 def test_kerning():
     face = ft.Face(vera_path())
     face.set_char_size(24, 24, 300, 300)
@@ -122,6 +331,39 @@ def test_kerning():
     assert face.get_kerning(A, V, ft.KERNING.DEFAULT) == (-6, 0)
 
 
+def test_kerning_batch():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24, 24, 300, 300)
+
+    # Both the precomputed ASCII pairs and others
+    glyphs = [face.get_char_index(ord(c)) for c in "AVTo.y\u00c5\u00e9"]
+    left = [l for l in glyphs for r in glyphs]
+    right = [r for l in glyphs for r in glyphs]
+
+    for kern_mode in (ft.KERNING.DEFAULT, ft.KERNING.UNFITTED,
+                      ft.KERNING.UNSCALED):
+        # Twice, to test the cached values
+        for i in range(2):
+            kerning = memoryview(
+                face.get_kerning_batch(left, right, kern_mode)).tolist()
+            assert kerning == [
+                list(face.get_kerning(l, r, kern_mode))
+                for l, r in zip(left, right)]
+
+    A = face.get_char_index(ord('A'))
+    V = face.get_char_index(ord('V'))
+    assert memoryview(face.get_kerning_batch([A], [V])).tolist() == [[-6, 0]]
+    face.set_char_size(12, 12, 300, 300)
+    assert memoryview(face.get_kerning_batch([A], [V])).tolist() == [[-3, 0]]
+
+
+@raises(ValueError)
+def test_kerning_batch_length_mismatch():
+    face = ft.Face(vera_path())
+    face.get_kerning_batch([1, 2], [1])
+
+
 def test_get_glyph_name():
     face = ft.Face(vera_path())
 
@@ -138,3 +380,99 @@ def test_char_iter():
     chars = list(face.get_chars())
     assert len(chars) == 256
     assert chars[-1] == (64258, 193)
+
+
+def test_face_own_library():
+    face = ft.Face(vera_path(), own_library=True)
+    assert face.own_library
+    assert not ft.Face(vera_path()).own_library
+
+    _test_face(face)
+
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+    glyph = face.load_char(ord('A'))
+    bitmap = glyph.render()
+
+    shared_face = ft.Face(vera_path())
+    shared_face.select_charmap(ft.ENCODING.UNICODE)
+    shared_face.set_char_size(24.0)
+    expected = shared_face.load_char(ord('A')).render()
+
+    del face
+    del glyph
+
+    assert bitmap.to_list() == expected.to_list()
+
+
+def test_face_own_library_lcd_filter():
+    def render_lcd(face):
+        face.select_charmap(ft.ENCODING.UNICODE)
+        face.set_char_size(24.0)
+        glyph = face.load_char(ord('A'), ft.LOAD.TARGET_LCD)
+        return glyph.render(ft.RENDER_MODE.LCD).to_list()
+
+    unfiltered = ft.Face(vera_path(), own_library=True)
+    filtered = ft.Face(vera_path(), own_library=True)
+    try:
+        unfiltered.set_lcd_filter(ft.LCD_FILTER.NONE)
+        filtered.set_lcd_filter(ft.LCD_FILTER.LIGHT)
+    except NotImplementedError:
+        return
+
+    assert render_lcd(unfiltered) != render_lcd(filtered)
+
+    # The shared library is not affected by the private ones
+    assert render_lcd(ft.Face(vera_path())) == render_lcd(
+        ft.Face(vera_path(), own_library=True))
+
+
+def test_face_render_glyphs():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+    indices = [face.get_char_index(ord(c)) for c in 'Hello, world']
+
+    atlas, metrics = face.render_glyphs(indices)
+    atlas_rows = atlas.to_list()
+    metrics = metrics.to_list()
+    assert len(metrics) == len(indices)
+
+    for index, (x, y, width, rows, left, top) in zip(indices, metrics):
+        glyph = face.load_glyph(index)
+        bitmap = glyph.render()
+        assert (width, rows) == (bitmap.width, bitmap.rows)
+        expected = bitmap.to_list()
+        actual = [row[x:x + width] for row in atlas_rows[y:y + rows]]
+        assert actual == expected
+
+    # Repeated glyphs share the same location in the atlas
+    assert metrics[2] == metrics[3]
+
+    atlas, metrics = face.render_glyphs(memoryview(bytearray(b'\x24\x25')))
+    assert len(metrics.to_list()) == 2
+
+    atlas, metrics = face.render_glyphs([])
+    assert metrics.to_list() == []
+
+
+@raises(IndexError)
+def test_face_render_glyphs_invalid_index():
+    face = ft.Face(vera_path())
+    face.set_char_size(24.0)
+    face.render_glyphs([1, face.num_glyphs])
+
+
+@raises(ValueError)
+def test_face_render_glyphs_lcd():
+    face = ft.Face(vera_path())
+    face.set_char_size(24.0)
+    face.render_glyphs([1, 2], ft.RENDER_MODE.LCD)
+
+
+@raises(TypeError)
+def test_face_render_glyphs_read_only():
+    face = ft.Face(vera_path())
+    face.set_char_size(24.0)
+    atlas, metrics = face.render_glyphs([36])
+    struct.pack_into('B', atlas, 0, 255)
@@ -0,0 +1,111 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2015, Michael Droettboom
+# All rights reserved.
+
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+# ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+# (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+# ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# The views and conclusions contained in the software and documentation are those
+# of the authors and should not be interpreted as representing official policies,
+# either expressed or implied, of the FreeBSD Project.
+
+
+from __future__ import print_function, unicode_literals, absolute_import
+
+import os
+import shutil
+import tempfile
+
+import freetypy as ft
+from freetypy import font_cache
+from .util import *
+
+
+def _check_vera(records, path):
+    face = ft.Face(vera_path())
+
+    assert len(records) == 1
+    record = records[0]
+    assert record.path == path
+    assert record.face_index == 0
+    assert record.family_name == face.family_name
+    assert record.style_name == face.style_name
+    assert record.postscript_name == face.get_postscript_name()
+    assert record.face_flags == int(face.face_flags)
+    assert record.weight_class == face.tt_os2.weight_class
+
+    face.select_charmap(ft.ENCODING.UNICODE)
+    for c in list(range(0x300)) + [0x2022, 0xfb01, 0xfffd, 0x1f600]:
+        assert record.has_char(c) == (face.get_char_index(c) != 0)
+    assert record.has_char('A')
+
+
+def test_font_cache():
+    tmpdir = tempfile.mkdtemp()
+    try:
+        font_path = os.path.join(tmpdir, 'Vera.ttf')
+        cache_path = os.path.join(tmpdir, 'fonts.cache')
+        shutil.copy(vera_path(), font_path)
+        paths = [font_path, os.path.join(tmpdir, 'missing.ttf')]
+
+        records = font_cache.FontCache(cache_path).scan(paths)
+        _check_vera(records, font_path)
+        assert os.path.exists(cache_path)
+
+        # A warm start doesn't open any fonts
+        def scan_fonts(*args):
+            raise AssertionError("Font was opened")
+        orig_scan_fonts = font_cache.scan_fonts
+        font_cache.scan_fonts = scan_fonts
+        try:
+            records = font_cache.FontCache(cache_path).scan(paths)
+        finally:
+            font_cache.scan_fonts = orig_scan_fonts
+        _check_vera(records, font_path)
+
+        # A changed file is scanned again
+        os.utime(font_path, (0, 0))
+        calls = []
+        def scan_fonts(paths, *args):
+            calls.append(paths)
+            return orig_scan_fonts(paths, *args)
+        font_cache.scan_fonts = scan_fonts
+        try:
+            records = font_cache.FontCache(cache_path).scan(paths)
+        finally:
+            font_cache.scan_fonts = orig_scan_fonts
+        assert calls == [[font_path]]
+        _check_vera(records, font_path)
+
+        # A corrupt cache is rebuilt
+        with open(cache_path, 'r+b') as fd:
+            fd.seek(40)
+            fd.write(b'\xff' * 8)
+            fd.truncate(60)
+        records = font_cache.FontCache(cache_path).scan(paths)
+        _check_vera(records, font_path)
+        records = font_cache.FontCache(cache_path).scan(paths)
+        _check_vera(records, font_path)
+
+        # Files that are no longer given are dropped
+        assert font_cache.FontCache(cache_path).scan([]) == []
+    finally:
+        shutil.rmtree(tmpdir)
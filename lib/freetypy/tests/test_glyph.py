@@ -119,3 +119,37 @@ def test_instantiate_Glyph():
         pass
     else:
         assert False, "Shouldn't be able to directly instantiate a Glyph"
+
+
+def test_render_threaded():
+    import threading
+
+    def render_all(face, results):
+        for c in range(32, 127):
+            glyph = face.load_char(c)
+            results.append(glyph.render().to_list())
+
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+    expected = []
+    render_all(face, expected)
+
+    # Threads using their own Face, plus two threads sharing one
+    faces = [ft.Face(vera_path()) for i in range(3)]
+    faces.append(faces[-1])
+    for face in faces:
+        face.select_charmap(ft.ENCODING.UNICODE)
+        face.set_char_size(24.0)
+
+    results = [[] for face in faces]
+    threads = [
+        threading.Thread(target=render_all, args=(face, result))
+        for face, result in zip(faces, results)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    for result in results:
+        assert result == expected
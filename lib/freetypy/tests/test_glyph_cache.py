@@ -0,0 +1,136 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2015, Michael Droettboom
+# All rights reserved.
+
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+# ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+# (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+# ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# The views and conclusions contained in the software and documentation are those
+# of the authors and should not be interpreted as representing official policies,
+# either expressed or implied, of the FreeBSD Project.
+
+from __future__ import print_function, unicode_literals, absolute_import
+
+import freetypy as ft
+from .util import *
+
+
+def _make_face():
+    face = ft.Face(vera_path())
+    face.set_charmap(0)
+    face.set_char_size(12, 12, 300, 300)
+    return face
+
+
+def test_glyph_cache():
+    face = _make_face()
+    cache = ft.GlyphCache()
+    index = face.get_char_index(ord('A'))
+
+    glyph = cache.load_glyph(face, index)
+    assert cache.misses == 1
+    assert cache.hits == 0
+    assert cache.count == 1
+    assert cache.nbytes > 0
+
+    glyph2 = cache.load_glyph(face, index)
+    assert cache.misses == 1
+    assert cache.hits == 1
+    assert cache.count == 1
+
+    expected = face.load_glyph(index)
+    for g in (glyph, glyph2):
+        assert g.face is face
+        assert g.advance == expected.advance
+        assert g.metrics.width == expected.metrics.width
+        assert memoryview(g.outline.points).tolist() == \
+            memoryview(expected.outline.points).tolist()
+
+    # Rendering a cached glyph must not affect the cache
+    glyph.render()
+    glyph3 = cache.load_glyph(face, index)
+    assert glyph3.format == ft.GLYPH_FORMAT.OUTLINE
+
+    cache.clear()
+    assert cache.count == 0
+    assert cache.nbytes == 0
+
+
+def test_glyph_cache_key():
+    face = _make_face()
+    cache = ft.GlyphCache()
+    index = face.get_char_index(ord('A'))
+
+    small = cache.load_glyph(face, index)
+    cache.load_glyph(face, index, ft.LOAD.NO_HINTING)
+    face.set_char_size(24, 24, 300, 300)
+    large = cache.load_glyph(face, index)
+    face.set_transform([[2, 0], [0, 2]])
+    cache.load_glyph(face, index)
+    assert cache.misses == 4
+    assert cache.count == 4
+
+    assert large.advance[0] > small.advance[0]
+
+    face.set_transform([[1, 0], [0, 1]])
+    cache.load_glyph(face, index)
+    assert cache.hits == 1
+
+    other_face = _make_face()
+    cache.load_glyph(other_face, index)
+    assert cache.misses == 5
+
+
+def test_glyph_cache_eviction():
+    face = _make_face()
+    cache = ft.GlyphCache()
+
+    for c in 'ABCDEFGHIJ':
+        cache.load_glyph(face, face.get_char_index(ord(c)))
+    assert cache.count == 10
+
+    cache.max_bytes = cache.nbytes // 2
+    assert cache.nbytes <= cache.max_bytes
+    assert 0 < cache.count < 10
+
+    # The most recently used glyph survives
+    cache.load_glyph(face, face.get_char_index(ord('J')))
+    assert cache.hits == 1
+
+    cache.max_bytes = 0
+    assert cache.count == 0
+
+    # A glyph larger than the budget is still returned
+    glyph = cache.load_glyph(face, face.get_char_index(ord('A')))
+    assert glyph.advance[0] > 0
+
+
+@raises(ValueError)
+def test_glyph_cache_negative_max_bytes():
+    cache = ft.GlyphCache()
+    cache.max_bytes = -1
+
+
+@raises(ValueError)
+def test_glyph_cache_invalid_glyph():
+    face = _make_face()
+    cache = ft.GlyphCache()
+    cache.load_glyph(face, 100000)
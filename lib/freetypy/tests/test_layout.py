@@ -29,6 +29,10 @@
 
 from __future__ import print_function, unicode_literals, absolute_import
 
+import math
+import os
+import struct
+
 import freetypy as ft
 from .util import *
 
@@ -41,11 +45,35 @@ def test_layout():
     layout = ft.Layout(
         face, "The quick brown fox jumped over the lazy dog")
 
-    assert layout.ink_bbox.width == 553.984375
+    # Each glyph is placed by the advance of the one before it, plus
+    # the kerning between them
+    x = 0.0
+    previous = None
+    ink = None
+    for (_, glyph_index, xy) in layout.layout:
+        if previous is not None:
+            x += face.get_kerning(previous, glyph_index).x
+        assert xy == (x, 0.0)
+        glyph = face.load_glyph(glyph_index)
+        # Outline bounding boxes are in 26.6
+        bbox = glyph.outline.get_bbox()
+        bbox = (x + bbox.x_min / 64.0, bbox.y_min / 64.0,
+                x + bbox.x_max / 64.0, bbox.y_max / 64.0)
+        if ink is None:
+            ink = bbox
+        else:
+            ink = (min(ink[0], bbox[0]), min(ink[1], bbox[1]),
+                   max(ink[2], bbox[2]), max(ink[3], bbox[3]))
+        x += glyph.metrics.hori_advance
+        previous = glyph_index
+
+    # "ro" and "ox" are kerned
+    assert x == 560.0
+    assert tuple(layout.ink_bbox) == ink
     assert layout.ink_bbox.ascent == 18.0
     assert layout.ink_bbox.depth == -5.0
 
-    assert tuple(layout.layout_bbox)[:3] == (0.0, -6.0, 555.984375)
+    assert tuple(layout.layout_bbox)[:3] == (0.0, -6.0, x)
 
     glyph_indices = [x[1] for x in layout.layout]
 
@@ -63,3 +91,622 @@ def test_layout_wrong_encoding():
 
     layout = ft.Layout(
         face, "The quick brown fox jumped over the lazy dog")
+
+
+def test_layout_draw():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+
+    layout = ft.Layout(face, "AV")
+    width, height = 60, 40
+    image = bytearray(width * height)
+    buffer = memoryview(image).cast('B', (height, width))
+    layout.draw(buffer, 2, 30)
+
+    # The first glyph matches a plain rendering of it
+    x0, y0 = 2, 30
+    glyph = face.load_glyph(layout.layout[0][1])
+    bitmap = glyph.render()
+    rows = bitmap.to_list()
+    for i, row in enumerate(rows):
+        start = (y0 - glyph.bitmap_top + i) * width + x0 + glyph.bitmap_left
+        drawn = list(image[start:start + len(row)])
+        # The second glyph may overlap the first
+        assert all(d >= r for d, r in zip(drawn, row))
+        assert drawn[:len(row) // 2] == row[:len(row) // 2]
+
+    # Nothing is drawn below the descender or to the left of the origin
+    assert not any(image[(y0 + 8) * width:])
+    assert not any(image[i * width] for i in range(height))
+
+    # Drawing partially outside of the buffer is clipped
+    layout.draw(buffer, -10, 5)
+    layout.draw(buffer, 1000, 1000)
+
+
+@raises(ValueError)
+def test_layout_draw_wrong_shape():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+
+    layout = ft.Layout(face, "AV")
+    layout.draw(bytearray(100))
+
+
+def test_layout_size_change():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+
+    face.set_char_size(12.0)
+    small = ft.Layout(face, "Hello").layout_bbox.width
+    face.set_char_size(24.0)
+    large = ft.Layout(face, "Hello").layout_bbox.width
+    face.set_char_size(12.0)
+
+    assert large > small
+    assert ft.Layout(face, "Hello").layout_bbox.width == small
+
+    face.set_transform([[2, 0], [0, 2]])
+    assert ft.Layout(face, "Hello").layout_bbox.width > small
+
+
+def test_layout_kerning():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+
+    layout = ft.Layout(face, "AV")
+    A, V = [x[1] for x in layout.layout]
+    kerning = face.get_kerning(A, V)
+    assert kerning.x != 0
+
+    advance = ft.Layout(face, "A").layout_bbox.width
+    assert layout.layout[1][2][0] == advance + kerning.x
+
+
+def test_layout_edit():
+    for load_flags in (ft.LOAD.DEFAULT, ft.LOAD.NO_HINTING):
+        face = ft.Face(vera_path())
+        face.select_charmap(ft.ENCODING.UNICODE)
+        face.set_char_size(24.0)
+
+        text = "AVAST ye"
+        layout = ft.Layout(face, text, load_flags)
+        edits = [
+            ('insert', 0, 0, "To"),
+            ('insert', len(text) + 2, 0, ", WAVY"),
+            ('replace', 3, 5, "VA"),
+            ('delete', 0, 1, None),
+            ('replace', 2, 2, "\u00c5V"),
+            ('delete', 4, 9, None),
+            ('insert', 3, 0, "A" * 100),
+            ('delete', 0, 110, None),
+            ('insert', 0, 0, "AV"),
+        ]
+
+        for op, start, end, new_text in edits:
+            if op == 'insert':
+                layout.insert(start, new_text)
+                text = text[:start] + new_text + text[start:]
+            elif op == 'delete':
+                layout.delete(start, end)
+                text = text[:start] + text[end:]
+            else:
+                layout.replace(start, end, new_text)
+                text = text[:start] + new_text + text[end:]
+
+            expected = ft.Layout(face, text, load_flags)
+            assert layout.text == text
+            assert layout.layout == expected.layout
+            assert tuple(layout.layout_bbox) == tuple(expected.layout_bbox)
+            assert tuple(layout.ink_bbox) == tuple(expected.ink_bbox)
+
+
+@raises(IndexError)
+def test_layout_edit_out_of_range():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+
+    layout = ft.Layout(face, "AV")
+    layout.delete(1, 3)
+
+
+def test_layout_edit_threaded():
+    import threading
+
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+
+    text = "Hello, world " * 20
+    layout = ft.Layout(face, text)
+    width, height = 400, 40
+    image = bytearray(width * height)
+    buffer = memoryview(image).cast('B', (height, width))
+    done = []
+
+    def read_all():
+        while not done:
+            layout.draw(buffer, 0, 30)
+            layout.get_transformed(((0, -1), (1, 0)))
+            layout.to_points_and_codes()
+            layout.ink_bbox
+
+    # Edits that move the layout's arrays while they are being read
+    thread = threading.Thread(target=read_all)
+    thread.start()
+    try:
+        for i in range(100):
+            inserted = "AV" * (2 ** (i % 10))
+            layout.insert(0, inserted)
+            layout.delete(0, len(inserted))
+            if i % 10 == 0:
+                layout.__init__(face, text)
+    finally:
+        done.append(True)
+        thread.join()
+
+    expected = ft.Layout(face, text)
+    assert layout.text == expected.text
+    assert layout.layout == expected.layout
+    assert tuple(layout.ink_bbox) == tuple(expected.ink_bbox)
+
+
+def test_layout_vertical():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+
+    text = "AgI"
+    layout = ft.Layout(face, text, ft.LOAD.VERTICAL_LAYOUT)
+
+    # Each glyph is hung from its vertical origin on the pen
+    pen_y = 0
+    for c, (_, glyph_index, (x, y)) in zip(text, layout.layout):
+        glyph = face.load_char_unicode(c, ft.LOAD.VERTICAL_LAYOUT)
+        metrics = glyph.metrics
+        assert glyph_index == face.get_char_index(ord(c))
+        assert x == metrics.vert_bearing_x - metrics.hori_bearing_x
+        assert y == pen_y - metrics.vert_bearing_y - metrics.hori_bearing_y
+        pen_y -= metrics.vert_advance
+
+    bbox = layout.layout_bbox
+    assert bbox.y_max == 0
+    assert bbox.y_min == pen_y
+    assert bbox.x_min == -bbox.x_max
+    assert bbox.width == face.size.metrics.ascender - face.size.metrics.descender
+
+    ink = layout.ink_bbox
+    assert ink.x_min < 0 < ink.x_max
+    assert pen_y <= ink.y_min < ink.y_max <= 0
+
+    # Edits work in the vertical direction too
+    layout.insert(1, "VV")
+    expected = ft.Layout(face, "AVVgI", ft.LOAD.VERTICAL_LAYOUT)
+    assert layout.layout == expected.layout
+    assert tuple(layout.layout_bbox) == tuple(expected.layout_bbox)
+    assert tuple(layout.ink_bbox) == tuple(expected.ink_bbox)
+
+
+def test_layout_buffers():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+
+    layout = ft.Layout(face, "Hello, world")
+
+    glyph_indices = memoryview(layout.glyph_indices)
+    xys = memoryview(layout.xys)
+    assert glyph_indices.readonly
+    assert xys.format == 'd'
+    assert xys.shape == (len(layout.text), 2)
+    assert [(glyph_index, tuple(xy)) for (glyph_index, xy) in
+            zip(glyph_indices.tolist(), xys.tolist())] == \
+        [(glyph_index, xy) for (_, glyph_index, xy) in layout.layout]
+
+    # Edits would move the memory out from under the views
+    try:
+        layout.insert(0, "A")
+    except BufferError:
+        pass
+    else:
+        assert False, "Layout was edited while being viewed"
+    assert layout.text == "Hello, world"
+
+    glyph_indices.release()
+    xys.release()
+    layout.insert(0, "A")
+    assert layout.glyph_indices.to_list() == \
+        [glyph_index for (_, glyph_index, _) in layout.layout]
+
+
+@raises(TypeError)
+def test_layout_xys_read_only():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+
+    layout = ft.Layout(face, "Hello, world")
+    struct.pack_into('d', layout.xys, 0, 1.0)
+
+
+@raises(TypeError)
+def test_layout_glyph_indices_read_only():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+
+    layout = ft.Layout(face, "Hello, world")
+    struct.pack_into('L', layout.glyph_indices, 0, 1)
+
+
+def test_layout_get_transformed():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+
+    layout = ft.Layout(face, "Hello, world")
+    xys = [xy for (_, _, xy) in layout.layout]
+
+    # The identity leaves everything where it was
+    result, ink = layout.get_transformed(((1, 0), (0, 1)))
+    assert memoryview(result).format == 'd'
+    assert [tuple(xy) for xy in memoryview(result).tolist()] == xys
+    assert tuple(ink) == tuple(layout.ink_bbox)
+
+    # A quarter turn counterclockwise, then an offset
+    result, ink = layout.get_transformed(((0, -1), (1, 0)), (10, 5))
+    assert [tuple(xy) for xy in memoryview(result).tolist()] == \
+        [(10 - y, 5 + x) for (x, y) in xys]
+    bbox = layout.ink_bbox
+    assert tuple(ink) == (
+        10 - bbox.y_max, 5 + bbox.x_min, 10 - bbox.y_min, 5 + bbox.x_max)
+
+    # The box is as tight as the transformed outlines
+    c = math.cos(math.radians(30))
+    s = math.sin(math.radians(30))
+    matrix = ((c, -s), (s, c))
+    result, ink = layout.get_transformed(matrix)
+    expected = None
+    for (_, glyph_index, _), (x, y) in zip(
+            layout.layout, memoryview(result).tolist()):
+        outline = face.load_glyph(glyph_index).outline
+        outline.transform(matrix)
+        # Outline bounding boxes are in 26.6
+        glyph_bbox = outline.get_bbox()
+        x = math.floor(x * 64)
+        y = math.floor(y * 64)
+        glyph_bbox = ((glyph_bbox.x_min + x) / 64.0,
+                      (glyph_bbox.y_min + y) / 64.0,
+                      (glyph_bbox.x_max + x) / 64.0,
+                      (glyph_bbox.y_max + y) / 64.0)
+        if expected is None:
+            expected = glyph_bbox
+        else:
+            expected = (min(expected[0], glyph_bbox[0]),
+                        min(expected[1], glyph_bbox[1]),
+                        max(expected[2], glyph_bbox[2]),
+                        max(expected[3], glyph_bbox[3]))
+    assert tuple(ink) == expected
+
+
+def test_layout_get_transformed_face_transform():
+    def make_layout():
+        face = ft.Face(vera_path())
+        face.select_charmap(ft.ENCODING.UNICODE)
+        face.set_char_size(24.0)
+        return face, ft.Layout(face, "Hello, world")
+
+    matrix = ((0, -1), (1, 0))
+    face, layout = make_layout()
+    expected = tuple(layout.get_transformed(matrix)[1])
+    expected_points = memoryview(layout.to_points_and_codes()[0]).tolist()
+
+    # The face's own transform isn't applied on top of the layout's
+    face, layout = make_layout()
+    face.set_transform(matrix, (64, 32))
+    assert tuple(layout.get_transformed(matrix)[1]) == expected
+    assert tuple(layout.get_transformed(((1, 0), (0, 1)))[1]) == \
+        tuple(layout.ink_bbox)
+    assert memoryview(layout.to_points_and_codes()[0]).tolist() == \
+        expected_points
+
+
+def test_layout_to_points_and_codes():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+
+    layout = ft.Layout(face, "Hi there")
+    points, codes = layout.to_points_and_codes()
+    assert memoryview(codes).format == 'B'
+
+    # The same as joining the paths of the glyphs, moved into place
+    expected_points = []
+    expected_codes = []
+    for (_, glyph_index, (x, y)) in layout.layout:
+        outline = face.load_glyph(glyph_index).outline
+        glyph_points, glyph_codes = outline.to_points_and_codes()
+        expected_points.extend(
+            [px + x, py + y] for (px, py) in memoryview(glyph_points).tolist())
+        expected_codes.extend(memoryview(glyph_codes).tolist())
+
+    assert memoryview(points).tolist() == expected_points
+    assert memoryview(codes).tolist() == expected_codes
+    assert expected_codes[0] == ft.CODES.MOVETO
+
+    points, codes = ft.Layout(face, "  ").to_points_and_codes()
+    assert memoryview(points).shape == (0, 2)
+    assert memoryview(codes).shape == (0,)
+
+
+@raises(TypeError)
+def test_layout_get_transformed_bad_matrix():
+    face = ft.Face(vera_path())
+    layout = ft.Layout(face, "Hello")
+    layout.get_transformed((1, 0, 0, 1))
+
+
+def test_measure_text():
+    text = "The quick brown fox jumped over the lazy dog"
+
+    for load_flags in (ft.LOAD.DEFAULT, ft.LOAD.NO_HINTING):
+        face = ft.Face(vera_path())
+        face.select_charmap(ft.ENCODING.UNICODE)
+        face.set_char_size(24.0)
+
+        # A cold face takes the fast advance-only path
+        layout_bbox, ink_bbox = face.measure_text(
+            text, load_flags=load_flags, ink=False)
+        assert ink_bbox is None
+
+        layout = ft.Layout(face, text, load_flags)
+        assert tuple(layout_bbox) == tuple(layout.layout_bbox)
+
+        layout_bbox, ink_bbox = face.measure_text(text, load_flags)
+        assert tuple(layout_bbox) == tuple(layout.layout_bbox)
+        assert tuple(ink_bbox) == tuple(layout.ink_bbox)
+
+    face.set_transform([[2, 0], [0, 2]])
+    layout = ft.Layout(face, text, load_flags)
+    layout_bbox, ink_bbox = face.measure_text(text, load_flags, ink=False)
+    assert tuple(layout_bbox) == tuple(layout.layout_bbox)
+
+
+@raises(ValueError)
+def test_measure_text_wrong_encoding():
+    face = ft.Face(vera_path())
+    face.set_charmap(0)
+    face.set_char_size(24.0)
+
+    face.measure_text("Hello")
+
+
+def test_layout_many():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+
+    strings = ["0.0", "0.5", "1.0", "", "AV", "Hello, world"]
+
+    offsets, glyph_indices, xys, layout_bboxes, ink_bboxes = \
+        face.layout_many(strings)
+    offsets = memoryview(offsets).tolist()
+    glyph_indices = memoryview(glyph_indices).tolist()
+    xys = memoryview(xys).tolist()
+    layout_bboxes = memoryview(layout_bboxes).tolist()
+    ink_bboxes = memoryview(ink_bboxes).tolist()
+
+    assert len(offsets) == len(strings) + 1
+    assert offsets[-1] == len(glyph_indices) == len(xys)
+
+    for i, text in enumerate(strings):
+        layout = ft.Layout(face, text)
+        start, end = offsets[i], offsets[i + 1]
+        assert [(glyph_index, tuple(xy)) for (glyph_index, xy) in
+                zip(glyph_indices[start:end], xys[start:end])] == \
+            [(glyph_index, xy) for (_, glyph_index, xy) in layout.layout]
+        assert tuple(layout_bboxes[i]) == tuple(layout.layout_bbox)
+        assert tuple(ink_bboxes[i]) == tuple(layout.ink_bbox)
+
+    offsets, glyph_indices, xys, layout_bboxes, ink_bboxes = \
+        face.layout_many([])
+    assert memoryview(offsets).tolist() == [0]
+    assert memoryview(glyph_indices).shape == (0,)
+    assert memoryview(xys).shape == (0, 2)
+    assert memoryview(ink_bboxes).shape == (0, 4)
+
+
+@raises(TypeError)
+def test_layout_many_not_strings():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+
+    face.layout_many(["Hello", 42])
+
+
+def test_fallback_layout():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+    fallback = ft.Face(vera_path())
+    fallback.select_charmap(ft.ENCODING.UNICODE)
+    fallback.set_char_size(12.0)
+
+    text = "Hello \u4e16\u754c, world"
+    layout = ft.Layout(face, text)
+
+    # Characters no face covers are laid out with the first face
+    fallback_layout = ft.FallbackLayout([face, fallback], text)
+    assert fallback_layout.faces == (face, fallback)
+    assert fallback_layout.runs == [(0, 0, len(text))]
+    assert memoryview(fallback_layout.face_ids).tolist() == [0] * len(text)
+    assert fallback_layout.layout == layout.layout
+    assert tuple(fallback_layout.layout_bbox) == tuple(layout.layout_bbox)
+    assert tuple(fallback_layout.ink_bbox) == tuple(layout.ink_bbox)
+
+    fallback_layout = ft.FallbackLayout([fallback, face], text)
+    assert fallback_layout.layout[-1][0] is fallback
+    assert tuple(fallback_layout.layout_bbox) == \
+        tuple(ft.Layout(fallback, text).layout_bbox)
+
+    # The same glyphs are drawn
+    width, height = 600, 40
+    image = bytearray(width * height)
+    expected = bytearray(width * height)
+    ft.FallbackLayout([face, fallback], text).draw(
+        memoryview(image).cast('B', (height, width)), 2, 30)
+    layout.draw(memoryview(expected).cast('B', (height, width)), 2, 30)
+    assert image == expected
+
+
+DEJAVU_SANS_PATH = '/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf'
+
+
+@skip_if(not os.path.exists(DEJAVU_SANS_PATH))
+def test_fallback_layout_several_faces():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(24.0)
+    # Has the Greek that Vera lacks
+    fallback = ft.Face(DEJAVU_SANS_PATH)
+    fallback.select_charmap(ft.ENCODING.UNICODE)
+    fallback.set_char_size(12.0)
+    faces = [face, fallback]
+
+    text = "Hi \u03b1\u03b2 there"
+    layout = ft.FallbackLayout(faces, text)
+    assert layout.runs == [(0, 0, 3), (1, 3, 5), (0, 5, 11)]
+    assert memoryview(layout.face_ids).tolist() == \
+        [0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0]
+
+    # Each run is laid out with its own face, continuing from the pen
+    # of the run before it
+    width, height = 200, 40
+    expected = bytearray(width * height)
+    expected_layout = []
+    ink = None
+    x = 0.0
+    for face_id, start, end in layout.runs:
+        run = ft.Layout(faces[face_id], text[start:end])
+        expected_layout.extend(
+            (run_face, glyph_index, (glyph_x + x, glyph_y))
+            for (run_face, glyph_index, (glyph_x, glyph_y)) in run.layout)
+        run_ink = run.ink_bbox
+        run_ink = (run_ink.x_min + x, run_ink.y_min,
+                   run_ink.x_max + x, run_ink.y_max)
+        if ink is None:
+            ink = run_ink
+        else:
+            ink = (min(ink[0], run_ink[0]), min(ink[1], run_ink[1]),
+                   max(ink[2], run_ink[2]), max(ink[3], run_ink[3]))
+        run.draw(memoryview(expected).cast('B', (height, width)), 2 + x, 30)
+        x += run.layout_bbox.x_max
+
+    assert layout.layout == expected_layout
+    assert layout.layout[3][0] is fallback
+    assert layout.layout[5][0] is face
+
+    # Vertically, the layout box covers both faces
+    assert tuple(layout.layout_bbox) == (
+        0.0, min(face.size.metrics.descender, fallback.size.metrics.descender),
+        x, max(face.size.metrics.ascender, fallback.size.metrics.ascender))
+    assert tuple(layout.ink_bbox) == ink
+
+    image = bytearray(width * height)
+    layout.draw(memoryview(image).cast('B', (height, width)), 2, 30)
+    assert image == expected
+
+
+@raises(ValueError)
+def test_fallback_layout_no_faces():
+    ft.FallbackLayout([], "Hello")
+
+
+@raises(ValueError)
+def test_fallback_layout_wrong_encoding():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    fallback = ft.Face(vera_path())
+    fallback.set_charmap(0)
+
+    ft.FallbackLayout([face, fallback], "Hello")
+
+
+def test_paragraph_layout():
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(12.0)
+
+    text = ("The quick brown fox jumped over the lazy dog.\n"
+            "A well-known pangram \u4e16\u754c\u4e16\u754c (really).")
+    layout = ft.ParagraphLayout(face, text, 100, line_spacing=1.5)
+    lines = layout.lines
+    line_height = face.size.metrics.height * 1.5
+
+    # The lines cover the whole text, in order
+    assert lines[0][0] == 0
+    assert lines[-1][1] == len(text)
+    assert all(a[1] == b[0] for a, b in zip(lines[:-1], lines[1:]))
+    assert [text[start:end] for start, end, _, _, _ in lines] == [
+        "The quick ", "brown fox ", "jumped over the ", "lazy dog.\n",
+        "A well-known ", "pangram \u4e16\u754c\u4e16\u754c ", "(really)."]
+
+    glyphs = layout.layout
+    for i, (start, end, baseline, layout_bbox, ink_bbox) in enumerate(lines):
+        assert baseline == -i * line_height
+        assert all(glyph[2][1] == baseline for glyph in glyphs[start:end])
+
+        # Each line is laid out as it would be by itself
+        line_text = text[start:end].rstrip()
+        line = ft.Layout(face, line_text)
+        assert [(g, (x, y + baseline)) for _, g, (x, y) in line.layout] == \
+            [(g, xy) for _, g, xy in glyphs[start:start + len(line_text)]]
+        assert layout_bbox.width == line.layout_bbox.width
+        assert layout_bbox.width <= 100
+
+    assert layout.layout_bbox.width == max(
+        line[3].width for line in lines)
+    assert layout.layout_bbox.ascent == lines[0][3].ascent
+    assert layout.layout_bbox.depth == lines[-1][3].depth
+
+    def split(text, width):
+        layout = ft.ParagraphLayout(face, text, width)
+        return [text[start:end] for start, end, _, _, _ in layout.lines]
+
+    assert split("well-known", 30) == ["well-", "known"]
+    assert split("\u4e16\u754c\u4e16\u754c", 20) == \
+        ["\u4e16\u754c", "\u4e16\u754c"]
+    assert split("Hello\r\n\r\nworld", 1000) == \
+        ["Hello\r\n", "\r\n", "world"]
+    assert split("", 100) == [""]
+
+    # A word wider than the paragraph overflows
+    layout = ft.ParagraphLayout(face, "Supercalifragilistic is long", 20)
+    assert [(start, end) for start, end, _, _, _ in layout.lines] == \
+        [(0, 21), (21, 24), (24, 28)]
+    assert layout.lines[0][3].width > 20
+
+
+@skip_if(not os.path.exists('/proc/self/statm'))
+def test_layout_memory():
+    def rss():
+        with open('/proc/self/statm') as fd:
+            return int(fd.read().split()[1]) * os.sysconf('SC_PAGE_SIZE')
+
+    face = ft.Face(vera_path())
+    face.select_charmap(ft.ENCODING.UNICODE)
+    face.set_char_size(12.0)
+
+    for i in range(1000):
+        ft.Layout(face, "Hello, world")
+
+    before = rss()
+    for i in range(1000000):
+        ft.Layout(face, "Hello, world")
+    after = rss()
+
+    assert after - before < 8 * 1024 * 1024
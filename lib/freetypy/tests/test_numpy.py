@@ -181,3 +181,23 @@ def test_outline_to_points_and_codes():
         [1, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 2, 1, 2, 2, 3, 3, 3, 3, 3,
          3, 3, 3, 2, 1, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
          3, 3, 2, 2])
+
+
+@skip_if(not HAS_NUMPY)
+def test_render_glyphs():
+    face = ft.Face(vera_path())
+    face.set_charmap(0)
+    face.set_char_size(12, 12, 300, 300)
+    indices = np.array([face.get_char_index(c) for c in b'ABA'], np.uint32)
+
+    atlas, metrics = face.render_glyphs(indices)
+    atlas = np.asarray(atlas)
+    metrics = np.asarray(metrics)
+    assert atlas.dtype == np.uint8
+    assert metrics.shape == (3, 6)
+
+    x, y, width, rows, left, top = metrics[0]
+    glyph = face.load_glyph(int(indices[0]))
+    assert_array_equal(
+        atlas[y:y + rows, x:x + width], np.asarray(glyph.render()))
+    assert_array_equal(metrics[0], metrics[2])
@@ -0,0 +1,74 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2015, Michael Droettboom
+# All rights reserved.
+
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+# ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+# (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+# ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# The views and conclusions contained in the software and documentation are those
+# of the authors and should not be interpreted as representing official policies,
+# either expressed or implied, of the FreeBSD Project.
+
+
+from __future__ import print_function, unicode_literals, absolute_import
+
+import freetypy as ft
+from .util import *
+
+
+def test_scan_fonts():
+    face = ft.Face(vera_path())
+
+    records = ft.scan_fonts([vera_path(), '/nonexistent.ttf', __file__])
+    assert records == [
+        (vera_path(), 0, face.family_name, face.style_name,
+         face.face_flags, face.style_flags,
+         face.tt_os2.weight_class, face.tt_os2.width_class)]
+
+
+def test_scan_fonts_fields():
+    face = ft.Face(vera_path())
+
+    records = ft.scan_fonts(
+        [vera_path()],
+        ['postscript_name', 'num_glyphs', 'sfnt_names'])
+    assert len(records) == 1
+    postscript_name, num_glyphs, sfnt_names = records[0]
+
+    assert postscript_name == face.get_postscript_name()
+    assert num_glyphs == face.num_glyphs
+    assert sfnt_names == [
+        (x.platform_id, x.encoding_id, x.language_id, x.name_id,
+         x.string_bytes)
+        for x in face.sfnt_names]
+
+
+def test_scan_fonts_threads():
+    paths = [vera_path(), '/nonexistent.ttf'] * 50
+
+    for threads in (1, 4):
+        records = ft.scan_fonts(paths, ['path', 'face_index'], threads=threads)
+        assert records == [(vera_path(), 0)] * 50
+
+
+@raises(ValueError)
+def test_scan_fonts_unknown_field():
+    ft.scan_fonts([vera_path()], ['family_name', 'color'])
@@ -0,0 +1,237 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#include "array.h"
+#include "doc/array.h"
+
+
+/****************************************************************************
+ Object basics
+*/
+
+
+static PyTypeObject Py_Array_Type;
+
+
+static void
+Py_Array_dealloc(ftpy_Array* self)
+{
+    free(self->data);
+    Py_TYPE(self)->tp_clear((PyObject*)self);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+
+static ftpy_Array *
+array_alloc(
+    const char *format, Py_ssize_t itemsize, int ndim,
+    Py_ssize_t shape0, Py_ssize_t shape1)
+{
+    ftpy_Array *self;
+
+    if (ndim == 1) {
+        shape1 = 1;
+    }
+
+    if (shape0 < 0 || shape1 < 0 ||
+        (shape1 != 0 && shape0 > PY_SSIZE_T_MAX / shape1 / itemsize)) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+
+    self = (ftpy_Array *)(&Py_Array_Type)->tp_alloc(&Py_Array_Type, 0);
+    if (self == NULL) {
+        return NULL;
+    }
+
+    self->base.owner = NULL;
+    self->data = NULL;
+    self->ndim = ndim;
+    self->itemsize = itemsize;
+    self->format = format;
+    self->shape[0] = shape0;
+    self->shape[1] = shape1;
+    self->strides[0] = shape1 * itemsize;
+    self->strides[1] = itemsize;
+    if (ndim == 1) {
+        self->strides[0] = itemsize;
+    }
+
+    return self;
+}
+
+
+PyObject *
+ftpy_Array_cnew(
+    const char *format, Py_ssize_t itemsize, int ndim,
+    Py_ssize_t shape0, Py_ssize_t shape1)
+{
+    ftpy_Array *self;
+    Py_ssize_t size;
+
+    self = array_alloc(format, itemsize, ndim, shape0, shape1);
+    if (self == NULL) {
+        return NULL;
+    }
+
+    size = self->shape[0] * self->shape[1] * itemsize;
+    /* Always allocate something, so data is never NULL */
+    self->data = calloc(size ? size : 1, 1);
+    if (self->data == NULL) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+
+    return (PyObject *)self;
+}
+
+
+PyObject *
+ftpy_Array_cnew_from_data(
+    void *data, const char *format, Py_ssize_t itemsize, int ndim,
+    Py_ssize_t shape0, Py_ssize_t shape1)
+{
+    ftpy_Array *self;
+
+    self = array_alloc(format, itemsize, ndim, shape0, shape1);
+    if (self == NULL) {
+        free(data);
+        return NULL;
+    }
+
+    self->data = data;
+
+    return (PyObject *)self;
+}
+
+
+static PyObject *
+Py_Array_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    ftpy_Array *self;
+
+    self = (ftpy_Array *)ftpy_Object_new(type, args, kwds);
+    if (self == NULL) {
+        return NULL;
+    }
+    self->data = NULL;
+    return (PyObject *)self;
+}
+
+
+static int
+Py_Array_init(ftpy_Array *self, PyObject *args, PyObject *kwds)
+{
+    PyErr_SetString(
+        PyExc_RuntimeError,
+        "Array objects may not be instantiated directly.");
+    return -1;
+}
+
+
+/****************************************************************************
+ Methods
+*/
+
+
+static PyObject*
+Py_Array_to_list(ftpy_Array* self) {
+    return ftpy_PyBuffer_ToList((PyObject *)self);
+};
+
+
+static PyMethodDef Py_Array_methods[] = {
+    {"to_list", (PyCFunction)Py_Array_to_list, METH_NOARGS, NULL},
+    {NULL}  /* Sentinel */
+};
+
+
+/****************************************************************************
+ Buffer interface
+*/
+
+
+static int Py_Array_get_buffer(ftpy_Array *self, Py_buffer *view, int flags)
+{
+    if (flags & PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "Array is read-only");
+        return -1;
+    }
+
+    Py_INCREF(self);
+    view->obj = (PyObject *)self;
+    view->buf = self->data;
+    view->readonly = 1;
+    view->itemsize = self->itemsize;
+    view->format = (char *)self->format;
+    view->len = self->shape[0] * self->strides[0];
+    view->internal = NULL;
+    view->ndim = self->ndim;
+    view->shape = self->shape;
+    view->strides = self->strides;
+    view->suboffsets = NULL;
+
+    return 0;
+}
+
+
+static PyBufferProcs Py_Array_buffer_procs;
+
+
+/****************************************************************************
+ Setup
+*/
+
+
+int setup_Array(PyObject *m)
+{
+    memset(&Py_Array_buffer_procs, 0, sizeof(PyBufferProcs));
+    Py_Array_buffer_procs.bf_getbuffer = (getbufferproc)Py_Array_get_buffer;
+
+    memset(&Py_Array_Type, 0, sizeof(PyTypeObject));
+    Py_Array_Type = (PyTypeObject) {
+        .tp_name = "freetypy.Array",
+        .tp_basicsize = sizeof(ftpy_Array),
+        .tp_dealloc = (destructor)Py_Array_dealloc,
+        .tp_as_buffer = &Py_Array_buffer_procs,
+        .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC
+        #if !PY3K
+        | Py_TPFLAGS_HAVE_NEWBUFFER
+        #endif
+        ,
+        .tp_doc = doc_Array__init__,
+        .tp_methods = Py_Array_methods,
+        .tp_init = (initproc)Py_Array_init,
+        .tp_new = Py_Array_new
+    };
+
+    ftpy_setup_type(m, &Py_Array_Type);
+
+    return 0;
+}
@@ -0,0 +1,72 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#ifndef __ARRAY_H__
+#define __ARRAY_H__
+
+#include "freetypy.h"
+
+
+/*
+   A simple 1- or 2-dimensional array that owns its memory and
+   exposes it through the buffer protocol.  Used to return bulk
+   results from C, which can be wrapped with Numpy without a copy.
+*/
+typedef struct {
+    ftpy_Object base;
+    void *data;
+    int ndim;
+    Py_ssize_t shape[2];
+    Py_ssize_t strides[2];
+    Py_ssize_t itemsize;
+    const char *format;
+} ftpy_Array;
+
+
+/* Creates a new zero-filled, C-contiguous array.  For a 1-dimensional
+   array, shape1 is ignored.  format must be a static string. */
+PyObject *ftpy_Array_cnew(
+    const char *format, Py_ssize_t itemsize, int ndim,
+    Py_ssize_t shape0, Py_ssize_t shape1);
+
+
+/* Creates a new array that takes ownership of data, which must have
+   been allocated with malloc().  data is freed even on failure. */
+PyObject *ftpy_Array_cnew_from_data(
+    void *data, const char *format, Py_ssize_t itemsize, int ndim,
+    Py_ssize_t shape0, Py_ssize_t shape1);
+
+
+#define ftpy_Array_DATA(a) (((ftpy_Array *)(a))->data)
+
+
+int setup_Array(PyObject *m);
+
+
+#endif
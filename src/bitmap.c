@@ -62,7 +62,10 @@ static PyTypeObject Py_Bitmap_Type;
 static void
 Py_Bitmap_dealloc(Py_Bitmap* self)
 {
-    FT_Bitmap_Done(get_ft_library(), self->x);
+    if (self->x) {
+        FT_Bitmap_Done(get_ft_library(), self->x);
+        PyMem_Free(self->x);
+    }
     Py_TYPE(self)->tp_clear((PyObject*)self);
     Py_TYPE(self)->tp_free((PyObject*)self);
 }
@@ -85,11 +88,16 @@ Py_Bitmap_cnew(FT_Bitmap *bitmap)
             FT_Bitmap_Copy(get_ft_library(),
                            bitmap, copy))) {
         FT_Bitmap_Done(get_ft_library(), copy);
-        free(copy);
+        PyMem_Free(copy);
         return NULL;
     }
 
     self = (Py_Bitmap *)(&Py_Bitmap_Type)->tp_alloc(&Py_Bitmap_Type, 0);
+    if (self == NULL) {
+        FT_Bitmap_Done(get_ft_library(), copy);
+        PyMem_Free(copy);
+        return NULL;
+    }
     self->base.owner = NULL;
     self->x = copy;
     return (PyObject *)self;
@@ -215,6 +223,11 @@ static PyMethodDef Py_Bitmap_methods[] = {
 
 static int Py_Bitmap_get_buffer(Py_Bitmap *self, Py_buffer *view, int flags)
 {
+    if (flags & PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "Bitmap is read-only");
+        return -1;
+    }
+
     /*
       This is decremented automatically by the Python runtime on
       destruction of the memoryview.
@@ -0,0 +1,409 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#include "bitmap_cache.h"
+#include "doc/bitmap_cache.h"
+
+#include "bitmap.h"
+
+#include FT_GLYPH_H
+
+
+#define DEFAULT_MAX_BYTES (1 << 24)
+#define DEFAULT_SUBPIXELS 4
+
+
+#define DEF_BITMAP_CACHE_GETTER(name) DEF_GETTER(name, doc_BitmapCache_ ## name)
+#define BITMAP_CACHE_METHOD(name) DEF_METHOD(name, BitmapCache)
+
+
+/****************************************************************************
+ Cache entries
+*/
+
+
+static void
+bitmap_cache_entry_destroy(ftpy_LRU_Entry *base)
+{
+    ftpy_BitmapCache_Entry *entry = (ftpy_BitmapCache_Entry *)base;
+
+    Py_DECREF(entry->bitmap);
+    Py_DECREF(entry->key.glyph.face);
+    free(entry);
+}
+
+
+/* Splits a 26.6 coordinate into whole pixels and a subpixel position
+   in the range [0, subpixels) */
+static void
+quantize(FT_Pos v, int subpixels, FT_Int *whole, int *subpixel)
+{
+    FT_Pos frac = v & 63;
+    int q = (int)((frac * subpixels + 32) >> 6);
+
+    *whole = (FT_Int)((v - frac) >> 6);
+    if (q == subpixels) {
+        q = 0;
+        *whole += 1;
+    }
+    *subpixel = q;
+}
+
+
+ftpy_BitmapCache_Entry *
+ftpy_BitmapCache_get(
+    Py_BitmapCache *cache, Py_Face *face, FT_UInt glyph_index,
+    FT_Int32 load_flags, int render_mode, FT_Vector *origin,
+    FT_Int *left, FT_Int *top)
+{
+    ftpy_BitmapCache_Key key;
+    ftpy_BitmapCache_Entry *entry;
+    FT_Int whole_x, whole_y;
+    FT_Vector subpixel_origin;
+    FT_Glyph glyph = NULL;
+    FT_BitmapGlyph bitmap_glyph;
+    FT_Error error;
+
+    memset(&key, 0, sizeof(ftpy_BitmapCache_Key));
+    ftpy_GlyphCache_make_key(&key.glyph, face, glyph_index, load_flags);
+    key.render_mode = render_mode;
+    quantize(origin->x, cache->subpixels, &whole_x, &key.subpixel_x);
+    quantize(origin->y, cache->subpixels, &whole_y, &key.subpixel_y);
+
+    entry = (ftpy_BitmapCache_Entry *)ftpy_LRU_lookup(&cache->lru, &key);
+    if (entry != NULL) {
+        goto found;
+    }
+
+    FTPY_FACE_LOCK(face);
+
+    /* Another thread may have rendered the glyph while we were
+       waiting for the face */
+    entry = (ftpy_BitmapCache_Entry *)ftpy_LRU_find(&cache->lru, &key);
+    if (entry != NULL) {
+        goto exit;
+    }
+
+    subpixel_origin.x = (key.subpixel_x << 6) / cache->subpixels;
+    subpixel_origin.y = (key.subpixel_y << 6) / cache->subpixels;
+
+    Py_BEGIN_ALLOW_THREADS
+    error = FT_Load_Glyph(face->x, glyph_index, load_flags);
+    if (!error) {
+        error = FT_Get_Glyph(face->x->glyph, &glyph);
+    }
+    if (!error) {
+        error = FT_Glyph_To_Bitmap(&glyph, render_mode, &subpixel_origin, 1);
+    }
+    Py_END_ALLOW_THREADS
+
+    if (ftpy_exc(error)) {
+        goto exit;
+    }
+
+    face->load_flags = load_flags;
+
+    entry = malloc(sizeof(ftpy_BitmapCache_Entry));
+    if (entry == NULL) {
+        PyErr_NoMemory();
+        goto exit;
+    }
+
+    bitmap_glyph = (FT_BitmapGlyph)glyph;
+    entry->bitmap = Py_Bitmap_cnew(&bitmap_glyph->bitmap);
+    if (entry->bitmap == NULL) {
+        free(entry);
+        entry = NULL;
+        goto exit;
+    }
+
+    entry->key = key;
+    entry->left = bitmap_glyph->left;
+    entry->top = bitmap_glyph->top;
+    entry->base.nbytes = (
+        sizeof(ftpy_BitmapCache_Entry) + Py_TYPE(entry->bitmap)->tp_basicsize +
+        sizeof(FT_Bitmap) +
+        (size_t)abs(bitmap_glyph->bitmap.pitch) * bitmap_glyph->bitmap.rows);
+    Py_INCREF(face);
+
+    if (ftpy_LRU_insert(&cache->lru, &entry->base)) {
+        bitmap_cache_entry_destroy(&entry->base);
+        entry = NULL;
+        PyErr_NoMemory();
+    }
+
+ exit:
+
+    if (glyph != NULL) {
+        FT_Done_Glyph(glyph);
+    }
+
+    FTPY_FACE_UNLOCK(face);
+
+    if (entry == NULL) {
+        return NULL;
+    }
+
+ found:
+
+    *left = entry->left + whole_x;
+    *top = entry->top + whole_y;
+
+    return entry;
+}
+
+
+/****************************************************************************
+ Object basics
+*/
+
+
+static void
+Py_BitmapCache_dealloc(Py_BitmapCache* self)
+{
+    ftpy_LRU_done(&self->lru);
+    Py_TYPE(self)->tp_clear((PyObject*)self);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+
+static PyObject *
+Py_BitmapCache_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    Py_BitmapCache *self;
+
+    self = (Py_BitmapCache *)ftpy_Object_new(type, args, kwds);
+    if (self == NULL) {
+        return NULL;
+    }
+    self->subpixels = DEFAULT_SUBPIXELS;
+    if (ftpy_LRU_init(
+            &self->lru, DEFAULT_MAX_BYTES,
+            offsetof(ftpy_BitmapCache_Entry, key), sizeof(ftpy_BitmapCache_Key),
+            bitmap_cache_entry_destroy)) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+    return (PyObject *)self;
+}
+
+
+static int
+Py_BitmapCache_init(Py_BitmapCache *self, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"max_bytes", "subpixels", NULL};
+    Py_ssize_t max_bytes = DEFAULT_MAX_BYTES;
+    int subpixels = DEFAULT_SUBPIXELS;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|ni:BitmapCache.__init__", kwlist,
+                                     &max_bytes, &subpixels)) {
+        return -1;
+    }
+
+    if (max_bytes < 0) {
+        PyErr_SetString(PyExc_ValueError, "max_bytes must be non-negative");
+        return -1;
+    }
+
+    if (subpixels < 1 || subpixels > 64) {
+        PyErr_SetString(PyExc_ValueError, "subpixels must be in the range 1-64");
+        return -1;
+    }
+
+    /* Changing the quantization invalidates everything */
+    if (subpixels != self->subpixels) {
+        ftpy_LRU_clear(&self->lru);
+        self->subpixels = subpixels;
+    }
+
+    ftpy_LRU_set_max_bytes(&self->lru, (size_t)max_bytes);
+
+    return 0;
+}
+
+
+/****************************************************************************
+ Getters
+*/
+
+
+static PyObject *hits_get(Py_BitmapCache *self, PyObject *closure)
+{
+    return PyLong_FromUnsignedLongLong(self->lru.hits);
+}
+
+
+static PyObject *misses_get(Py_BitmapCache *self, PyObject *closure)
+{
+    return PyLong_FromUnsignedLongLong(self->lru.misses);
+}
+
+
+static PyObject *count_get(Py_BitmapCache *self, PyObject *closure)
+{
+    return PyLong_FromSize_t(self->lru.count);
+}
+
+
+static PyObject *nbytes_get(Py_BitmapCache *self, PyObject *closure)
+{
+    return PyLong_FromSize_t(self->lru.nbytes);
+}
+
+
+static PyObject *subpixels_get(Py_BitmapCache *self, PyObject *closure)
+{
+    return PyLong_FromLong(self->subpixels);
+}
+
+
+static PyObject *max_bytes_get(Py_BitmapCache *self, PyObject *closure)
+{
+    return PyLong_FromSize_t(self->lru.max_bytes);
+}
+
+
+static int max_bytes_set(Py_BitmapCache *self, PyObject *value, PyObject *closure)
+{
+    Py_ssize_t max_bytes;
+
+    if (value == NULL) {
+        PyErr_SetString(PyExc_AttributeError, "Can not delete max_bytes");
+        return -1;
+    }
+
+    max_bytes = PyNumber_AsSsize_t(value, PyExc_OverflowError);
+    if (max_bytes == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+
+    if (max_bytes < 0) {
+        PyErr_SetString(PyExc_ValueError, "max_bytes must be non-negative");
+        return -1;
+    }
+
+    ftpy_LRU_set_max_bytes(&self->lru, (size_t)max_bytes);
+
+    return 0;
+}
+
+
+static PyGetSetDef Py_BitmapCache_getset[] = {
+    DEF_BITMAP_CACHE_GETTER(hits),
+    DEF_BITMAP_CACHE_GETTER(misses),
+    DEF_BITMAP_CACHE_GETTER(count),
+    DEF_BITMAP_CACHE_GETTER(nbytes),
+    DEF_BITMAP_CACHE_GETTER(subpixels),
+    {"max_bytes", (getter)max_bytes_get, (setter)max_bytes_set,
+     doc_BitmapCache_max_bytes},
+    {NULL}
+};
+
+
+/****************************************************************************
+ Methods
+*/
+
+
+static PyObject*
+Py_BitmapCache_render(Py_BitmapCache* self, PyObject* args, PyObject* kwds) {
+    PyObject *face_obj;
+    unsigned int glyph_index;
+    int load_flags = 0;
+    int render_mode = FT_RENDER_MODE_NORMAL;
+    double x = 0;
+    double y = 0;
+    FT_Vector origin;
+    FT_Int left, top;
+    ftpy_BitmapCache_Entry *entry;
+
+    const char* keywords[] = {
+        "face", "glyph_index", "load_flags", "render_mode", "origin", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "O!I|ii(dd):render", (char **)keywords,
+            &Py_Face_Type, &face_obj, &glyph_index, &load_flags,
+            &render_mode, &x, &y)) {
+        return NULL;
+    }
+
+    origin.x = TO_F26DOT6(x);
+    origin.y = TO_F26DOT6(y);
+
+    entry = ftpy_BitmapCache_get(
+        self, (Py_Face *)face_obj, glyph_index, load_flags, render_mode,
+        &origin, &left, &top);
+    if (entry == NULL) {
+        return NULL;
+    }
+
+    return Py_BuildValue("(Oii)", entry->bitmap, left, top);
+}
+
+
+static PyObject*
+Py_BitmapCache_clear(Py_BitmapCache* self, PyObject* args, PyObject* kwds) {
+    ftpy_LRU_clear(&self->lru);
+    Py_RETURN_NONE;
+}
+
+
+static PyMethodDef Py_BitmapCache_methods[] = {
+    BITMAP_CACHE_METHOD(render),
+    DEF_METHOD_NOARGS(clear, BitmapCache),
+    {NULL}  /* Sentinel */
+};
+
+
+/****************************************************************************
+ Setup
+*/
+
+
+PyTypeObject Py_BitmapCache_Type;
+
+
+int setup_BitmapCache(PyObject *m)
+{
+    memset(&Py_BitmapCache_Type, 0, sizeof(PyTypeObject));
+    Py_BitmapCache_Type = (PyTypeObject) {
+        .tp_name = "freetypy.BitmapCache",
+        .tp_basicsize = sizeof(Py_BitmapCache),
+        .tp_dealloc = (destructor)Py_BitmapCache_dealloc,
+        .tp_doc = doc_BitmapCache__init__,
+        .tp_methods = Py_BitmapCache_methods,
+        .tp_getset = Py_BitmapCache_getset,
+        .tp_init = (initproc)Py_BitmapCache_init,
+        .tp_new = Py_BitmapCache_new
+    };
+
+    ftpy_setup_type(m, &Py_BitmapCache_Type);
+
+    return 0;
+}
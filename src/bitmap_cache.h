@@ -0,0 +1,80 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#ifndef __BITMAP_CACHE_H__
+#define __BITMAP_CACHE_H__
+
+#include "freetypy.h"
+#include "glyph_cache.h"
+#include "lru.h"
+
+
+typedef struct {
+    ftpy_GlyphCache_Key glyph;
+    int render_mode;
+    int subpixel_x;
+    int subpixel_y;
+} ftpy_BitmapCache_Key;
+
+
+typedef struct {
+    ftpy_LRU_Entry base;
+    ftpy_BitmapCache_Key key;
+    PyObject *bitmap;
+    FT_Int left;
+    FT_Int top;
+} ftpy_BitmapCache_Entry;
+
+
+typedef struct {
+    ftpy_Object base;
+    ftpy_LRU lru;
+    int subpixels;
+} Py_BitmapCache;
+
+
+/* Returns the cached rendering of the given glyph, rendering it if
+   necessary.  The origin is in 26.6 fixed point.  On success, the
+   integral part of the origin is added to left and top, which are
+   relative to the pen position.  Must be called with the GIL held,
+   and without holding the face lock.  The entry is only valid until
+   the next call into the cache. */
+ftpy_BitmapCache_Entry *ftpy_BitmapCache_get(
+    Py_BitmapCache *cache, Py_Face *face, FT_UInt glyph_index,
+    FT_Int32 load_flags, int render_mode, FT_Vector *origin,
+    FT_Int *left, FT_Int *top);
+
+
+int setup_BitmapCache(PyObject *m);
+
+
+extern PyTypeObject Py_BitmapCache_Type;
+
+
+#endif
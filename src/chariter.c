@@ -94,6 +94,7 @@ Py_CharIter_next(Py_CharIter *self)
 {
     Py_Face *face = (Py_Face *)self->base.owner;
 
+    FTPY_FACE_LOCK(face);
     if (self->started) {
         self->charcode = FT_Get_Next_Char(
             face->x, self->charcode, &self->glyph_index);
@@ -102,6 +103,7 @@ Py_CharIter_next(Py_CharIter *self)
             face->x, &self->glyph_index);
         self->started = 1;
     }
+    FTPY_FACE_UNLOCK(face);
 
     if (self->glyph_index) {
         return Py_BuildValue("kI", self->charcode, self->glyph_index);
@@ -0,0 +1,158 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "charmap_cache.h"
+
+
+#define BMP_SIZE 0x10000
+
+/* Shorter runs than this are mapped directly, unless the table for the
+   charmap has already been built */
+#define MIN_TABLE_RUN 256
+
+
+void
+ftpy_charmap_cache_done(ftpy_Charmap_Cache *cache)
+{
+    int i;
+
+    for (i = 0; i < cache->num_tables; ++i) {
+        free(cache->tables[i]);
+    }
+    free(cache->tables);
+    cache->tables = NULL;
+    cache->num_tables = 0;
+}
+
+
+static FT_Error
+build_table(FT_Face face, uint32_t **table)
+{
+    uint32_t *result;
+    FT_ULong charcode;
+    FT_UInt glyph_index;
+
+    result = calloc(BMP_SIZE, sizeof(uint32_t));
+    if (result == NULL) {
+        return FT_Err_Out_Of_Memory;
+    }
+
+    /* Walk only the mapped characters, rather than looking up every
+       codepoint */
+    charcode = FT_Get_First_Char(face, &glyph_index);
+    while (glyph_index != 0) {
+        if (charcode < BMP_SIZE) {
+            result[charcode] = glyph_index;
+        }
+        charcode = FT_Get_Next_Char(face, charcode, &glyph_index);
+    }
+
+    *table = result;
+    return 0;
+}
+
+
+static FT_Error
+get_table(
+    ftpy_Charmap_Cache *cache, FT_Face face, size_t n, uint32_t **table)
+{
+    int charmap_index;
+    uint32_t **tables;
+    FT_Error error;
+
+    *table = NULL;
+
+    if (face->charmap == NULL) {
+        return 0;
+    }
+
+    charmap_index = FT_Get_Charmap_Index(face->charmap);
+    if (charmap_index < 0 || charmap_index >= face->num_charmaps) {
+        return 0;
+    }
+
+    if (cache->num_tables < face->num_charmaps) {
+        tables = realloc(cache->tables, sizeof(uint32_t *) * face->num_charmaps);
+        if (tables == NULL) {
+            return FT_Err_Out_Of_Memory;
+        }
+        memset(tables + cache->num_tables, 0,
+               sizeof(uint32_t *) * (face->num_charmaps - cache->num_tables));
+        cache->tables = tables;
+        cache->num_tables = face->num_charmaps;
+    }
+
+    if (cache->tables[charmap_index] == NULL && n >= MIN_TABLE_RUN) {
+        error = build_table(face, &cache->tables[charmap_index]);
+        if (error) {
+            return error;
+        }
+    }
+
+    *table = cache->tables[charmap_index];
+    return 0;
+}
+
+
+FT_Error
+ftpy_charmap_cache_get_char_indices(
+    ftpy_Charmap_Cache *cache, FT_Face face,
+    const uint32_t *charcodes, size_t n, uint32_t *glyph_indices)
+{
+    uint32_t *table;
+    uint32_t charcode;
+    size_t i;
+    FT_Error error;
+
+    error = get_table(cache, face, n, &table);
+    if (error) {
+        return error;
+    }
+
+    if (table == NULL) {
+        for (i = 0; i < n; ++i) {
+            glyph_indices[i] = FT_Get_Char_Index(face, charcodes[i]);
+        }
+        return 0;
+    }
+
+    for (i = 0; i < n; ++i) {
+        charcode = charcodes[i];
+        if (charcode < BMP_SIZE) {
+            glyph_indices[i] = table[charcode];
+        } else {
+            glyph_indices[i] = FT_Get_Char_Index(face, charcode);
+        }
+    }
+
+    return 0;
+}
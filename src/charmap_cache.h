@@ -0,0 +1,66 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#ifndef __CHARMAP_CACHE_H__
+#define __CHARMAP_CACHE_H__
+
+#include <stdint.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+
+/*
+   Lookup tables from the Basic Multilingual Plane to glyph indices,
+   one for each of a face's charmaps, so that mapping long runs of
+   text doesn't need to search the charmap for every character.  Each
+   Face has one, which is protected by the face lock.
+
+   The tables are built the first time a long enough run of text is
+   mapped with each charmap, and are freed with the face.
+*/
+
+
+typedef struct {
+    uint32_t **tables;
+    int num_tables;
+} ftpy_Charmap_Cache;
+
+
+void ftpy_charmap_cache_done(ftpy_Charmap_Cache *cache);
+
+
+/* Maps charcodes in the encoding of the face's current charmap to
+   glyph indices. */
+FT_Error ftpy_charmap_cache_get_char_indices(
+    ftpy_Charmap_Cache *cache, FT_Face face,
+    const uint32_t *charcodes, size_t n, uint32_t *glyph_indices);
+
+
+#endif
@@ -0,0 +1,598 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#include "coverage.h"
+#include "doc/coverage.h"
+
+#include "pyutil.h"
+
+
+/* Returns the leaf for the given index, or where it would be
+   inserted */
+static size_t
+find_leaf(const uint32_t *leaves, size_t nleaves, uint32_t index)
+{
+    size_t lo = 0;
+    size_t hi = nleaves;
+    size_t mid;
+
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (leaves[mid * FTPY_COVERAGE_LEAF_WORDS] < index) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+
+static int
+add_char(ftpy_Coverage *coverage, size_t *capacity, uint32_t codepoint)
+{
+    uint32_t index = codepoint >> 8;
+    uint32_t *leaf;
+    uint32_t *leaves;
+    size_t i;
+
+    /* Charmaps are usually walked in order, so check the last leaf
+       first */
+    if (coverage->nleaves > 0 &&
+        coverage->leaves[(coverage->nleaves - 1) * FTPY_COVERAGE_LEAF_WORDS] == index) {
+        i = coverage->nleaves - 1;
+    } else {
+        i = find_leaf(coverage->leaves, coverage->nleaves, index);
+        if (i == coverage->nleaves ||
+            coverage->leaves[i * FTPY_COVERAGE_LEAF_WORDS] != index) {
+            if (coverage->nleaves == *capacity) {
+                *capacity = *capacity ? *capacity * 2 : 16;
+                leaves = realloc(
+                    coverage->leaves,
+                    *capacity * FTPY_COVERAGE_LEAF_WORDS * sizeof(uint32_t));
+                if (leaves == NULL) {
+                    return -1;
+                }
+                coverage->leaves = leaves;
+            }
+            memmove(coverage->leaves + (i + 1) * FTPY_COVERAGE_LEAF_WORDS,
+                    coverage->leaves + i * FTPY_COVERAGE_LEAF_WORDS,
+                    (coverage->nleaves - i) * FTPY_COVERAGE_LEAF_WORDS * sizeof(uint32_t));
+            memset(coverage->leaves + i * FTPY_COVERAGE_LEAF_WORDS, 0,
+                   FTPY_COVERAGE_LEAF_WORDS * sizeof(uint32_t));
+            coverage->leaves[i * FTPY_COVERAGE_LEAF_WORDS] = index;
+            coverage->nleaves++;
+        }
+    }
+
+    leaf = coverage->leaves + i * FTPY_COVERAGE_LEAF_WORDS + 1;
+    leaf[(codepoint & 0xff) >> 5] |= (uint32_t)1 << (codepoint & 0x1f);
+    return 0;
+}
+
+
+FT_Error
+ftpy_coverage_build(FT_Face face, ftpy_Coverage *coverage)
+{
+    FT_CharMap charmap = face->charmap;
+    FT_ULong charcode;
+    FT_UInt glyph_index;
+    size_t capacity = 0;
+    FT_Error error = 0;
+
+    coverage->leaves = NULL;
+    coverage->nleaves = 0;
+
+    if (FT_Select_Charmap(face, FT_ENCODING_UNICODE)) {
+        return 0;
+    }
+
+    charcode = FT_Get_First_Char(face, &glyph_index);
+    while (glyph_index != 0) {
+        if (charcode <= 0x10ffff && add_char(coverage, &capacity, charcode)) {
+            ftpy_coverage_done(coverage);
+            error = FT_Err_Out_Of_Memory;
+            break;
+        }
+        charcode = FT_Get_Next_Char(face, charcode, &glyph_index);
+    }
+
+    if (charmap != NULL) {
+        FT_Set_Charmap(face, charmap);
+    } else {
+        face->charmap = NULL;
+    }
+
+    return error;
+}
+
+
+void
+ftpy_coverage_done(ftpy_Coverage *coverage)
+{
+    free(coverage->leaves);
+    coverage->leaves = NULL;
+    coverage->nleaves = 0;
+}
+
+
+int
+ftpy_coverage_has_char(
+    const uint32_t *leaves, size_t nleaves, uint32_t codepoint)
+{
+    uint32_t index = codepoint >> 8;
+    size_t i;
+
+    i = find_leaf(leaves, nleaves, index);
+    if (i == nleaves || leaves[i * FTPY_COVERAGE_LEAF_WORDS] != index) {
+        return 0;
+    }
+
+    return (leaves[i * FTPY_COVERAGE_LEAF_WORDS + 1 + ((codepoint & 0xff) >> 5)] >>
+            (codepoint & 0x1f)) & 1;
+}
+
+
+/****************************************************************************
+ Object basics
+*/
+
+
+static PyTypeObject Py_Coverage_Type;
+
+
+static void
+Py_Coverage_dealloc(Py_Coverage* self)
+{
+    ftpy_coverage_done(&self->x);
+    Py_TYPE(self)->tp_clear((PyObject*)self);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+
+PyObject *
+Py_Coverage_cnew(ftpy_Coverage *coverage)
+{
+    Py_Coverage *self;
+
+    self = (Py_Coverage *)(&Py_Coverage_Type)->tp_alloc(&Py_Coverage_Type, 0);
+    if (self == NULL) {
+        ftpy_coverage_done(coverage);
+        return NULL;
+    }
+
+    self->base.owner = NULL;
+    self->x = *coverage;
+    self->shape[0] = (Py_ssize_t)coverage->nleaves;
+    self->shape[1] = FTPY_COVERAGE_LEAF_WORDS;
+    self->strides[0] = FTPY_COVERAGE_LEAF_WORDS * sizeof(uint32_t);
+    self->strides[1] = sizeof(uint32_t);
+
+    return (PyObject *)self;
+}
+
+
+static PyObject *
+Py_Coverage_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    Py_Coverage *self;
+
+    self = (Py_Coverage *)ftpy_Object_new(type, args, kwds);
+    if (self == NULL) {
+        return NULL;
+    }
+    self->x.leaves = NULL;
+    self->x.nleaves = 0;
+    return (PyObject *)self;
+}
+
+
+static int
+Py_Coverage_init(Py_Coverage *self, PyObject *args, PyObject *kwds)
+{
+    PyErr_SetString(
+        PyExc_RuntimeError,
+        "Coverage objects may not be instantiated directly.  "
+        "Use Face.coverage() instead.");
+    return -1;
+}
+
+
+/****************************************************************************
+ Helpers
+*/
+
+
+/* Looks up many characters, remembering the last leaf, since text
+   tends to stay within the same block */
+typedef struct {
+    const ftpy_Coverage *coverage;
+    uint32_t index;
+    const uint32_t *bits;
+} coverage_cursor;
+
+
+static int
+cursor_has_char(coverage_cursor *cursor, uint32_t codepoint)
+{
+    uint32_t index = codepoint >> 8;
+    size_t i;
+
+    if (cursor->bits == NULL || index != cursor->index) {
+        cursor->index = index;
+        i = find_leaf(cursor->coverage->leaves, cursor->coverage->nleaves, index);
+        if (i == cursor->coverage->nleaves ||
+            cursor->coverage->leaves[i * FTPY_COVERAGE_LEAF_WORDS] != index) {
+            cursor->bits = NULL;
+            return 0;
+        }
+        cursor->bits = cursor->coverage->leaves + i * FTPY_COVERAGE_LEAF_WORDS + 1;
+    }
+
+    return (cursor->bits[(codepoint & 0xff) >> 5] >> (codepoint & 0x1f)) & 1;
+}
+
+
+static int
+get_codepoint(PyObject *obj, uint32_t *codepoint)
+{
+    PyObject *decoded_text;
+    uint32_t *text;
+    Py_ssize_t text_size;
+    long value;
+
+    if (PyUnicode_Check(obj)) {
+        decoded_text = ftpy_PyUnicode_AsUTF32(obj, &text, &text_size);
+        if (decoded_text == NULL) {
+            return -1;
+        }
+        if (text_size != 1) {
+            Py_DECREF(decoded_text);
+            PyErr_SetString(PyExc_TypeError, "Expected a single character");
+            return -1;
+        }
+        *codepoint = text[0];
+        Py_DECREF(decoded_text);
+        return 0;
+    }
+
+    value = PyLong_AsLong(obj);
+    if (value == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+    if (value < 0 || value > 0x10ffff) {
+        PyErr_SetString(PyExc_ValueError, "Codepoint out of range");
+        return -1;
+    }
+    *codepoint = (uint32_t)value;
+    return 0;
+}
+
+
+/****************************************************************************
+ Methods
+*/
+
+
+#define COVERAGE_METHOD(name) DEF_METHOD(name, Coverage)
+#define COVERAGE_METHOD_NOARGS(name) DEF_METHOD_NOARGS(name, Coverage)
+
+
+static PyObject*
+Py_Coverage_has_char(Py_Coverage* self, PyObject* args, PyObject* kwds)
+{
+    PyObject *char_obj;
+    uint32_t codepoint;
+
+    const char* keywords[] = {"char", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "O:has_char", (char **)keywords, &char_obj)) {
+        return NULL;
+    }
+
+    if (get_codepoint(char_obj, &codepoint)) {
+        return NULL;
+    }
+
+    return PyBool_FromLong(
+        ftpy_coverage_has_char(self->x.leaves, self->x.nleaves, codepoint));
+}
+
+
+static PyObject*
+Py_Coverage_has_all(Py_Coverage* self, PyObject* args, PyObject* kwds)
+{
+    PyObject *text_obj;
+    PyObject *decoded_text;
+    uint32_t *text;
+    Py_ssize_t text_size;
+    Py_ssize_t i;
+    coverage_cursor cursor = {&self->x, 0, NULL};
+    int result = 1;
+
+    const char* keywords[] = {"text", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "O:has_all", (char **)keywords, &text_obj)) {
+        return NULL;
+    }
+
+    decoded_text = ftpy_PyUnicode_AsUTF32(text_obj, &text, &text_size);
+    if (decoded_text == NULL) {
+        return NULL;
+    }
+
+    for (i = 0; i < text_size; ++i) {
+        if (!cursor_has_char(&cursor, text[i])) {
+            result = 0;
+            break;
+        }
+    }
+
+    Py_DECREF(decoded_text);
+
+    return PyBool_FromLong(result);
+}
+
+
+static PyObject*
+Py_Coverage_missing(Py_Coverage* self, PyObject* args, PyObject* kwds)
+{
+    PyObject *text_obj;
+    PyObject *decoded_text;
+    uint32_t *text;
+    Py_ssize_t text_size;
+    Py_ssize_t i;
+    coverage_cursor cursor = {&self->x, 0, NULL};
+    ftpy_Coverage seen = {NULL, 0};
+    size_t seen_capacity = 0;
+    uint32_t *missing = NULL;
+    Py_ssize_t nmissing = 0;
+    PyObject *result = NULL;
+
+    const char* keywords[] = {"text", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "O:missing", (char **)keywords, &text_obj)) {
+        return NULL;
+    }
+
+    decoded_text = ftpy_PyUnicode_AsUTF32(text_obj, &text, &text_size);
+    if (decoded_text == NULL) {
+        return NULL;
+    }
+
+    missing = malloc(sizeof(uint32_t) * (text_size ? text_size : 1));
+    if (missing == NULL) {
+        PyErr_NoMemory();
+        goto exit;
+    }
+
+    for (i = 0; i < text_size; ++i) {
+        if (cursor_has_char(&cursor, text[i]) ||
+            ftpy_coverage_has_char(seen.leaves, seen.nleaves, text[i])) {
+            continue;
+        }
+        if (add_char(&seen, &seen_capacity, text[i])) {
+            PyErr_NoMemory();
+            goto exit;
+        }
+        missing[nmissing++] = text[i];
+    }
+
+    result = ftpy_PyUnicode_FromUTF32(missing, nmissing);
+
+ exit:
+
+    free(missing);
+    ftpy_coverage_done(&seen);
+    Py_DECREF(decoded_text);
+
+    return result;
+}
+
+
+static PyObject*
+Py_Coverage_ranges(Py_Coverage* self, PyObject* args, PyObject* kwds)
+{
+    PyObject *result;
+    PyObject *range;
+    size_t i;
+    uint32_t j;
+    uint32_t codepoint;
+    const uint32_t *leaf;
+    long start = -1;
+    long last = -2;
+
+    result = PyList_New(0);
+    if (result == NULL) {
+        return NULL;
+    }
+
+    for (i = 0; i < self->x.nleaves; ++i) {
+        leaf = self->x.leaves + i * FTPY_COVERAGE_LEAF_WORDS;
+        for (j = 0; j < 256; ++j) {
+            if (!((leaf[1 + (j >> 5)] >> (j & 0x1f)) & 1)) {
+                continue;
+            }
+            codepoint = (leaf[0] << 8) | j;
+            if ((long)codepoint != last + 1) {
+                if (start >= 0) {
+                    range = Py_BuildValue("(ll)", start, last);
+                    if (range == NULL || PyList_Append(result, range)) {
+                        Py_XDECREF(range);
+                        Py_DECREF(result);
+                        return NULL;
+                    }
+                    Py_DECREF(range);
+                }
+                start = codepoint;
+            }
+            last = codepoint;
+        }
+    }
+
+    if (start >= 0) {
+        range = Py_BuildValue("(ll)", start, last);
+        if (range == NULL || PyList_Append(result, range)) {
+            Py_XDECREF(range);
+            Py_DECREF(result);
+            return NULL;
+        }
+        Py_DECREF(range);
+    }
+
+    return result;
+}
+
+
+static PyMethodDef Py_Coverage_methods[] = {
+    COVERAGE_METHOD(has_all),
+    COVERAGE_METHOD(has_char),
+    COVERAGE_METHOD(missing),
+    COVERAGE_METHOD_NOARGS(ranges),
+    {NULL}  /* Sentinel */
+};
+
+
+/****************************************************************************
+ Sequence interface
+*/
+
+
+static Py_ssize_t
+Py_Coverage_len(Py_Coverage *self)
+{
+    Py_ssize_t count = 0;
+    size_t i;
+    int j;
+    uint32_t word;
+
+    for (i = 0; i < self->x.nleaves; ++i) {
+        for (j = 1; j < FTPY_COVERAGE_LEAF_WORDS; ++j) {
+            for (word = self->x.leaves[i * FTPY_COVERAGE_LEAF_WORDS + j];
+                 word != 0;
+                 word &= word - 1) {
+                ++count;
+            }
+        }
+    }
+
+    return count;
+}
+
+
+static int
+Py_Coverage_contains(Py_Coverage *self, PyObject *char_obj)
+{
+    uint32_t codepoint;
+
+    if (get_codepoint(char_obj, &codepoint)) {
+        return -1;
+    }
+
+    return ftpy_coverage_has_char(self->x.leaves, self->x.nleaves, codepoint);
+}
+
+
+static PySequenceMethods Py_Coverage_sequence_methods;
+
+
+/****************************************************************************
+ Buffer interface
+*/
+
+
+static int Py_Coverage_get_buffer(Py_Coverage *self, Py_buffer *view, int flags)
+{
+    static uint32_t empty = 0;
+
+    if (flags & PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "Coverage is read-only");
+        return -1;
+    }
+
+    Py_INCREF(self);
+    view->obj = (PyObject *)self;
+    view->buf = self->x.leaves ? (void *)self->x.leaves : (void *)&empty;
+    view->readonly = 1;
+    view->itemsize = sizeof(uint32_t);
+    view->format = "I";
+    view->len = self->shape[0] * self->strides[0];
+    view->internal = NULL;
+    view->ndim = 2;
+    view->shape = self->shape;
+    view->strides = self->strides;
+    view->suboffsets = NULL;
+
+    return 0;
+}
+
+
+static PyBufferProcs Py_Coverage_buffer_procs;
+
+
+/****************************************************************************
+ Setup
+*/
+
+
+int setup_Coverage(PyObject *m)
+{
+    memset(&Py_Coverage_sequence_methods, 0, sizeof(PySequenceMethods));
+    Py_Coverage_sequence_methods.sq_length = (lenfunc)Py_Coverage_len;
+    Py_Coverage_sequence_methods.sq_contains = (objobjproc)Py_Coverage_contains;
+
+    memset(&Py_Coverage_buffer_procs, 0, sizeof(PyBufferProcs));
+    Py_Coverage_buffer_procs.bf_getbuffer = (getbufferproc)Py_Coverage_get_buffer;
+
+    memset(&Py_Coverage_Type, 0, sizeof(PyTypeObject));
+    Py_Coverage_Type = (PyTypeObject) {
+        .tp_name = "freetypy.Coverage",
+        .tp_basicsize = sizeof(Py_Coverage),
+        .tp_dealloc = (destructor)Py_Coverage_dealloc,
+        .tp_as_sequence = &Py_Coverage_sequence_methods,
+        .tp_as_buffer = &Py_Coverage_buffer_procs,
+        .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC
+        #if !PY3K
+        | Py_TPFLAGS_HAVE_NEWBUFFER
+        #endif
+        ,
+        .tp_doc = doc_Coverage__init__,
+        .tp_methods = Py_Coverage_methods,
+        .tp_init = (initproc)Py_Coverage_init,
+        .tp_new = Py_Coverage_new
+    };
+
+    ftpy_setup_type(m, &Py_Coverage_Type);
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#ifndef __COVERAGE_H__
+#define __COVERAGE_H__
+
+#include "freetypy.h"
+
+#include <stdint.h>
+
+
+/*
+   The set of Unicode characters a face covers, as a sparse bitmap.
+   Like fontconfig's charsets, it is made of leaves covering 256
+   codepoints each, and only leaves with any characters are stored.
+
+   Each leaf is FTPY_COVERAGE_LEAF_WORDS uint32s: the codepoint >> 8,
+   followed by a 256-bit bitmap.  Leaves are sorted, so the packed
+   form can be stored and searched as is.
+*/
+
+
+#define FTPY_COVERAGE_LEAF_WORDS 9
+
+
+typedef struct {
+    uint32_t *leaves;
+    size_t nleaves;
+} ftpy_Coverage;
+
+
+/* Builds the coverage from the face's Unicode charmap.  The face's
+   selected charmap is restored afterward.  Faces without a Unicode
+   charmap have an empty coverage. */
+FT_Error ftpy_coverage_build(FT_Face face, ftpy_Coverage *coverage);
+
+
+void ftpy_coverage_done(ftpy_Coverage *coverage);
+
+
+int ftpy_coverage_has_char(
+    const uint32_t *leaves, size_t nleaves, uint32_t codepoint);
+
+
+/*
+   A Python wrapper around a coverage
+*/
+
+
+typedef struct {
+    ftpy_Object base;
+    ftpy_Coverage x;
+    Py_ssize_t shape[2];
+    Py_ssize_t strides[2];
+} Py_Coverage;
+
+
+/* Creates a new Coverage object, which takes ownership of the
+   coverage's leaves, even on failure. */
+PyObject *Py_Coverage_cnew(ftpy_Coverage *coverage);
+
+
+int setup_Coverage(PyObject *m);
+
+
+#endif
@@ -0,0 +1,48 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/array.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "array.h"
+
+char doc_Array__init__[261] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x41, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2d, 0x6f, 0x6e, 
+    0x6c, 0x79, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6f, 
+    0x66, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x62, 
+    0x79, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x6c, 0x6b, 0x0a, 0x6d, 
+    0x65, 0x74, 0x68, 0x6f, 0x64, 0x73, 0x2e, 0x0a, 0x0a, 0x60, 
+    0x41, 0x72, 0x72, 0x61, 0x79, 0x60, 0x20, 0x73, 0x75, 0x70, 
+    0x70, 0x6f, 0x72, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x50, 0x79, 0x74, 0x68, 0x6f, 0x6e, 0x20, 0x62, 0x75, 0x66, 
+    0x66, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x66, 
+    0x61, 0x63, 0x65, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x69, 0x74, 
+    0x20, 0x69, 0x73, 0x20, 0x65, 0x61, 0x73, 0x79, 0x20, 0x74, 
+    0x6f, 0x0a, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 
+    0x69, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x4e, 0x75, 
+    0x6d, 0x70, 0x79, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 
+    0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x63, 0x6f, 
+    0x70, 0x79, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x20, 0x46, 0x6f, 
+    0x72, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 
+    0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3e, 0x3e, 0x3e, 
+    0x20, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x6e, 0x75, 
+    0x6d, 0x70, 0x79, 0x20, 0x61, 0x73, 0x20, 0x6e, 0x70, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x3e, 0x3e, 0x3e, 0x20, 0x61, 0x20, 
+    0x3d, 0x20, 0x6e, 0x70, 0x2e, 0x61, 0x73, 0x61, 0x72, 0x72, 
+    0x61, 0x79, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x29, 0x0a, 
+    0x00, 
+};
+
+char doc_typecodes[14] = {
+    0x62, 0x42, 0x75, 0x68, 0x48, 0x69, 0x49, 0x6c, 0x4c, 0x71, 
+    0x51, 0x66, 0x64, 0x00, 
+};
+
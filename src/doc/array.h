@@ -0,0 +1,14 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/array.py.
+*/
+
+#ifndef __DOC_ARRAY_H__
+#define __DOC_ARRAY_H__
+extern char doc_Array__init__[261];
+extern char doc_typecodes[14];
+
+#endif
+
@@ -0,0 +1,156 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/bbox.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "bbox.h"
+
+char doc_BBox__init__[696] = {
+    0x41, 0x6e, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 
+    0x27, 0x73, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 
+    0x67, 0x20, 0x62, 0x6f, 0x78, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 
+    0x65, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 
+    0x20, 0x62, 0x6f, 0x78, 0x20, 0x69, 0x73, 0x20, 0x73, 0x70, 
+    0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x77, 0x69, 
+    0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6f, 
+    0x72, 0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x73, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x6f, 0x77, 0x65, 
+    0x72, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x0a, 0x61, 0x6e, 0x64, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x70, 0x70, 0x65, 0x72, 
+    0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x63, 0x6f, 0x72, 
+    0x6e, 0x65, 0x72, 0x2e, 0x20, 0x49, 0x6e, 0x20, 0x50, 0x6f, 
+    0x73, 0x74, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x2c, 0x20, 
+    0x74, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+    0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6f, 0x66, 0x74, 
+    0x65, 0x6e, 0x0a, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 
+    0x60, 0x60, 0x28, 0x6c, 0x6c, 0x78, 0x2c, 0x20, 0x6c, 0x6c, 
+    0x79, 0x29, 0x60, 0x60, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x60, 
+    0x60, 0x28, 0x75, 0x72, 0x78, 0x2c, 0x20, 0x75, 0x72, 0x79, 
+    0x29, 0x60, 0x60, 0x2c, 0x20, 0x72, 0x65, 0x73, 0x70, 0x65, 
+    0x63, 0x74, 0x69, 0x76, 0x65, 0x6c, 0x79, 0x2e, 0x0a, 0x0a, 
+    0x49, 0x66, 0x20, 0x60, 0x79, 0x5f, 0x6d, 0x69, 0x6e, 0x60, 
+    0x20, 0x69, 0x73, 0x20, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x69, 
+    0x76, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x73, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x27, 0x73, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 
+    0x65, 0x72, 0x2e, 0x20, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x77, 
+    0x69, 0x73, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x6e, 
+    0x27, 0x74, 0x20, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 
+    0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x20, 0x74, 0x68, 0x65, 
+    0x0a, 0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 
+    0x20, 0x53, 0x69, 0x6d, 0x69, 0x6c, 0x61, 0x72, 0x6c, 0x79, 
+    0x2c, 0x20, 0x69, 0x66, 0x20, 0x60, 0x79, 0x5f, 0x6d, 0x61, 
+    0x78, 0x60, 0x20, 0x69, 0x73, 0x20, 0x70, 0x6f, 0x73, 0x69, 
+    0x74, 0x69, 0x76, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x67, 0x69, 0x76, 
+    0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x27, 0x73, 0x20, 0x61, 0x73, 0x63, 0x65, 0x6e, 
+    0x64, 0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x60, 0x78, 0x5f, 0x6d, 
+    0x69, 0x6e, 0x60, 0x20, 0x67, 0x69, 0x76, 0x65, 0x73, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 
+    0x6e, 0x74, 0x61, 0x6c, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 
+    0x6e, 0x63, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x27, 0x73, 
+    0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x20, 0x74, 0x6f, 
+    0x20, 0x74, 0x68, 0x65, 0x0a, 0x6c, 0x65, 0x66, 0x74, 0x20, 
+    0x65, 0x64, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x27, 0x73, 0x20, 
+    0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 
+    0x6f, 0x78, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x60, 0x78, 0x5f, 
+    0x6d, 0x69, 0x6e, 0x60, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x65, 
+    0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2c, 0x20, 0x74, 0x68, 
+    0x65, 0x0a, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x65, 0x78, 
+    0x74, 0x65, 0x6e, 0x64, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x6f, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 
+    0x6e, 0x2e, 0x0a, 0x0a, 0x60, 0x42, 0x42, 0x6f, 0x78, 0x60, 
+    0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6b, 
+    0x73, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x50, 0x79, 0x74, 
+    0x68, 0x6f, 0x6e, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 
+    0x63, 0x65, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x69, 0x74, 0x20, 
+    0x69, 0x73, 0x20, 0x65, 0x61, 0x73, 0x79, 0x20, 0x74, 0x6f, 
+    0x20, 0x64, 0x6f, 0x3a, 0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x78, 0x5f, 0x6d, 0x69, 0x6e, 0x2c, 0x20, 0x79, 0x5f, 
+    0x6d, 0x69, 0x6e, 0x2c, 0x20, 0x78, 0x5f, 0x6d, 0x61, 0x78, 
+    0x2c, 0x20, 0x79, 0x5f, 0x6d, 0x61, 0x78, 0x20, 0x3d, 0x20, 
+    0x62, 0x62, 0x6f, 0x78, 0x0a, 0x00, 
+};
+
+char doc_BBox_ascent[83] = {
+    0x54, 0x68, 0x65, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6f, 
+    0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6f, 0x78, 
+    0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 
+    0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 
+    0x61, 0x6e, 0x20, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x0a, 0x66, 
+    0x6f, 0x72, 0x20, 0x60, 0x79, 0x5f, 0x6d, 0x61, 0x78, 0x60, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_BBox_depth[82] = {
+    0x54, 0x68, 0x65, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6f, 0x75, 
+    0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6f, 0x78, 0x20, 
+    0x62, 0x65, 0x6c, 0x6f, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x20, 
+    0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 
+    0x6e, 0x20, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x0a, 0x66, 0x6f, 
+    0x72, 0x20, 0x60, 0x79, 0x5f, 0x6d, 0x69, 0x6e, 0x60, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_BBox_height[53] = {
+    0x54, 0x68, 0x65, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6f, 
+    0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6f, 0x78, 
+    0x20, 0x28, 0x60, 0x60, 0x79, 0x5f, 0x6d, 0x61, 0x78, 0x20, 
+    0x2d, 0x20, 0x79, 0x5f, 0x6d, 0x69, 0x6e, 0x60, 0x60, 0x29, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_BBox_width[52] = {
+    0x54, 0x68, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6f, 0x75, 
+    0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6f, 0x78, 0x20, 
+    0x28, 0x60, 0x60, 0x78, 0x5f, 0x6d, 0x61, 0x78, 0x20, 0x2d, 
+    0x20, 0x78, 0x5f, 0x6d, 0x69, 0x6e, 0x60, 0x60, 0x29, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_BBox_x_max[38] = {
+    0x54, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 
+    0x6e, 0x74, 0x61, 0x6c, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 
+    0x75, 0x6d, 0x20, 0x28, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2d, 
+    0x6d, 0x6f, 0x73, 0x74, 0x29, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_BBox_x_min[37] = {
+    0x54, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 
+    0x6e, 0x74, 0x61, 0x6c, 0x20, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 
+    0x75, 0x6d, 0x20, 0x28, 0x6c, 0x65, 0x66, 0x74, 0x2d, 0x6d, 
+    0x6f, 0x73, 0x74, 0x29, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_BBox_y_max[34] = {
+    0x54, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 
+    0x61, 0x6c, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 
+    0x20, 0x28, 0x74, 0x6f, 0x70, 0x2d, 0x6d, 0x6f, 0x73, 0x74, 
+    0x29, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_BBox_y_min[37] = {
+    0x54, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 
+    0x61, 0x6c, 0x20, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 
+    0x20, 0x28, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x2d, 0x6d, 
+    0x6f, 0x73, 0x74, 0x29, 0x2e, 0x0a, 0x00, 
+};
+
@@ -0,0 +1,21 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/bbox.py.
+*/
+
+#ifndef __DOC_BBOX_H__
+#define __DOC_BBOX_H__
+extern char doc_BBox__init__[696];
+extern char doc_BBox_ascent[83];
+extern char doc_BBox_depth[82];
+extern char doc_BBox_height[53];
+extern char doc_BBox_width[52];
+extern char doc_BBox_x_max[38];
+extern char doc_BBox_x_min[37];
+extern char doc_BBox_y_max[34];
+extern char doc_BBox_y_min[37];
+
+#endif
+
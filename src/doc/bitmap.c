@@ -0,0 +1,383 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/bitmap.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "bitmap.h"
+
+char doc_Bitmap__init__[196] = {
+    0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x73, 0x20, 
+    0x61, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x72, 
+    0x61, 0x73, 0x74, 0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x60, 0x42, 
+    0x69, 0x74, 0x6d, 0x61, 0x70, 0x60, 0x20, 0x73, 0x75, 0x70, 
+    0x70, 0x6f, 0x72, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x50, 0x79, 0x74, 0x68, 0x6f, 0x6e, 0x20, 0x62, 0x75, 0x66, 
+    0x66, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x66, 
+    0x61, 0x63, 0x65, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x69, 0x74, 
+    0x20, 0x69, 0x73, 0x20, 0x65, 0x61, 0x73, 0x79, 0x20, 0x74, 
+    0x6f, 0x0a, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 
+    0x69, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x4e, 0x75, 
+    0x6d, 0x70, 0x79, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2e, 
+    0x20, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6d, 
+    0x70, 0x6c, 0x65, 0x3a, 0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x3e, 0x3e, 0x3e, 0x20, 0x69, 0x6d, 0x70, 0x6f, 0x72, 
+    0x74, 0x20, 0x6e, 0x75, 0x6d, 0x70, 0x79, 0x20, 0x61, 0x73, 
+    0x20, 0x6e, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3e, 0x3e, 
+    0x3e, 0x20, 0x61, 0x20, 0x3d, 0x20, 0x6e, 0x70, 0x2e, 0x61, 
+    0x73, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x62, 0x69, 0x74, 
+    0x6d, 0x61, 0x70, 0x29, 0x0a, 0x00, 
+};
+
+char doc_Bitmap_buffer[194] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 
+    0x74, 0x6d, 0x61, 0x70, 0x27, 0x73, 0x20, 0x63, 0x6f, 0x6e, 
+    0x74, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x73, 0x20, 0x61, 
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x0a, 0x0a, 
+    0x49, 0x6e, 0x20, 0x6d, 0x6f, 0x73, 0x74, 0x20, 0x63, 0x61, 
+    0x73, 0x65, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 
+    0x72, 0x65, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x20, 0x6d, 
+    0x65, 0x74, 0x68, 0x6f, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x67, 
+    0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 
+    0x61, 0x20, 0x69, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x61, 
+    0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x60, 0x42, 0x69, 
+    0x74, 0x6d, 0x61, 0x70, 0x60, 0x20, 0x6f, 0x62, 0x6a, 0x65, 
+    0x63, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x6d, 0x65, 
+    0x6d, 0x6f, 0x72, 0x79, 0x76, 0x69, 0x65, 0x77, 0x2c, 0x20, 
+    0x73, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 
+    0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x61, 0x6c, 0x73, 0x6f, 
+    0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 
+    0x20, 0x61, 0x6e, 0x64, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x20, 
+    0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Bitmap_convert[437] = {
+    0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x61, 0x20, 
+    0x60, 0x42, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x60, 0x20, 0x74, 
+    0x6f, 0x20, 0x38, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x70, 
+    0x65, 0x72, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x2e, 0x20, 
+    0x20, 0x47, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x61, 0x20, 0x60, 
+    0x42, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x60, 0x20, 0x77, 0x69, 
+    0x74, 0x68, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x0a, 0x31, 
+    0x62, 0x70, 0x70, 0x2c, 0x20, 0x32, 0x62, 0x70, 0x70, 0x2c, 
+    0x20, 0x34, 0x62, 0x70, 0x70, 0x2c, 0x20, 0x6f, 0x72, 0x20, 
+    0x38, 0x62, 0x70, 0x70, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 
+    0x72, 0x74, 0x73, 0x20, 0x69, 0x74, 0x20, 0x74, 0x6f, 0x20, 
+    0x6f, 0x6e, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 
+    0x65, 0x70, 0x74, 0x68, 0x20, 0x38, 0x62, 0x70, 0x70, 0x2c, 
+    0x20, 0x6d, 0x61, 0x6b, 0x69, 0x6e, 0x67, 0x0a, 0x74, 0x68, 
+    0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 
+    0x66, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x74, 
+    0x65, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x6c, 0x69, 0x6e, 
+    0x65, 0x20, 0x28, 0x61, 0x2e, 0x6b, 0x2e, 0x61, 0x2e, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0xe2, 0x80, 0x98, 0x70, 0x69, 0x74, 
+    0x63, 0x68, 0xe2, 0x80, 0x99, 0x29, 0x20, 0x61, 0x20, 0x6d, 
+    0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x65, 0x20, 0x6f, 0x66, 
+    0x0a, 0x60, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x6d, 0x65, 0x6e, 
+    0x74, 0x60, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 
+    0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x61, 0x6c, 0x69, 
+    0x67, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x3a, 0x20, 0x69, 
+    0x6e, 0x74, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+    0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 
+    0x20, 0x70, 0x69, 0x74, 0x63, 0x68, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x6d, 0x75, 0x6c, 0x74, 
+    0x69, 0x70, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x69, 0x73, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 
+    0x65, 0x72, 0x2e, 0x20, 0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+    0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x31, 0x2c, 0x20, 0x32, 
+    0x2c, 0x20, 0x6f, 0x72, 0x20, 0x34, 0x2e, 0x0a, 0x0a, 0x52, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x74, 0x61, 0x72, 0x67, 0x65, 
+    0x74, 0x20, 0x3a, 0x20, 0x42, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x62, 
+    0x69, 0x74, 0x6d, 0x61, 0x70, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 
+    0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 
+    0x38, 0x62, 0x70, 0x70, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Bitmap_num_grays[95] = {
+    0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 
+    0x20, 0x6f, 0x66, 0x20, 0x67, 0x72, 0x61, 0x79, 0x20, 0x6c, 
+    0x65, 0x76, 0x65, 0x6c, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 
+    0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 
+    0x74, 0x6d, 0x61, 0x70, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 
+    0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x69, 0x73, 0x20, 
+    0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x75, 0x73, 0x65, 0x64, 0x0a, 
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x60, 0x50, 0x49, 0x58, 0x45, 
+    0x4c, 0x5f, 0x4d, 0x4f, 0x44, 0x45, 0x2e, 0x47, 0x52, 0x41, 
+    0x59, 0x60, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Bitmap_pitch[662] = {
+    0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 
+    0x20, 0x6f, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 
+    0x74, 0x61, 0x6b, 0x65, 0x6e, 0x20, 0x62, 0x79, 0x20, 0x6f, 
+    0x6e, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 
+    0x72, 0x6f, 0x77, 0x2e, 0x0a, 0x0a, 0x49, 0x6e, 0x63, 0x6c, 
+    0x75, 0x64, 0x65, 0x73, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 
+    0x6e, 0x67, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x70, 
+    0x69, 0x74, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x70, 0x6f, 
+    0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x20, 0x77, 0x68, 0x65, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 
+    0x61, 0x70, 0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x20, 0xe2, 
+    0x80, 0x98, 0x64, 0x6f, 0x77, 0x6e, 0xe2, 0x80, 0x99, 0x20, 
+    0x66, 0x6c, 0x6f, 0x77, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x6e, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x0a, 0x77, 
+    0x68, 0x65, 0x6e, 0x20, 0x69, 0x74, 0x20, 0x68, 0x61, 0x73, 
+    0x20, 0x61, 0x6e, 0x20, 0xe2, 0x80, 0x98, 0x75, 0x70, 0xe2, 
+    0x80, 0x99, 0x20, 0x66, 0x6c, 0x6f, 0x77, 0x2e, 0x20, 0x49, 
+    0x6e, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x63, 0x61, 0x73, 0x65, 
+    0x73, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x69, 0x74, 
+    0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x6f, 
+    0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x61, 
+    0x64, 0x64, 0x0a, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x62, 0x69, 
+    0x74, 0x6d, 0x61, 0x70, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 
+    0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x6f, 0x72, 0x64, 0x65, 
+    0x72, 0x20, 0x74, 0x6f, 0x20, 0x67, 0x6f, 0x20, 0x64, 0x6f, 
+    0x77, 0x6e, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x72, 0x6f, 0x77, 
+    0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x20, 0x74, 0x68, 
+    0x61, 0x74, 0x20, 0xe2, 0x80, 0x98, 0x70, 0x61, 0x64, 0x64, 
+    0x69, 0x6e, 0x67, 0xe2, 0x80, 0x99, 0x20, 0x6d, 0x65, 0x61, 
+    0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x6c, 0x69, 
+    0x67, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 
+    0x61, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x74, 
+    0x6f, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x62, 
+    0x6f, 0x72, 0x64, 0x65, 0x72, 0x2c, 0x0a, 0x61, 0x6e, 0x64, 
+    0x20, 0x46, 0x72, 0x65, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 
+    0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x61, 
+    0x6c, 0x69, 0x67, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x65, 0x73, 0x74, 
+    0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 
+    0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x0a, 0x76, 0x61, 
+    0x6c, 0x75, 0x65, 0x2e, 0x0a, 0x0a, 0x46, 0x6f, 0x72, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x42, 0x2f, 0x57, 0x20, 0x72, 0x61, 
+    0x73, 0x74, 0x65, 0x72, 0x69, 0x7a, 0x65, 0x72, 0x2c, 0x20, 
+    0x60, 0x70, 0x69, 0x74, 0x63, 0x68, 0x60, 0x20, 0x69, 0x73, 
+    0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x61, 0x6e, 
+    0x20, 0x65, 0x76, 0x65, 0x6e, 0x20, 0x6e, 0x75, 0x6d, 0x62, 
+    0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x54, 0x6f, 0x20, 0x63, 0x68, 
+    0x61, 0x6e, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 
+    0x69, 0x74, 0x63, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 
+    0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x28, 0x73, 0x61, 
+    0x79, 0x2c, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x61, 0x6b, 0x65, 
+    0x20, 0x69, 0x74, 0x20, 0x61, 0x20, 0x6d, 0x75, 0x6c, 0x74, 
+    0x69, 0x70, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x34, 0x29, 
+    0x2c, 0x20, 0x75, 0x73, 0x65, 0x0a, 0x60, 0x42, 0x69, 0x74, 
+    0x6d, 0x61, 0x70, 0x2e, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 
+    0x74, 0x60, 0x2e, 0x20, 0x41, 0x6c, 0x74, 0x65, 0x72, 0x6e, 
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x6c, 0x79, 0x2c, 0x20, 0x79, 
+    0x6f, 0x75, 0x20, 0x6d, 0x69, 0x67, 0x68, 0x74, 0x20, 0x75, 
+    0x73, 0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 
+    0x6b, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x73, 0x20, 0x74, 0x6f, 0x0a, 0x64, 0x69, 0x72, 0x65, 0x63, 
+    0x74, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 
+    0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x70, 
+    0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x27, 
+    0x73, 0x20, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_Bitmap_pixel_mode[52] = {
+    0x54, 0x68, 0x65, 0x20, 0x60, 0x50, 0x49, 0x58, 0x45, 0x4c, 
+    0x5f, 0x4d, 0x4f, 0x44, 0x45, 0x60, 0x2c, 0x20, 0x69, 0x2e, 
+    0x65, 0x2e, 0x2c, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x70, 0x69, 
+    0x78, 0x65, 0x6c, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x61, 
+    0x72, 0x65, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x64, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_Bitmap_rows[28] = {
+    0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 
+    0x20, 0x6f, 0x66, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x20, 0x72, 0x6f, 0x77, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Bitmap_to_list[49] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 
+    0x74, 0x6f, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x73, 0x74, 0x65, 
+    0x64, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Bitmap_width[37] = {
+    0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 
+    0x20, 0x6f, 0x66, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 
+    0x20, 0x69, 0x6e, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x20, 0x72, 0x6f, 0x77, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_PIXEL_MODE[1608] = {
+    0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x20, 
+    0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 
+    0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x60, 
+    0x42, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x60, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x4d, 0x4f, 0x4e, 0x4f, 0x60, 0x3a, 0x20, 
+    0x41, 0x20, 0x6d, 0x6f, 0x6e, 0x6f, 0x63, 0x68, 0x72, 0x6f, 
+    0x6d, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x2c, 
+    0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x31, 0x20, 0x62, 
+    0x69, 0x74, 0x20, 0x70, 0x65, 0x72, 0x20, 0x70, 0x69, 0x78, 
+    0x65, 0x6c, 0x2e, 0x20, 0x4e, 0x6f, 0x74, 0x65, 0x20, 0x74, 
+    0x68, 0x61, 0x74, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 
+    0x0a, 0x20, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x74, 0x6f, 
+    0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x6d, 0x6f, 0x73, 
+    0x74, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 
+    0x61, 0x6e, 0x74, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20, 
+    0x28, 0x4d, 0x53, 0x42, 0x29, 0x2c, 0x20, 0x77, 0x68, 0x69, 
+    0x63, 0x68, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x74, 
+    0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 
+    0x6c, 0x65, 0x66, 0x74, 0x2d, 0x6d, 0x6f, 0x73, 0x74, 0x20, 
+    0x70, 0x69, 0x78, 0x65, 0x6c, 0x20, 0x69, 0x6e, 0x20, 0x61, 
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x68, 0x61, 0x73, 0x20, 
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x31, 0x32, 0x38, 0x2e, 
+    0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x47, 0x52, 0x41, 0x59, 0x60, 
+    0x3a, 0x20, 0x41, 0x6e, 0x20, 0x38, 0x2d, 0x62, 0x69, 0x74, 
+    0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x2c, 0x20, 0x67, 
+    0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x75, 
+    0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x70, 
+    0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x74, 
+    0x69, 0x2d, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x65, 0x64, 0x0a, 
+    0x20, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6d, 
+    0x61, 0x67, 0x65, 0x73, 0x2e, 0x20, 0x45, 0x61, 0x63, 0x68, 
+    0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x20, 0x69, 0x73, 0x20, 
+    0x73, 0x74, 0x6f, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 
+    0x6f, 0x6e, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x2e, 0x20, 
+    0x4e, 0x6f, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 
+    0x0a, 0x20, 0x20, 0x6f, 0x66, 0x20, 0xe2, 0x80, 0x98, 0x67, 
+    0x72, 0x61, 0x79, 0xe2, 0x80, 0x99, 0x20, 0x6c, 0x65, 0x76, 
+    0x65, 0x6c, 0x73, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x6f, 
+    0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0xe2, 0x80, 0x98, 0x6e, 0x75, 0x6d, 0x5f, 0x67, 0x72, 
+    0x61, 0x79, 0x73, 0xe2, 0x80, 0x99, 0x20, 0x66, 0x69, 0x65, 
+    0x6c, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x42, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x0a, 0x20, 0x20, 0x73, 
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x28, 
+    0x69, 0x74, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 
+    0x6c, 0x79, 0x20, 0x69, 0x73, 0x20, 0x32, 0x35, 0x36, 0x29, 
+    0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x47, 0x52, 0x41, 0x59, 
+    0x32, 0x60, 0x3a, 0x20, 0x41, 0x20, 0x32, 0x2d, 0x62, 0x69, 
+    0x74, 0x20, 0x70, 0x65, 0x72, 0x20, 0x70, 0x69, 0x78, 0x65, 
+    0x6c, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x2c, 0x20, 
+    0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 
+    0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x20, 0x65, 0x6d, 
+    0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x61, 
+    0x6e, 0x74, 0x69, 0x2d, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x65, 
+    0x64, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x73, 0x20, 
+    0x69, 0x6e, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x66, 0x69, 
+    0x6c, 0x65, 0x73, 0x20, 0x61, 0x63, 0x63, 0x6f, 0x72, 0x64, 
+    0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x4f, 0x70, 0x65, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x0a, 
+    0x20, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x57, 0x65, 0x20, 
+    0x68, 0x61, 0x76, 0x65, 0x6e, 0x27, 0x74, 0x20, 0x66, 0x6f, 
+    0x75, 0x6e, 0x64, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6e, 0x67, 
+    0x6c, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x75, 0x73, 
+    0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x68, 
+    0x6f, 0x77, 0x65, 0x76, 0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x2d, 
+    0x20, 0x60, 0x47, 0x52, 0x41, 0x59, 0x34, 0x60, 0x3a, 0x20, 
+    0x41, 0x20, 0x34, 0x2d, 0x62, 0x69, 0x74, 0x20, 0x70, 0x65, 
+    0x72, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x20, 0x62, 0x69, 
+    0x74, 0x6d, 0x61, 0x70, 0x2c, 0x20, 0x72, 0x65, 0x70, 0x72, 
+    0x65, 0x73, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x65, 
+    0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x0a, 0x20, 0x20, 
+    0x61, 0x6e, 0x74, 0x69, 0x2d, 0x61, 0x6c, 0x69, 0x61, 0x73, 
+    0x65, 0x64, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x73, 
+    0x20, 0x69, 0x6e, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x66, 
+    0x69, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x63, 0x63, 0x6f, 0x72, 
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x54, 0x79, 0x70, 0x65, 
+    0x0a, 0x20, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x57, 0x65, 
+    0x20, 0x68, 0x61, 0x76, 0x65, 0x6e, 0x27, 0x74, 0x20, 0x66, 
+    0x6f, 0x75, 0x6e, 0x64, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6e, 
+    0x67, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x75, 
+    0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2c, 0x0a, 0x20, 0x20, 
+    0x68, 0x6f, 0x77, 0x65, 0x76, 0x65, 0x72, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x4c, 0x43, 0x44, 0x60, 0x3a, 0x20, 0x41, 
+    0x6e, 0x20, 0x38, 0x2d, 0x62, 0x69, 0x74, 0x20, 0x62, 0x69, 
+    0x74, 0x6d, 0x61, 0x70, 0x2c, 0x20, 0x72, 0x65, 0x70, 0x72, 
+    0x65, 0x73, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x52, 
+    0x47, 0x42, 0x20, 0x6f, 0x72, 0x20, 0x42, 0x47, 0x52, 0x20, 
+    0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 0x74, 0x65, 0x64, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x0a, 0x20, 0x20, 0x69, 0x6d, 
+    0x61, 0x67, 0x65, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 
+    0x79, 0x20, 0x6f, 0x6e, 0x20, 0x4c, 0x43, 0x44, 0x20, 0x64, 
+    0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x73, 0x3b, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 
+    0x69, 0x73, 0x20, 0x74, 0x68, 0x72, 0x65, 0x65, 0x20, 0x74, 
+    0x69, 0x6d, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x77, 0x69, 0x64, 
+    0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6d, 0x61, 
+    0x67, 0x65, 0x2e, 0x20, 0x53, 0x65, 0x65, 0x20, 0x61, 0x6c, 
+    0x73, 0x6f, 0x20, 0x60, 0x52, 0x45, 0x4e, 0x44, 0x45, 0x52, 
+    0x5f, 0x4d, 0x4f, 0x44, 0x45, 0x2e, 0x4c, 0x43, 0x44, 0x60, 
+    0x2e, 0x20, 0x20, 0x4f, 0x6e, 0x0a, 0x20, 0x20, 0x6d, 0x61, 
+    0x6e, 0x79, 0x20, 0x46, 0x72, 0x65, 0x65, 0x54, 0x79, 0x70, 
+    0x65, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x73, 0x2c, 0x20, 
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x77, 
+    0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x64, 0x69, 0x73, 
+    0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x64, 0x75, 0x65, 0x20, 
+    0x74, 0x6f, 0x0a, 0x20, 0x20, 0x70, 0x61, 0x74, 0x65, 0x6e, 
+    0x74, 0x20, 0x72, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 
+    0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x77, 
+    0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 
+    0x69, 0x6e, 0x67, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x0a, 0x20, 
+    0x20, 0x67, 0x72, 0x61, 0x79, 0x73, 0x63, 0x61, 0x6c, 0x65, 
+    0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4c, 0x43, 0x44, 0x5f, 
+    0x56, 0x60, 0x3a, 0x20, 0x41, 0x6e, 0x20, 0x38, 0x2d, 0x62, 
+    0x69, 0x74, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x2c, 
+    0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 
+    0x69, 0x6e, 0x67, 0x20, 0x52, 0x47, 0x42, 0x20, 0x6f, 0x72, 
+    0x20, 0x42, 0x47, 0x52, 0x20, 0x64, 0x65, 0x63, 0x69, 0x6d, 
+    0x61, 0x74, 0x65, 0x64, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x0a, 0x20, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x73, 0x20, 
+    0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 
+    0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x20, 0x6f, 0x6e, 0x20, 
+    0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x64, 0x20, 0x4c, 0x43, 
+    0x44, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x73, 
+    0x3b, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 
+    0x61, 0x70, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x72, 0x65, 
+    0x65, 0x0a, 0x20, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 
+    0x74, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x72, 0x69, 0x67, 
+    0x69, 0x6e, 0x61, 0x6c, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2e, 0x20, 0x53, 0x65, 
+    0x65, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x0a, 0x20, 0x20, 0x60, 
+    0x52, 0x45, 0x4e, 0x44, 0x45, 0x52, 0x5f, 0x4d, 0x4f, 0x44, 
+    0x45, 0x2e, 0x4c, 0x43, 0x44, 0x5f, 0x56, 0x60, 0x2e, 0x20, 
+    0x4f, 0x6e, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x46, 0x72, 
+    0x65, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x62, 0x75, 0x69, 
+    0x6c, 0x64, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 
+    0x69, 0x74, 0x79, 0x0a, 0x20, 0x20, 0x77, 0x69, 0x6c, 0x6c, 
+    0x20, 0x62, 0x65, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
+    0x65, 0x64, 0x20, 0x64, 0x75, 0x65, 0x20, 0x74, 0x6f, 0x20, 
+    0x70, 0x61, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x72, 0x65, 0x73, 
+    0x74, 0x72, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 
+    0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 
+    0x63, 0x61, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 
+    0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x69, 0x6e, 0x67, 
+    0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x77, 0x69, 
+    0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x67, 0x72, 0x61, 0x79, 
+    0x73, 0x63, 0x61, 0x6c, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
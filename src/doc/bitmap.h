@@ -0,0 +1,22 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/bitmap.py.
+*/
+
+#ifndef __DOC_BITMAP_H__
+#define __DOC_BITMAP_H__
+extern char doc_Bitmap__init__[196];
+extern char doc_Bitmap_buffer[194];
+extern char doc_Bitmap_convert[437];
+extern char doc_Bitmap_num_grays[95];
+extern char doc_Bitmap_pitch[662];
+extern char doc_Bitmap_pixel_mode[52];
+extern char doc_Bitmap_rows[28];
+extern char doc_Bitmap_to_list[49];
+extern char doc_Bitmap_width[37];
+extern char doc_PIXEL_MODE[1608];
+
+#endif
+
@@ -0,0 +1,21 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/bitmap_cache.py.
+*/
+
+#ifndef __DOC_BITMAP_CACHE_H__
+#define __DOC_BITMAP_CACHE_H__
+extern char doc_BitmapCache__init__[1027];
+extern char doc_BitmapCache_clear[85];
+extern char doc_BitmapCache_count[37];
+extern char doc_BitmapCache_hits[54];
+extern char doc_BitmapCache_max_bytes[136];
+extern char doc_BitmapCache_misses[60];
+extern char doc_BitmapCache_nbytes[73];
+extern char doc_BitmapCache_render[997];
+extern char doc_BitmapCache_subpixels[58];
+
+#endif
+
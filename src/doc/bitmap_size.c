@@ -0,0 +1,78 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/bitmap_size.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "bitmap_size.h"
+
+char doc_Bitmap_Size__init__[92] = {
+    0x54, 0x68, 0x65, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 
+    0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x62, 0x69, 0x74, 
+    0x6d, 0x61, 0x70, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6b, 0x65, 
+    0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x62, 0x69, 0x74, 0x6d, 
+    0x61, 0x70, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x2e, 
+    0x0a, 0x0a, 0x49, 0x74, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 
+    0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x60, 0x46, 0x61, 
+    0x63, 0x65, 0x2e, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 
+    0x6c, 0x65, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x60, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_Bitmap_Size_height[93] = {
+    0x54, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 
+    0x61, 0x6c, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 
+    0x65, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x69, 0x78, 0x65, 
+    0x6c, 0x73, 0x2c, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 
+    0x6e, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x73, 
+    0x65, 0x63, 0x75, 0x74, 0x69, 0x76, 0x65, 0x0a, 0x62, 0x61, 
+    0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x2e, 0x20, 0x49, 
+    0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 
+    0x73, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Bitmap_Size_size[85] = {
+    0x54, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x6d, 0x69, 0x6e, 0x61, 
+    0x6c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6b, 0x65, 
+    0x20, 0x69, 0x6e, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 
+    0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 
+    0x73, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 
+    0x65, 0x6c, 0x64, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 
+    0x0a, 0x76, 0x65, 0x72, 0x79, 0x20, 0x75, 0x73, 0x65, 0x66, 
+    0x75, 0x6c, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Bitmap_Size_width[60] = {
+    0x54, 0x68, 0x65, 0x20, 0x61, 0x76, 0x65, 0x72, 0x61, 0x67, 
+    0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x69, 
+    0x6e, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x2c, 0x20, 
+    0x6f, 0x66, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6b, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Bitmap_Size_x_ppem[59] = {
+    0x54, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 
+    0x6e, 0x74, 0x61, 0x6c, 0x20, 0x70, 0x70, 0x65, 0x6d, 0x20, 
+    0x28, 0x6e, 0x6f, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x77, 
+    0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x69, 0x6e, 0x20, 0x66, 
+    0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 
+    0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Bitmap_Size_y_ppem[58] = {
+    0x54, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 
+    0x61, 0x6c, 0x20, 0x70, 0x70, 0x65, 0x6d, 0x20, 0x28, 0x6e, 
+    0x6f, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x68, 0x65, 0x69, 
+    0x67, 0x68, 0x74, 0x29, 0x20, 0x69, 0x6e, 0x20, 0x66, 0x72, 
+    0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 
+    0x69, 0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
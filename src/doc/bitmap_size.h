@@ -0,0 +1,18 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/bitmap_size.py.
+*/
+
+#ifndef __DOC_BITMAP_SIZE_H__
+#define __DOC_BITMAP_SIZE_H__
+extern char doc_Bitmap_Size__init__[92];
+extern char doc_Bitmap_Size_height[93];
+extern char doc_Bitmap_Size_size[85];
+extern char doc_Bitmap_Size_width[60];
+extern char doc_Bitmap_Size_x_ppem[59];
+extern char doc_Bitmap_Size_y_ppem[58];
+
+#endif
+
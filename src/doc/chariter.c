@@ -0,0 +1,21 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/chariter.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "chariter.h"
+
+char doc_CharIter__init__[50] = {
+    0x41, 0x6e, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x6f, 
+    0x72, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x61, 0x6c, 0x6c, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 0x2e, 0x0a, 0x00, 
+};
+
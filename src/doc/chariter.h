@@ -0,0 +1,13 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/chariter.py.
+*/
+
+#ifndef __DOC_CHARITER_H__
+#define __DOC_CHARITER_H__
+extern char doc_CharIter__init__[50];
+
+#endif
+
@@ -0,0 +1,412 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/charmap.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "charmap.h"
+
+char doc_CharMap__init__[403] = {
+    0x41, 0x20, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x20, 
+    0x66, 0x72, 0x6f, 0x6d, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 
+    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x64, 0x65, 0x6e, 
+    0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x73, 0x2e, 0x0a, 0x0a, 
+    0x53, 0x6f, 0x6d, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 
+    0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x20, 0x6d, 0x61, 
+    0x79, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x20, 
+    0x73, 0x65, 0x76, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x60, 0x43, 
+    0x68, 0x61, 0x72, 0x4d, 0x61, 0x70, 0x60, 0x20, 0x69, 0x6e, 
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x20, 0x70, 0x65, 
+    0x72, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x0a, 0x0a, 0x45, 
+    0x61, 0x63, 0x68, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x6f, 
+    0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x73, 
+    0x20, 0x7a, 0x65, 0x72, 0x6f, 0x20, 0x6f, 0x72, 0x20, 0x6d, 
+    0x6f, 0x72, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x6d, 0x61, 
+    0x70, 0x73, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x6f, 0x6e, 
+    0x6c, 0x79, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x6d, 0x20, 0x63, 0x61, 0x6e, 0x0a, 0x62, 
+    0x65, 0x20, 0xe2, 0x80, 0x98, 0x61, 0x63, 0x74, 0x69, 0x76, 
+    0x65, 0xe2, 0x80, 0x99, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x75, 
+    0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x60, 0x46, 0x61, 
+    0x63, 0x65, 0x2e, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x68, 0x61, 
+    0x72, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x60, 0x20, 0x6f, 
+    0x72, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x2e, 0x6c, 0x6f, 
+    0x61, 0x64, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x60, 0x2e, 0x0a, 
+    0x0a, 0x54, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 
+    0x6f, 0x66, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 
+    0x6c, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 
+    0x73, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x66, 0x61, 0x63, 
+    0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 
+    0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 
+    0x67, 0x68, 0x0a, 0x60, 0x46, 0x61, 0x63, 0x65, 0x2e, 0x63, 
+    0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 0x73, 0x60, 0x2e, 0x0a, 
+    0x0a, 0x54, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 
+    0x6e, 0x74, 0x6c, 0x79, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 
+    0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 0x20, 
+    0x69, 0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 
+    0x6c, 0x65, 0x20, 0x61, 0x73, 0x20, 0x60, 0x46, 0x61, 0x63, 
+    0x65, 0x2e, 0x63, 0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 0x60, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_CharMap_encoding[192] = {
+    0x41, 0x6e, 0x20, 0x60, 0x45, 0x4e, 0x43, 0x4f, 0x44, 0x49, 
+    0x4e, 0x47, 0x60, 0x20, 0x74, 0x61, 0x67, 0x20, 0x69, 0x64, 
+    0x65, 0x6e, 0x74, 0x69, 0x66, 0x79, 0x69, 0x6e, 0x67, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x6d, 0x61, 
+    0x70, 0x2e, 0x0a, 0x0a, 0x44, 0x65, 0x73, 0x70, 0x69, 0x74, 
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
+    0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x76, 0x61, 0x6c, 
+    0x75, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 
+    0x65, 0x73, 0x20, 0x61, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 
+    0x66, 0x69, 0x63, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+    0x74, 0x65, 0x72, 0x0a, 0x72, 0x65, 0x70, 0x65, 0x72, 0x74, 
+    0x6f, 0x72, 0x79, 0x20, 0x28, 0x69, 0x2e, 0x65, 0x2e, 0x2c, 
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x29, 0x2c, 
+    0x20, 0x61, 0x6e, 0x64, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 
+    0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x65, 0x6e, 0x63, 0x6f, 
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 
+    0x64, 0x20, 0x28, 0x65, 0x2e, 0x67, 0x2e, 0x2c, 0x0a, 0x55, 
+    0x54, 0x46, 0x2d, 0x38, 0x2c, 0x20, 0x55, 0x54, 0x46, 0x2d, 
+    0x31, 0x36, 0x2c, 0x20, 0x65, 0x74, 0x63, 0x2e, 0x29, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_CharMap_encoding_id[224] = {
+    0x41, 0x20, 0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 
+    0x2d, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 
+    0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6e, 
+    0x75, 0x6d, 0x62, 0x65, 0x72, 0x2e, 0x20, 0x54, 0x68, 0x69, 
+    0x73, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x63, 0x6f, 0x6d, 
+    0x65, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 
+    0x0a, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x61, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 
+    0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x65, 
+    0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x20, 0x73, 0x69, 
+    0x6d, 0x69, 0x6c, 0x61, 0x72, 0x6c, 0x79, 0x2e, 0x0a, 0x0a, 
+    0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 
+    0x6f, 0x6e, 0x20, 0x60, 0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 
+    0x72, 0x6d, 0x5f, 0x69, 0x64, 0x60, 0x2c, 0x20, 0x74, 0x68, 
+    0x69, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 
+    0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x60, 0x54, 0x54, 0x5f, 
+    0x41, 0x50, 0x50, 0x4c, 0x45, 0x5f, 0x49, 0x44, 0x60, 0x2c, 
+    0x0a, 0x60, 0x54, 0x54, 0x5f, 0x4d, 0x41, 0x43, 0x5f, 0x49, 
+    0x44, 0x60, 0x2c, 0x20, 0x60, 0x54, 0x54, 0x5f, 0x4d, 0x53, 
+    0x5f, 0x49, 0x44, 0x60, 0x20, 0x6f, 0x72, 0x20, 0x60, 0x54, 
+    0x54, 0x5f, 0x41, 0x44, 0x4f, 0x42, 0x45, 0x5f, 0x49, 0x44, 
+    0x60, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_CharMap_face[27] = {
+    0x54, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 
+    0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x20, 0x6f, 0x62, 
+    0x6a, 0x65, 0x63, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_CharMap_get_format[192] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x54, 0x72, 
+    0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x2f, 0x73, 0x66, 0x6e, 
+    0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 
+    0x20, 0x63, 0x6d, 0x61, 0x70, 0x20, 0x66, 0x6f, 0x72, 0x6d, 
+    0x61, 0x74, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 
+    0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x0a, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x20, 0x3a, 0x20, 
+    0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 
+    0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x20, 0x6f, 
+    0x66, 0x20, 0xe2, 0x80, 0x98, 0x63, 0x68, 0x61, 0x72, 0x6d, 
+    0x61, 0x70, 0xe2, 0x80, 0x99, 0x2e, 0x20, 0x49, 0x66, 0x20, 
+    0xe2, 0x80, 0x98, 0x63, 0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 
+    0xe2, 0x80, 0x99, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x6e, 0x27, 
+    0x74, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 
+    0x6f, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x72, 
+    0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x2f, 0x73, 0x66, 0x6e, 
+    0x74, 0x20, 0x66, 0x61, 0x63, 0x65, 0x2c, 0x20, 0x72, 0x61, 
+    0x69, 0x73, 0x65, 0x73, 0x20, 0x61, 0x20, 0x60, 0x56, 0x61, 
+    0x6c, 0x75, 0x65, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x60, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_CharMap_get_language_id[354] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x54, 0x72, 
+    0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x2f, 0x73, 0x66, 0x6e, 
+    0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 
+    0x20, 0x63, 0x6d, 0x61, 0x70, 0x20, 0x6c, 0x61, 0x6e, 0x67, 
+    0x75, 0x61, 0x67, 0x65, 0x20, 0x49, 0x44, 0x2e, 0x0a, 0x0a, 
+    0x49, 0x74, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 
+    0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 
+    0x73, 0x20, 0x69, 0x6e, 0x20, 0x60, 0x54, 0x54, 0x5f, 0x4d, 
+    0x41, 0x43, 0x5f, 0x4c, 0x41, 0x4e, 0x47, 0x49, 0x44, 0x60, 
+    0x20, 0x6f, 0x72, 0x20, 0x60, 0x54, 0x54, 0x5f, 0x4d, 0x53, 
+    0x5f, 0x4c, 0x41, 0x4e, 0x47, 0x49, 0x44, 0x60, 0x2e, 0x0a, 
+    0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x6c, 0x61, 0x6e, 
+    0x67, 0x75, 0x61, 0x67, 0x65, 0x5f, 0x69, 0x64, 0x20, 0x3a, 
+    0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 
+    0x65, 0x20, 0x49, 0x44, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x60, 0x43, 0x68, 0x61, 0x72, 0x4d, 0x61, 0x70, 
+    0x60, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x69, 0x74, 0x20, 0x64, 
+    0x6f, 0x65, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x62, 0x65, 0x6c, 
+    0x6f, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 
+    0x65, 0x2f, 0x73, 0x66, 0x6e, 0x74, 0x20, 0x66, 0x61, 0x63, 
+    0x65, 0x2c, 0x20, 0x72, 0x61, 0x69, 0x73, 0x65, 0x73, 0x20, 
+    0x61, 0x20, 0x60, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x45, 0x72, 
+    0x72, 0x6f, 0x72, 0x60, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x46, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x72, 
+    0x6d, 0x61, 0x74, 0x20, 0x31, 0x34, 0x20, 0x63, 0x6d, 0x61, 
+    0x70, 0x20, 0x28, 0x74, 0x6f, 0x20, 0x61, 0x63, 0x63, 0x65, 
+    0x73, 0x73, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 
+    0x20, 0x49, 0x56, 0x53, 0x29, 0x2c, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x61, 
+    0x6c, 0x75, 0x65, 0x20, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 
+    0x46, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_CharMap_platform_id[170] = {
+    0x41, 0x6e, 0x20, 0x60, 0x54, 0x54, 0x5f, 0x50, 0x4c, 0x41, 
+    0x54, 0x46, 0x4f, 0x52, 0x4d, 0x60, 0x20, 0x69, 0x64, 0x20, 
+    0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x69, 0x6e, 0x67, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6c, 0x61, 0x74, 0x66, 
+    0x6f, 0x72, 0x6d, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 
+    0x67, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 
+    0x0a, 0x49, 0x44, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 
+    0x63, 0x6f, 0x6d, 0x65, 0x73, 0x20, 0x64, 0x69, 0x72, 0x65, 
+    0x63, 0x74, 0x6c, 0x79, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64, 
+    0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 
+    0x0a, 0x65, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 
+    0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_ENCODING[2150] = {
+    0x41, 0x20, 0x74, 0x61, 0x67, 0x20, 0x69, 0x64, 0x65, 0x6e, 
+    0x74, 0x69, 0x66, 0x79, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 
+    0x60, 0x43, 0x68, 0x61, 0x72, 0x4d, 0x61, 0x70, 0x60, 0x20, 
+    0x74, 0x79, 0x70, 0x65, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 
+    0x4e, 0x4f, 0x4e, 0x45, 0x60, 0x3a, 0x20, 0x54, 0x68, 0x65, 
+    0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x20, 
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x30, 0x20, 0x69, 0x73, 
+    0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x2e, 
+    0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x55, 0x4e, 0x49, 0x43, 0x4f, 
+    0x44, 0x45, 0x60, 0x3a, 0x20, 0x43, 0x6f, 0x72, 0x72, 0x65, 
+    0x73, 0x70, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x74, 0x6f, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 
+    0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
+    0x72, 0x20, 0x73, 0x65, 0x74, 0x2e, 0x20, 0x54, 0x68, 0x69, 
+    0x73, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x0a, 0x20, 0x20, 
+    0x63, 0x6f, 0x76, 0x65, 0x72, 0x73, 0x20, 0x61, 0x6c, 0x6c, 
+    0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x55, 0x6e, 0x69, 
+    0x63, 0x6f, 0x64, 0x65, 0x20, 0x72, 0x65, 0x70, 0x65, 0x72, 
+    0x74, 0x6f, 0x69, 0x72, 0x65, 0x2c, 0x20, 0x69, 0x6e, 0x63, 
+    0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x41, 0x53, 0x43, 
+    0x49, 0x49, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x4c, 
+    0x61, 0x74, 0x69, 0x6e, 0x2d, 0x31, 0x2e, 0x20, 0x4d, 0x6f, 
+    0x73, 0x74, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 0x69, 
+    0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x61, 0x20, 0x55, 
+    0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x6d, 0x61, 0x70, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 
+    0x6e, 0x6f, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x6d, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 
+    0x46, 0x6f, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 
+    0x65, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 
+    0x77, 0x61, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x63, 
+    0x63, 0x65, 0x73, 0x73, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 
+    0x64, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x55, 
+    0x2b, 0x31, 0x46, 0x30, 0x32, 0x38, 0x20, 0x28, 0x61, 0x6e, 
+    0x64, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 
+    0x73, 0x20, 0x69, 0x74, 0x29, 0x2c, 0x20, 0x75, 0x73, 0x65, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x30, 0x78, 0x31, 
+    0x46, 0x30, 0x32, 0x38, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x76, 0x61, 
+    0x6c, 0x75, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x0a, 0x20, 0x20, 
+    0x60, 0x46, 0x61, 0x63, 0x65, 0x2e, 0x67, 0x65, 0x74, 0x5f, 
+    0x63, 0x68, 0x61, 0x72, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 
+    0x60, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4d, 0x53, 0x5f, 
+    0x53, 0x59, 0x4d, 0x42, 0x4f, 0x4c, 0x60, 0x3a, 0x20, 0x43, 
+    0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x73, 
+    0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4d, 0x69, 
+    0x63, 0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x20, 0x53, 0x79, 
+    0x6d, 0x62, 0x6f, 0x6c, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 
+    0x69, 0x6e, 0x67, 0x2c, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 
+    0x74, 0x6f, 0x0a, 0x20, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 
+    0x65, 0x20, 0x6d, 0x61, 0x74, 0x68, 0x65, 0x6d, 0x61, 0x74, 
+    0x69, 0x63, 0x61, 0x6c, 0x20, 0x73, 0x79, 0x6d, 0x62, 0x6f, 
+    0x6c, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x33, 0x32, 0x2e, 0x2e, 0x32, 0x35, 0x35, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x63, 0x6f, 
+    0x64, 0x65, 0x20, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x2e, 0x20, 
+    0x46, 0x6f, 0x72, 0x0a, 0x20, 0x20, 0x6d, 0x6f, 0x72, 0x65, 
+    0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 
+    0x6f, 0x6e, 0x2c, 0x20, 0x73, 0x65, 0x65, 0x20, 0x60, 0x3c, 
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 
+    0x2e, 0x63, 0x65, 0x76, 0x69, 0x7a, 0x2e, 0x6e, 0x65, 0x74, 
+    0x2f, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x2e, 0x68, 0x74, 
+    0x6d, 0x3e, 0x60, 0x5f, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 
+    0x53, 0x4a, 0x49, 0x53, 0x60, 0x3a, 0x20, 0x43, 0x6f, 0x72, 
+    0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x74, 
+    0x6f, 0x20, 0x4a, 0x61, 0x70, 0x61, 0x6e, 0x65, 0x73, 0x65, 
+    0x20, 0x53, 0x4a, 0x49, 0x53, 0x20, 0x65, 0x6e, 0x63, 0x6f, 
+    0x64, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x4d, 0x6f, 0x72, 0x65, 
+    0x20, 0x69, 0x6e, 0x66, 0x6f, 0x20, 0x61, 0x74, 0x20, 0x61, 
+    0x74, 0x0a, 0x20, 0x20, 0x60, 0x3c, 0x68, 0x74, 0x74, 0x70, 
+    0x3a, 0x2f, 0x2f, 0x6c, 0x61, 0x6e, 0x67, 0x73, 0x75, 0x70, 
+    0x70, 0x6f, 0x72, 0x74, 0x2e, 0x6a, 0x61, 0x70, 0x61, 0x6e, 
+    0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x2e, 
+    0x63, 0x6f, 0x6d, 0x2f, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 
+    0x6e, 0x67, 0x2e, 0x73, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x60, 
+    0x5f, 0x2e, 0x20, 0x53, 0x65, 0x65, 0x20, 0x6e, 0x6f, 0x74, 
+    0x65, 0x0a, 0x20, 0x20, 0x6f, 0x6e, 0x20, 0x6d, 0x75, 0x6c, 
+    0x74, 0x69, 0x2d, 0x62, 0x79, 0x74, 0x65, 0x20, 0x65, 0x6e, 
+    0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x62, 0x65, 
+    0x6c, 0x6f, 0x77, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x47, 
+    0x42, 0x32, 0x33, 0x31, 0x32, 0x60, 0x3a, 0x20, 0x43, 0x6f, 
+    0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x73, 0x20, 
+    0x74, 0x6f, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x6e, 0x63, 0x6f, 
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 
+    0x6d, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x53, 0x69, 0x6d, 0x70, 
+    0x6c, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x43, 0x68, 0x69, 
+    0x6e, 0x65, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x61, 0x73, 0x20, 
+    0x75, 0x73, 0x65, 0x64, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 
+    0x69, 0x6e, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x6c, 0x61, 0x6e, 
+    0x64, 0x20, 0x43, 0x68, 0x69, 0x6e, 0x61, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x42, 0x49, 0x47, 0x35, 0x60, 0x3a, 0x20, 
+    0x43, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 
+    0x73, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x6e, 
+    0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x79, 0x73, 
+    0x74, 0x65, 0x6d, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x54, 0x72, 
+    0x61, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 
+    0x43, 0x68, 0x69, 0x6e, 0x65, 0x73, 0x65, 0x20, 0x61, 0x73, 
+    0x0a, 0x20, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 
+    0x20, 0x54, 0x61, 0x69, 0x77, 0x61, 0x6e, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x48, 0x6f, 0x6e, 0x67, 0x20, 0x4b, 0x6f, 0x6e, 
+    0x67, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x57, 0x41, 0x4e, 
+    0x53, 0x55, 0x4e, 0x47, 0x60, 0x3a, 0x20, 0x43, 0x6f, 0x72, 
+    0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x74, 
+    0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4b, 0x6f, 0x72, 0x65, 
+    0x61, 0x6e, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 
+    0x67, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x6b, 
+    0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x61, 0x73, 0x0a, 0x20, 0x20, 
+    0x57, 0x61, 0x6e, 0x73, 0x75, 0x6e, 0x67, 0x2e, 0x20, 0x46, 
+    0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x69, 0x6e, 
+    0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+    0x73, 0x65, 0x65, 0x0a, 0x20, 0x20, 0x60, 0x3c, 0x68, 0x74, 
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x6d, 
+    0x69, 0x63, 0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x2e, 0x63, 
+    0x6f, 0x6d, 0x2f, 0x74, 0x79, 0x70, 0x6f, 0x67, 0x72, 0x61, 
+    0x70, 0x68, 0x79, 0x2f, 0x75, 0x6e, 0x69, 0x63, 0x6f, 0x64, 
+    0x65, 0x2f, 0x39, 0x34, 0x39, 0x2e, 0x74, 0x78, 0x74, 0x3e, 
+    0x60, 0x5f, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4a, 0x4f, 
+    0x48, 0x41, 0x42, 0x60, 0x3a, 0x20, 0x54, 0x68, 0x65, 0x20, 
+    0x4b, 0x6f, 0x72, 0x65, 0x61, 0x6e, 0x20, 0x73, 0x74, 0x61, 
+    0x6e, 0x64, 0x61, 0x72, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 
+    0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x73, 0x65, 0x74, 0x20, 
+    0x28, 0x4b, 0x53, 0x20, 0x43, 0x20, 0x35, 0x36, 0x30, 0x31, 
+    0x2d, 0x31, 0x39, 0x39, 0x32, 0x29, 0x2c, 0x20, 0x77, 0x68, 
+    0x69, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x72, 0x72, 
+    0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x74, 0x6f, 
+    0x20, 0x4d, 0x53, 0x20, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 
+    0x73, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x70, 0x61, 0x67, 
+    0x65, 0x20, 0x31, 0x33, 0x36, 0x31, 0x2e, 0x20, 0x54, 0x68, 
+    0x69, 0x73, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x20, 0x73, 0x65, 0x74, 0x0a, 0x20, 0x20, 0x69, 
+    0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x20, 0x61, 0x6c, 
+    0x6c, 0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 
+    0x20, 0x48, 0x61, 0x6e, 0x67, 0x65, 0x75, 0x6c, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x63, 
+    0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 
+    0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x41, 0x44, 0x4f, 
+    0x42, 0x45, 0x5f, 0x4c, 0x41, 0x54, 0x49, 0x4e, 0x5f, 0x31, 
+    0x60, 0x3a, 0x20, 0x43, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 
+    0x6f, 0x6e, 0x64, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 
+    0x4c, 0x61, 0x74, 0x69, 0x6e, 0x2d, 0x31, 0x20, 0x65, 0x6e, 
+    0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x73, 0x20, 
+    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 
+    0x20, 0x61, 0x0a, 0x20, 0x20, 0x54, 0x79, 0x70, 0x65, 0x20, 
+    0x31, 0x20, 0x50, 0x6f, 0x73, 0x74, 0x53, 0x63, 0x72, 0x69, 
+    0x70, 0x74, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x20, 0x49, 
+    0x74, 0x20, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 
+    0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x32, 0x35, 0x36, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 
+    0x63, 0x6f, 0x64, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x41, 0x44, 0x4f, 0x42, 0x45, 0x5f, 0x53, 0x54, 0x41, 
+    0x4e, 0x44, 0x41, 0x52, 0x44, 0x60, 0x3a, 0x20, 0x43, 0x6f, 
+    0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x73, 0x20, 
+    0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x64, 0x6f, 
+    0x62, 0x65, 0x20, 0x53, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 
+    0x64, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 
+    0x2c, 0x20, 0x61, 0x73, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x75, 
+    0x6e, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x54, 0x79, 0x70, 0x65, 
+    0x20, 0x31, 0x2c, 0x20, 0x43, 0x46, 0x46, 0x2c, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x54, 0x79, 0x70, 
+    0x65, 0x2f, 0x43, 0x46, 0x46, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x73, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6c, 
+    0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 
+    0x32, 0x35, 0x36, 0x0a, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 
+    0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x64, 0x65, 
+    0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x41, 0x44, 0x4f, 
+    0x42, 0x45, 0x5f, 0x45, 0x58, 0x50, 0x45, 0x52, 0x54, 0x60, 
+    0x3a, 0x20, 0x43, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 
+    0x6e, 0x64, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x45, 0x78, 0x70, 
+    0x65, 0x72, 0x74, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 
+    0x6e, 0x67, 0x2c, 0x20, 0x61, 0x73, 0x20, 0x66, 0x6f, 0x75, 
+    0x6e, 0x64, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x20, 0x54, 0x79, 
+    0x70, 0x65, 0x20, 0x31, 0x2c, 0x20, 0x43, 0x46, 0x46, 0x2c, 
+    0x20, 0x61, 0x6e, 0x64, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x54, 
+    0x79, 0x70, 0x65, 0x2f, 0x43, 0x46, 0x46, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x73, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x69, 0x73, 
+    0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 0x20, 0x74, 
+    0x6f, 0x20, 0x32, 0x35, 0x36, 0x0a, 0x20, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x63, 0x6f, 
+    0x64, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x41, 
+    0x44, 0x4f, 0x42, 0x45, 0x5f, 0x43, 0x55, 0x53, 0x54, 0x4f, 
+    0x4d, 0x60, 0x3a, 0x20, 0x43, 0x6f, 0x72, 0x72, 0x65, 0x73, 
+    0x70, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x61, 
+    0x20, 0x63, 0x75, 0x73, 0x74, 0x6f, 0x6d, 0x20, 0x65, 0x6e, 
+    0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x61, 0x73, 
+    0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x20, 
+    0x54, 0x79, 0x70, 0x65, 0x0a, 0x20, 0x20, 0x31, 0x2c, 0x20, 
+    0x43, 0x46, 0x46, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x4f, 
+    0x70, 0x65, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x2f, 0x43, 0x46, 
+    0x46, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2e, 0x20, 0x49, 
+    0x74, 0x20, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 
+    0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x32, 0x35, 0x36, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x0a, 
+    0x20, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x41, 0x50, 0x50, 0x4c, 0x45, 0x5f, 0x52, 
+    0x4f, 0x4d, 0x41, 0x4e, 0x60, 0x3a, 0x20, 0x43, 0x6f, 0x72, 
+    0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x74, 
+    0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x38, 0x2d, 0x62, 0x69, 
+    0x74, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x65, 0x20, 0x72, 0x6f, 
+    0x6d, 0x61, 0x6e, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 
+    0x6e, 0x67, 0x2e, 0x20, 0x4d, 0x61, 0x6e, 0x79, 0x0a, 0x20, 
+    0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x54, 0x79, 
+    0x70, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 0x63, 
+    0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x65, 0x6e, 0x63, 0x6f, 
+    0x64, 0x69, 0x6e, 0x67, 0x2c, 0x0a, 0x20, 0x20, 0x73, 0x69, 
+    0x6e, 0x63, 0x65, 0x20, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x20, 
+    0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 
+    0x66, 0x20, 0x4d, 0x61, 0x63, 0x20, 0x4f, 0x53, 0x20, 0x61, 
+    0x72, 0x65, 0x20, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+    0x20, 0x75, 0x73, 0x65, 0x20, 0x69, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
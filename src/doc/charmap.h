@@ -0,0 +1,20 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/charmap.py.
+*/
+
+#ifndef __DOC_CHARMAP_H__
+#define __DOC_CHARMAP_H__
+extern char doc_CharMap__init__[403];
+extern char doc_CharMap_encoding[192];
+extern char doc_CharMap_encoding_id[224];
+extern char doc_CharMap_face[27];
+extern char doc_CharMap_get_format[192];
+extern char doc_CharMap_get_language_id[354];
+extern char doc_CharMap_platform_id[170];
+extern char doc_ENCODING[2150];
+
+#endif
+
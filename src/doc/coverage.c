@@ -0,0 +1,186 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/coverage.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "coverage.h"
+
+char doc_Coverage__init__[745] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6f, 
+    0x66, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 
+    0x20, 0x61, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x20, 
+    0x68, 0x61, 0x73, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 
+    0x20, 0x66, 0x6f, 0x72, 0x2e, 0x0a, 0x0a, 0x43, 0x6f, 0x76, 
+    0x65, 0x72, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 
+    0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x20, 0x6f, 0x6e, 
+    0x63, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x27, 0x73, 0x20, 0x55, 
+    0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x60, 0x43, 0x68, 
+    0x61, 0x72, 0x4d, 0x61, 0x70, 0x60, 0x20, 0x62, 0x79, 0x0a, 
+    0x60, 0x46, 0x61, 0x63, 0x65, 0x2e, 0x63, 0x6f, 0x76, 0x65, 
+    0x72, 0x61, 0x67, 0x65, 0x60, 0x2e, 0x20, 0x20, 0x49, 0x74, 
+    0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x64, 
+    0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x73, 0x6f, 0x72, 0x74, 
+    0x65, 0x64, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 
+    0x20, 0x32, 0x35, 0x36, 0x2d, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x0a, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 
+    0x73, 0x2c, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x77, 0x69, 
+    0x74, 0x68, 0x20, 0x61, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 
+    0x70, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 
+    0x69, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 
+    0x73, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x61, 0x74, 
+    0x0a, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x73, 0x20, 0x61, 
+    0x72, 0x65, 0x20, 0x63, 0x68, 0x65, 0x61, 0x70, 0x20, 0x65, 
+    0x76, 0x65, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x66, 0x61, 
+    0x63, 0x65, 0x73, 0x20, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x69, 
+    0x6e, 0x67, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x73, 0x63, 
+    0x72, 0x69, 0x70, 0x74, 0x73, 0x2e, 0x0a, 0x0a, 0x53, 0x75, 
+    0x70, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x60, 0x60, 0x69, 0x6e, 0x60, 0x60, 0x20, 0x6f, 0x70, 
+    0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x61, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 
+    0x6f, 0x72, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x70, 0x6f, 
+    0x69, 0x6e, 0x74, 0x2c, 0x0a, 0x61, 0x6e, 0x64, 0x20, 0x60, 
+    0x60, 0x6c, 0x65, 0x6e, 0x60, 0x60, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 
+    0x72, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x63, 0x6f, 0x76, 0x65, 
+    0x72, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x53, 0x75, 0x70, 0x70, 
+    0x6f, 0x72, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x74, 0x65, 
+    0x72, 0x66, 0x61, 0x63, 0x65, 0x2e, 0x20, 0x20, 0x54, 0x68, 
+    0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 
+    0x73, 0x20, 0x61, 0x6e, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 
+    0x20, 0x6f, 0x66, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 
+    0x65, 0x64, 0x0a, 0x33, 0x32, 0x2d, 0x62, 0x69, 0x74, 0x20, 
+    0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x73, 0x20, 0x6f, 
+    0x66, 0x20, 0x73, 0x68, 0x61, 0x70, 0x65, 0x20, 0x28, 0x2a, 
+    0x6e, 0x2a, 0x2c, 0x20, 0x39, 0x29, 0x2c, 0x20, 0x77, 0x69, 
+    0x74, 0x68, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x72, 0x6f, 0x77, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 
+    0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x74, 0x68, 0x61, 0x74, 
+    0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x2e, 
+    0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 
+    0x74, 0x20, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x20, 0x69, 
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6c, 0x6f, 0x63, 
+    0x6b, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x28, 
+    0x74, 0x68, 0x65, 0x0a, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x70, 
+    0x6f, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 
+    0x65, 0x64, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x62, 
+    0x79, 0x20, 0x38, 0x29, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 
+    0x69, 0x6e, 0x67, 0x20, 0x38, 0x20, 0x61, 0x72, 0x65, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x0a, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6c, 
+    0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x6c, 0x65, 0x61, 0x73, 0x74, 
+    0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 
+    0x6e, 0x74, 0x20, 0x62, 0x69, 0x74, 0x20, 0x66, 0x69, 0x72, 
+    0x73, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Coverage_has_all[144] = {
+    0x57, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x65, 0x76, 
+    0x65, 0x72, 0x79, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+    0x74, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x73, 
+    0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x63, 
+    0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x50, 
+    0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x0a, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3a, 0x20, 0x73, 0x74, 
+    0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 
+    0x20, 0x74, 0x6f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x2e, 
+    0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x68, 0x61, 
+    0x73, 0x5f, 0x61, 0x6c, 0x6c, 0x20, 0x3a, 0x20, 0x62, 0x6f, 
+    0x6f, 0x6c, 0x0a, 0x00, 
+};
+
+char doc_Coverage_has_char[163] = {
+    0x57, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61, 0x20, 
+    0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 
+    0x63, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 
+    0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x63, 0x68, 0x61, 0x72, 0x20, 0x3a, 0x20, 0x73, 
+    0x74, 0x72, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x74, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x41, 0x20, 0x73, 0x69, 0x6e, 0x67, 
+    0x6c, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x55, 
+    0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x63, 0x6f, 0x64, 
+    0x65, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2e, 0x0a, 0x0a, 
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x68, 0x61, 0x73, 0x5f, 
+    0x63, 0x68, 0x61, 0x72, 0x20, 0x3a, 0x20, 0x62, 0x6f, 0x6f, 
+    0x6c, 0x0a, 0x00, 
+};
+
+char doc_Coverage_missing[281] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x6f, 
+    0x66, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 
+    0x6e, 0x6f, 0x74, 0x20, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x65, 
+    0x64, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 
+    0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x74, 0x65, 0x78, 0x74, 
+    0x20, 0x3a, 0x20, 0x73, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x63, 
+    0x68, 0x65, 0x63, 0x6b, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 0x74, 
+    0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x0a, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 
+    0x20, 0x3a, 0x20, 0x73, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x63, 0x68, 0x61, 0x72, 
+    0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x2a, 
+    0x74, 0x65, 0x78, 0x74, 0x2a, 0x20, 0x74, 0x68, 0x61, 0x74, 
+    0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x63, 0x6f, 
+    0x76, 0x65, 0x72, 0x65, 0x64, 0x2c, 0x20, 0x6f, 0x6e, 0x63, 
+    0x65, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6f, 0x72, 0x64, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x74, 0x68, 0x65, 0x79, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 
+    0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x2e, 0x20, 0x20, 
+    0x45, 0x6d, 0x70, 0x74, 0x79, 0x20, 0x69, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x63, 0x6f, 
+    0x76, 0x65, 0x72, 0x73, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 
+    0x66, 0x20, 0x2a, 0x74, 0x65, 0x78, 0x74, 0x2a, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Coverage_ranges[213] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 
+    0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 
+    0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x61, 0x73, 0x20, 
+    0x72, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 
+    0x63, 0x6f, 0x64, 0x65, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 
+    0x73, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+    0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 
+    0x72, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x20, 0x3a, 0x20, 0x6c, 
+    0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x28, 0x69, 0x6e, 
+    0x74, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x74, 0x75, 
+    0x70, 0x6c, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x20, 0x63, 0x6f, 
+    0x64, 0x65, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 
+    0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x72, 0x75, 
+    0x6e, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x65, 
+    0x63, 0x75, 0x74, 0x69, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x2c, 
+    0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x73, 0x69, 0x76, 0x65, 
+    0x2c, 0x20, 0x69, 0x6e, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 
+    0x2e, 0x0a, 0x00, 
+};
+
@@ -0,0 +1,17 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/coverage.py.
+*/
+
+#ifndef __DOC_COVERAGE_H__
+#define __DOC_COVERAGE_H__
+extern char doc_Coverage__init__[745];
+extern char doc_Coverage_has_all[144];
+extern char doc_Coverage_has_char[163];
+extern char doc_Coverage_missing[281];
+extern char doc_Coverage_ranges[213];
+
+#endif
+
@@ -0,0 +1,4024 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/face.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "face.h"
+
+char doc_FACE_FLAG[3347] = {
+    0x42, 0x69, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 
+    0x61, 0x6e, 0x74, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x64, 0x61, 
+    0x74, 0x61, 0x20, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x20, 0x61, 
+    0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x53, 0x43, 0x41, 0x4c, 0x41, 0x42, 0x4c, 
+    0x45, 0x60, 0x3a, 0x20, 0x49, 0x6e, 0x64, 0x69, 0x63, 0x61, 
+    0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x63, 0x6f, 
+    0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x6f, 0x75, 0x74, 
+    0x6c, 0x69, 0x6e, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x73, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x0a, 0x20, 0x20, 
+    0x64, 0x6f, 0x65, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x70, 0x72, 
+    0x65, 0x76, 0x65, 0x6e, 0x74, 0x20, 0x62, 0x69, 0x74, 0x6d, 
+    0x61, 0x70, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6b, 0x65, 0x73, 
+    0x2c, 0x20, 0x69, 0x2e, 0x65, 0x2e, 0x2c, 0x20, 0x61, 0x20, 
+    0x66, 0x61, 0x63, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x68, 
+    0x61, 0x76, 0x65, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x20, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x60, 0x46, 0x41, 0x43, 0x45, 0x5f, 
+    0x46, 0x4c, 0x41, 0x47, 0x2e, 0x46, 0x49, 0x58, 0x45, 0x44, 
+    0x5f, 0x53, 0x49, 0x5a, 0x45, 0x53, 0x60, 0x20, 0x73, 0x65, 
+    0x74, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x46, 0x49, 0x58, 
+    0x45, 0x44, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x53, 0x60, 0x3a, 
+    0x20, 0x49, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x61, 0x63, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 
+    0x69, 0x6e, 0x73, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6b, 0x65, 0x73, 0x2e, 0x20, 
+    0x53, 0x65, 0x65, 0x0a, 0x20, 0x20, 0x61, 0x6c, 0x73, 0x6f, 
+    0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x2e, 0x61, 0x76, 0x61, 
+    0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x73, 0x69, 0x7a, 
+    0x65, 0x73, 0x60, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x46, 
+    0x49, 0x58, 0x45, 0x44, 0x5f, 0x57, 0x49, 0x44, 0x54, 0x48, 
+    0x60, 0x3a, 0x20, 0x49, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 
+    0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x63, 0x6f, 0x6e, 
+    0x74, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x66, 0x69, 0x78, 0x65, 
+    0x64, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x0a, 0x20, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 
+    0x20, 0x28, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x43, 0x6f, 0x75, 
+    0x72, 0x69, 0x65, 0x72, 0x2c, 0x20, 0x4c, 0x75, 0x63, 0x69, 
+    0x64, 0x6f, 0x2c, 0x20, 0x4d, 0x6f, 0x6e, 0x6f, 0x54, 0x79, 
+    0x70, 0x65, 0x2c, 0x20, 0x65, 0x74, 0x63, 0x2e, 0x29, 0x2e, 
+    0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x53, 0x46, 0x4e, 0x54, 0x60, 
+    0x3a, 0x20, 0x49, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 
+    0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x75, 0x73, 0x65, 0x73, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0xe2, 0x80, 0x98, 0x73, 0x66, 
+    0x6e, 0x74, 0xe2, 0x80, 0x99, 0x20, 0x73, 0x74, 0x6f, 0x72, 
+    0x61, 0x67, 0x65, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x65, 
+    0x2e, 0x20, 0x46, 0x6f, 0x72, 0x0a, 0x20, 0x20, 0x6e, 0x6f, 
+    0x77, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6d, 0x65, 
+    0x61, 0x6e, 0x73, 0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x4f, 0x70, 0x65, 
+    0x6e, 0x54, 0x79, 0x70, 0x65, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x48, 0x4f, 0x52, 0x49, 0x5a, 0x4f, 0x4e, 0x54, 0x41, 
+    0x4c, 0x60, 0x3a, 0x20, 0x49, 0x6e, 0x64, 0x69, 0x63, 0x61, 
+    0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x63, 0x6f, 
+    0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x68, 0x6f, 0x72, 
+    0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x0a, 0x20, 0x20, 0x6d, 0x65, 0x74, 0x72, 
+    0x69, 0x63, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 
+    0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 
+    0x73, 0x65, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6c, 
+    0x6c, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x66, 
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x2e, 0x0a, 0x0a, 0x2d, 
+    0x20, 0x60, 0x56, 0x45, 0x52, 0x54, 0x49, 0x43, 0x41, 0x4c, 
+    0x60, 0x3a, 0x20, 0x49, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 
+    0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x63, 0x6f, 0x6e, 
+    0x74, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x76, 0x65, 0x72, 0x74, 
+    0x69, 0x63, 0x61, 0x6c, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x0a, 0x20, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 
+    0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 
+    0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 
+    0x61, 0x62, 0x6c, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x6f, 
+    0x6d, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 
+    0x2c, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x4b, 0x45, 0x52, 0x4e, 0x49, 0x4e, 0x47, 
+    0x60, 0x3a, 0x20, 0x49, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 
+    0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x63, 0x6f, 0x6e, 
+    0x74, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x6b, 0x65, 0x72, 0x6e, 
+    0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x49, 0x66, 0x0a, 
+    0x20, 0x20, 0x73, 0x65, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6b, 0x65, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x64, 
+    0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x63, 0x61, 
+    0x6e, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x74, 0x72, 0x69, 
+    0x65, 0x76, 0x65, 0x64, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 
+    0x67, 0x68, 0x0a, 0x20, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 
+    0x2e, 0x67, 0x65, 0x74, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x69, 
+    0x6e, 0x67, 0x60, 0x2e, 0x20, 0x4f, 0x74, 0x68, 0x65, 0x72, 
+    0x77, 0x69, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6c, 
+    0x77, 0x61, 0x79, 0x73, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x65, 0x63, 
+    0x74, 0x6f, 0x72, 0x0a, 0x20, 0x20, 0x28, 0x30, 0x2c, 0x20, 
+    0x30, 0x29, 0x2e, 0x20, 0x4e, 0x6f, 0x74, 0x65, 0x20, 0x74, 
+    0x68, 0x61, 0x74, 0x20, 0x46, 0x72, 0x65, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x6e, 0x27, 0x74, 
+    0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x20, 0x6b, 0x65, 
+    0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x61, 0x74, 0x61, 
+    0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x0a, 
+    0x20, 0x20, 0xe2, 0x80, 0x98, 0x47, 0x50, 0x4f, 0x53, 0xe2, 
+    0x80, 0x99, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x28, 
+    0x61, 0x73, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 
+    0x20, 0x69, 0x6e, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x4f, 
+    0x70, 0x65, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x73, 0x29, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 
+    0x4d, 0x55, 0x4c, 0x54, 0x49, 0x50, 0x4c, 0x45, 0x5f, 0x4d, 
+    0x41, 0x53, 0x54, 0x45, 0x52, 0x53, 0x60, 0x3a, 0x20, 0x49, 
+    0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 
+    0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 
+    0x73, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x65, 
+    0x0a, 0x20, 0x20, 0x6d, 0x61, 0x73, 0x74, 0x65, 0x72, 0x73, 
+    0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x73, 0x20, 0x63, 0x61, 
+    0x70, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x69, 
+    0x6e, 0x74, 0x65, 0x72, 0x70, 0x6f, 0x6c, 0x61, 0x74, 0x69, 
+    0x6e, 0x67, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 
+    0x20, 0x74, 0x68, 0x65, 0x6d, 0x2e, 0x20, 0x53, 0x65, 0x65, 
+    0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x6d, 0x75, 0x6c, 
+    0x74, 0x69, 0x70, 0x6c, 0x65, 0x2d, 0x6d, 0x61, 0x73, 0x74, 
+    0x65, 0x72, 0x73, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 
+    0x69, 0x63, 0x20, 0x41, 0x50, 0x49, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 0x73, 0x2e, 0x0a, 
+    0x0a, 0x2d, 0x20, 0x60, 0x47, 0x4c, 0x59, 0x50, 0x48, 0x5f, 
+    0x4e, 0x41, 0x4d, 0x45, 0x53, 0x60, 0x3a, 0x20, 0x49, 0x6e, 
+    0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 
+    0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x6e, 0x61, 0x6d, 
+    0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x61, 
+    0x6e, 0x0a, 0x20, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x74, 
+    0x72, 0x69, 0x65, 0x76, 0x65, 0x64, 0x20, 0x74, 0x68, 0x72, 
+    0x6f, 0x75, 0x67, 0x68, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 
+    0x2e, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x60, 0x2e, 0x20, 0x4e, 0x6f, 
+    0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x6f, 
+    0x6d, 0x65, 0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 
+    0x65, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 
+    0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x20, 0x62, 0x72, 
+    0x6f, 0x6b, 0x65, 0x6e, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c, 
+    0x65, 0x73, 0x2e, 0x20, 0x55, 0x73, 0x65, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x0a, 0x20, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x2e, 0x68, 
+    0x61, 0x73, 0x5f, 0x70, 0x73, 0x5f, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x60, 0x20, 0x77, 
+    0x68, 0x65, 0x6e, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x65, 0x64, 
+    0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x45, 0x58, 0x54, 0x45, 
+    0x52, 0x4e, 0x41, 0x4c, 0x5f, 0x53, 0x54, 0x52, 0x45, 0x41, 
+    0x4d, 0x60, 0x3a, 0x20, 0x55, 0x73, 0x65, 0x64, 0x20, 0x69, 
+    0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x6c, 0x79, 0x20, 
+    0x62, 0x79, 0x20, 0x46, 0x72, 0x65, 0x65, 0x54, 0x79, 0x70, 
+    0x65, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 
+    0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 
+    0x0a, 0x20, 0x20, 0x66, 0x61, 0x63, 0x65, 0x27, 0x73, 0x20, 
+    0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x20, 0x77, 0x61, 0x73, 
+    0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 
+    0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6c, 0x69, 
+    0x65, 0x6e, 0x74, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6e, 0x6f, 0x74, 
+    0x0a, 0x20, 0x20, 0x62, 0x65, 0x20, 0x64, 0x65, 0x73, 0x74, 
+    0x72, 0x6f, 0x79, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6e, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 
+    0x69, 0x73, 0x20, 0x64, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 
+    0x74, 0x65, 0x64, 0x2e, 0x20, 0x44, 0x6f, 0x6e, 0x27, 0x74, 
+    0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x6f, 0x72, 0x20, 0x74, 
+    0x65, 0x73, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x20, 
+    0x20, 0x66, 0x6c, 0x61, 0x67, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x48, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x60, 0x3a, 0x20, 
+    0x53, 0x65, 0x74, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x72, 0x69, 0x76, 
+    0x65, 0x72, 0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x20, 0x68, 
+    0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x6d, 0x61, 0x63, 
+    0x68, 0x69, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x74, 
+    0x73, 0x0a, 0x20, 0x20, 0x6f, 0x77, 0x6e, 0x2e, 0x20, 0x46, 
+    0x6f, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 
+    0x2c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x54, 0x72, 0x75, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x73, 0x2c, 0x20, 0x69, 0x74, 0x20, 0x6d, 0x61, 0x6b, 0x65, 
+    0x73, 0x20, 0x73, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x74, 0x6f, 
+    0x20, 0x75, 0x73, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0a, 
+    0x20, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x53, 0x46, 0x4e, 0x54, 0x20, 0xe2, 0x80, 0x98, 0x67, 
+    0x61, 0x73, 0x70, 0xe2, 0x80, 0x99, 0x20, 0x74, 0x61, 0x62, 
+    0x6c, 0x65, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x69, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x61, 0x74, 0x69, 0x76, 
+    0x65, 0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 
+    0x20, 0x68, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x0a, 0x20, 
+    0x20, 0x65, 0x6e, 0x67, 0x69, 0x6e, 0x65, 0x20, 0x28, 0x77, 
+    0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x79, 
+    0x74, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x69, 0x6e, 0x74, 
+    0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x72, 0x29, 0x20, 
+    0x69, 0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 
+    0x6c, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x63, 0x74, 
+    0x69, 0x76, 0x65, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x43, 
+    0x49, 0x44, 0x5f, 0x4b, 0x45, 0x59, 0x45, 0x44, 0x60, 0x3a, 
+    0x20, 0x53, 0x65, 0x74, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 
+    0x43, 0x49, 0x44, 0x2d, 0x6b, 0x65, 0x79, 0x65, 0x64, 0x2e, 
+    0x20, 0x49, 0x6e, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 
+    0x61, 0x73, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x6e, 
+    0x6f, 0x74, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x65, 
+    0x64, 0x20, 0x62, 0x79, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x62, 
+    0x75, 0x74, 0x20, 0x62, 0x79, 0x20, 0x43, 0x49, 0x44, 0x20, 
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x2e, 0x20, 0x46, 0x6f, 
+    0x72, 0x20, 0x73, 0x75, 0x62, 0x73, 0x65, 0x74, 0x74, 0x65, 
+    0x64, 0x0a, 0x20, 0x20, 0x43, 0x49, 0x44, 0x2d, 0x6b, 0x65, 
+    0x79, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x68, 0x61, 0x73, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x65, 0x71, 0x75, 
+    0x65, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 
+    0x6e, 0x6f, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x69, 0x6e, 
+    0x64, 0x65, 0x78, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 
+    0x0a, 0x20, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x20, 0x76, 
+    0x61, 0x6c, 0x69, 0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 
+    0x65, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x60, 0x46, 0x61, 
+    0x63, 0x65, 0x2e, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x60, 0x2e, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x49, 0x44, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x0a, 
+    0x20, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x6f, 
+    0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 
+    0x67, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x69, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x73, 
+    0x65, 0x74, 0x74, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x20, 0x6d, 0x61, 0x6b, 
+    0x65, 0x0a, 0x20, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x2e, 
+    0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x60, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 
+    0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6c, 0x6c, 
+    0x79, 0x3b, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6c, 0x6c, 0x20, 
+    0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x63, 0x61, 0x73, 0x65, 
+    0x73, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x67, 0x65, 0x74, 0x20, 
+    0x61, 0x0a, 0x20, 0x20, 0x60, 0x56, 0x61, 0x6c, 0x75, 0x65, 
+    0x45, 0x72, 0x72, 0x6f, 0x72, 0x60, 0x20, 0x65, 0x78, 0x63, 
+    0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x20, 
+    0x20, 0x4e, 0x6f, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 
+    0x20, 0x43, 0x49, 0x44, 0x2d, 0x6b, 0x65, 0x79, 0x65, 0x64, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 0x77, 0x68, 0x69, 
+    0x63, 0x68, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x20, 
+    0x61, 0x6e, 0x20, 0x53, 0x46, 0x4e, 0x54, 0x20, 0x77, 0x72, 
+    0x61, 0x70, 0x70, 0x65, 0x72, 0x20, 0x64, 0x6f, 0x6e, 0x27, 
+    0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x73, 
+    0x65, 0x74, 0x20, 0x73, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 
+    0x61, 0x72, 0x65, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 
+    0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x77, 0x61, 0x79, 
+    0x20, 0x28, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x0a, 0x20, 0x20, 
+    0x63, 0x6f, 0x6e, 0x74, 0x69, 0x67, 0x75, 0x6f, 0x75, 0x73, 
+    0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x29, 0x3b, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0xe2, 0x80, 0x98, 0x43, 0x49, 
+    0x44, 0x2d, 0x6e, 0x65, 0x73, 0x73, 0xe2, 0x80, 0x99, 0x20, 
+    0x69, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x76, 0x69, 0x73, 0x69, 
+    0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 
+    0x0a, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 
+    0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 
+    0x54, 0x52, 0x49, 0x43, 0x4b, 0x59, 0x60, 0x3a, 0x20, 0x53, 
+    0x65, 0x74, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 0xe2, 0x80, 
+    0x98, 0x74, 0x72, 0x69, 0x63, 0x6b, 0x79, 0xe2, 0x80, 0x99, 
+    0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x2c, 
+    0x20, 0x69, 0x74, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 
+    0x20, 0x6e, 0x65, 0x65, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 
+    0x0a, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x74, 0x27, 0x73, 0x20, 0x6e, 0x61, 0x74, 
+    0x69, 0x76, 0x65, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x69, 0x6e, 
+    0x67, 0x20, 0x65, 0x6e, 0x67, 0x69, 0x6e, 0x65, 0x20, 0x74, 
+    0x6f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x61, 0x20, 0x72, 0x65, 
+    0x61, 0x73, 0x6f, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x72, 
+    0x65, 0x73, 0x75, 0x6c, 0x74, 0x2e, 0x20, 0x41, 0x0a, 0x20, 
+    0x20, 0x74, 0x79, 0x70, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x65, 
+    0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x69, 0x73, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x43, 0x68, 0x69, 0x6e, 0x65, 0x73, 
+    0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0xe2, 0x80, 0x98, 
+    0x6d, 0x69, 0x6e, 0x67, 0x6c, 0x69, 0x2e, 0x74, 0x74, 0x66, 
+    0xe2, 0x80, 0x99, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 
+    0x75, 0x73, 0x65, 0x73, 0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 
+    0x79, 0x70, 0x65, 0x0a, 0x20, 0x20, 0x62, 0x79, 0x74, 0x65, 
+    0x63, 0x6f, 0x64, 0x65, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x72, 
+    0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x74, 0x6f, 
+    0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x73, 0x63, 0x61, 0x6c, 0x65, 0x20, 0x61, 0x6c, 0x6c, 0x20, 
+    0x6f, 0x66, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x75, 0x62, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 
+    0x20, 0x49, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 
+    0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 
+    0x74, 0x6f, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x68, 0x69, 0x6e, 
+    0x74, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x73, 0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x0a, 0x20, 
+    0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x46, 0x4f, 0x52, 
+    0x43, 0x45, 0x5f, 0x41, 0x55, 0x54, 0x4f, 0x48, 0x49, 0x4e, 
+    0x54, 0x60, 0x3b, 0x20, 0x69, 0x74, 0x20, 0x77, 0x69, 0x6c, 
+    0x6c, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x69, 0x67, 0x6e, 
+    0x6f, 0x72, 0x65, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 
+    0x4e, 0x4f, 0x5f, 0x48, 0x49, 0x4e, 0x54, 0x49, 0x4e, 0x47, 
+    0x60, 0x2e, 0x20, 0x59, 0x6f, 0x75, 0x0a, 0x20, 0x20, 0x68, 
+    0x61, 0x76, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x65, 0x74, 
+    0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x60, 0x4c, 0x4f, 0x41, 
+    0x44, 0x2e, 0x4e, 0x4f, 0x5f, 0x48, 0x49, 0x4e, 0x54, 0x49, 
+    0x4e, 0x47, 0x60, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x60, 0x4c, 
+    0x4f, 0x41, 0x44, 0x2e, 0x4e, 0x4f, 0x5f, 0x41, 0x55, 0x54, 
+    0x4f, 0x48, 0x49, 0x4e, 0x54, 0x60, 0x20, 0x74, 0x6f, 0x20, 
+    0x72, 0x65, 0x61, 0x6c, 0x6c, 0x79, 0x0a, 0x20, 0x20, 0x64, 
+    0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x68, 0x69, 0x6e, 
+    0x74, 0x69, 0x6e, 0x67, 0x3b, 0x20, 0x68, 0x6f, 0x77, 0x65, 
+    0x76, 0x65, 0x72, 0x2c, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x70, 
+    0x72, 0x6f, 0x62, 0x61, 0x62, 0x6c, 0x79, 0x20, 0x6e, 0x65, 
+    0x76, 0x65, 0x72, 0x20, 0x77, 0x61, 0x6e, 0x74, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 
+    0x20, 0x66, 0x6f, 0x72, 0x0a, 0x20, 0x20, 0x64, 0x65, 0x6d, 
+    0x6f, 0x6e, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x70, 0x75, 0x72, 0x70, 0x6f, 0x73, 0x65, 0x73, 0x2e, 
+    0x0a, 0x0a, 0x20, 0x20, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 
+    0x74, 0x6c, 0x79, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x62, 0x6f, 0x75, 0x74, 
+    0x20, 0x61, 0x20, 0x64, 0x6f, 0x7a, 0x65, 0x6e, 0x20, 0x54, 
+    0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x0a, 0x20, 
+    0x20, 0x74, 0x72, 0x69, 0x63, 0x6b, 0x79, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x73, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 
+    0x61, 0x72, 0x65, 0x20, 0x68, 0x61, 0x72, 0x64, 0x2d, 0x63, 
+    0x6f, 0x64, 0x65, 0x64, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_FSTYPE[1261] = {
+    0x42, 0x69, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 
+    0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6e, 0x67, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6d, 0x62, 0x65, 0x64, 
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 
+    0x75, 0x62, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x0a, 
+    0x72, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x60, 0x46, 
+    0x61, 0x63, 0x65, 0x60, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 
+    0x49, 0x4e, 0x53, 0x54, 0x41, 0x4c, 0x4c, 0x41, 0x42, 0x4c, 
+    0x45, 0x5f, 0x45, 0x4d, 0x42, 0x45, 0x44, 0x44, 0x49, 0x4e, 
+    0x47, 0x60, 0x3a, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x73, 0x20, 
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x6e, 0x6f, 0x20, 0x66, 0x73, 
+    0x54, 0x79, 0x70, 0x65, 0x20, 0x62, 0x69, 0x74, 0x20, 0x73, 
+    0x65, 0x74, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x0a, 
+    0x20, 0x20, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 
+    0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x61, 
+    0x6e, 0x65, 0x6e, 0x74, 0x6c, 0x79, 0x20, 0x69, 0x6e, 0x73, 
+    0x74, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 
+    0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x62, 0x79, 
+    0x20, 0x61, 0x6e, 0x0a, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 
+    0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x52, 0x45, 0x53, 0x54, 0x52, 0x49, 0x43, 
+    0x54, 0x45, 0x44, 0x5f, 0x4c, 0x49, 0x43, 0x45, 0x4e, 0x53, 
+    0x45, 0x5f, 0x45, 0x4d, 0x42, 0x45, 0x44, 0x44, 0x49, 0x4e, 
+    0x47, 0x60, 0x3a, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x73, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 
+    0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x62, 0x69, 0x74, 0x20, 0x73, 0x65, 0x74, 0x0a, 0x20, 0x20, 
+    0x6d, 0x75, 0x73, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 
+    0x65, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 
+    0x2c, 0x20, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 
+    0x20, 0x6f, 0x72, 0x20, 0x65, 0x78, 0x63, 0x68, 0x61, 0x6e, 
+    0x67, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6e, 0x79, 
+    0x20, 0x6d, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x20, 0x77, 0x69, 
+    0x74, 0x68, 0x6f, 0x75, 0x74, 0x0a, 0x20, 0x20, 0x66, 0x69, 
+    0x72, 0x73, 0x74, 0x20, 0x6f, 0x62, 0x74, 0x61, 0x69, 0x6e, 
+    0x69, 0x6e, 0x67, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x69, 0x73, 
+    0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x73, 0x6f, 0x66, 
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 
+    0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6f, 0x77, 0x6e, 0x65, 
+    0x72, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x50, 0x52, 0x45, 
+    0x56, 0x49, 0x45, 0x57, 0x5f, 0x41, 0x4e, 0x44, 0x5f, 0x50, 
+    0x52, 0x49, 0x4e, 0x54, 0x5f, 0x45, 0x4d, 0x42, 0x45, 0x44, 
+    0x44, 0x49, 0x4e, 0x47, 0x60, 0x3a, 0x20, 0x49, 0x66, 0x20, 
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x62, 0x69, 0x74, 0x20, 0x69, 
+    0x73, 0x20, 0x73, 0x65, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x79, 0x20, 
+    0x62, 0x65, 0x0a, 0x20, 0x20, 0x65, 0x6d, 0x62, 0x65, 0x64, 
+    0x64, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x65, 
+    0x6d, 0x70, 0x6f, 0x72, 0x61, 0x72, 0x69, 0x6c, 0x79, 0x20, 
+    0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 
+    0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2e, 0x20, 0x44, 
+    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x0a, 0x20, 
+    0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x69, 0x6e, 
+    0x67, 0x20, 0x50, 0x72, 0x65, 0x76, 0x69, 0x65, 0x77, 0x20, 
+    0x26, 0x20, 0x50, 0x72, 0x69, 0x6e, 0x74, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x73, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 
+    0x65, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x65, 0x64, 0x20, 0xe2, 
+    0x80, 0x98, 0x72, 0x65, 0x61, 0x64, 0x2d, 0x6f, 0x6e, 0x6c, 
+    0x79, 0xe2, 0x80, 0x99, 0x3b, 0x20, 0x6e, 0x6f, 0x0a, 0x20, 
+    0x20, 0x65, 0x64, 0x69, 0x74, 0x73, 0x20, 0x63, 0x61, 0x6e, 
+    0x20, 0x62, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x65, 
+    0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 
+    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x45, 0x44, 0x49, 0x54, 0x41, 0x42, 0x4c, 
+    0x45, 0x5f, 0x45, 0x4d, 0x42, 0x45, 0x44, 0x44, 0x49, 0x4e, 
+    0x47, 0x60, 0x3a, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x69, 
+    0x73, 0x20, 0x62, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73, 
+    0x65, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 
+    0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x0a, 0x20, 
+    0x20, 0x62, 0x75, 0x74, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 
+    0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6e, 
+    0x73, 0x74, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x65, 
+    0x6d, 0x70, 0x6f, 0x72, 0x61, 0x72, 0x69, 0x6c, 0x79, 0x20, 
+    0x6f, 0x6e, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x73, 
+    0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x2e, 0x20, 0x49, 0x6e, 
+    0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x61, 0x73, 0x74, 0x0a, 
+    0x20, 0x20, 0x74, 0x6f, 0x20, 0x50, 0x72, 0x65, 0x76, 0x69, 
+    0x65, 0x77, 0x20, 0x26, 0x20, 0x50, 0x72, 0x69, 0x6e, 0x74, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x64, 0x6f, 
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x63, 0x6f, 
+    0x6e, 0x74, 0x61, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x65, 
+    0x64, 0x69, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x73, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 
+    0x0a, 0x20, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x65, 0x64, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 
+    0x67, 0x2c, 0x20, 0x65, 0x64, 0x69, 0x74, 0x69, 0x6e, 0x67, 
+    0x20, 0x69, 0x73, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x69, 0x74, 
+    0x74, 0x65, 0x64, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 
+    0x68, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x20, 0x6d, 0x61, 0x79, 
+    0x20, 0x62, 0x65, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x2e, 
+    0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4e, 0x4f, 0x5f, 0x53, 0x55, 
+    0x42, 0x53, 0x45, 0x54, 0x54, 0x49, 0x4e, 0x47, 0x60, 0x3a, 
+    0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x62, 
+    0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x2c, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 
+    0x6d, 0x61, 0x79, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 
+    0x20, 0x73, 0x75, 0x62, 0x73, 0x65, 0x74, 0x74, 0x65, 0x64, 
+    0x0a, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6f, 0x72, 0x20, 0x74, 
+    0x6f, 0x20, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x69, 0x6e, 
+    0x67, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x42, 0x49, 0x54, 
+    0x4d, 0x41, 0x50, 0x5f, 0x45, 0x4d, 0x42, 0x45, 0x44, 0x44, 
+    0x49, 0x4e, 0x47, 0x5f, 0x4f, 0x4e, 0x4c, 0x59, 0x60, 0x3a, 
+    0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x62, 
+    0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x2c, 
+    0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, 0x69, 0x74, 0x6d, 
+    0x61, 0x70, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 
+    0x6e, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x6d, 0x61, 
+    0x79, 0x20, 0x62, 0x65, 0x20, 0x65, 0x6d, 0x62, 0x65, 0x64, 
+    0x64, 0x65, 0x64, 0x3b, 0x20, 0x6e, 0x6f, 0x20, 0x6f, 0x75, 
+    0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 
+    0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x65, 0x6d, 
+    0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x2e, 0x20, 0x49, 0x66, 
+    0x0a, 0x20, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 
+    0x72, 0x65, 0x20, 0x6e, 0x6f, 0x20, 0x62, 0x69, 0x74, 0x6d, 
+    0x61, 0x70, 0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 
+    0x62, 0x6c, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x75, 0x6e, 0x65, 0x6d, 
+    0x62, 0x65, 0x64, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Face__init__[1878] = {
+    0x4d, 0x6f, 0x64, 0x65, 0x6c, 0x73, 0x20, 0x61, 0x20, 0x67, 
+    0x69, 0x76, 0x65, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x66, 
+    0x61, 0x63, 0x65, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 
+    0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x73, 0x74, 0x79, 0x6c, 
+    0x65, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 
+    0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x66, 0x69, 0x6c, 0x65, 
+    0x20, 0x3a, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2c, 0x20, 0x62, 
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2c, 0x20, 0x6f, 0x72, 0x20, 
+    0x72, 0x65, 0x61, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 
+    0x69, 0x6c, 0x65, 0x2d, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x6f, 
+    0x62, 0x6a, 0x65, 0x63, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x63, 
+    0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x64, 
+    0x61, 0x74, 0x61, 0x2e, 0x20, 0x20, 0x57, 0x68, 0x65, 0x72, 
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6c, 0x61, 0x74, 
+    0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 
+    0x73, 0x2c, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x69, 0x6c, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 
+    0x62, 0x79, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x69, 0x73, 
+    0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2d, 0x6d, 0x61, 
+    0x70, 0x70, 0x65, 0x64, 0x20, 0x72, 0x61, 0x74, 0x68, 0x65, 
+    0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x72, 0x65, 0x61, 
+    0x64, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x69, 0x74, 0x73, 0x20, 
+    0x70, 0x61, 0x67, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x61, 0x72, 0x65, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 
+    0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x70, 
+    0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x75, 
+    0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 
+    0x61, 0x6d, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x0a, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x41, 0x6e, 0x79, 0x20, 0x6f, 
+    0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 
+    0x6f, 0x72, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x70, 0x72, 
+    0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x20, 0x6f, 0x74, 0x68, 
+    0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x60, 0x62, 
+    0x79, 0x74, 0x65, 0x73, 0x60, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x28, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 
+    0x74, 0x61, 0x6b, 0x65, 0x6e, 0x20, 0x61, 0x73, 0x20, 0x61, 
+    0x20, 0x70, 0x61, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x73, 0x75, 
+    0x63, 0x68, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x60, 0x62, 
+    0x79, 0x74, 0x65, 0x61, 0x72, 0x72, 0x61, 0x79, 0x60, 0x2c, 
+    0x20, 0x60, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x76, 0x69, 
+    0x65, 0x77, 0x60, 0x20, 0x6f, 0x72, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x60, 0x6d, 0x6d, 0x61, 0x70, 0x2e, 0x6d, 0x6d, 0x61, 
+    0x70, 0x60, 0x2c, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x61, 
+    0x64, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6c, 0x79, 
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x63, 
+    0x6f, 0x70, 0x79, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x6b, 0x65, 
+    0x65, 0x70, 0x73, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x65, 
+    0x78, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x61, 0x73, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 
+    0x61, 0x73, 0x20, 0x69, 0x74, 0x20, 0x65, 0x78, 0x69, 0x73, 
+    0x74, 0x73, 0x2e, 0x0a, 0x0a, 0x66, 0x61, 0x63, 0x65, 0x5f, 
+    0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3a, 0x20, 0x69, 0x6e, 
+    0x74, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 
+    0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 
+    0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x77, 0x69, 
+    0x74, 0x68, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 
+    0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x61, 0x63, 0x65, 
+    0x20, 0x68, 0x61, 0x73, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2e, 0x0a, 0x0a, 0x6f, 
+    0x77, 0x6e, 0x5f, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 
+    0x20, 0x3a, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x2c, 0x20, 0x6f, 
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 
+    0x79, 0x7c, 0x20, 0x57, 0x68, 0x65, 0x6e, 0x20, 0x60, 0x54, 
+    0x72, 0x75, 0x65, 0x60, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x61, 0x63, 0x65, 0x20, 0x69, 0x73, 0x20, 0x67, 0x69, 
+    0x76, 0x65, 0x6e, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6f, 0x77, 
+    0x6e, 0x20, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x20, 
+    0x46, 0x72, 0x65, 0x65, 0x54, 0x79, 0x70, 0x65, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 
+    0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x2c, 
+    0x20, 0x72, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 
+    0x61, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x6e, 0x65, 
+    0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 
+    0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 
+    0x20, 0x66, 0x61, 0x63, 0x65, 0x73, 0x2e, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x46, 0x72, 0x65, 0x65, 0x54, 0x79, 0x70, 0x65, 
+    0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 
+    0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x20, 0x61, 0x20, 0x73, 0x69, 
+    0x6e, 0x67, 0x6c, 0x65, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 
+    0x72, 0x79, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 
+    0x65, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 
+    0x65, 0x64, 0x20, 0x62, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x65, 0x76, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x74, 0x68, 
+    0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x61, 0x74, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x69, 
+    0x6d, 0x65, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x69, 
+    0x73, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x66, 0x75, 
+    0x6c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x66, 0x61, 0x63, 0x65, 
+    0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x61, 0x74, 
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 
+    0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x75, 0x73, 0x65, 
+    0x64, 0x20, 0x62, 0x79, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 
+    0x72, 0x65, 0x6e, 0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 
+    0x64, 0x73, 0x2e, 0x20, 0x20, 0x4c, 0x69, 0x62, 0x72, 0x61, 
+    0x72, 0x79, 0x2d, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+    0x73, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x60, 0x73, 0x65, 
+    0x74, 0x5f, 0x6c, 0x63, 0x64, 0x5f, 0x66, 0x69, 0x6c, 0x74, 
+    0x65, 0x72, 0x60, 0x29, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 
+    0x6f, 0x70, 0x69, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 
+    0x64, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x69, 0x73, 
+    0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x2c, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x77, 
+    0x61, 0x72, 0x64, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 
+    0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x61, 0x6c, 0x6f, 
+    0x6e, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x60, 0x46, 
+    0x61, 0x63, 0x65, 0x2e, 0x73, 0x65, 0x74, 0x5f, 0x6c, 0x63, 
+    0x64, 0x5f, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x60, 0x2e, 
+    0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x66, 0x61, 
+    0x63, 0x65, 0x20, 0x3a, 0x20, 0x46, 0x61, 0x63, 0x65, 0x20, 
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x0a, 0x0a, 
+    0x4e, 0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x4c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x2c, 
+    0x20, 0x68, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x69, 
+    0x6e, 0x67, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 
+    0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x47, 0x49, 0x4c, 0x2c, 0x20, 0x73, 0x6f, 0x20, 
+    0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x0a, 
+    0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x20, 0x6f, 0x62, 0x6a, 
+    0x65, 0x63, 0x74, 0x73, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 
+    0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 
+    0x6d, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 
+    0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 
+    0x69, 0x6e, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6c, 0x6c, 0x65, 
+    0x6c, 0x2e, 0x20, 0x20, 0x43, 0x61, 0x6c, 0x6c, 0x73, 0x0a, 
+    0x6f, 0x6e, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 
+    0x65, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x20, 0x28, 
+    0x61, 0x6e, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x60, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x60, 0x20, 0x6f, 
+    0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x6c, 0x6f, 0x61, 
+    0x64, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x69, 
+    0x74, 0x29, 0x20, 0x61, 0x72, 0x65, 0x0a, 0x73, 0x65, 0x72, 
+    0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x62, 0x79, 
+    0x20, 0x61, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x68, 0x65, 
+    0x6c, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x2e, 0x0a, 0x0a, 0x41, 
+    0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2d, 0x6d, 0x61, 
+    0x70, 0x70, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 
+    0x66, 0x69, 0x6c, 0x65, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 
+    0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x74, 0x72, 0x75, 
+    0x6e, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x6f, 0x72, 0x20, 
+    0x72, 0x65, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6e, 0x20, 
+    0x69, 0x6e, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x0a, 0x77, 
+    0x68, 0x69, 0x6c, 0x65, 0x20, 0x61, 0x20, 0x66, 0x61, 0x63, 
+    0x65, 0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x74, 
+    0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x2e, 0x20, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x77, 
+    0x6f, 0x75, 0x6c, 0x64, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 
+    0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2c, 0x0a, 0x6f, 0x72, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 
+    0x73, 0x73, 0x20, 0x63, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 
+    0x65, 0x20, 0x6b, 0x69, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x77, 
+    0x69, 0x74, 0x68, 0x20, 0x60, 0x60, 0x53, 0x49, 0x47, 0x42, 
+    0x55, 0x53, 0x60, 0x60, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 
+    0x69, 0x74, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x73, 0x20, 0x61, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x2e, 0x0a, 0x52, 0x65, 
+    0x70, 0x6c, 0x61, 0x63, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x62, 0x79, 0x20, 
+    0x77, 0x72, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 
+    0x6e, 0x65, 0x77, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x72, 0x65, 0x6e, 0x61, 0x6d, 0x69, 0x6e, 
+    0x67, 0x20, 0x69, 0x74, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6f, 0x6c, 0x64, 0x0a, 0x6f, 0x6e, 
+    0x65, 0x2e, 0x20, 0x20, 0x41, 0x6c, 0x74, 0x65, 0x72, 0x6e, 
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x6c, 0x79, 0x2c, 0x20, 0x70, 
+    0x61, 0x73, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x6f, 0x70, 0x65, 
+    0x6e, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x6f, 0x62, 0x6a, 
+    0x65, 0x63, 0x74, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 
+    0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x69, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x75, 0x73, 0x75, 0x61, 
+    0x6c, 0x20, 0x77, 0x61, 0x79, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_ascender[172] = {
+    0x54, 0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x6f, 0x67, 0x72, 
+    0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x61, 0x73, 0x63, 0x65, 
+    0x6e, 0x64, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x2c, 0x20, 0x65, 0x78, 
+    0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x75, 0x6e, 0x69, 0x74, 
+    0x73, 0x2e, 0x20, 0x46, 0x6f, 0x72, 0x0a, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x20, 
+    0x6e, 0x6f, 0x74, 0x20, 0x68, 0x61, 0x76, 0x69, 0x6e, 0x67, 
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x69, 
+    0x74, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 
+    0x6f, 0x0a, 0x60, 0x42, 0x42, 0x6f, 0x78, 0x2e, 0x79, 0x4d, 
+    0x61, 0x78, 0x60, 0x2e, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 
+    0x72, 0x65, 0x6c, 0x65, 0x76, 0x61, 0x6e, 0x74, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x61, 0x62, 0x6c, 
+    0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_Face_attach[345] = {
+    0xe2, 0x80, 0x98, 0x41, 0x74, 0x74, 0x61, 0x63, 0x68, 0xe2, 
+    0x80, 0x99, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x74, 0x6f, 
+    0x20, 0x61, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x6f, 0x62, 
+    0x6a, 0x65, 0x63, 0x74, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x72, 
+    0x6d, 0x61, 0x6c, 0x6c, 0x79, 0x2c, 0x20, 0x74, 0x68, 0x69, 
+    0x73, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 
+    0x74, 0x6f, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x61, 0x64, 
+    0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x69, 
+    0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x61, 0x63, 0x65, 0x0a, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 
+    0x2e, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6d, 
+    0x70, 0x6c, 0x65, 0x2c, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x63, 
+    0x61, 0x6e, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x20, 
+    0x61, 0x6e, 0x20, 0x41, 0x46, 0x4d, 0x20, 0x66, 0x69, 0x6c, 
+    0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x6d, 
+    0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 
+    0x54, 0x79, 0x70, 0x65, 0x0a, 0x31, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x74, 0x6f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x69, 0x6e, 0x67, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6d, 0x65, 
+    0x74, 0x72, 0x69, 0x63, 0x73, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 
+    0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 
+    0x66, 0x69, 0x6c, 0x65, 0x20, 0x3a, 0x20, 0x70, 0x61, 0x74, 
+    0x68, 0x2c, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2c, 
+    0x20, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x61, 0x64, 0x61, 0x62, 
+    0x6c, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x6c, 0x69, 
+    0x6b, 0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 
+    0x6c, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 
+    0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 
+    0x74, 0x61, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x74, 0x74, 0x61, 
+    0x63, 0x68, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_available_sizes[70] = {
+    0x41, 0x6e, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 
+    0x20, 0x60, 0x42, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x5f, 0x53, 
+    0x69, 0x7a, 0x65, 0x60, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 
+    0x74, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6c, 0x6c, 
+    0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x73, 0x74, 
+    0x72, 0x69, 0x6b, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_bbox[425] = {
+    0x54, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x62, 
+    0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6f, 
+    0x78, 0x2e, 0x20, 0x43, 0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e, 
+    0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x65, 
+    0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x69, 
+    0x6e, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x75, 0x6e, 0x69, 
+    0x74, 0x73, 0x20, 0x28, 0x73, 0x65, 0x65, 0x0a, 0x60, 0x7e, 
+    0x46, 0x61, 0x63, 0x65, 0x2e, 0x75, 0x6e, 0x69, 0x74, 0x73, 
+    0x5f, 0x70, 0x65, 0x72, 0x5f, 0x65, 0x6d, 0x60, 0x29, 0x2e, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x62, 0x6f, 0x78, 0x20, 0x69, 
+    0x73, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x20, 0x65, 0x6e, 
+    0x6f, 0x75, 0x67, 0x68, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 
+    0x6e, 0x74, 0x61, 0x69, 0x6e, 0x20, 0x61, 0x6e, 0x79, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x0a, 0x66, 0x72, 0x6f, 0x6d, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 
+    0x20, 0x54, 0x68, 0x75, 0x73, 0x2c, 0x20, 0x60, 0x42, 0x42, 
+    0x6f, 0x78, 0x2e, 0x79, 0x5f, 0x6d, 0x61, 0x78, 0x60, 0x20, 
+    0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x73, 0x65, 0x65, 
+    0x6e, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0xe2, 
+    0x80, 0x98, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x0a, 
+    0x61, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 0xe2, 0x80, 
+    0x99, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x60, 0x42, 0x42, 
+    0x6f, 0x78, 0x2e, 0x79, 0x5f, 0x6d, 0x69, 0x6e, 0x60, 0x20, 
+    0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0xe2, 0x80, 0x98, 
+    0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x64, 0x65, 
+    0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 0xe2, 0x80, 0x99, 
+    0x2e, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x6c, 
+    0x65, 0x76, 0x61, 0x6e, 0x74, 0x0a, 0x66, 0x6f, 0x72, 0x20, 
+    0x73, 0x63, 0x61, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x2e, 0x0a, 0x0a, 0x4e, 
+    0x6f, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 
+    0x67, 0x20, 0x62, 0x6f, 0x78, 0x20, 0x6d, 0x69, 0x67, 0x68, 
+    0x74, 0x20, 0x62, 0x65, 0x20, 0x6f, 0x66, 0x66, 0x20, 0x62, 
+    0x79, 0x20, 0x28, 0x61, 0x74, 0x20, 0x6c, 0x65, 0x61, 0x73, 
+    0x74, 0x29, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x70, 0x69, 0x78, 
+    0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x0a, 0x68, 0x69, 0x6e, 
+    0x74, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2e, 
+    0x20, 0x53, 0x65, 0x65, 0x20, 0x60, 0x53, 0x69, 0x7a, 0x65, 
+    0x5f, 0x4d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x60, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x66, 0x75, 0x72, 0x74, 0x68, 0x65, 
+    0x72, 0x20, 0x64, 0x69, 0x73, 0x63, 0x75, 0x73, 0x73, 0x69, 
+    0x6f, 0x6e, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_charmap[33] = {
+    0x54, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 
+    0x74, 0x6c, 0x79, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 
+    0x20, 0x60, 0x43, 0x68, 0x61, 0x72, 0x4d, 0x61, 0x70, 0x60, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_charmaps[30] = {
+    0x41, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 
+    0x60, 0x43, 0x68, 0x61, 0x72, 0x4d, 0x61, 0x70, 0x60, 0x20, 
+    0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_coverage[383] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 
+    0x65, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x55, 0x6e, 0x69, 0x63, 
+    0x6f, 0x64, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+    0x74, 0x65, 0x72, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x61, 0x63, 0x65, 0x20, 0x68, 0x61, 0x73, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x2e, 0x0a, 
+    0x0a, 0x54, 0x68, 0x65, 0x20, 0x60, 0x43, 0x6f, 0x76, 0x65, 
+    0x72, 0x61, 0x67, 0x65, 0x60, 0x20, 0x69, 0x73, 0x20, 0x63, 
+    0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72, 
+    0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 
+    0x65, 0x27, 0x73, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 
+    0x65, 0x20, 0x60, 0x43, 0x68, 0x61, 0x72, 0x4d, 0x61, 0x70, 
+    0x60, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 
+    0x74, 0x0a, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x69, 0x74, 0x20, 
+    0x69, 0x73, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 
+    0x65, 0x64, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x6f, 0x62, 0x6a, 
+    0x65, 0x63, 0x74, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x61, 0x66, 0x74, 0x65, 
+    0x72, 0x77, 0x61, 0x72, 0x64, 0x2e, 0x20, 0x20, 0x54, 0x68, 
+    0x65, 0x0a, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 
+    0x20, 0x60, 0x43, 0x68, 0x61, 0x72, 0x4d, 0x61, 0x70, 0x60, 
+    0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x63, 0x68, 
+    0x61, 0x6e, 0x67, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x7c, 0x66, 
+    0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 0x20, 0x54, 
+    0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x66, 
+    0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x2d, 0x73, 0x70, 
+    0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 0x66, 0x75, 0x6e, 
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 
+    0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x0a, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x61, 
+    0x67, 0x65, 0x20, 0x3a, 0x20, 0x43, 0x6f, 0x76, 0x65, 0x72, 
+    0x61, 0x67, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x45, 0x6d, 
+    0x70, 0x74, 0x79, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x68, 0x61, 0x73, 0x20, 
+    0x6e, 0x6f, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 
+    0x20, 0x60, 0x43, 0x68, 0x61, 0x72, 0x4d, 0x61, 0x70, 0x60, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_descender[216] = {
+    0x54, 0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x6f, 0x67, 0x72, 
+    0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x64, 0x65, 0x73, 0x63, 
+    0x65, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x2c, 0x20, 0x65, 
+    0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x69, 
+    0x6e, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x75, 0x6e, 0x69, 
+    0x74, 0x73, 0x2e, 0x20, 0x46, 0x6f, 0x72, 0x0a, 0x66, 0x6f, 
+    0x6e, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 
+    0x20, 0x6e, 0x6f, 0x74, 0x20, 0x68, 0x61, 0x76, 0x69, 0x6e, 
+    0x67, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x66, 
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 
+    0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 
+    0x74, 0x6f, 0x0a, 0x60, 0x42, 0x42, 0x6f, 0x78, 0x2e, 0x79, 
+    0x5f, 0x6d, 0x69, 0x6e, 0x60, 0x2e, 0x20, 0x4e, 0x6f, 0x74, 
+    0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x69, 
+    0x73, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x69, 0x73, 
+    0x20, 0x75, 0x73, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x6e, 
+    0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2e, 0x20, 0x4f, 
+    0x6e, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x76, 0x61, 
+    0x6e, 0x74, 0x0a, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x63, 0x61, 
+    0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 
+    0x61, 0x74, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_face_flags[76] = {
+    0x41, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x60, 
+    0x46, 0x41, 0x43, 0x45, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x60, 
+    0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x74, 0x68, 0x61, 
+    0x74, 0x20, 0x67, 0x69, 0x76, 0x65, 0x20, 0x69, 0x6d, 0x70, 
+    0x6f, 0x72, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x66, 
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 
+    0x62, 0x6f, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x61, 0x63, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_face_index[100] = {
+    0x54, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 
+    0x65, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x20, 
+    0x49, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 
+    0x74, 0x6f, 0x20, 0x30, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x72, 0x65, 0x20, 0x69, 0x73, 0x0a, 0x6f, 0x6e, 0x6c, 
+    0x79, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 
+    0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_family_name[443] = {
+    0x54, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x27, 0x73, 
+    0x20, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x20, 0x6e, 0x61, 
+    0x6d, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 
+    0x73, 0x20, 0x61, 0x6e, 0x20, 0x41, 0x53, 0x43, 0x49, 0x49, 
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x75, 
+    0x73, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x69, 0x6e, 0x20, 
+    0x45, 0x6e, 0x67, 0x6c, 0x69, 0x73, 0x68, 0x2c, 0x0a, 0x77, 
+    0x68, 0x69, 0x63, 0x68, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 
+    0x69, 0x62, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 
+    0x79, 0x70, 0x65, 0x66, 0x61, 0x63, 0x65, 0x27, 0x73, 0x20, 
+    0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x20, 0x28, 0x6c, 0x69, 
+    0x6b, 0x65, 0x20, 0xe2, 0x80, 0x98, 0x54, 0x69, 0x6d, 0x65, 
+    0x73, 0x20, 0x4e, 0x65, 0x77, 0x20, 0x52, 0x6f, 0x6d, 0x61, 
+    0x6e, 0xe2, 0x80, 0x99, 0x2c, 0x0a, 0xe2, 0x80, 0x98, 0x42, 
+    0x6f, 0x64, 0x6f, 0x6e, 0x69, 0xe2, 0x80, 0x99, 0x2c, 0x20, 
+    0xe2, 0x80, 0x98, 0x47, 0x61, 0x72, 0x61, 0x6d, 0x6f, 0x6e, 
+    0x64, 0xe2, 0x80, 0x99, 0x2c, 0x20, 0x65, 0x74, 0x63, 0x29, 
+    0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 
+    0x61, 0x20, 0x6c, 0x65, 0x61, 0x73, 0x74, 0x20, 0x63, 0x6f, 
+    0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x64, 0x65, 0x6e, 0x6f, 0x6d, 
+    0x69, 0x6e, 0x61, 0x74, 0x6f, 0x72, 0x20, 0x75, 0x73, 0x65, 
+    0x64, 0x20, 0x74, 0x6f, 0x0a, 0x6c, 0x69, 0x73, 0x74, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2e, 0x20, 0x53, 0x6f, 0x6d, 
+    0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x20, 
+    0x28, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 
+    0x26, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x54, 0x79, 0x70, 0x65, 
+    0x29, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x20, 
+    0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x20, 
+    0x61, 0x6e, 0x64, 0x0a, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 
+    0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 
+    0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x41, 0x70, 0x70, 
+    0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 
+    0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x75, 0x73, 0x65, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 
+    0x74, 0x0a, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 
+    0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 
+    0x20, 0x74, 0x6f, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 
+    0x20, 0x74, 0x68, 0x65, 0x6d, 0x2e, 0x20, 0x43, 0x61, 0x6e, 
+    0x20, 0x62, 0x65, 0x20, 0x60, 0x4e, 0x6f, 0x6e, 0x65, 0x60, 
+    0x20, 0x28, 0x65, 0x2e, 0x67, 0x2e, 0x2c, 0x20, 0x69, 0x6e, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x0a, 0x65, 0x6d, 0x62, 
+    0x65, 0x64, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x61, 
+    0x20, 0x50, 0x44, 0x46, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x29, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_filename[107] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 
+    0x65, 0x6e, 0x74, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 
+    0x6f, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 
+    0x7a, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x2e, 0x0a, 0x0a, 0x49, 0x74, 0x20, 0x69, 0x73, 0x20, 
+    0x75, 0x73, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x61, 0x20, 
+    0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 
+    0x62, 0x75, 0x74, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 
+    0x20, 0x61, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x6f, 0x62, 
+    0x6a, 0x65, 0x63, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_get_char_index[969] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 
+    0x6f, 0x66, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x63, 0x6f, 0x64, 0x65, 
+    0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x75, 0x73, 0x65, 
+    0x73, 0x20, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x6d, 0x61, 
+    0x70, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x74, 
+    0x6f, 0x20, 0x64, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 
+    0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x2e, 0x0a, 0x0a, 0x50, 
+    0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x0a, 0x63, 0x68, 0x61, 0x72, 0x63, 0x6f, 0x64, 0x65, 0x20, 
+    0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x63, 
+    0x6f, 0x64, 0x65, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 
+    0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x5f, 0x69, 0x6e, 
+    0x64, 0x65, 0x78, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 
+    0x20, 0x20, 0x30, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 
+    0xe2, 0x80, 0x98, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 
+    0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x63, 0x6f, 
+    0x64, 0x65, 0xe2, 0x80, 0x99, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 
+    0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 
+    0x49, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x75, 0x73, 0x65, 
+    0x20, 0x46, 0x72, 0x65, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 
+    0x74, 0x6f, 0x20, 0x6d, 0x61, 0x6e, 0x69, 0x70, 0x75, 0x6c, 
+    0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 
+    0x6e, 0x74, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 
+    0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6c, 0x79, 0x2c, 
+    0x0a, 0x62, 0x65, 0x20, 0x61, 0x77, 0x61, 0x72, 0x65, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 
+    0x62, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x6f, 0x65, 
+    0x73, 0x6e, 0x27, 0x74, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 
+    0x73, 0x0a, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 
+    0x6e, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x69, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x20, 0x69, 
+    0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x75, 0x73, 0x65, 
+    0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x20, 0x54, 
+    0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x64, 0x6f, 0x6e, 
+    0x65, 0x0a, 0x74, 0x6f, 0x20, 0x65, 0x6e, 0x73, 0x75, 0x72, 
+    0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x76, 0x61, 0x6c, 
+    0x75, 0x65, 0x20, 0x30, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 
+    0x73, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 
+    0x6e, 0x64, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0xe2, 0x80, 0x98, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 
+    0x67, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0xe2, 0x80, 0x99, 
+    0x2e, 0x20, 0x49, 0x66, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x69, 0x72, 0x73, 0x74, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6e, 0x61, 
+    0x6d, 0x65, 0x64, 0x20, 0xe2, 0x80, 0x98, 0x2e, 0x6e, 0x6f, 
+    0x74, 0x64, 0x65, 0x66, 0xe2, 0x80, 0x99, 0x2c, 0x20, 0x74, 
+    0x68, 0x65, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x54, 0x79, 
+    0x70, 0x65, 0x20, 0x31, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x54, 
+    0x79, 0x70, 0x65, 0x20, 0x34, 0x32, 0x0a, 0x66, 0x6f, 0x6e, 
+    0x74, 0x73, 0x2c, 0x20, 0xe2, 0x80, 0x98, 0x2e, 0x6e, 0x6f, 
+    0x74, 0x64, 0x65, 0x66, 0xe2, 0x80, 0x99, 0x20, 0x77, 0x69, 
+    0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 
+    0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x49, 0x44, 0x20, 
+    0x30, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
+    0x2c, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x77, 0x68, 0x61, 0x74, 
+    0x65, 0x76, 0x65, 0x72, 0x20, 0x77, 0x61, 0x73, 0x20, 0x74, 
+    0x68, 0x65, 0x72, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 
+    0x62, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20, 0x74, 
+    0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x69, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0xe2, 0x80, 0x98, 0x2e, 0x6e, 
+    0x6f, 0x74, 0x64, 0x65, 0x66, 0xe2, 0x80, 0x99, 0x20, 0x68, 
+    0x61, 0x64, 0x2e, 0x20, 0x46, 0x6f, 0x72, 0x0a, 0x54, 0x79, 
+    0x70, 0x65, 0x20, 0x31, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 
+    0x2c, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 
+    0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0xe2, 0x80, 0x98, 
+    0x2e, 0x6e, 0x6f, 0x74, 0x64, 0x65, 0x66, 0xe2, 0x80, 0x99, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x61, 0x74, 0x20, 
+    0x61, 0x6c, 0x6c, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 
+    0x6f, 0x6e, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 
+    0x65, 0x0a, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 
+    0x61, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x30, 
+    0x20, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x68, 0x61, 0x74, 0x65, 
+    0x76, 0x65, 0x72, 0x20, 0x77, 0x61, 0x73, 0x20, 0x74, 0x68, 
+    0x65, 0x72, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 
+    0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20, 0x74, 0x6f, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x0a, 
+    0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x2d, 0x2d, 0x20, 0x54, 
+    0x79, 0x70, 0x65, 0x20, 0x34, 0x32, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6f, 0x6e, 
+    0x73, 0x69, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 
+    0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 
+    0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x63, 0x6f, 0x6e, 
+    0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_get_char_index_unicode[457] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 
+    0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 
+    0x6e, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x2e, 
+    0x0a, 0x0a, 0x55, 0x6e, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x60, 
+    0x67, 0x65, 0x74, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x5f, 0x69, 
+    0x6e, 0x64, 0x65, 0x78, 0x60, 0x2c, 0x20, 0x69, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
+    0x65, 0x64, 0x20, 0x60, 0x43, 0x68, 0x61, 0x72, 0x4d, 0x61, 
+    0x70, 0x60, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 
+    0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x2c, 0x20, 0x74, 
+    0x68, 0x65, 0x0a, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x75, 
+    0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x77, 0x69, 0x6c, 
+    0x6c, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x62, 0x65, 
+    0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x20, 0x74, 
+    0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x72, 0x72, 
+    0x65, 0x63, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+    0x74, 0x65, 0x72, 0x0a, 0x6d, 0x61, 0x70, 0x2c, 0x20, 0x69, 
+    0x66, 0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 
+    0x2e, 0x0a, 0x0a, 0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 
+    0x70, 0x79, 0x7c, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 
+    0x73, 0x20, 0x61, 0x20, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 
+    0x70, 0x79, 0x2d, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 
+    0x63, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 
+    0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x63, 0x68, 0x61, 0x72, 0x63, 
+    0x6f, 0x64, 0x65, 0x20, 0x3a, 0x20, 0x6c, 0x65, 0x6e, 0x67, 
+    0x74, 0x68, 0x2d, 0x31, 0x20, 0x75, 0x6e, 0x69, 0x63, 0x6f, 
+    0x64, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 
+    0x6f, 0x72, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 
+    0x64, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 
+    0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x0a, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x5f, 0x69, 0x6e, 0x64, 
+    0x65, 0x78, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x20, 
+    0x20, 0x30, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0xe2, 
+    0x80, 0x98, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 
+    0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x63, 0x6f, 0x64, 
+    0x65, 0xe2, 0x80, 0x99, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_get_char_indices[668] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 
+    0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x6e, 0x79, 
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 
+    0x73, 0x20, 0x61, 0x74, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0x2e, 
+    0x0a, 0x0a, 0x46, 0x6f, 0x72, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 
+    0x20, 0x72, 0x75, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x65, 0x78, 0x74, 0x2c, 0x20, 0x61, 0x20, 0x6c, 0x6f, 0x6f, 
+    0x6b, 0x75, 0x70, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x42, 0x61, 
+    0x73, 0x69, 0x63, 0x20, 0x4d, 0x75, 0x6c, 0x74, 0x69, 0x6c, 
+    0x69, 0x6e, 0x67, 0x75, 0x61, 0x6c, 0x20, 0x50, 0x6c, 0x61, 
+    0x6e, 0x65, 0x0a, 0x69, 0x73, 0x20, 0x62, 0x75, 0x69, 0x6c, 
+    0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x60, 
+    0x43, 0x68, 0x61, 0x72, 0x4d, 0x61, 0x70, 0x60, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x6b, 0x65, 0x70, 0x74, 0x20, 0x77, 0x69, 
+    0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 
+    0x65, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x61, 0x74, 
+    0x0a, 0x6c, 0x61, 0x74, 0x65, 0x72, 0x20, 0x63, 0x61, 0x6c, 
+    0x6c, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x20, 0x73, 
+    0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 
+    0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x74, 0x65, 0x78, 0x74, 0x2e, 0x0a, 0x0a, 0x7c, 0x66, 0x72, 
+    0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 0x20, 0x54, 0x68, 
+    0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x66, 0x72, 
+    0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x2d, 0x73, 0x70, 0x65, 
+    0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 0x66, 0x75, 0x6e, 0x63, 
+    0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 
+    0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x74, 
+    0x65, 0x78, 0x74, 0x20, 0x3a, 0x20, 0x73, 0x74, 0x72, 0x2c, 
+    0x20, 0x6f, 0x72, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 
+    0x63, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x62, 0x75, 0x66, 0x66, 
+    0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x6e, 0x74, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x74, 
+    0x6f, 0x20, 0x6d, 0x61, 0x70, 0x2e, 0x20, 0x20, 0x41, 0x20, 
+    0x73, 0x74, 0x72, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x6f, 0x6e, 
+    0x6c, 0x79, 0x20, 0x62, 0x65, 0x20, 0x6d, 0x61, 0x70, 0x70, 
+    0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 
+    0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x60, 0x43, 0x68, 0x61, 0x72, 0x4d, 0x61, 0x70, 
+    0x60, 0x2e, 0x20, 0x20, 0x49, 0x6e, 0x74, 0x65, 0x67, 0x65, 
+    0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x69, 0x6e, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 
+    0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 
+    0x74, 0x65, 0x64, 0x20, 0x60, 0x43, 0x68, 0x61, 0x72, 0x4d, 
+    0x61, 0x70, 0x60, 0x2c, 0x20, 0x61, 0x73, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x60, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x68, 0x61, 
+    0x72, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x60, 0x2e, 0x0a, 
+    0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x5f, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 
+    0x20, 0x3a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x41, 0x20, 0x62, 0x75, 0x66, 0x66, 
+    0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x75, 0x6e, 0x73, 0x69, 
+    0x67, 0x6e, 0x65, 0x64, 0x20, 0x33, 0x32, 0x2d, 0x62, 0x69, 
+    0x74, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6e, 
+    0x64, 0x69, 0x63, 0x65, 0x73, 0x2e, 0x20, 0x20, 0x30, 0x20, 
+    0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0xe2, 0x80, 0x98, 0x75, 
+    0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 
+    0x64, 0x65, 0xe2, 0x80, 0x99, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_get_char_map_arrays[541] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x47, 0x65, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 
+    0x20, 0x63, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 
+    0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 0x20, 
+    0x61, 0x74, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0x2e, 0x0a, 0x0a, 
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x65, 0x71, 
+    0x75, 0x69, 0x76, 0x61, 0x6c, 0x65, 0x6e, 0x74, 0x20, 0x74, 
+    0x6f, 0x20, 0x60, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x68, 0x61, 
+    0x72, 0x73, 0x60, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 0x20, 0x69, 0x73, 0x20, 
+    0x72, 0x65, 0x61, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x0a, 
+    0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x70, 0x61, 0x73, 
+    0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 
+    0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 
+    0x20, 0x50, 0x79, 0x74, 0x68, 0x6f, 0x6e, 0x20, 0x6f, 0x62, 
+    0x6a, 0x65, 0x63, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 
+    0x61, 0x63, 0x68, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x2e, 
+    0x0a, 0x0a, 0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 
+    0x79, 0x7c, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 
+    0x20, 0x61, 0x20, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 
+    0x79, 0x2d, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 
+    0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 
+    0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x63, 0x68, 
+    0x61, 0x72, 0x63, 0x6f, 0x64, 0x65, 0x73, 0x2c, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x5f, 0x69, 0x6e, 0x64, 0x69, 0x63, 
+    0x65, 0x73, 0x20, 0x3a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 
+    0x72, 0x2c, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x54, 0x77, 0x6f, 0x20, 0x62, 0x75, 
+    0x66, 0x66, 0x65, 0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x75, 
+    0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x33, 0x32, 
+    0x2d, 0x62, 0x69, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 
+    0x65, 0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x6c, 0x65, 0x6e, 0x67, 
+    0x74, 0x68, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x63, 0x6f, 
+    0x64, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6e, 
+    0x20, 0x69, 0x6e, 0x63, 0x72, 0x65, 0x61, 0x73, 0x69, 0x6e, 
+    0x67, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2c, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x68, 0x61, 
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 
+    0x61, 0x6d, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 
+    0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x2a, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x5f, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 
+    0x2a, 0x2e, 0x20, 0x20, 0x42, 0x6f, 0x74, 0x68, 0x20, 0x61, 
+    0x72, 0x65, 0x20, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x20, 0x69, 
+    0x66, 0x20, 0x6e, 0x6f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 0x20, 0x69, 0x73, 0x20, 
+    0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Face_get_char_name[309] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 
+    0x65, 0x6e, 0x20, 0x75, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 
+    0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x70, 0x6f, 0x69, 0x6e, 
+    0x74, 0x2e, 0x0a, 0x0a, 0x55, 0x6e, 0x6c, 0x69, 0x6b, 0x65, 
+    0x20, 0x60, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x60, 0x2c, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
+    0x6f, 0x6e, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x61, 0x6c, 
+    0x77, 0x61, 0x79, 0x73, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6e, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x74, 0x68, 0x69, 0x6e, 
+    0x67, 0x2c, 0x0a, 0x65, 0x76, 0x65, 0x6e, 0x20, 0x69, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 
+    0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x6e, 
+    0x6f, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x6e, 0x61, 
+    0x6d, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 
+    0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x63, 0x68, 
+    0x61, 0x72, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x3a, 0x20, 0x69, 
+    0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x63, 0x6f, 0x64, 0x65, 
+    0x2e, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x20, 
+    0x3a, 0x20, 0x75, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x61, 
+    0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_get_char_variant_index[884] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x69, 0x64, 0x20, 0x6f, 0x66, 0x20, 
+    0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x63, 0x6f, 0x64, 
+    0x65, 0x20, 0x61, 0x73, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 
+    0x69, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x74, 0x0a, 0x73, 
+    0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2e, 0x0a, 0x0a, 
+    0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x63, 0x68, 0x61, 0x72, 0x63, 0x6f, 0x64, 0x65, 
+    0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 
+    0x63, 0x6f, 0x64, 0x65, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 
+    0x20, 0x69, 0x6e, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 
+    0x65, 0x2e, 0x0a, 0x0a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x6e, 
+    0x74, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 
+    0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 
+    0x65, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x70, 0x6f, 0x69, 
+    0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x76, 0x61, 0x72, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+    0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2e, 0x0a, 
+    0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3a, 
+    0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 
+    0x6e, 0x64, 0x65, 0x78, 0x2e, 0x20, 0x30, 0x20, 0x6d, 0x65, 
+    0x61, 0x6e, 0x73, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 
+    0x20, 0xe2, 0x80, 0x98, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 
+    0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x63, 
+    0x6f, 0x64, 0x65, 0xe2, 0x80, 0x99, 0x2c, 0x20, 0x6f, 0x72, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0xe2, 0x80, 0x98, 0x75, 0x6e, 
+    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x73, 0x65, 
+    0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x64, 
+    0x65, 0xe2, 0x80, 0x99, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0xe2, 
+    0x80, 0x98, 0x6e, 0x6f, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 
+    0x74, 0x6f, 0x72, 0x20, 0x63, 0x6d, 0x61, 0x70, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x75, 0x62, 0x74, 0x61, 0x62, 0x6c, 
+    0x65, 0xe2, 0x80, 0x99, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0xe2, 
+    0x80, 0x98, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 
+    0x43, 0x68, 0x61, 0x72, 0x4d, 0x61, 0x70, 0x20, 0x69, 0x73, 
+    0x20, 0x6e, 0x6f, 0x74, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 
+    0x64, 0x65, 0xe2, 0x80, 0x99, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 
+    0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 
+    0x49, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x75, 0x73, 0x65, 
+    0x20, 0x46, 0x72, 0x65, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 
+    0x74, 0x6f, 0x20, 0x6d, 0x61, 0x6e, 0x69, 0x70, 0x75, 0x6c, 
+    0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 
+    0x6e, 0x74, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 
+    0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6c, 0x79, 0x2c, 
+    0x0a, 0x62, 0x65, 0x20, 0x61, 0x77, 0x61, 0x72, 0x65, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 
+    0x62, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x6f, 0x65, 
+    0x73, 0x6e, 0x27, 0x74, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 
+    0x73, 0x0a, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 
+    0x6e, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x69, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x20, 0x69, 
+    0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x75, 0x73, 0x65, 
+    0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x20, 0x54, 
+    0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x64, 0x6f, 0x6e, 
+    0x65, 0x0a, 0x74, 0x6f, 0x20, 0x65, 0x6e, 0x73, 0x75, 0x72, 
+    0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x76, 0x61, 0x6c, 
+    0x75, 0x65, 0x20, 0x30, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 
+    0x73, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 
+    0x6e, 0x64, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0xe2, 0x80, 0x98, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 
+    0x67, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0xe2, 0x80, 0x99, 
+    0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 
+    0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x69, 
+    0x6e, 0x67, 0x66, 0x75, 0x6c, 0x20, 0x69, 0x66, 0x20, 0x61, 
+    0x29, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x20, 0x76, 0x61, 0x72, 
+    0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x73, 0x65, 0x6c, 
+    0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x63, 0x6d, 0x61, 0x70, 
+    0x20, 0x73, 0x75, 0x62, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 
+    0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x62, 0x29, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 0x20, 0x68, 
+    0x61, 0x73, 0x20, 0x61, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 
+    0x64, 0x65, 0x0a, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 
+    0x67, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_get_chars[141] = {
+    0x49, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6f, 0x76, 
+    0x65, 0x72, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x63, 
+    0x6f, 0x64, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 0x2e, 0x0a, 0x0a, 
+    0x45, 0x61, 0x63, 0x68, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 
+    0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 
+    0x74, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x20, 0x69, 0x73, 
+    0x20, 0x61, 0x20, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 
+    0x20, 0x60, 0x60, 0x28, 0x63, 0x68, 0x61, 0x72, 0x63, 0x6f, 
+    0x64, 0x65, 0x2c, 0x0a, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x5f, 
+    0x69, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x60, 0x60, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Face_get_fstype_flags[178] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x46, 
+    0x53, 0x54, 0x59, 0x50, 0x45, 0x60, 0x20, 0x66, 0x6c, 0x61, 
+    0x67, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x73, 
+    0x65, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 
+    0x73, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 
+    0x6d, 0x62, 0x65, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x73, 0x75, 0x62, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x2e, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x66, 
+    0x6c, 0x61, 0x67, 0x73, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x41, 0x20, 0x62, 0x69, 0x74, 
+    0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x6d, 0x61, 0x64, 0x65, 
+    0x20, 0x75, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x60, 0x46, 0x53, 0x54, 0x59, 0x50, 0x45, 0x60, 0x20, 
+    0x66, 0x6c, 0x61, 0x67, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_get_glyph_name[502] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x53, 
+    0x43, 0x49, 0x49, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 
+    0x6e, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6e, 
+    0x20, 0x61, 0x20, 0x66, 0x61, 0x63, 0x65, 0x2e, 0x0a, 0x0a, 
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 
+    0x77, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+    0x74, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 
+    0x73, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x60, 0x68, 
+    0x61, 0x73, 0x5f, 0x70, 0x73, 0x5f, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x60, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x60, 0x54, 0x72, 
+    0x75, 0x65, 0x60, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 
+    0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 
+    0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 
+    0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x0a, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x5f, 
+    0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3a, 0x20, 0x73, 0x74, 0x72, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 
+    0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x0a, 0x41, 0x6e, 0x20, 0x65, 0x78, 0x63, 
+    0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 
+    0x72, 0x61, 0x69, 0x73, 0x65, 0x64, 0x20, 0x69, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x64, 
+    0x6f, 0x65, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x70, 0x72, 0x6f, 
+    0x76, 0x69, 0x64, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x6f, 0x72, 0x20, 
+    0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x69, 
+    0x73, 0x20, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x2e, 
+    0x0a, 0x0a, 0x42, 0x65, 0x20, 0x61, 0x77, 0x61, 0x72, 0x65, 
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x46, 0x72, 0x65, 0x65, 
+    0x54, 0x79, 0x70, 0x65, 0x20, 0x72, 0x65, 0x6f, 0x72, 0x64, 
+    0x65, 0x72, 0x73, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x69, 0x6e, 
+    0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x73, 
+    0x6f, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x0a, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x30, 
+    0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x63, 0x6f, 
+    0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x73, 0x20, 
+    0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0xe2, 0x80, 0x98, 
+    0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0xe2, 0x80, 0x99, 0x20, 0x28, 0x63, 0x61, 
+    0x6c, 0x6c, 0x65, 0x64, 0x20, 0xe2, 0x80, 0x98, 0x2e, 0x6e, 
+    0x6f, 0x74, 0x64, 0x65, 0x66, 0xe2, 0x80, 0x99, 0x29, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_Face_get_kerning[592] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6b, 0x65, 
+    0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x76, 0x65, 0x63, 0x74, 
+    0x6f, 0x72, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 
+    0x20, 0x74, 0x77, 0x6f, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x73, 0x61, 0x6d, 
+    0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x2e, 0x0a, 0x0a, 0x50, 
+    0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x0a, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 
+    0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 
+    0x65, 0x66, 0x74, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6b, 0x65, 0x72, 
+    0x6e, 0x20, 0x70, 0x61, 0x69, 0x72, 0x2e, 0x0a, 0x0a, 0x72, 
+    0x69, 0x67, 0x68, 0x74, 0x5f, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x69, 
+    0x67, 0x68, 0x74, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6b, 0x65, 0x72, 
+    0x6e, 0x20, 0x70, 0x61, 0x69, 0x72, 0x2e, 0x0a, 0x0a, 0x6b, 
+    0x65, 0x72, 0x6e, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x3a, 
+    0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 
+    0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x41, 
+    0x20, 0x60, 0x4b, 0x45, 0x52, 0x4e, 0x49, 0x4e, 0x47, 0x60, 
+    0x20, 0x6d, 0x6f, 0x64, 0x65, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 
+    0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x0a, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 
+    0x20, 0x3a, 0x20, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6b, 0x65, 
+    0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x65, 0x74, 0x77, 
+    0x65, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x77, 
+    0x6f, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x2e, 0x0a, 
+    0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x0a, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x68, 0x6f, 
+    0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x6c, 
+    0x61, 0x79, 0x6f, 0x75, 0x74, 0x73, 0x20, 0x28, 0x6c, 0x65, 
+    0x66, 0x74, 0x2d, 0x74, 0x6f, 0x2d, 0x72, 0x69, 0x67, 0x68, 
+    0x74, 0x20, 0x26, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2d, 
+    0x74, 0x6f, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x29, 0x20, 0x61, 
+    0x72, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 
+    0x65, 0x64, 0x0a, 0x62, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x2e, 0x20, 0x4f, 
+    0x74, 0x68, 0x65, 0x72, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 
+    0x74, 0x73, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x72, 
+    0x65, 0x20, 0x73, 0x6f, 0x70, 0x68, 0x69, 0x73, 0x74, 0x69, 
+    0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x6b, 0x65, 0x72, 0x6e, 
+    0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x61, 0x72, 0x65, 0x20, 
+    0x6f, 0x75, 0x74, 0x0a, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x73, 0x63, 0x6f, 0x70, 0x65, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x41, 0x50, 0x49, 0x20, 0x66, 
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x2d, 
+    0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x63, 0x61, 0x6e, 0x20, 
+    0x62, 0x65, 0x20, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x6d, 0x65, 
+    0x6e, 0x74, 0x65, 0x64, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 
+    0x67, 0x68, 0x0a, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 
+    0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 0x69, 
+    0x6e, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x73, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_Face_get_kerning_batch[706] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6b, 0x65, 
+    0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x76, 0x65, 0x63, 0x74, 
+    0x6f, 0x72, 0x73, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 
+    0x6e, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x70, 0x61, 0x69, 
+    0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x73, 0x20, 0x61, 0x74, 0x20, 0x6f, 0x6e, 0x63, 0x65, 
+    0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x6b, 0x65, 0x72, 
+    0x6e, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 
+    0x61, 0x63, 0x68, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x69, 0x73, 
+    0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x20, 0x6f, 0x6e, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x3a, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 
+    0x0a, 0x6f, 0x66, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x61, 
+    0x62, 0x6c, 0x65, 0x20, 0x41, 0x53, 0x43, 0x49, 0x49, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x61, 0x72, 0x65, 
+    0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x20, 
+    0x74, 0x6f, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 
+    0x69, 0x6d, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x6f, 
+    0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x6c, 0x6f, 0x6f, 0x6b, 0x65, 
+    0x64, 0x20, 0x75, 0x70, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 
+    0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x65, 0x65, 
+    0x64, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 
+    0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x6c, 0x65, 
+    0x66, 0x74, 0x5f, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 
+    0x3a, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 
+    0x20, 0x6f, 0x72, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 
+    0x20, 0x6f, 0x66, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x69, 
+    0x63, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6b, 0x65, 0x72, 0x6e, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 
+    0x2e, 0x0a, 0x0a, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x3a, 0x20, 0x73, 0x65, 
+    0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x6f, 0x72, 0x20, 
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 
+    0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 
+    0x65, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x69, 0x67, 
+    0x68, 0x74, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6b, 0x65, 0x72, 
+    0x6e, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x2e, 0x20, 0x20, 
+    0x4d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x74, 0x68, 
+    0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x61, 0x6d, 0x65, 
+    0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x61, 0x73, 
+    0x20, 0x2a, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x73, 0x2a, 0x2e, 0x0a, 0x0a, 0x6b, 0x65, 0x72, 
+    0x6e, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x3a, 0x20, 0x69, 
+    0x6e, 0x74, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+    0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x41, 0x20, 0x60, 
+    0x4b, 0x45, 0x52, 0x4e, 0x49, 0x4e, 0x47, 0x60, 0x20, 0x6d, 
+    0x6f, 0x64, 0x65, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 
+    0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x6b, 0x65, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 
+    0x3a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x41, 0x20, 0x32, 0x2d, 0x64, 0x69, 0x6d, 
+    0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x62, 
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x64, 
+    0x6f, 0x75, 0x62, 0x6c, 0x65, 0x73, 0x2c, 0x20, 0x77, 0x69, 
+    0x74, 0x68, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x72, 0x6f, 0x77, 
+    0x20, 0x6f, 0x66, 0x20, 0x60, 0x60, 0x28, 0x78, 0x2c, 0x20, 
+    0x79, 0x29, 0x60, 0x60, 0x20, 0x70, 0x65, 0x72, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x70, 0x61, 0x69, 0x72, 0x2c, 0x20, 0x69, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 
+    0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x61, 0x73, 0x20, 
+    0x60, 0x67, 0x65, 0x74, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x69, 
+    0x6e, 0x67, 0x60, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_get_name_index[263] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 
+    0x6f, 0x66, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x6e, 0x61, 0x6d, 
+    0x65, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x75, 0x73, 
+    0x65, 0x73, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 
+    0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 0x6f, 
+    0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20, 
+    0x64, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x72, 0x61, 
+    0x6e, 0x73, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 
+    0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 
+    0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x0a, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x5f, 0x6e, 
+    0x61, 0x6d, 0x65, 0x20, 0x3a, 0x20, 0x73, 0x74, 0x72, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x0a, 
+    0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3a, 
+    0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 
+    0x6e, 0x64, 0x65, 0x78, 0x2e, 0x20, 0x20, 0x30, 0x20, 0x6d, 
+    0x65, 0x61, 0x6e, 0x73, 0x20, 0xe2, 0x80, 0x98, 0x75, 0x6e, 
+    0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x20, 0x63, 0x6f, 0x64, 0x65, 0xe2, 0x80, 0x99, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_get_postscript_name[115] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x53, 
+    0x43, 0x49, 0x49, 0x20, 0x50, 0x6f, 0x73, 0x74, 0x53, 0x63, 
+    0x72, 0x69, 0x70, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 
+    0x6f, 0x66, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 
+    0x20, 0x66, 0x61, 0x63, 0x65, 0x2c, 0x20, 0x69, 0x66, 0x20, 
+    0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x2e, 
+    0x0a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 
+    0x79, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x77, 0x69, 
+    0x74, 0x68, 0x20, 0x50, 0x6f, 0x73, 0x74, 0x53, 0x63, 0x72, 
+    0x69, 0x70, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x54, 0x72, 
+    0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_get_track_kerning[688] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x72, 
+    0x61, 0x63, 0x6b, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x69, 0x6e, 
+    0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x67, 0x69, 
+    0x76, 0x65, 0x6e, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x6f, 
+    0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x61, 0x74, 0x20, 0x61, 
+    0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x73, 0x69, 0x7a, 
+    0x65, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 
+    0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x70, 0x6f, 0x69, 0x6e, 
+    0x74, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3a, 0x20, 0x66, 
+    0x6c, 0x6f, 0x61, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x73, 
+    0x69, 0x7a, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x66, 0x72, 0x61, 
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 0x6f, 
+    0x69, 0x6e, 0x74, 0x73, 0x2e, 0x0a, 0x0a, 0x64, 0x65, 0x67, 
+    0x72, 0x65, 0x65, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x64, 0x65, 
+    0x67, 0x72, 0x65, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x69, 
+    0x67, 0x68, 0x74, 0x6e, 0x65, 0x73, 0x73, 0x2e, 0x20, 0x20, 
+    0x49, 0x6e, 0x63, 0x72, 0x65, 0x61, 0x73, 0x69, 0x6e, 0x67, 
+    0x6c, 0x79, 0x20, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 
+    0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x72, 
+    0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x74, 0x69, 0x67, 0x68, 0x74, 0x65, 0x72, 
+    0x20, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x20, 0x6b, 0x65, 0x72, 
+    0x6e, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x6c, 
+    0x65, 0x20, 0x69, 0x6e, 0x63, 0x72, 0x65, 0x61, 0x73, 0x69, 
+    0x6e, 0x67, 0x6c, 0x79, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 
+    0x69, 0x76, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 
+    0x73, 0x65, 0x6e, 0x74, 0x20, 0x6c, 0x6f, 0x6f, 0x73, 0x65, 
+    0x72, 0x20, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x20, 0x6b, 0x65, 
+    0x72, 0x6e, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x56, 0x61, 0x6c, 
+    0x75, 0x65, 0x20, 0x7a, 0x65, 0x72, 0x6f, 0x20, 0x6d, 0x65, 
+    0x61, 0x6e, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x74, 0x72, 0x61, 
+    0x63, 0x6b, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x69, 0x6e, 0x67, 
+    0x2e, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x6b, 
+    0x65, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x3a, 0x20, 0x66, 
+    0x6c, 0x6f, 0x61, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x20, 0x6b, 
+    0x65, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x65, 0x74, 
+    0x77, 0x65, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x73, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 
+    0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 
+    0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x6c, 0x79, 0x2c, 
+    0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x54, 0x79, 0x70, 0x65, 0x20, 0x31, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x73, 
+    0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x20, 0x74, 0x72, 
+    0x61, 0x63, 0x6b, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x69, 0x6e, 
+    0x67, 0x2c, 0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x0a, 0x64, 
+    0x61, 0x74, 0x61, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x41, 
+    0x46, 0x4d, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x28, 
+    0x69, 0x66, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x65, 
+    0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x60, 0x61, 0x74, 
+    0x74, 0x61, 0x63, 0x68, 0x60, 0x29, 0x2e, 0x0a, 0x0a, 0x4f, 
+    0x6e, 0x6c, 0x79, 0x20, 0x76, 0x65, 0x72, 0x79, 0x20, 0x66, 
+    0x65, 0x77, 0x20, 0x41, 0x46, 0x4d, 0x20, 0x66, 0x69, 0x6c, 
+    0x65, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x65, 0x20, 0x77, 0x69, 
+    0x74, 0x68, 0x20, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x20, 0x6b, 
+    0x65, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x61, 0x74, 
+    0x61, 0x3b, 0x20, 0x70, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 
+    0x72, 0x65, 0x66, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x0a, 0x74, 
+    0x68, 0x65, 0x20, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x27, 0x73, 
+    0x20, 0x41, 0x46, 0x4d, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 
+    0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x64, 0x65, 
+    0x74, 0x61, 0x69, 0x6c, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_glyph[41] = {
+    0x54, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x27, 0x73, 
+    0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x6c, 0x79, 
+    0x20, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Face_has_horizontal[78] = {
+    0x48, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 
+    0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x20, 0x61, 
+    0x72, 0x65, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 
+    0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 
+    0x20, 0x60, 0x54, 0x72, 0x75, 0x65, 0x60, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x20, 0x74, 
+    0x68, 0x6f, 0x75, 0x67, 0x68, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_has_kerning[85] = {
+    0x4b, 0x65, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x61, 
+    0x74, 0x61, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x65, 0x73, 
+    0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 
+    0x6b, 0x65, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x61, 
+    0x74, 0x61, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 
+    0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x77, 
+    0x69, 0x74, 0x68, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x2e, 
+    0x67, 0x65, 0x74, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x69, 0x6e, 
+    0x67, 0x60, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_has_ps_glyph_names[197] = {
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x60, 0x54, 0x72, 
+    0x75, 0x65, 0x60, 0x20, 0x69, 0x66, 0x20, 0x61, 0x20, 0x67, 
+    0x69, 0x76, 0x65, 0x6e, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 
+    0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x73, 0x20, 0x72, 
+    0x65, 0x6c, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x50, 0x6f, 
+    0x73, 0x74, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 
+    0x2e, 0x0a, 0x0a, 0x57, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 
+    0x69, 0x73, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 
+    0x60, 0x54, 0x72, 0x75, 0x65, 0x60, 0x2c, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x69, 
+    0x73, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 
+    0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x0a, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 
+    0x60, 0x46, 0x61, 0x63, 0x65, 0x2e, 0x67, 0x65, 0x74, 0x5f, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 
+    0x60, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x6c, 0x69, 
+    0x61, 0x62, 0x6c, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_has_vertical[98] = {
+    0x56, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x6d, 
+    0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x20, 0x61, 0x72, 0x65, 
+    0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 
+    0x0a, 0x60, 0x46, 0x61, 0x6c, 0x73, 0x65, 0x60, 0x20, 0x77, 
+    0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 
+    0x63, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 
+    0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x73, 0x79, 0x6e, 
+    0x74, 0x68, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x76, 
+    0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x6d, 0x65, 
+    0x74, 0x72, 0x69, 0x63, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_height[211] = {
+    0x54, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 
+    0x61, 0x6c, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 
+    0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 
+    0x74, 0x77, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x65, 0x63, 
+    0x75, 0x74, 0x69, 0x76, 0x65, 0x20, 0x62, 0x61, 0x73, 0x65, 
+    0x6c, 0x69, 0x6e, 0x65, 0x73, 0x2c, 0x20, 0x65, 0x78, 0x70, 
+    0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x0a, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 
+    0x2e, 0x0a, 0x0a, 0x49, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 
+    0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x70, 0x6f, 0x73, 0x69, 
+    0x74, 0x69, 0x76, 0x65, 0x2e, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 
+    0x20, 0x72, 0x65, 0x6c, 0x65, 0x76, 0x61, 0x6e, 0x74, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x61, 0x62, 
+    0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 
+    0x2e, 0x0a, 0x0a, 0x49, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 
+    0x77, 0x61, 0x6e, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 
+    0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2c, 0x20, 
+    0x75, 0x73, 0x65, 0x20, 0x60, 0x61, 0x73, 0x63, 0x65, 0x6e, 
+    0x64, 0x65, 0x72, 0x60, 0x20, 0x2d, 0x20, 0x60, 0x64, 0x65, 
+    0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x60, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Face_is_fixed_width[51] = {
+    0x43, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x66, 
+    0x69, 0x78, 0x65, 0x64, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 
+    0x20, 0x28, 0x6f, 0x72, 0x20, 0xe2, 0x80, 0x98, 0x6d, 0x6f, 
+    0x6e, 0x6f, 0x73, 0x70, 0x61, 0x63, 0x65, 0xe2, 0x80, 0x99, 
+    0x29, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Face_is_scalable[106] = {
+    0x49, 0x73, 0x20, 0x61, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x61, 
+    0x62, 0x6c, 0x65, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 
+    0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x6e, 
+    0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x20, 0x54, 0x72, 0x75, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x2c, 0x20, 0x54, 0x79, 0x70, 
+    0x65, 0x20, 0x31, 0x2c, 0x20, 0x54, 0x79, 0x70, 0x65, 0x20, 
+    0x34, 0x32, 0x2c, 0x20, 0x43, 0x49, 0x44, 0x2c, 0x20, 0x4f, 
+    0x70, 0x65, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x2f, 0x43, 0x46, 
+    0x46, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x50, 0x46, 0x52, 
+    0x0a, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x6d, 
+    0x61, 0x74, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_is_sfnt[133] = {
+    0x42, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x53, 0x46, 0x4e, 0x54, 0x20, 0x73, 0x74, 
+    0x6f, 0x72, 0x61, 0x67, 0x65, 0x20, 0x73, 0x63, 0x68, 0x65, 
+    0x6d, 0x65, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 
+    0x75, 0x73, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x6d, 0x65, 
+    0x61, 0x6e, 0x73, 0x3a, 0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 
+    0x79, 0x70, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2c, 
+    0x20, 0x4f, 0x70, 0x65, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x61, 0x73, 0x20, 
+    0x77, 0x65, 0x6c, 0x6c, 0x20, 0x61, 0x73, 0x0a, 0x53, 0x46, 
+    0x4e, 0x54, 0x2d, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x65, 
+    0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x20, 0x62, 0x69, 
+    0x74, 0x6d, 0x61, 0x70, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_layout_many[1313] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x4c, 0x61, 0x79, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x6d, 
+    0x61, 0x6e, 0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+    0x73, 0x20, 0x61, 0x74, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0x2c, 
+    0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x73, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x74, 0x69, 0x63, 0x6b, 0x20, 0x6c, 0x61, 
+    0x62, 0x65, 0x6c, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x0a, 
+    0x70, 0x6c, 0x6f, 0x74, 0x2e, 0x0a, 0x0a, 0x45, 0x61, 0x63, 
+    0x68, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x69, 
+    0x73, 0x20, 0x6c, 0x61, 0x69, 0x64, 0x20, 0x6f, 0x75, 0x74, 
+    0x20, 0x65, 0x78, 0x61, 0x63, 0x74, 0x6c, 0x79, 0x20, 0x61, 
+    0x73, 0x20, 0x61, 0x20, 0x60, 0x4c, 0x61, 0x79, 0x6f, 0x75, 
+    0x74, 0x60, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x74, 0x20, 0x77, 
+    0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x2c, 0x20, 0x62, 
+    0x75, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x0a, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x6d, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6c, 
+    0x61, 0x69, 0x64, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x69, 0x6e, 
+    0x20, 0x6f, 0x6e, 0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x2c, 
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x47, 0x49, 0x4c, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 
+    0x65, 0x64, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 
+    0x65, 0x0a, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x20, 
+    0x61, 0x72, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x64, 
+    0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x66, 0x65, 
+    0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x20, 0x72, 
+    0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 
+    0x20, 0x6f, 0x6e, 0x65, 0x20, 0x60, 0x4c, 0x61, 0x79, 0x6f, 
+    0x75, 0x74, 0x60, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 
+    0x0a, 0x70, 0x65, 0x72, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 
+    0x67, 0x2e, 0x20, 0x20, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 
+    0x61, 0x72, 0x65, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 
+    0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 
+    0x63, 0x65, 0x2c, 0x20, 0x73, 0x6f, 0x0a, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 
+    0x70, 0x70, 0x65, 0x61, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x6d, 
+    0x6f, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x6f, 
+    0x6e, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 
+    0x61, 0x72, 0x65, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x6c, 
+    0x6f, 0x61, 0x64, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x63, 0x65, 
+    0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 
+    0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 
+    0x67, 0x73, 0x20, 0x3a, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 
+    0x6e, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x75, 0x6e, 0x69, 
+    0x63, 0x6f, 0x64, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 
+    0x20, 0x74, 0x6f, 0x20, 0x6c, 0x61, 0x79, 0x20, 0x6f, 0x75, 
+    0x74, 0x2e, 0x0a, 0x0a, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x66, 
+    0x6c, 0x61, 0x67, 0x73, 0x20, 0x3a, 0x20, 0x60, 0x4c, 0x4f, 
+    0x41, 0x44, 0x60, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x2c, 
+    0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x41, 0x6e, 0x79, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x66, 
+    0x6c, 0x61, 0x67, 0x73, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 
+    0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x73, 0x20, 
+    0x3a, 0x20, 0x60, 0x41, 0x72, 0x72, 0x61, 0x79, 0x60, 0x20, 
+    0x6f, 0x66, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x73, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 
+    0x67, 0x20, 0x2a, 0x69, 0x2a, 0x20, 0x61, 0x72, 0x65, 0x20, 
+    0x61, 0x74, 0x20, 0x60, 0x60, 0x6f, 0x66, 0x66, 0x73, 0x65, 
+    0x74, 0x73, 0x5b, 0x69, 0x5d, 0x3a, 0x6f, 0x66, 0x66, 0x73, 
+    0x65, 0x74, 0x73, 0x5b, 0x69, 0x20, 0x2b, 0x20, 0x31, 0x5d, 
+    0x60, 0x60, 0x20, 0x69, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x60, 0x60, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x5f, 0x69, 0x6e, 
+    0x64, 0x69, 0x63, 0x65, 0x73, 0x60, 0x60, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x60, 0x60, 0x78, 0x79, 0x73, 0x60, 0x60, 0x2e, 
+    0x20, 0x20, 0x54, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x73, 
+    0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 
+    0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x74, 0x68, 0x61, 
+    0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x72, 
+    0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 
+    0x6e, 0x67, 0x73, 0x2e, 0x0a, 0x0a, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x5f, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 
+    0x3a, 0x20, 0x60, 0x41, 0x72, 0x72, 0x61, 0x79, 0x60, 0x20, 
+    0x6f, 0x66, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x6f, 0x66, 0x20, 
+    0x65, 0x61, 0x63, 0x68, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x2e, 0x0a, 0x0a, 0x78, 0x79, 0x73, 0x20, 0x3a, 0x20, 0x60, 
+    0x41, 0x72, 0x72, 0x61, 0x79, 0x60, 0x20, 0x6f, 0x66, 0x20, 
+    0x66, 0x6c, 0x6f, 0x61, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 
+    0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x2c, 0x20, 0x6f, 0x66, 
+    0x20, 0x73, 0x68, 0x61, 0x70, 0x65, 0x20, 0x28, 0x2a, 0x6e, 
+    0x2a, 0x2c, 0x20, 0x32, 0x29, 0x2c, 0x20, 0x72, 0x65, 0x6c, 
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 
+    0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 
+    0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x74, 0x73, 0x20, 
+    0x6f, 0x77, 0x6e, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+    0x2c, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 
+    0x73, 0x2e, 0x0a, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 
+    0x5f, 0x62, 0x62, 0x6f, 0x78, 0x65, 0x73, 0x2c, 0x20, 0x69, 
+    0x6e, 0x6b, 0x5f, 0x62, 0x62, 0x6f, 0x78, 0x65, 0x73, 0x20, 
+    0x3a, 0x20, 0x60, 0x41, 0x72, 0x72, 0x61, 0x79, 0x60, 0x20, 
+    0x6f, 0x66, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6c, 0x6f, 0x67, 
+    0x69, 0x63, 0x61, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 
+    0x6e, 0x6b, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 
+    0x67, 0x20, 0x62, 0x6f, 0x78, 0x65, 0x73, 0x20, 0x6f, 0x66, 
+    0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x73, 0x74, 0x72, 0x69, 
+    0x6e, 0x67, 0x2c, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x68, 0x61, 
+    0x70, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x2a, 0x63, 
+    0x6f, 0x75, 0x6e, 0x74, 0x2a, 0x2c, 0x20, 0x34, 0x29, 0x2c, 
+    0x20, 0x61, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x60, 0x42, 0x42, 
+    0x6f, 0x78, 0x60, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x69, 
+    0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 
+    0x65, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x41, 
+    0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x20, 
+    0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 
+    0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x6f, 0x6e, 
+    0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x61, 
+    0x74, 0x20, 0x61, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x2c, 0x20, 
+    0x73, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 
+    0x69, 0x6e, 0x67, 0x73, 0x20, 0x61, 0x72, 0x65, 0x0a, 0x6c, 
+    0x61, 0x69, 0x64, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x69, 0x6e, 
+    0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x2e, 
+    0x20, 0x20, 0x53, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x47, 0x49, 0x4c, 0x20, 0x69, 0x73, 0x20, 0x72, 
+    0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x64, 0x2c, 0x20, 0x6f, 
+    0x74, 0x68, 0x65, 0x72, 0x20, 0x50, 0x79, 0x74, 0x68, 0x6f, 
+    0x6e, 0x0a, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 
+    0x6d, 0x61, 0x79, 0x20, 0x6c, 0x61, 0x79, 0x20, 0x6f, 0x75, 
+    0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x77, 0x69, 0x74, 
+    0x68, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x66, 0x61, 
+    0x63, 0x65, 0x73, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_load_char[552] = {
+    0x4c, 0x6f, 0x61, 0x64, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6e, 
+    0x67, 0x6c, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x2c, 
+    0x20, 0x61, 0x63, 0x63, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x67, 
+    0x20, 0x74, 0x6f, 0x20, 0x69, 0x74, 0x73, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x2e, 0x0a, 0x0a, 
+    0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x63, 0x68, 0x61, 0x72, 0x5f, 0x63, 0x6f, 0x64, 
+    0x65, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x27, 0x73, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x63, 
+    0x6f, 0x64, 0x65, 0x2c, 0x20, 0x61, 0x63, 0x63, 0x6f, 0x72, 
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 0x20, 0x75, 0x73, 
+    0x65, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x2e, 0x0a, 
+    0x0a, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x66, 0x6c, 0x61, 0x67, 
+    0x73, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x6f, 
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x41, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x69, 
+    0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x20, 
+    0x77, 0x68, 0x61, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x6f, 
+    0x61, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x69, 
+    0x73, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x2e, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x60, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 
+    0x6e, 0x74, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 
+    0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x63, 
+    0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x6c, 0x6f, 0x61, 
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 
+    0x73, 0x73, 0x20, 0x28, 0x65, 0x2e, 0x67, 0x2e, 0x2c, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 
+    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 
+    0x69, 0x6e, 0x65, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 
+    0x20, 0x62, 0x65, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x64, 
+    0x2c, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 
+    0x74, 0x6f, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x62, 0x69, 
+    0x74, 0x6d, 0x61, 0x70, 0x73, 0x20, 0x6f, 0x72, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x6e, 0x6f, 0x74, 0x2c, 0x20, 0x77, 0x68, 
+    0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x68, 
+    0x69, 0x6e, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 
+    0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20, 0x65, 0x74, 0x63, 
+    0x29, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+    0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x3a, 0x20, 0x47, 0x6c, 
+    0x79, 0x70, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 
+    0x65, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x20, 0x60, 
+    0x47, 0x6c, 0x79, 0x70, 0x68, 0x60, 0x2e, 0x0a, 0x0a, 0x4e, 
+    0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x53, 0x65, 0x65, 0x20, 0x60, 0x6c, 0x6f, 0x61, 
+    0x64, 0x5f, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x60, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x69, 0x6e, 
+    0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_Face_load_char_unicode[766] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x4c, 0x6f, 0x61, 0x64, 0x20, 0x61, 0x20, 0x73, 0x69, 
+    0x6e, 0x67, 0x6c, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x2c, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x61, 0x20, 0x67, 
+    0x69, 0x76, 0x65, 0x6e, 0x20, 0x75, 0x6e, 0x69, 0x63, 0x6f, 
+    0x64, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x55, 0x6e, 0x6c, 0x69, 0x6b, 
+    0x65, 0x20, 0x60, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x63, 0x68, 
+    0x61, 0x72, 0x60, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 
+    0x20, 0x60, 0x43, 0x68, 0x61, 0x72, 0x4d, 0x61, 0x70, 0x60, 
+    0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x55, 0x6e, 
+    0x69, 0x63, 0x6f, 0x64, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x65, 
+    0x0a, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x75, 0x6e, 0x69, 
+    0x63, 0x6f, 0x64, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 
+    0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x65, 
+    0x6e, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x63, 
+    0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
+    0x72, 0x0a, 0x6d, 0x61, 0x70, 0x2c, 0x20, 0x69, 0x66, 0x20, 
+    0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x2e, 0x0a, 
+    0x0a, 0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 
+    0x7c, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 
+    0x61, 0x20, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 
+    0x2d, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 
+    0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 
+    0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x0a, 0x63, 0x68, 0x61, 0x72, 0x5f, 0x63, 0x6f, 
+    0x64, 0x65, 0x20, 0x3a, 0x20, 0x75, 0x6e, 0x69, 0x63, 0x6f, 
+    0x64, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x20, 0x28, 0x31, 0x2d, 0x65, 0x6c, 0x65, 0x6d, 
+    0x65, 0x6e, 0x74, 0x20, 0x75, 0x6e, 0x69, 0x63, 0x6f, 0x64, 
+    0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x29, 0x20, 
+    0x6f, 0x72, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x75, 0x6e, 0x69, 0x63, 0x6f, 
+    0x64, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 
+    0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3a, 0x20, 0x69, 0x6e, 
+    0x74, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 
+    0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x41, 0x20, 0x66, 0x6c, 
+    0x61, 0x67, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 
+    0x69, 0x6e, 0x67, 0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 0x74, 
+    0x6f, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x60, 0x4c, 0x4f, 
+    0x41, 0x44, 0x60, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 
+    0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x20, 0x63, 0x61, 
+    0x6e, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 
+    0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x70, 
+    0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x20, 0x28, 0x65, 0x2e, 
+    0x67, 0x2e, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 
+    0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x73, 0x68, 
+    0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x73, 0x63, 
+    0x61, 0x6c, 0x65, 0x64, 0x2c, 0x20, 0x77, 0x68, 0x65, 0x74, 
+    0x68, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x6f, 0x61, 
+    0x64, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x73, 0x20, 
+    0x6f, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x6f, 0x74, 
+    0x2c, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 
+    0x74, 0x6f, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 
+    0x20, 0x65, 0x74, 0x63, 0x29, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 
+    0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x0a, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x3a, 0x20, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6c, 0x6f, 0x61, 0x64, 
+    0x65, 0x64, 0x20, 0x60, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x60, 
+    0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x53, 0x65, 0x65, 0x20, 
+    0x60, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x60, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x72, 
+    0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_load_glyph[2093] = {
+    0x4c, 0x6f, 0x61, 0x64, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6e, 
+    0x67, 0x6c, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x2e, 
+    0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 
+    0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x0a, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x5f, 
+    0x69, 0x6e, 0x64, 0x65, 0x78, 0x09, 0x3a, 0x20, 0x69, 0x6e, 
+    0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 
+    0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x20, 0x46, 0x6f, 0x72, 
+    0x20, 0x43, 0x49, 0x44, 0x2d, 0x6b, 0x65, 0x79, 0x65, 0x64, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x28, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x69, 
+    0x6e, 0x20, 0x50, 0x53, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x6e, 
+    0x20, 0x43, 0x46, 0x46, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 
+    0x74, 0x29, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x61, 0x72, 
+    0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x70, 0x65, 
+    0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x43, 0x49, 0x44, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x2e, 0x0a, 0x0a, 0x6c, 0x6f, 0x61, 
+    0x64, 0x5f, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3a, 0x20, 
+    0x69, 0x6e, 0x74, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+    0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x41, 0x20, 
+    0x66, 0x6c, 0x61, 0x67, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 
+    0x61, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x77, 0x68, 0x61, 0x74, 
+    0x20, 0x74, 0x6f, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x60, 
+    0x4c, 0x4f, 0x41, 0x44, 0x60, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x20, 
+    0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 
+    0x64, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 
+    0x6f, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67, 
+    0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x20, 0x28, 
+    0x65, 0x2e, 0x67, 0x2e, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 
+    0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 
+    0x73, 0x63, 0x61, 0x6c, 0x65, 0x64, 0x2c, 0x20, 0x77, 0x68, 
+    0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x6c, 
+    0x6f, 0x61, 0x64, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x73, 0x20, 0x6f, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 
+    0x6f, 0x74, 0x2c, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 
+    0x72, 0x20, 0x74, 0x6f, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x2c, 0x20, 0x65, 0x74, 0x63, 0x29, 0x2e, 0x0a, 0x0a, 
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x20, 0x3a, 0x20, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6c, 0x6f, 
+    0x61, 0x64, 0x65, 0x64, 0x20, 0x60, 0x47, 0x6c, 0x79, 0x70, 
+    0x68, 0x60, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x42, 0x79, 0x20, 
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x2c, 0x20, 0x68, 
+    0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 
+    0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x27, 0x73, 0x20, 0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 
+    0x68, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x28, 0x73, 0x65, 
+    0x65, 0x0a, 0x60, 0x46, 0x41, 0x43, 0x45, 0x5f, 0x46, 0x4c, 
+    0x41, 0x47, 0x2e, 0x48, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x60, 
+    0x29, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x65, 0x66, 0x65, 
+    0x72, 0x72, 0x65, 0x64, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x2d, 0x68, 
+    0x69, 0x6e, 0x74, 0x65, 0x72, 0x2e, 0x20, 0x59, 0x6f, 0x75, 
+    0x20, 0x63, 0x61, 0x6e, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 
+    0x6c, 0x65, 0x0a, 0x68, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 
+    0x20, 0x62, 0x79, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+    0x67, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x4e, 0x4f, 
+    0x5f, 0x48, 0x49, 0x4e, 0x54, 0x49, 0x4e, 0x47, 0x60, 0x20, 
+    0x6f, 0x72, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x63, 0x65, 0x64, 
+    0x65, 0x6e, 0x63, 0x65, 0x20, 0x62, 0x79, 0x0a, 0x73, 0x65, 
+    0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x60, 0x4c, 0x4f, 0x41, 
+    0x44, 0x2e, 0x46, 0x4f, 0x52, 0x43, 0x45, 0x5f, 0x41, 0x55, 
+    0x54, 0x4f, 0x48, 0x49, 0x4e, 0x54, 0x60, 0x2e, 0x20, 0x59, 
+    0x6f, 0x75, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x61, 0x6c, 0x73, 
+    0x6f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x60, 0x4c, 0x4f, 0x41, 
+    0x44, 0x2e, 0x4e, 0x4f, 0x5f, 0x41, 0x55, 0x54, 0x4f, 0x48, 
+    0x49, 0x4e, 0x54, 0x60, 0x20, 0x69, 0x6e, 0x0a, 0x63, 0x61, 
+    0x73, 0x65, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x64, 0x6f, 0x6e, 
+    0x27, 0x74, 0x20, 0x77, 0x61, 0x6e, 0x74, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x2d, 0x68, 0x69, 0x6e, 
+    0x74, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x65, 0x20, 
+    0x75, 0x73, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x61, 0x6c, 
+    0x6c, 0x2e, 0x0a, 0x0a, 0x53, 0x65, 0x65, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 
+    0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x60, 0x46, 0x41, 
+    0x43, 0x45, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x2e, 0x54, 0x52, 
+    0x49, 0x43, 0x4b, 0x59, 0x60, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+    0x61, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 
+    0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 
+    0x28, 0x61, 0x66, 0x66, 0x65, 0x63, 0x74, 0x69, 0x6e, 0x67, 
+    0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x20, 0x68, 0x61, 
+    0x6e, 0x64, 0x66, 0x75, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x41, 
+    0x73, 0x69, 0x61, 0x6e, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 
+    0x29, 0x2e, 0x0a, 0x0a, 0x42, 0x65, 0x73, 0x69, 0x64, 0x65, 
+    0x73, 0x20, 0x64, 0x65, 0x63, 0x69, 0x64, 0x69, 0x6e, 0x67, 
+    0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x68, 0x69, 0x6e, 
+    0x74, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 
+    0x2c, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x63, 0x61, 0x6e, 0x20, 
+    0x61, 0x6c, 0x73, 0x6f, 0x20, 0x64, 0x65, 0x63, 0x69, 0x64, 
+    0x65, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x0a, 0x68, 0x69, 
+    0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6c, 0x67, 0x6f, 
+    0x72, 0x69, 0x74, 0x68, 0x6d, 0x20, 0x74, 0x6f, 0x20, 0x75, 
+    0x73, 0x65, 0x2e, 0x20, 0x53, 0x65, 0x65, 0x20, 0x60, 0x4c, 
+    0x4f, 0x41, 0x44, 0x60, 0x27, 0x73, 0x20, 0x60, 0x60, 0x54, 
+    0x41, 0x52, 0x47, 0x45, 0x54, 0x5f, 0x58, 0x58, 0x58, 0x60, 
+    0x60, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 
+    0x73, 0x20, 0x66, 0x6f, 0x72, 0x0a, 0x64, 0x65, 0x74, 0x61, 
+    0x69, 0x6c, 0x73, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x61, 0x75, 0x74, 0x6f, 0x2d, 0x68, 0x69, 0x6e, 0x74, 0x65, 
+    0x72, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x73, 0x20, 0x61, 0x20, 
+    0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x55, 0x6e, 0x69, 0x63, 
+    0x6f, 0x64, 0x65, 0x20, 0x63, 0x6d, 0x61, 0x70, 0x20, 0x28, 
+    0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61, 0x20, 0x6e, 
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x0a, 0x6f, 0x6e, 0x65, 0x20, 
+    0x6f, 0x72, 0x20, 0x73, 0x79, 0x6e, 0x74, 0x68, 0x65, 0x73, 
+    0x69, 0x7a, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x46, 0x72, 
+    0x65, 0x65, 0x54, 0x79, 0x70, 0x65, 0x29, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x69, 0x6e, 
+    0x67, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x63, 0x74, 0x20, 
+    0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x2e, 0x20, 0x49, 
+    0x66, 0x20, 0x61, 0x0a, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x70, 
+    0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x73, 0x20, 0x61, 0x6e, 
+    0x20, 0x69, 0x6e, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x63, 0x74, 
+    0x20, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x20, 0x28, 
+    0x66, 0x6f, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 
+    0x65, 0x2c, 0x20, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x69, 
+    0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x63, 0x68, 0x61, 
+    0x72, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x55, 0x2b, 0x30, 
+    0x30, 0x35, 0x41, 0x2c, 0x20, 0x4c, 0x41, 0x54, 0x49, 0x4e, 
+    0x20, 0x43, 0x41, 0x50, 0x49, 0x54, 0x41, 0x4c, 0x20, 0x4c, 
+    0x45, 0x54, 0x54, 0x45, 0x52, 0x20, 0x5a, 0x2c, 0x20, 0x74, 
+    0x6f, 0x20, 0x61, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x64, 0x65, 0x70, 0x69, 0x63, 0x74, 0x69, 0x6e, 0x67, 0x20, 
+    0x61, 0x0a, 0x6d, 0x61, 0x74, 0x68, 0x65, 0x6d, 0x61, 0x74, 
+    0x69, 0x63, 0x61, 0x6c, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 
+    0x72, 0x61, 0x6c, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x2c, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x2d, 
+    0x68, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x6d, 0x69, 0x67, 
+    0x68, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65, 
+    0x20, 0x75, 0x73, 0x65, 0x6c, 0x65, 0x73, 0x73, 0x0a, 0x72, 
+    0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x2e, 0x0a, 0x0a, 0x54, 
+    0x68, 0x65, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x6d, 0x61, 0x79, 0x20, 
+    0x62, 0x65, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 
+    0x72, 0x6d, 0x65, 0x64, 0x2e, 0x20, 0x53, 0x65, 0x65, 0x20, 
+    0x60, 0x73, 0x65, 0x74, 0x5f, 0x74, 0x72, 0x61, 0x6e, 0x73, 
+    0x66, 0x6f, 0x72, 0x6d, 0x60, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+    0x74, 0x68, 0x65, 0x0a, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 
+    0x73, 0x2e, 0x0a, 0x0a, 0x46, 0x6f, 0x72, 0x20, 0x73, 0x75, 
+    0x62, 0x73, 0x65, 0x74, 0x74, 0x65, 0x64, 0x20, 0x43, 0x49, 
+    0x44, 0x2d, 0x6b, 0x65, 0x79, 0x65, 0x64, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x73, 0x2c, 0x20, 0x61, 0x20, 0x60, 0x56, 0x61, 
+    0x6c, 0x75, 0x65, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x60, 0x20, 
+    0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+    0x69, 0x73, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x6e, 0x20, 
+    0x66, 0x6f, 0x72, 0x0a, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 
+    0x64, 0x20, 0x43, 0x49, 0x44, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+    0x65, 0x73, 0x20, 0x28, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 
+    0x73, 0x2c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x43, 0x49, 0x44, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x77, 0x68, 
+    0x69, 0x63, 0x68, 0x20, 0x64, 0x6f, 0x6e, 0x27, 0x74, 0x20, 
+    0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x0a, 0x63, 0x6f, 0x72, 
+    0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6e, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x29, 0x2e, 
+    0x20, 0x53, 0x65, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 
+    0x69, 0x73, 0x63, 0x75, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x60, 0x46, 0x41, 
+    0x43, 0x45, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x2e, 0x43, 0x49, 
+    0x44, 0x5f, 0x4b, 0x45, 0x59, 0x45, 0x44, 0x60, 0x20, 0x66, 
+    0x6c, 0x61, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 
+    0x72, 0x65, 0x20, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 0x73, 
+    0x2e, 0x0a, 0x0a, 0x59, 0x6f, 0x75, 0x20, 0x73, 0x68, 0x6f, 
+    0x75, 0x6c, 0x64, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x6e, 
+    0x6c, 0x79, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x60, 
+    0x20, 0x60, 0x60, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5f, 
+    0x58, 0x58, 0x58, 0x60, 0x60, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+    0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x79, 0x6f, 0x75, 0x72, 
+    0x0a, 0x60, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x66, 0x6c, 0x61, 
+    0x67, 0x73, 0x60, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 
+    0x63, 0x61, 0x6e, 0x27, 0x74, 0x20, 0x62, 0x65, 0x20, 0x4f, 
+    0x52, 0x27, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x49, 0x66, 0x20, 
+    0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x52, 0x45, 0x4e, 0x44, 
+    0x45, 0x52, 0x60, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6c, 0x73, 
+    0x6f, 0x20, 0x73, 0x65, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x73, 0x20, 
+    0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 0x69, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x63, 0x6f, 0x72, 0x72, 
+    0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 
+    0x6d, 0x6f, 0x64, 0x65, 0x20, 0x28, 0x69, 0x2e, 0x65, 0x2e, 
+    0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x64, 0x65, 
+    0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x6d, 0x61, 0x74, 
+    0x63, 0x68, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 
+    0x73, 0x65, 0x64, 0x20, 0x61, 0x6c, 0x67, 0x6f, 0x72, 0x69, 
+    0x74, 0x68, 0x6d, 0x0a, 0x62, 0x65, 0x73, 0x74, 0x29, 0x2e, 
+    0x20, 0x41, 0x6e, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 
+    0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x60, 0x4c, 0x4f, 
+    0x41, 0x44, 0x2e, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5f, 
+    0x4d, 0x4f, 0x4e, 0x4f, 0x60, 0x20, 0x73, 0x69, 0x6e, 0x63, 
+    0x65, 0x20, 0x69, 0x74, 0x20, 0x69, 0x6d, 0x70, 0x6c, 0x69, 
+    0x65, 0x73, 0x0a, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x4d, 
+    0x4f, 0x4e, 0x4f, 0x43, 0x48, 0x52, 0x4f, 0x4d, 0x45, 0x60, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_max_advance_height[224] = {
+    0x54, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 
+    0x6d, 0x20, 0x61, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x20, 
+    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2c, 0x20, 0x69, 0x6e, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x75, 0x6e, 0x69, 0x74, 
+    0x73, 0x2c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6c, 0x6c, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x69, 0x6e, 
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x66, 0x61, 0x63, 0x65, 
+    0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 
+    0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x76, 
+    0x61, 0x6e, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x76, 0x65, 
+    0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x6c, 0x61, 0x79, 
+    0x6f, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x0a, 
+    0x60, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x60, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 0x74, 
+    0x68, 0x61, 0x74, 0x20, 0x64, 0x6f, 0x20, 0x6e, 0x6f, 0x74, 
+    0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x20, 0x76, 
+    0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x6d, 0x65, 
+    0x74, 0x72, 0x69, 0x63, 0x73, 0x2e, 0x20, 0x4f, 0x6e, 0x6c, 
+    0x79, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x76, 0x61, 0x6e, 0x74, 
+    0x0a, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x61, 
+    0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_max_advance_width[168] = {
+    0x54, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 
+    0x6d, 0x20, 0x61, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x20, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 
+    0x2c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6c, 0x6c, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x69, 0x6e, 0x20, 
+    0x74, 0x68, 0x69, 0x73, 0x0a, 0x66, 0x61, 0x63, 0x65, 0x2e, 
+    0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 
+    0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 
+    0x20, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x64, 
+    0x20, 0x77, 0x72, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x20, 
+    0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x73, 0x20, 0x66, 0x61, 0x73, 0x74, 0x65, 0x72, 0x2e, 
+    0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x0a, 0x72, 0x65, 0x6c, 0x65, 
+    0x76, 0x61, 0x6e, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 
+    0x63, 0x61, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x74, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_measure_text[940] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x4d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x20, 0x61, 
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 
+    0x20, 0x74, 0x65, 0x78, 0x74, 0x2c, 0x20, 0x77, 0x69, 0x74, 
+    0x68, 0x6f, 0x75, 0x74, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 
+    0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 0x60, 0x4c, 0x61, 0x79, 
+    0x6f, 0x75, 0x74, 0x60, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 
+    0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x73, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 
+    0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x4c, 0x61, 
+    0x79, 0x6f, 0x75, 0x74, 0x2e, 0x6c, 0x61, 0x79, 0x6f, 0x75, 
+    0x74, 0x5f, 0x62, 0x62, 0x6f, 0x78, 0x60, 0x20, 0x61, 0x6e, 
+    0x64, 0x0a, 0x60, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 
+    0x69, 0x6e, 0x6b, 0x5f, 0x62, 0x62, 0x6f, 0x78, 0x60, 0x20, 
+    0x6f, 0x66, 0x20, 0x61, 0x20, 0x60, 0x4c, 0x61, 0x79, 0x6f, 
+    0x75, 0x74, 0x60, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 
+    0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x6e, 0x6f, 0x20, 0x60, 
+    0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x60, 0x0a, 0x6f, 0x62, 
+    0x6a, 0x65, 0x63, 0x74, 0x20, 0x6f, 0x72, 0x20, 0x70, 0x65, 
+    0x72, 0x2d, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x64, 0x61, 
+    0x74, 0x61, 0x20, 0x69, 0x73, 0x20, 0x63, 0x72, 0x65, 0x61, 
+    0x74, 0x65, 0x64, 0x2e, 0x20, 0x20, 0x47, 0x6c, 0x79, 0x70, 
+    0x68, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x20, 
+    0x61, 0x72, 0x65, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 
+    0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x66, 0x61, 
+    0x63, 0x65, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x6d, 0x65, 0x61, 
+    0x73, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x73, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x20, 0x64, 
+    0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6c, 0x6f, 
+    0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x61, 0x67, 
+    0x61, 0x69, 0x6e, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 
+    0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x74, 0x65, 
+    0x78, 0x74, 0x20, 0x3a, 0x20, 0x75, 0x6e, 0x69, 0x63, 0x6f, 
+    0x64, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 
+    0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x6d, 
+    0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x2e, 0x0a, 0x0a, 0x6c, 
+    0x6f, 0x61, 0x64, 0x5f, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 
+    0x3a, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x60, 0x20, 0x66, 
+    0x6c, 0x61, 0x67, 0x73, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 
+    0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x41, 
+    0x6e, 0x79, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x6c, 
+    0x6f, 0x61, 0x64, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x0a, 
+    0x0a, 0x69, 0x6e, 0x6b, 0x20, 0x3a, 0x20, 0x62, 0x6f, 0x6f, 
+    0x6c, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 
+    0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x57, 0x68, 0x65, 0x6e, 
+    0x20, 0x60, 0x46, 0x61, 0x6c, 0x73, 0x65, 0x60, 0x2c, 0x20, 
+    0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 
+    0x61, 0x79, 0x6f, 0x75, 0x74, 0x20, 0x62, 0x6f, 0x75, 0x6e, 
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6f, 0x78, 0x20, 0x69, 
+    0x73, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 
+    0x2e, 0x20, 0x20, 0x57, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x61, 
+    0x72, 0x65, 0x20, 0x75, 0x6e, 0x68, 0x69, 0x6e, 0x74, 0x65, 
+    0x64, 0x20, 0x28, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x4e, 
+    0x4f, 0x5f, 0x48, 0x49, 0x4e, 0x54, 0x49, 0x4e, 0x47, 0x60, 
+    0x29, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x61, 
+    0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x20, 0x63, 0x61, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x64, 
+    0x69, 0x72, 0x65, 0x63, 0x74, 0x6c, 0x79, 0x20, 0x66, 0x72, 
+    0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 
+    0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x61, 
+    0x74, 0x20, 0x61, 0x6c, 0x6c, 0x2c, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 
+    0x6d, 0x75, 0x63, 0x68, 0x20, 0x66, 0x61, 0x73, 0x74, 0x65, 
+    0x72, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 
+    0x65, 0x6e, 0x27, 0x74, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 
+    0x64, 0x79, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x2e, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x66, 0x61, 0x75, 
+    0x6c, 0x74, 0x20, 0x69, 0x73, 0x20, 0x60, 0x54, 0x72, 0x75, 
+    0x65, 0x60, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 
+    0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x5f, 0x62, 0x62, 
+    0x6f, 0x78, 0x2c, 0x20, 0x69, 0x6e, 0x6b, 0x5f, 0x62, 0x62, 
+    0x6f, 0x78, 0x20, 0x3a, 0x20, 0x42, 0x42, 0x6f, 0x78, 0x2c, 
+    0x20, 0x42, 0x42, 0x6f, 0x78, 0x20, 0x6f, 0x72, 0x20, 0x4e, 
+    0x6f, 0x6e, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 
+    0x65, 0x20, 0x6c, 0x6f, 0x67, 0x69, 0x63, 0x61, 0x6c, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x6b, 0x20, 0x62, 0x6f, 
+    0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6f, 0x78, 
+    0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x74, 0x65, 0x78, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x70, 
+    0x69, 0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x60, 0x60, 0x69, 0x6e, 0x6b, 0x5f, 0x62, 0x62, 0x6f, 
+    0x78, 0x60, 0x60, 0x20, 0x69, 0x73, 0x20, 0x60, 0x4e, 0x6f, 
+    0x6e, 0x65, 0x60, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x60, 
+    0x60, 0x69, 0x6e, 0x6b, 0x60, 0x60, 0x20, 0x69, 0x73, 0x20, 
+    0x60, 0x46, 0x61, 0x6c, 0x73, 0x65, 0x60, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_num_faces[97] = {
+    0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 
+    0x20, 0x6f, 0x66, 0x20, 0x66, 0x61, 0x63, 0x65, 0x73, 0x20, 
+    0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x20, 0x53, 0x6f, 
+    0x6d, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x74, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 
+    0x68, 0x61, 0x76, 0x65, 0x0a, 0x6d, 0x75, 0x6c, 0x74, 0x69, 
+    0x70, 0x6c, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x73, 0x20, 
+    0x69, 0x6e, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 
+    0x66, 0x69, 0x6c, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_num_fixed_sizes[153] = {
+    0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 
+    0x20, 0x6f, 0x66, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6b, 0x65, 0x73, 0x20, 0x69, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 
+    0x2e, 0x20, 0x45, 0x76, 0x65, 0x6e, 0x20, 0x69, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x69, 
+    0x73, 0x0a, 0x73, 0x63, 0x61, 0x6c, 0x61, 0x62, 0x6c, 0x65, 
+    0x2c, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x6d, 0x69, 
+    0x67, 0x68, 0x74, 0x20, 0x73, 0x74, 0x69, 0x6c, 0x6c, 0x20, 
+    0x62, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 
+    0x73, 0x74, 0x72, 0x69, 0x6b, 0x65, 0x73, 0x2c, 0x20, 0x77, 
+    0x68, 0x69, 0x63, 0x68, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 
+    0x61, 0x6c, 0x6c, 0x65, 0x64, 0x0a, 0xe2, 0x80, 0x98, 0x73, 
+    0x62, 0x69, 0x74, 0x73, 0xe2, 0x80, 0x99, 0x20, 0x69, 0x6e, 
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x61, 0x73, 0x65, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_num_glyphs[214] = {
+    0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 
+    0x20, 0x6f, 0x66, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 
+    0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 
+    0x63, 0x65, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x69, 0x73, 0x20, 0x73, 
+    0x63, 0x61, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x68, 0x61, 0x73, 0x0a, 0x73, 0x62, 0x69, 0x74, 
+    0x73, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x60, 0x6e, 0x75, 
+    0x6d, 0x5f, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5f, 0x73, 0x69, 
+    0x7a, 0x65, 0x73, 0x60, 0x29, 0x2c, 0x20, 0x69, 0x74, 0x20, 
+    0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 
+    0x20, 0x6f, 0x66, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x0a, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x2e, 0x0a, 
+    0x0a, 0x46, 0x6f, 0x72, 0x20, 0x43, 0x49, 0x44, 0x2d, 0x6b, 
+    0x65, 0x79, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 
+    0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x76, 0x61, 0x6c, 
+    0x75, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x73, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x73, 0x74, 
+    0x20, 0x43, 0x49, 0x44, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 
+    0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x66, 0x6f, 0x6e, 
+    0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_own_library[91] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x60, 0x54, 0x72, 0x75, 0x65, 0x60, 0x20, 0x69, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 
+    0x68, 0x61, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6f, 0x77, 
+    0x6e, 0x20, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x20, 
+    0x46, 0x72, 0x65, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x6c, 
+    0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x0a, 0x69, 0x6e, 0x73, 
+    0x74, 0x61, 0x6e, 0x63, 0x65, 0x2e, 0x20, 0x20, 0x53, 0x65, 
+    0x65, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Face_render_glyphs[1294] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x52, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x6d, 0x61, 
+    0x6e, 0x79, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 
+    0x61, 0x74, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x6e, 
+    0x74, 0x6f, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 
+    0x65, 0x20, 0x61, 0x74, 0x6c, 0x61, 0x73, 0x2e, 0x0a, 0x0a, 
+    0x41, 0x6c, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x69, 
+    0x6e, 0x67, 0x20, 0x68, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x73, 
+    0x20, 0x69, 0x6e, 0x20, 0x43, 0x2c, 0x20, 0x77, 0x69, 0x74, 
+    0x68, 0x6f, 0x75, 0x74, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 
+    0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x79, 0x0a, 0x69, 0x6e, 
+    0x74, 0x65, 0x72, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 
+    0x20, 0x50, 0x79, 0x74, 0x68, 0x6f, 0x6e, 0x20, 0x6f, 0x62, 
+    0x6a, 0x65, 0x63, 0x74, 0x73, 0x2c, 0x20, 0x73, 0x6f, 0x20, 
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x6d, 0x75, 
+    0x63, 0x68, 0x20, 0x66, 0x61, 0x73, 0x74, 0x65, 0x72, 0x20, 
+    0x74, 0x68, 0x61, 0x6e, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x69, 
+    0x6e, 0x67, 0x0a, 0x60, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x60, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x60, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x2e, 0x72, 0x65, 0x6e, 
+    0x64, 0x65, 0x72, 0x60, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 
+    0x61, 0x63, 0x68, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x2e, 
+    0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 
+    0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x0a, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x5f, 
+    0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x3a, 0x20, 
+    0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x6f, 
+    0x72, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x6f, 
+    0x66, 0x20, 0x69, 0x6e, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 
+    0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x74, 0x6f, 0x20, 
+    0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x2e, 0x20, 0x20, 0x45, 
+    0x61, 0x63, 0x68, 0x20, 0x64, 0x69, 0x73, 0x74, 0x69, 0x6e, 
+    0x63, 0x74, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 
+    0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 
+    0x6f, 0x6e, 0x63, 0x65, 0x2e, 0x0a, 0x0a, 0x72, 0x65, 0x6e, 
+    0x64, 0x65, 0x72, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x3a, 
+    0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 
+    0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x53, 
+    0x65, 0x65, 0x20, 0x60, 0x52, 0x45, 0x4e, 0x44, 0x45, 0x52, 
+    0x5f, 0x4d, 0x4f, 0x44, 0x45, 0x60, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 
+    0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+    0x6e, 0x73, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x4c, 
+    0x43, 0x44, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x61, 
+    0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x6f, 0x74, 
+    0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x64, 
+    0x2e, 0x0a, 0x0a, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x66, 0x6c, 
+    0x61, 0x67, 0x73, 0x20, 0x3a, 0x20, 0x60, 0x4c, 0x4f, 0x41, 
+    0x44, 0x60, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x2c, 0x20, 
+    0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x41, 0x6e, 0x79, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x66, 0x6c, 
+    0x61, 0x67, 0x73, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 
+    0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x0a, 0x61, 0x74, 0x6c, 0x61, 0x73, 0x2c, 0x20, 0x6d, 0x65, 
+    0x74, 0x72, 0x69, 0x63, 0x73, 0x20, 0x3a, 0x20, 0x41, 0x72, 
+    0x72, 0x61, 0x79, 0x2c, 0x20, 0x41, 0x72, 0x72, 0x61, 0x79, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x60, 0x60, 0x61, 0x74, 0x6c, 
+    0x61, 0x73, 0x60, 0x60, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 
+    0x32, 0x2d, 0x64, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f, 
+    0x6e, 0x61, 0x6c, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 
+    0x6f, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x63, 
+    0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 
+    0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 
+    0x72, 0x65, 0x64, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 
+    0x2c, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x69, 
+    0x6e, 0x74, 0x6f, 0x20, 0x72, 0x6f, 0x77, 0x73, 0x2e, 0x20, 
+    0x20, 0x4d, 0x6f, 0x6e, 0x6f, 0x63, 0x68, 0x72, 0x6f, 0x6d, 
+    0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x73, 0x20, 
+    0x61, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 
+    0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 
+    0x20, 0x38, 0x2d, 0x62, 0x69, 0x74, 0x20, 0x67, 0x72, 0x61, 
+    0x79, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x2e, 0x20, 0x20, 0x46, 
+    0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x43, 0x44, 
+    0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x6d, 0x6f, 
+    0x64, 0x65, 0x73, 0x2c, 0x20, 0x65, 0x61, 0x63, 0x68, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x20, 
+    0x69, 0x73, 0x20, 0x33, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 
+    0x20, 0x77, 0x69, 0x64, 0x65, 0x20, 0x28, 0x6f, 0x72, 0x20, 
+    0x74, 0x61, 0x6c, 0x6c, 0x29, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x60, 0x60, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 
+    0x73, 0x60, 0x60, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6f, 0x6e, 
+    0x65, 0x20, 0x72, 0x6f, 0x77, 0x20, 0x6f, 0x66, 0x20, 0x36, 
+    0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x73, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x65, 
+    0x6e, 0x74, 0x72, 0x79, 0x20, 0x69, 0x6e, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x60, 0x60, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x5f, 
+    0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x60, 0x60, 0x3a, 
+    0x20, 0x60, 0x60, 0x28, 0x78, 0x2c, 0x20, 0x79, 0x2c, 0x20, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x72, 0x6f, 0x77, 
+    0x73, 0x2c, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x2c, 0x20, 0x74, 
+    0x6f, 0x70, 0x29, 0x60, 0x60, 0x2e, 0x20, 0x20, 0x60, 0x60, 
+    0x78, 0x60, 0x60, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x60, 
+    0x60, 0x79, 0x60, 0x60, 0x2c, 0x20, 0x60, 0x60, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x60, 0x60, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x60, 0x60, 0x72, 0x6f, 0x77, 0x73, 0x60, 0x60, 0x20, 0x6c, 
+    0x6f, 0x63, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x27, 0x73, 0x20, 0x62, 0x69, 
+    0x74, 0x6d, 0x61, 0x70, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 
+    0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x60, 0x60, 0x61, 0x74, 
+    0x6c, 0x61, 0x73, 0x60, 0x60, 0x2c, 0x20, 0x61, 0x6e, 0x64, 
+    0x20, 0x60, 0x60, 0x6c, 0x65, 0x66, 0x74, 0x60, 0x60, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x60, 0x60, 0x74, 0x6f, 0x70, 0x60, 
+    0x60, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x27, 0x73, 0x20, 0x6f, 
+    0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 
+    0x65, 0x6e, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 
+    0x6e, 0x2c, 0x20, 0x61, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x60, 
+    0x47, 0x6c, 0x79, 0x70, 0x68, 0x2e, 0x62, 0x69, 0x74, 0x6d, 
+    0x61, 0x70, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x60, 0x20, 0x61, 
+    0x6e, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x60, 0x47, 0x6c, 
+    0x79, 0x70, 0x68, 0x2e, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x5f, 0x74, 0x6f, 0x70, 0x60, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x42, 0x6f, 0x74, 0x68, 0x20, 0x73, 0x75, 0x70, 
+    0x70, 0x6f, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x74, 
+    0x6f, 0x63, 0x6f, 0x6c, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x63, 
+    0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x76, 
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x4e, 
+    0x75, 0x6d, 0x70, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 
+    0x72, 0x72, 0x61, 0x79, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 
+    0x6f, 0x75, 0x74, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x69, 0x6e, 
+    0x67, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_request_size[1255] = {
+    0x52, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 
+    0x20, 0x60, 0x53, 0x69, 0x7a, 0x65, 0x60, 0x20, 0x6f, 0x62, 
+    0x6a, 0x65, 0x63, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 
+    0x66, 0x61, 0x63, 0x65, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 
+    0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x74, 
+    0x79, 0x70, 0x65, 0x20, 0x3a, 0x20, 0x73, 0x69, 0x7a, 0x65, 
+    0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x20, 0x63, 
+    0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 
+    0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x20, 0x74, 
+    0x79, 0x70, 0x65, 0x2e, 0x20, 0x20, 0x53, 0x65, 0x65, 0x20, 
+    0x60, 0x53, 0x49, 0x5a, 0x45, 0x5f, 0x52, 0x45, 0x51, 0x55, 
+    0x45, 0x53, 0x54, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x60, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x76, 
+    0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 
+    0x73, 0x2e, 0x0a, 0x0a, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 
+    0x3a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x2c, 0x20, 0x6f, 
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x64, 0x65, 0x73, 0x69, 
+    0x72, 0x65, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2e, 
+    0x0a, 0x0a, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3a, 
+    0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x2c, 0x20, 0x6f, 0x70, 
+    0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 
+    0x65, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2e, 
+    0x0a, 0x0a, 0x68, 0x6f, 0x72, 0x69, 0x52, 0x65, 0x73, 0x6f, 
+    0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3a, 0x20, 0x69, 
+    0x6e, 0x74, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+    0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 
+    0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 
+    0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 
+    0x6f, 0x6e, 0x2e, 0x20, 0x20, 0x49, 0x66, 0x20, 0x73, 0x65, 
+    0x74, 0x20, 0x74, 0x6f, 0x20, 0x7a, 0x65, 0x72, 0x6f, 0x2c, 
+    0x20, 0x60, 0x77, 0x69, 0x64, 0x74, 0x68, 0x60, 0x20, 0x69, 
+    0x73, 0x20, 0x74, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 
+    0x61, 0x73, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 
+    0x70, 0x69, 0x78, 0x65, 0x6c, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+    0x65, 0x2e, 0x0a, 0x0a, 0x76, 0x65, 0x72, 0x74, 0x52, 0x65, 
+    0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3a, 
+    0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 
+    0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 
+    0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 
+    0x6f, 0x6e, 0x2e, 0x20, 0x20, 0x49, 0x66, 0x20, 0x73, 0x65, 
+    0x74, 0x20, 0x74, 0x6f, 0x20, 0x7a, 0x65, 0x72, 0x6f, 0x2c, 
+    0x20, 0x60, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x60, 0x20, 
+    0x69, 0x73, 0x20, 0x74, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 
+    0x20, 0x61, 0x73, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 
+    0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x20, 0x76, 0x61, 0x6c, 
+    0x75, 0x65, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x49, 0x66, 0x20, 
+    0x60, 0x77, 0x69, 0x64, 0x74, 0x68, 0x60, 0x20, 0x69, 0x73, 
+    0x20, 0x7a, 0x65, 0x72, 0x6f, 0x2c, 0x20, 0x74, 0x68, 0x65, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x72, 0x69, 
+    0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x73, 0x63, 0x61, 
+    0x6c, 0x69, 0x6e, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+    0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x65, 0x71, 
+    0x75, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x0a, 0x74, 0x68, 0x65, 
+    0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 
+    0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x76, 0x61, 
+    0x6c, 0x75, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x76, 
+    0x69, 0x63, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x61, 0x2e, 
+    0x0a, 0x0a, 0x41, 0x6c, 0x74, 0x68, 0x6f, 0x75, 0x67, 0x68, 
+    0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x20, 0x6d, 
+    0x61, 0x79, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6b, 0x65, 0x20, 0x6d, 0x61, 
+    0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2c, 0x0a, 
+    0x79, 0x6f, 0x75, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 
+    0x20, 0x6e, 0x6f, 0x74, 0x20, 0x72, 0x65, 0x6c, 0x79, 0x20, 
+    0x6f, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x66, 
+    0x20, 0x79, 0x6f, 0x75, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x6e, 
+    0x64, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 
+    0x74, 0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 
+    0x75, 0x6c, 0x61, 0x72, 0x0a, 0x62, 0x69, 0x74, 0x6d, 0x61, 
+    0x70, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6b, 0x65, 0x2e, 0x20, 
+    0x55, 0x73, 0x65, 0x20, 0x60, 0x73, 0x65, 0x6c, 0x65, 0x63, 
+    0x74, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x60, 0x20, 0x69, 0x6e, 
+    0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x61, 0x74, 0x20, 0x63, 0x61, 0x73, 0x65, 0x2e, 0x0a, 
+    0x0a, 0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 
+    0x65, 0x73, 0x74, 0x65, 0x64, 0x20, 0x73, 0x69, 0x7a, 0x65, 
+    0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 
+    0x65, 0x73, 0x75, 0x6c, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x0a, 
+    0x69, 0x73, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 
+    0x6e, 0x74, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x72, 0x65, 0x6c, 
+    0x79, 0x20, 0x6f, 0x6e, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x69, 0x73, 
+    0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x69, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6f, 0x75, 0x72, 
+    0x63, 0x65, 0x0a, 0x66, 0x61, 0x63, 0x65, 0x2e, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x65, 
+    0x73, 0x69, 0x67, 0x6e, 0x65, 0x72, 0x20, 0x63, 0x68, 0x6f, 
+    0x6f, 0x73, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x69, 0x6e, 0x61, 0x6c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 
+    0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 
+    0x76, 0x65, 0x0a, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x20, 0x73, 0x69, 0x7a, 0x65, 0x2e, 0x20, 0x46, 0x6f, 0x72, 
+    0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 
+    0x66, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x0a, 0x60, 0x3c, 0x68, 
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 
+    0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x6f, 
+    0x72, 0x67, 0x2f, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 
+    0x65, 0x32, 0x2f, 0x64, 0x6f, 0x63, 0x73, 0x2f, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x73, 0x2f, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x73, 0x2d, 0x32, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x60, 
+    0x5f, 0x2e, 0x0a, 0x0a, 0x53, 0x65, 0x65, 0x20, 0x60, 0x53, 
+    0x69, 0x7a, 0x65, 0x5f, 0x4d, 0x65, 0x74, 0x72, 0x69, 0x63, 
+    0x73, 0x60, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x68, 0x6f, 0x77, 
+    0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 
+    0x65, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x72, 0x65, 0x6c, 
+    0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x63, 
+    0x61, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+    0x65, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_select_charmap[526] = {
+    0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x61, 0x20, 0x67, 
+    0x69, 0x76, 0x65, 0x6e, 0x20, 0x63, 0x68, 0x61, 0x72, 0x6d, 
+    0x61, 0x70, 0x20, 0x62, 0x79, 0x20, 0x69, 0x74, 0x73, 0x20, 
+    0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 
+    0x61, 0x67, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 
+    0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x65, 0x6e, 0x63, 
+    0x6f, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x3a, 0x20, 0x69, 0x6e, 
+    0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x41, 0x6e, 0x20, 0x65, 
+    0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 
+    0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x2e, 0x20, 0x20, 0x53, 
+    0x65, 0x65, 0x20, 0x60, 0x45, 0x4e, 0x43, 0x4f, 0x44, 0x49, 
+    0x4e, 0x47, 0x60, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 
+    0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x54, 0x68, 
+    0x69, 0x73, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x72, 0x61, 0x69, 0x73, 0x65, 0x73, 0x20, 0x61, 
+    0x6e, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x6d, 0x61, 0x70, 0x20, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x63, 0x6f, 
+    0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x73, 0x0a, 
+    0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6e, 0x63, 
+    0x6f, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x71, 0x75, 0x65, 0x72, 
+    0x69, 0x65, 0x64, 0x20, 0x68, 0x65, 0x72, 0x65, 0x2e, 0x0a, 
+    0x0a, 0x42, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x20, 0x6d, 
+    0x61, 0x6e, 0x79, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 
+    0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x20, 0x6d, 0x6f, 
+    0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x61, 0x20, 
+    0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x63, 0x6d, 0x61, 
+    0x70, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x55, 0x6e, 0x69, 0x63, 
+    0x6f, 0x64, 0x65, 0x0a, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 
+    0x6e, 0x67, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x68, 0x61, 
+    0x73, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x73, 0x70, 0x65, 
+    0x63, 0x69, 0x61, 0x6c, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 
+    0x74, 0x6f, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x77, 0x68, 
+    0x69, 0x63, 0x68, 0x0a, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x73, 
+    0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x62, 
+    0x65, 0x73, 0x74, 0x20, 0x28, 0xe2, 0x80, 0x98, 0x62, 0x65, 
+    0x73, 0x74, 0xe2, 0x80, 0x99, 0x20, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x74, 
+    0x68, 0x61, 0x74, 0x20, 0x61, 0x20, 0x55, 0x43, 0x53, 0x2d, 
+    0x34, 0x20, 0x63, 0x6d, 0x61, 0x70, 0x20, 0x69, 0x73, 0x0a, 
+    0x70, 0x72, 0x65, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x20, 
+    0x74, 0x6f, 0x20, 0x61, 0x20, 0x55, 0x43, 0x53, 0x2d, 0x32, 
+    0x20, 0x63, 0x6d, 0x61, 0x70, 0x29, 0x2e, 0x20, 0x49, 0x74, 
+    0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x75, 0x73, 0x20, 0x70, 
+    0x72, 0x65, 0x66, 0x65, 0x72, 0x61, 0x62, 0x6c, 0x65, 0x20, 
+    0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x60, 0x73, 0x65, 
+    0x74, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 0x60, 
+    0x0a, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x63, 
+    0x61, 0x73, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_select_size[144] = {
+    0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x61, 0x20, 0x62, 
+    0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x73, 0x74, 0x72, 0x69, 
+    0x6b, 0x65, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 
+    0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x73, 0x74, 0x72, 
+    0x69, 0x6b, 0x65, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 
+    0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 
+    0x6d, 0x61, 0x70, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6b, 0x65, 
+    0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x7e, 
+    0x46, 0x61, 0x63, 0x65, 0x2e, 0x61, 0x76, 0x61, 0x69, 0x6c, 
+    0x61, 0x62, 0x6c, 0x65, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x73, 
+    0x60, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x65, 0x6c, 
+    0x64, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_set_char_size[702] = {
+    0x53, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 
+    0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x28, 0x69, 0x6e, 0x20, 
+    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x29, 0x2e, 0x0a, 0x0a, 
+    0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x63, 0x68, 0x61, 0x72, 0x5f, 0x77, 0x69, 0x64, 
+    0x74, 0x68, 0x20, 0x3a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 
+    0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 
+    0x6f, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x77, 0x69, 0x64, 
+    0x74, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x66, 0x72, 0x61, 
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 0x6f, 
+    0x69, 0x6e, 0x74, 0x73, 0x2e, 0x0a, 0x0a, 0x63, 0x68, 0x61, 
+    0x72, 0x5f, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3a, 
+    0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x2c, 0x20, 0x6f, 0x70, 
+    0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x6d, 0x69, 0x6e, 
+    0x61, 0x6c, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2c, 
+    0x20, 0x69, 0x6e, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 
+    0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 
+    0x73, 0x2e, 0x0a, 0x0a, 0x68, 0x6f, 0x72, 0x7a, 0x5f, 0x72, 
+    0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+    0x3a, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x6f, 0x70, 0x74, 
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 
+    0x6e, 0x74, 0x61, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x6c, 
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x69, 0x6e, 0x20, 
+    0x64, 0x70, 0x69, 0x2e, 0x0a, 0x0a, 0x76, 0x65, 0x72, 0x74, 
+    0x5f, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x6f, 
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x74, 
+    0x69, 0x63, 0x61, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x6c, 
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x69, 0x6e, 0x20, 
+    0x64, 0x70, 0x69, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 
+    0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x49, 0x66, 
+    0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
+    0x72, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x6f, 0x72, 
+    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x69, 0x73, 
+    0x20, 0x7a, 0x65, 0x72, 0x6f, 0x20, 0x28, 0x6f, 0x72, 0x20, 
+    0x6e, 0x6f, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 
+    0x65, 0x64, 0x29, 0x2c, 0x20, 0x69, 0x74, 0x0a, 0x69, 0x73, 
+    0x20, 0x73, 0x65, 0x74, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6c, 
+    0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x74, 
+    0x68, 0x65, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 
+    0x20, 0x20, 0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 
+    0x79, 0x7c, 0x3a, 0x20, 0x49, 0x66, 0x20, 0x62, 0x6f, 0x74, 
+    0x68, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0a, 0x61, 
+    0x72, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x70, 0x72, 0x6f, 
+    0x76, 0x69, 0x64, 0x65, 0x64, 0x2c, 0x20, 0x69, 0x74, 0x20, 
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73, 0x20, 0x74, 
+    0x6f, 0x20, 0x31, 0x32, 0x2e, 0x30, 0x2e, 0x0a, 0x0a, 0x49, 
+    0x66, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 
+    0x74, 0x61, 0x6c, 0x20, 0x6f, 0x72, 0x20, 0x76, 0x65, 0x72, 
+    0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x6f, 
+    0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 
+    0x7a, 0x65, 0x72, 0x6f, 0x2c, 0x20, 0x69, 0x74, 0x20, 0x69, 
+    0x73, 0x20, 0x73, 0x65, 0x74, 0x0a, 0x65, 0x71, 0x75, 0x61, 
+    0x6c, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 
+    0x74, 0x68, 0x65, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+    0x2e, 0x20, 0x49, 0x66, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 
+    0x72, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 
+    0x65, 0x20, 0x7a, 0x65, 0x72, 0x6f, 0x2c, 0x20, 0x74, 0x68, 
+    0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x0a, 0x73, 0x65, 0x74, 
+    0x20, 0x74, 0x6f, 0x20, 0x37, 0x32, 0x64, 0x70, 0x69, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_Face_set_charmap[193] = {
+    0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x61, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x63, 0x6f, 0x64, 0x65, 
+    0x20, 0x74, 0x6f, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x6d, 0x61, 0x70, 0x70, 
+    0x69, 0x6e, 0x67, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 
+    0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x63, 0x68, 
+    0x61, 0x72, 0x6d, 0x61, 0x70, 0x5f, 0x69, 0x6e, 0x64, 0x65, 
+    0x78, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 
+    0x78, 0x20, 0x69, 0x6e, 0x20, 0x60, 0x63, 0x68, 0x61, 0x72, 
+    0x6d, 0x61, 0x70, 0x73, 0x60, 0x20, 0x74, 0x6f, 0x20, 0x75, 
+    0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x54, 0x68, 0x69, 
+    0x73, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x73, 0x20, 0x69, 0x66, 
+    0x20, 0x61, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x31, 0x34, 
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x6d, 0x61, 0x70, 0x20, 0x69, 
+    0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_set_lcd_filter[389] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x41, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x63, 0x6f, 0x6c, 
+    0x6f, 0x72, 0x20, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x69, 
+    0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x4c, 0x43, 0x44, 0x20, 
+    0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 0x74, 0x65, 0x64, 0x20, 
+    0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x73, 0x20, 0x72, 0x65, 
+    0x6e, 0x64, 0x65, 0x72, 0x65, 0x64, 0x0a, 0x66, 0x72, 0x6f, 
+    0x6d, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x61, 0x63, 
+    0x65, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 
+    0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x66, 0x69, 0x6c, 0x74, 
+    0x65, 0x72, 0x20, 0x3a, 0x20, 0x60, 0x4c, 0x43, 0x44, 0x5f, 
+    0x46, 0x49, 0x4c, 0x54, 0x45, 0x52, 0x60, 0x20, 0x63, 0x6f, 
+    0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x0a, 0x0a, 0x4e, 0x6f, 
+    0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 
+    0x4c, 0x43, 0x44, 0x20, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 
+    0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x46, 0x72, 0x65, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 
+    0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x2e, 
+    0x20, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x66, 
+    0x61, 0x63, 0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x63, 0x72, 
+    0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 
+    0x20, 0x60, 0x60, 0x6f, 0x77, 0x6e, 0x5f, 0x6c, 0x69, 0x62, 
+    0x72, 0x61, 0x72, 0x79, 0x3d, 0x54, 0x72, 0x75, 0x65, 0x60, 
+    0x60, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6f, 0x6e, 
+    0x6c, 0x79, 0x20, 0x61, 0x66, 0x66, 0x65, 0x63, 0x74, 0x73, 
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x66, 0x61, 0x63, 0x65, 
+    0x2e, 0x20, 0x20, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 
+    0x73, 0x65, 0x2c, 0x20, 0x69, 0x74, 0x20, 0x61, 0x66, 0x66, 
+    0x65, 0x63, 0x74, 0x73, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x66, 
+    0x61, 0x63, 0x65, 0x73, 0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 
+    0x64, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2c, 
+    0x20, 0x6a, 0x75, 0x73, 0x74, 0x0a, 0x6c, 0x69, 0x6b, 0x65, 
+    0x20, 0x60, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 
+    0x2e, 0x73, 0x65, 0x74, 0x5f, 0x6c, 0x63, 0x64, 0x5f, 0x66, 
+    0x69, 0x6c, 0x74, 0x65, 0x72, 0x60, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_set_lcd_filter_weights[238] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x45, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x4c, 0x43, 
+    0x44, 0x20, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x20, 0x77, 
+    0x69, 0x74, 0x68, 0x20, 0x63, 0x75, 0x73, 0x74, 0x6f, 0x6d, 
+    0x20, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x73, 
+    0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x65, 0x64, 0x0a, 
+    0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x66, 0x61, 0x63, 0x65, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 
+    0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x61, 
+    0x2c, 0x20, 0x62, 0x2c, 0x20, 0x63, 0x2c, 0x20, 0x64, 0x2c, 
+    0x20, 0x65, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 
+    0x74, 0x65, 0x72, 0x20, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 
+    0x73, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x53, 0x65, 0x65, 0x20, 0x60, 
+    0x46, 0x61, 0x63, 0x65, 0x2e, 0x73, 0x65, 0x74, 0x5f, 0x6c, 
+    0x63, 0x64, 0x5f, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x60, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+    0x67, 0x20, 0x69, 0x73, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 
+    0x64, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x0a, 
+    0x66, 0x61, 0x63, 0x65, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_set_transform[596] = {
+    0x53, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x72, 
+    0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 
+    0x6f, 0x6e, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x65, 0x64, 
+    0x20, 0x74, 0x6f, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x69, 0x6d, 0x61, 0x67, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x50, 
+    0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x0a, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x20, 0x3a, 0x20, 
+    0x32, 0x78, 0x32, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 
+    0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x6c, 0x6f, 0x61, 
+    0x74, 0x73, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+    0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x41, 0x20, 0x6d, 
+    0x61, 0x74, 0x72, 0x69, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x3a, 0x0a, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x20, 0x20, 
+    0x5b, 0x5b, 0x78, 0x78, 0x2c, 0x20, 0x78, 0x79, 0x5d, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x20, 0x20, 0x20, 
+    0x5b, 0x79, 0x78, 0x2c, 0x20, 0x79, 0x79, 0x5d, 0x5d, 0x0a, 
+    0x0a, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x20, 0x3a, 0x20, 0x32, 
+    0x2d, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x20, 
+    0x6f, 0x66, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x73, 0x2c, 
+    0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 
+    0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x74, 0x72, 0x61, 
+    0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 
+    0x61, 0x70, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x74, 0x6f, 
+    0x20, 0x73, 0x63, 0x61, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 
+    0x69, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 
+    0x61, 0x74, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 
+    0x74, 0x68, 0x65, 0x0a, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6e, 0x20, 0x6c, 
+    0x6f, 0x61, 0x64, 0x65, 0x64, 0x2e, 0x20, 0x49, 0x74, 0x20, 
+    0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 
+    0x20, 0x68, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x69, 
+    0x73, 0x20, 0x75, 0x6e, 0x61, 0x6c, 0x74, 0x65, 0x72, 0x65, 
+    0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x74, 
+    0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x73, 
+    0x20, 0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 
+    0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x73, 0x69, 
+    0x7a, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x69, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x6c, 0x61, 0x73, 0x74, 
+    0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x6f, 0x20, 0x60, 
+    0x73, 0x65, 0x74, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x5f, 0x73, 
+    0x69, 0x7a, 0x65, 0x60, 0x20, 0x6f, 0x72, 0x20, 0x60, 0x73, 
+    0x65, 0x74, 0x5f, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x5f, 0x73, 
+    0x69, 0x7a, 0x65, 0x73, 0x60, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 
+    0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 
+    0x69, 0x73, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x74, 0x72, 
+    0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x73, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x2e, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x2e, 0x61, 0x64, 0x76, 0x61, 0x6e, 
+    0x63, 0x65, 0x60, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x2c, 
+    0x20, 0x62, 0x75, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x0a, 0x74, 
+    0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 
+    0x69, 0x6e, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x2e, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x2e, 0x6d, 0x65, 0x74, 0x72, 0x69, 
+    0x63, 0x73, 0x60, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_sfnt_names[60] = {
+    0x47, 0x65, 0x74, 0x20, 0x61, 0x20, 0x60, 0x53, 0x66, 0x6e, 
+    0x74, 0x4e, 0x61, 0x6d, 0x65, 0x73, 0x60, 0x20, 0x6c, 0x69, 
+    0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x60, 0x53, 0x66, 0x6e, 
+    0x74, 0x4e, 0x61, 0x6d, 0x65, 0x60, 0x20, 0x65, 0x6e, 0x74, 
+    0x72, 0x69, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x46, 0x61, 0x63, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_size[28] = {
+    0x54, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 
+    0x74, 0x6c, 0x79, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 
+    0x20, 0x73, 0x69, 0x7a, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_style_flags[63] = {
+    0x41, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x60, 
+    0x53, 0x54, 0x59, 0x4c, 0x45, 0x5f, 0x46, 0x4c, 0x41, 0x47, 
+    0x60, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x69, 0x6e, 
+    0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_style_name[423] = {
+    0x54, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x27, 0x73, 
+    0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x6e, 0x61, 0x6d, 
+    0x65, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 
+    0x20, 0x61, 0x6e, 0x20, 0x41, 0x53, 0x43, 0x49, 0x49, 0x20, 
+    0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x75, 0x73, 
+    0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x45, 
+    0x6e, 0x67, 0x6c, 0x69, 0x73, 0x68, 0x2c, 0x0a, 0x77, 0x68, 
+    0x69, 0x63, 0x68, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 
+    0x62, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x79, 
+    0x70, 0x65, 0x66, 0x61, 0x63, 0x65, 0x27, 0x73, 0x20, 0x73, 
+    0x74, 0x79, 0x6c, 0x65, 0x20, 0x28, 0x6c, 0x69, 0x6b, 0x65, 
+    0x20, 0xe2, 0x80, 0x98, 0x49, 0x74, 0x61, 0x6c, 0x69, 0x63, 
+    0xe2, 0x80, 0x99, 0x2c, 0x20, 0xe2, 0x80, 0x98, 0x42, 0x6f, 
+    0x6c, 0x64, 0xe2, 0x80, 0x99, 0x2c, 0x0a, 0xe2, 0x80, 0x98, 
+    0x43, 0x6f, 0x6e, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x64, 0xe2, 
+    0x80, 0x99, 0x2c, 0x20, 0x65, 0x74, 0x63, 0x29, 0x2e, 0x20, 
+    0x4e, 0x6f, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 
+    0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x20, 0x61, 
+    0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x6e, 0x61, 0x6d, 
+    0x65, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x0a, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x69, 0x73, 0x20, 
+    0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x2c, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 
+    0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x60, 0x4e, 
+    0x6f, 0x6e, 0x65, 0x60, 0x2e, 0x20, 0x41, 0x73, 0x20, 0x66, 
+    0x6f, 0x72, 0x0a, 0x60, 0x7e, 0x46, 0x61, 0x63, 0x65, 0x2e, 
+    0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x5f, 0x6e, 0x61, 0x6d, 
+    0x65, 0x60, 0x2c, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x66, 
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x20, 0x70, 0x72, 0x6f, 
+    0x76, 0x69, 0x64, 0x65, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 
+    0x69, 0x7a, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x55, 
+    0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x0a, 0x76, 0x65, 0x72, 
+    0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+    0x2e, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x73, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 
+    0x64, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x20, 0x73, 0x70, 0x65, 
+    0x63, 0x69, 0x66, 0x69, 0x63, 0x0a, 0x69, 0x6e, 0x74, 0x65, 
+    0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x61, 
+    0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6d, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_tt_header[36] = {
+    0x54, 0x68, 0x65, 0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 
+    0x28, 0x60, 0x54, 0x54, 0x5f, 0x48, 0x65, 0x61, 0x64, 0x65, 
+    0x72, 0x60, 0x29, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_tt_horiheader[126] = {
+    0x54, 0x68, 0x65, 0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 
+    0x74, 0x61, 0x6c, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 
+    0x20, 0x28, 0x60, 0x54, 0x54, 0x5f, 0x48, 0x6f, 0x72, 0x69, 
+    0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x60, 0x29, 0x2e, 0x0a, 
+    0x0a, 0x49, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x70, 0x72, 0x65, 
+    0x73, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6c, 
+    0x6c, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x66, 0x69, 0x6c, 
+    0x65, 0x73, 0x2e, 0x20, 0x20, 0x49, 0x66, 0x20, 0x6d, 0x69, 
+    0x73, 0x73, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x60, 0x41, 0x74, 
+    0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x45, 0x72, 0x72, 
+    0x6f, 0x72, 0x60, 0x20, 0x69, 0x73, 0x0a, 0x72, 0x61, 0x69, 
+    0x73, 0x65, 0x64, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_tt_os2[113] = {
+    0x54, 0x68, 0x65, 0x20, 0x4f, 0x53, 0x2f, 0x32, 0x20, 0x54, 
+    0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x68, 0x65, 
+    0x61, 0x64, 0x65, 0x72, 0x20, 0x28, 0x60, 0x54, 0x54, 0x5f, 
+    0x4f, 0x53, 0x32, 0x60, 0x29, 0x2e, 0x0a, 0x0a, 0x49, 0x73, 
+    0x6e, 0x27, 0x74, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 
+    0x74, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x2e, 
+    0x20, 0x20, 0x49, 0x66, 0x20, 0x6d, 0x69, 0x73, 0x73, 0x69, 
+    0x6e, 0x67, 0x2c, 0x20, 0x60, 0x41, 0x74, 0x74, 0x72, 0x69, 
+    0x62, 0x75, 0x74, 0x65, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x60, 
+    0x20, 0x69, 0x73, 0x0a, 0x72, 0x61, 0x69, 0x73, 0x65, 0x64, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_tt_pclt[105] = {
+    0x54, 0x68, 0x65, 0x20, 0x50, 0x43, 0x4c, 0x54, 0x20, 0x68, 
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x28, 0x60, 0x54, 0x54, 
+    0x5f, 0x50, 0x63, 0x6c, 0x74, 0x60, 0x29, 0x2e, 0x0a, 0x0a, 
+    0x49, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x70, 0x72, 0x65, 0x73, 
+    0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6c, 0x6c, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 
+    0x73, 0x2e, 0x20, 0x20, 0x49, 0x66, 0x20, 0x6d, 0x69, 0x73, 
+    0x73, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x60, 0x41, 0x74, 0x74, 
+    0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x45, 0x72, 0x72, 0x6f, 
+    0x72, 0x60, 0x20, 0x69, 0x73, 0x0a, 0x72, 0x61, 0x69, 0x73, 
+    0x65, 0x64, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_tt_postscript[117] = {
+    0x54, 0x68, 0x65, 0x20, 0x50, 0x6f, 0x73, 0x74, 0x73, 0x63, 
+    0x72, 0x69, 0x70, 0x74, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 
+    0x72, 0x20, 0x28, 0x60, 0x54, 0x54, 0x5f, 0x50, 0x6f, 0x73, 
+    0x74, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x60, 0x29, 0x2e, 
+    0x0a, 0x0a, 0x49, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x70, 0x72, 
+    0x65, 0x73, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x61, 
+    0x6c, 0x6c, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x66, 0x69, 
+    0x6c, 0x65, 0x73, 0x2e, 0x20, 0x20, 0x49, 0x66, 0x20, 0x6d, 
+    0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x60, 0x41, 
+    0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x45, 0x72, 
+    0x72, 0x6f, 0x72, 0x60, 0x20, 0x69, 0x73, 0x0a, 0x72, 0x61, 
+    0x69, 0x73, 0x65, 0x64, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_tt_vertheader[124] = {
+    0x54, 0x68, 0x65, 0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 
+    0x6c, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x28, 
+    0x60, 0x54, 0x54, 0x5f, 0x56, 0x65, 0x72, 0x74, 0x48, 0x65, 
+    0x61, 0x64, 0x65, 0x72, 0x60, 0x29, 0x2e, 0x0a, 0x0a, 0x49, 
+    0x73, 0x6e, 0x27, 0x74, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 
+    0x6e, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6c, 0x6c, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 
+    0x2e, 0x20, 0x20, 0x49, 0x66, 0x20, 0x6d, 0x69, 0x73, 0x73, 
+    0x69, 0x6e, 0x67, 0x2c, 0x20, 0x60, 0x41, 0x74, 0x74, 0x72, 
+    0x69, 0x62, 0x75, 0x74, 0x65, 0x45, 0x72, 0x72, 0x6f, 0x72, 
+    0x60, 0x20, 0x69, 0x73, 0x0a, 0x72, 0x61, 0x69, 0x73, 0x65, 
+    0x64, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_underline_position[131] = {
+    0x54, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 
+    0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x20, 
+    0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x2e, 
+    0x0a, 0x0a, 0x49, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x6e, 0x64, 0x65, 
+    0x72, 0x6c, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x74, 
+    0x65, 0x6d, 0x2e, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x72, 
+    0x65, 0x6c, 0x65, 0x76, 0x61, 0x6e, 0x74, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x61, 0x62, 0x6c, 0x65, 
+    0x0a, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Face_underline_thickness[85] = {
+    0x54, 0x68, 0x65, 0x20, 0x74, 0x68, 0x69, 0x63, 0x6b, 0x6e, 
+    0x65, 0x73, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 
+    0x2c, 0x20, 0x69, 0x6e, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 
+    0x75, 0x6e, 0x69, 0x74, 0x73, 0x2e, 0x0a, 0x0a, 0x4f, 0x6e, 
+    0x6c, 0x79, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x76, 0x61, 0x6e, 
+    0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x63, 0x61, 0x6c, 
+    0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 
+    0x74, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Face_units_per_em[148] = {
+    0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 
+    0x20, 0x6f, 0x66, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x75, 
+    0x6e, 0x69, 0x74, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x45, 
+    0x4d, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2e, 0x0a, 
+    0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 
+    0x79, 0x70, 0x69, 0x63, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x32, 
+    0x30, 0x34, 0x38, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x54, 0x72, 
+    0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x31, 0x30, 
+    0x30, 0x30, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x54, 0x79, 0x70, 
+    0x65, 0x20, 0x31, 0x0a, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2e, 
+    0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x6c, 0x65, 
+    0x76, 0x61, 0x6e, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 
+    0x63, 0x61, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x74, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_KERNING[226] = {
+    0x4b, 0x65, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x6d, 0x6f, 
+    0x64, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x44, 
+    0x45, 0x46, 0x41, 0x55, 0x4c, 0x54, 0x60, 0x3a, 0x20, 0x52, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x63, 0x61, 0x6c, 
+    0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x67, 0x72, 0x69, 
+    0x64, 0x2d, 0x66, 0x69, 0x74, 0x74, 0x65, 0x64, 0x20, 0x6b, 
+    0x65, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x69, 0x73, 
+    0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x20, 0x28, 0x76, 0x61, 
+    0x6c, 0x75, 0x65, 0x20, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x30, 
+    0x29, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x55, 0x4e, 0x46, 
+    0x49, 0x54, 0x54, 0x45, 0x44, 0x60, 0x3a, 0x20, 0x52, 0x65, 
+    0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 
+    0x64, 0x20, 0x62, 0x75, 0x74, 0x20, 0x75, 0x6e, 0x2d, 0x67, 
+    0x72, 0x69, 0x64, 0x2d, 0x66, 0x69, 0x74, 0x74, 0x65, 0x64, 
+    0x20, 0x6b, 0x65, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x64, 
+    0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x2e, 0x0a, 
+    0x0a, 0x2d, 0x20, 0x60, 0x55, 0x4e, 0x53, 0x43, 0x41, 0x4c, 
+    0x45, 0x44, 0x60, 0x3a, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6b, 0x65, 0x72, 0x6e, 
+    0x69, 0x6e, 0x67, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 
+    0x20, 0x69, 0x6e, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 
+    0x61, 0x6c, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x75, 0x6e, 
+    0x69, 0x74, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_LOAD[5714] = {
+    0x49, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 
+    0x77, 0x68, 0x61, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x6f, 
+    0x61, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 
+    0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x60, 0x20, 0x63, 0x6f, 
+    0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x20, 0x63, 0x61, 
+    0x6e, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 
+    0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x70, 
+    0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x0a, 0x28, 0x65, 0x2e, 
+    0x67, 0x2e, 0x2c, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 
+    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 
+    0x69, 0x6e, 0x65, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 
+    0x20, 0x62, 0x65, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x64, 
+    0x2c, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 
+    0x74, 0x6f, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x62, 0x69, 
+    0x74, 0x6d, 0x61, 0x70, 0x73, 0x0a, 0x6f, 0x72, 0x20, 0x6e, 
+    0x6f, 0x74, 0x2c, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 
+    0x72, 0x20, 0x74, 0x6f, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x2c, 0x20, 0x65, 0x74, 0x63, 0x29, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x44, 0x45, 0x46, 0x41, 0x55, 0x4c, 0x54, 
+    0x60, 0x3a, 0x20, 0x43, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 
+    0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 
+    0x30, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x76, 0x61, 
+    0x6c, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 
+    0x64, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 
+    0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x0a, 0x20, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 
+    0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 
+    0x20, 0x49, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x63, 
+    0x61, 0x73, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x68, 
+    0x61, 0x70, 0x70, 0x65, 0x6e, 0x73, 0x3a, 0x0a, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x31, 0x2e, 0x20, 0x46, 0x72, 0x65, 0x65, 
+    0x54, 0x79, 0x70, 0x65, 0x20, 0x6c, 0x6f, 0x6f, 0x6b, 0x73, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x62, 0x69, 0x74, 
+    0x6d, 0x61, 0x70, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x63, 0x6f, 
+    0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 
+    0x67, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x61, 0x63, 0x65, 
+    0x27, 0x73, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 
+    0x20, 0x73, 0x69, 0x7a, 0x65, 0x2e, 0x20, 0x49, 0x66, 0x20, 
+    0x6f, 0x6e, 0x65, 0x20, 0x69, 0x73, 0x20, 0x66, 0x6f, 0x75, 
+    0x6e, 0x64, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6e, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x74, 
+    0x6d, 0x61, 0x70, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x63, 
+    0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x61, 0x63, 0x63, 0x65, 
+    0x73, 0x73, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x73, 0x6c, 0x6f, 0x74, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 
+    0x6e, 0x6f, 0x74, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x29, 0x2e, 0x0a, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x32, 0x2e, 0x20, 0x49, 0x66, 
+    0x20, 0x6e, 0x6f, 0x20, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 
+    0x65, 0x64, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 
+    0x69, 0x73, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x65, 
+    0x64, 0x20, 0x6f, 0x72, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 
+    0x2c, 0x20, 0x46, 0x72, 0x65, 0x65, 0x54, 0x79, 0x70, 0x65, 
+    0x20, 0x6c, 0x6f, 0x6f, 0x6b, 0x73, 0x20, 0x66, 0x6f, 0x72, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x20, 
+    0x73, 0x63, 0x61, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 
+    0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x20, 0x49, 0x66, 
+    0x20, 0x6f, 0x6e, 0x65, 0x20, 0x69, 0x73, 0x20, 0x66, 0x6f, 
+    0x75, 0x6e, 0x64, 0x2c, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 
+    0x20, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x20, 0x66, 0x72, 
+    0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x69, 0x6c, 0x65, 0x2c, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 
+    0x64, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 
+    0x65, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x2c, 0x20, 
+    0x74, 0x68, 0x65, 0x6e, 0x20, 0xe2, 0x80, 0x98, 0x68, 0x69, 
+    0x6e, 0x74, 0x65, 0x64, 0xe2, 0x80, 0x99, 0x20, 0x74, 0x6f, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 
+    0x20, 0x67, 0x72, 0x69, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x6e, 0x20, 0x6f, 0x72, 0x64, 0x65, 
+    0x72, 0x20, 0x74, 0x6f, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6d, 
+    0x69, 0x7a, 0x65, 0x20, 0x69, 0x74, 0x2e, 0x20, 0x54, 0x68, 
+    0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 
+    0x64, 0x61, 0x74, 0x61, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 
+    0x65, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x65, 0x64, 
+    0x20, 0x66, 0x72, 0x6f, 0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x20, 0x28, 0x73, 
+    0x65, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x65, 0x20, 0x62, 0x65, 
+    0x6c, 0x6f, 0x77, 0x29, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x4e, 
+    0x6f, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x62, 
+    0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x2c, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x72, 0x20, 0x64, 0x6f, 
+    0x65, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x72, 0x65, 0x6e, 0x64, 
+    0x65, 0x72, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 
+    0x73, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x0a, 0x20, 0x20, 0x62, 
+    0x69, 0x74, 0x6d, 0x61, 0x70, 0x73, 0x2e, 0x20, 0x54, 0x68, 
+    0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 
+    0x67, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x61, 0x72, 
+    0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 
+    0x6d, 0x6f, 0x64, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x69, 
+    0x73, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x0a, 
+    0x20, 0x20, 0x62, 0x65, 0x68, 0x61, 0x76, 0x69, 0x6f, 0x75, 
+    0x72, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 
+    0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x75, 0x73, 0x65, 0x66, 0x75, 0x6c, 0x20, 
+    0x63, 0x61, 0x73, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x4e, 0x4f, 0x5f, 0x53, 0x43, 0x41, 0x4c, 0x45, 0x60, 
+    0x3a, 0x20, 0x44, 0x6f, 0x6e, 0x27, 0x74, 0x20, 0x73, 0x63, 
+    0x61, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x6f, 
+    0x61, 0x64, 0x65, 0x64, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 
+    0x6e, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x62, 
+    0x75, 0x74, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x69, 0x74, 
+    0x20, 0x69, 0x6e, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x0a, 0x20, 
+    0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 
+    0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6c, 0x61, 0x67, 
+    0x20, 0x69, 0x6d, 0x70, 0x6c, 0x69, 0x65, 0x73, 0x20, 0x60, 
+    0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x4e, 0x4f, 0x5f, 0x48, 0x49, 
+    0x4e, 0x54, 0x49, 0x4e, 0x47, 0x60, 0x20, 0x61, 0x6e, 0x64, 
+    0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x4e, 0x4f, 0x5f, 
+    0x42, 0x49, 0x54, 0x4d, 0x41, 0x50, 0x60, 0x2c, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x75, 0x6e, 0x73, 0x65, 0x74, 0x73, 0x0a, 
+    0x20, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x52, 0x45, 
+    0x4e, 0x44, 0x45, 0x52, 0x60, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 
+    0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x69, 0x73, 0x20, 0xe2, 0x80, 0x98, 0x74, 0x72, 
+    0x69, 0x63, 0x6b, 0x79, 0xe2, 0x80, 0x99, 0x20, 0x28, 0x73, 
+    0x65, 0x65, 0x20, 0x60, 0x46, 0x41, 0x43, 0x45, 0x5f, 0x46, 
+    0x4c, 0x41, 0x47, 0x2e, 0x54, 0x52, 0x49, 0x43, 0x4b, 0x59, 
+    0x60, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x72, 0x65, 
+    0x29, 0x2c, 0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x0a, 0x20, 
+    0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x4e, 0x4f, 0x5f, 
+    0x53, 0x43, 0x41, 0x4c, 0x45, 0x60, 0x20, 0x75, 0x73, 0x75, 
+    0x61, 0x6c, 0x6c, 0x79, 0x20, 0x79, 0x69, 0x65, 0x6c, 0x64, 
+    0x73, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x69, 0x6e, 0x67, 0x6c, 
+    0x65, 0x73, 0x73, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x73, 0x20, 0x62, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 
+    0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x73, 0x75, 0x62, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x6d, 0x75, 0x73, 
+    0x74, 0x20, 0x62, 0x65, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 
+    0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x6f, 0x73, 0x69, 
+    0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 
+    0x68, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x0a, 
+    0x20, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 
+    0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 
+    0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x73, 0x6f, 
+    0x6c, 0x76, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x6c, 0x6f, 
+    0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 
+    0x75, 0x74, 0x0a, 0x20, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 
+    0x2e, 0x4e, 0x4f, 0x5f, 0x53, 0x43, 0x41, 0x4c, 0x45, 0x60, 
+    0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x73, 0x69, 0x7a, 
+    0x65, 0x20, 0x74, 0x6f, 0x0a, 0x20, 0x20, 0x60, 0x7e, 0x46, 
+    0x61, 0x63, 0x65, 0x2e, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x5f, 
+    0x70, 0x65, 0x72, 0x5f, 0x65, 0x6d, 0x60, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x4e, 0x4f, 0x5f, 0x48, 0x49, 0x4e, 0x54, 
+    0x49, 0x4e, 0x47, 0x60, 0x3a, 0x20, 0x44, 0x69, 0x73, 0x61, 
+    0x62, 0x6c, 0x65, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x69, 0x6e, 
+    0x67, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x67, 0x65, 
+    0x6e, 0x65, 0x72, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x67, 0x65, 
+    0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x73, 0x20, 0xe2, 0x80, 
+    0x98, 0x62, 0x6c, 0x75, 0x72, 0x72, 0x69, 0x65, 0x72, 0xe2, 
+    0x80, 0x99, 0x0a, 0x20, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 
+    0x70, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x77, 
+    0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 
+    0x6e, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 
+    0x61, 0x6e, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x61, 0x6e, 0x74, 0x69, 0x2d, 0x61, 0x6c, 0x69, 0x61, 
+    0x73, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x6d, 0x6f, 0x64, 0x65, 
+    0x73, 0x2e, 0x20, 0x53, 0x65, 0x65, 0x20, 0x61, 0x6c, 0x73, 
+    0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x65, 
+    0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x2e, 0x0a, 0x0a, 0x20, 
+    0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6c, 0x61, 0x67, 
+    0x20, 0x69, 0x73, 0x20, 0x69, 0x6d, 0x70, 0x6c, 0x69, 0x65, 
+    0x64, 0x20, 0x62, 0x79, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 
+    0x2e, 0x4e, 0x4f, 0x5f, 0x53, 0x43, 0x41, 0x4c, 0x45, 0x60, 
+    0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x52, 0x45, 0x4e, 0x44, 
+    0x45, 0x52, 0x60, 0x3a, 0x20, 0x52, 0x65, 0x6e, 0x64, 0x65, 
+    0x72, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x73, 
+    0x20, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x2e, 0x20, 0x42, 
+    0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x2c, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x6e, 0x64, 
+    0x65, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x60, 0x52, 
+    0x45, 0x4e, 0x44, 0x45, 0x52, 0x5f, 0x4d, 0x4f, 0x44, 0x45, 
+    0x2e, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x60, 0x20, 0x6d, 
+    0x6f, 0x64, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 
+    0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x6f, 0x76, 0x65, 
+    0x72, 0x72, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x20, 0x62, 0x79, 
+    0x0a, 0x20, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x54, 
+    0x41, 0x52, 0x47, 0x45, 0x54, 0x5f, 0x58, 0x58, 0x58, 0x60, 
+    0x20, 0x6f, 0x72, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 
+    0x4d, 0x4f, 0x4e, 0x4f, 0x43, 0x48, 0x52, 0x4f, 0x4d, 0x45, 
+    0x60, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 
+    0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x69, 0x73, 0x20, 0x75, 
+    0x6e, 0x73, 0x65, 0x74, 0x20, 0x62, 0x79, 0x20, 0x60, 0x4c, 
+    0x4f, 0x41, 0x44, 0x2e, 0x4e, 0x4f, 0x5f, 0x53, 0x43, 0x41, 
+    0x4c, 0x45, 0x60, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4e, 
+    0x4f, 0x5f, 0x42, 0x49, 0x54, 0x4d, 0x41, 0x50, 0x60, 0x3a, 
+    0x20, 0x49, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x20, 0x62, 0x69, 
+    0x74, 0x6d, 0x61, 0x70, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6b, 
+    0x65, 0x73, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x6c, 0x6f, 
+    0x61, 0x64, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x42, 0x69, 0x74, 
+    0x6d, 0x61, 0x70, 0x2d, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x69, 0x67, 0x6e, 
+    0x6f, 0x72, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 
+    0x6c, 0x61, 0x67, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x60, 0x4c, 
+    0x4f, 0x41, 0x44, 0x2e, 0x4e, 0x4f, 0x5f, 0x53, 0x43, 0x41, 
+    0x4c, 0x45, 0x60, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 
+    0x20, 0x73, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x20, 0x66, 0x6c, 0x61, 0x67, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x56, 0x45, 0x52, 0x54, 0x49, 0x43, 0x41, 0x4c, 0x5f, 
+    0x4c, 0x41, 0x59, 0x4f, 0x55, 0x54, 0x60, 0x3a, 0x20, 0x4c, 
+    0x6f, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x76, 0x65, 
+    0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x74, 0x65, 0x78, 
+    0x74, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x20, 
+    0x49, 0x6e, 0x0a, 0x20, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 
+    0x63, 0x75, 0x6c, 0x61, 0x72, 0x2c, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x60, 0x61, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x60, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x69, 0x6e, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x60, 0x47, 0x6c, 0x79, 0x70, 0x68, 
+    0x60, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x69, 
+    0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x74, 
+    0x68, 0x65, 0x0a, 0x20, 0x20, 0x60, 0x76, 0x65, 0x72, 0x74, 
+    0x5f, 0x61, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x60, 0x20, 
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x60, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 
+    0x73, 0x60, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x2e, 0x0a, 
+    0x0a, 0x20, 0x20, 0x49, 0x6e, 0x20, 0x63, 0x61, 0x73, 0x65, 
+    0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x2e, 0x68, 0x61, 0x73, 
+    0x5f, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x60, 
+    0x20, 0x64, 0x6f, 0x65, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x60, 0x54, 0x72, 0x75, 
+    0x65, 0x60, 0x2c, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x73, 0x68, 
+    0x6f, 0x75, 0x6c, 0x64, 0x6e, 0x27, 0x74, 0x20, 0x75, 0x73, 
+    0x65, 0x0a, 0x20, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 
+    0x6c, 0x61, 0x67, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 
+    0x74, 0x6c, 0x79, 0x2e, 0x20, 0x52, 0x65, 0x61, 0x73, 0x6f, 
+    0x6e, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 
+    0x69, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x63, 0x61, 
+    0x73, 0x65, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 
+    0x6c, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x0a, 
+    0x20, 0x20, 0x67, 0x65, 0x74, 0x20, 0x73, 0x79, 0x6e, 0x74, 
+    0x68, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x64, 0x2c, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x74, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 
+    0x6e, 0x6f, 0x74, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 
+    0x20, 0x63, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 
+    0x74, 0x20, 0x61, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x0a, 0x20, 
+    0x20, 0x76, 0x61, 0x72, 0x69, 0x6f, 0x75, 0x73, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x46, 0x4f, 0x52, 
+    0x43, 0x45, 0x5f, 0x41, 0x55, 0x54, 0x4f, 0x48, 0x49, 0x4e, 
+    0x54, 0x60, 0x3a, 0x20, 0x49, 0x6e, 0x64, 0x69, 0x63, 0x61, 
+    0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x2d, 0x68, 0x69, 
+    0x6e, 0x74, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 
+    0x65, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x20, 0x6f, 0x76, 
+    0x65, 0x72, 0x0a, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x27, 0x73, 0x20, 0x6e, 0x61, 0x74, 0x69, 
+    0x76, 0x65, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x2e, 
+    0x20, 0x53, 0x65, 0x65, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x65, 0x20, 0x62, 
+    0x65, 0x6c, 0x6f, 0x77, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 
+    0x43, 0x52, 0x4f, 0x50, 0x5f, 0x42, 0x49, 0x54, 0x4d, 0x41, 
+    0x50, 0x60, 0x3a, 0x20, 0x49, 0x6e, 0x64, 0x69, 0x63, 0x61, 
+    0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x72, 
+    0x69, 0x76, 0x65, 0x72, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 
+    0x64, 0x20, 0x63, 0x72, 0x6f, 0x70, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x0a, 0x20, 0x20, 
+    0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x20, 0x28, 0x69, 0x2e, 0x65, 0x2e, 0x2c, 0x20, 
+    0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x61, 0x6c, 0x6c, 
+    0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x61, 0x72, 0x6f, 
+    0x75, 0x6e, 0x64, 0x20, 0x69, 0x74, 0x73, 0x20, 0x62, 0x6c, 
+    0x61, 0x63, 0x6b, 0x20, 0x62, 0x69, 0x74, 0x73, 0x29, 0x2e, 
+    0x20, 0x4e, 0x6f, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x0a, 0x20, 
+    0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x20, 0x69, 
+    0x6d, 0x70, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x50, 
+    0x45, 0x44, 0x41, 0x4e, 0x54, 0x49, 0x43, 0x60, 0x3a, 0x20, 
+    0x49, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 
+    0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x70, 0x65, 
+    0x72, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x70, 0x65, 0x64, 0x61, 
+    0x6e, 0x74, 0x69, 0x63, 0x0a, 0x20, 0x20, 0x76, 0x65, 0x72, 
+    0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+    0x20, 0x64, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 
+    0x67, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 
+    0x20, 0x6d, 0x6f, 0x73, 0x74, 0x6c, 0x79, 0x20, 0x75, 0x73, 
+    0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x65, 0x74, 0x65, 
+    0x63, 0x74, 0x0a, 0x20, 0x20, 0x62, 0x72, 0x6f, 0x6b, 0x65, 
+    0x6e, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x69, 
+    0x6e, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2e, 0x20, 0x42, 
+    0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x2c, 
+    0x20, 0x46, 0x72, 0x65, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 
+    0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x68, 
+    0x61, 0x6e, 0x64, 0x6c, 0x65, 0x20, 0x62, 0x72, 0x6f, 0x6b, 
+    0x65, 0x6e, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 
+    0x20, 0x61, 0x6c, 0x73, 0x6f, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 
+    0x49, 0x6e, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x75, 
+    0x6c, 0x61, 0x72, 0x2c, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+    0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 
+    0x62, 0x79, 0x74, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x65, 
+    0x6e, 0x67, 0x69, 0x6e, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 
+    0x6e, 0x6f, 0x74, 0x0a, 0x20, 0x20, 0x70, 0x61, 0x73, 0x73, 
+    0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x66, 0x6c, 0x61, 0x67, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 
+    0x74, 0x20, 0x73, 0x65, 0x74, 0x3b, 0x20, 0x74, 0x68, 0x69, 
+    0x73, 0x20, 0x6d, 0x69, 0x67, 0x68, 0x74, 0x20, 0x72, 0x65, 
+    0x73, 0x75, 0x6c, 0x74, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x20, 
+    0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6c, 0x6c, 0x79, 0x20, 
+    0x68, 0x69, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x6f, 0x72, 0x20, 
+    0x64, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x69, 0x6e, 0x20, 
+    0x63, 0x61, 0x73, 0x65, 0x20, 0x61, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x27, 0x73, 0x20, 0x62, 0x79, 0x74, 0x65, 0x63, 
+    0x6f, 0x64, 0x65, 0x0a, 0x20, 0x20, 0x69, 0x73, 0x20, 0x62, 
+    0x75, 0x67, 0x67, 0x79, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 
+    0x4e, 0x4f, 0x5f, 0x52, 0x45, 0x43, 0x55, 0x52, 0x53, 0x45, 
+    0x60, 0x3a, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6c, 
+    0x61, 0x67, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 
+    0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x65, 
+    0x72, 0x6e, 0x61, 0x6c, 0x6c, 0x79, 0x2e, 0x20, 0x49, 0x74, 
+    0x20, 0x6d, 0x65, 0x72, 0x65, 0x6c, 0x79, 0x20, 0x69, 0x6e, 
+    0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x0a, 0x20, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 
+    0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6e, 0x6f, 
+    0x74, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x63, 0x6f, 0x6d, 
+    0x70, 0x6f, 0x73, 0x69, 0x74, 0x65, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x73, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x63, 0x75, 
+    0x72, 0x73, 0x69, 0x76, 0x65, 0x6c, 0x79, 0x2e, 0x20, 0x49, 
+    0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 0x2c, 0x20, 0x69, 0x74, 
+    0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x73, 0x65, 
+    0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x6e, 0x75, 0x6d, 
+    0x5f, 0x73, 0x75, 0x62, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x60, 
+    0x20, 0x61, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x60, 0x73, 0x75, 
+    0x62, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x60, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x60, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x60, 
+    0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x65, 0x74, 0x20, 
+    0x60, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x2e, 0x66, 0x6f, 0x72, 
+    0x6d, 0x61, 0x74, 0x60, 0x0a, 0x20, 0x20, 0x74, 0x6f, 0x20, 
+    0x60, 0x47, 0x4c, 0x59, 0x50, 0x48, 0x5f, 0x46, 0x4f, 0x52, 
+    0x4d, 0x41, 0x54, 0x2e, 0x43, 0x4f, 0x4d, 0x50, 0x4f, 0x53, 
+    0x49, 0x54, 0x45, 0x60, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 
+    0x62, 0x2d, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x69, 
+    0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 
+    0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x63, 
+    0x6c, 0x69, 0x65, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x61, 0x70, 
+    0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x6e, 0x6f, 0x77, 0x2e, 0x0a, 
+    0x0a, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6c, 
+    0x61, 0x67, 0x20, 0x69, 0x6d, 0x70, 0x6c, 0x69, 0x65, 0x73, 
+    0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x4e, 0x4f, 0x5f, 
+    0x53, 0x43, 0x41, 0x4c, 0x45, 0x60, 0x20, 0x61, 0x6e, 0x64, 
+    0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x49, 0x47, 0x4e, 
+    0x4f, 0x52, 0x45, 0x5f, 0x54, 0x52, 0x41, 0x4e, 0x53, 0x46, 
+    0x4f, 0x52, 0x4d, 0x60, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 
+    0x49, 0x47, 0x4e, 0x4f, 0x52, 0x45, 0x5f, 0x54, 0x52, 0x41, 
+    0x4e, 0x53, 0x46, 0x4f, 0x52, 0x4d, 0x60, 0x3a, 0x20, 0x49, 
+    0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 
+    0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x72, 
+    0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 
+    0x74, 0x72, 0x69, 0x78, 0x20, 0x73, 0x65, 0x74, 0x20, 0x62, 
+    0x79, 0x0a, 0x20, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x2e, 
+    0x73, 0x65, 0x74, 0x5f, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 
+    0x6f, 0x72, 0x6d, 0x60, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 
+    0x64, 0x20, 0x62, 0x65, 0x20, 0x69, 0x67, 0x6e, 0x6f, 0x72, 
+    0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4d, 0x4f, 
+    0x4e, 0x4f, 0x43, 0x48, 0x52, 0x4f, 0x4d, 0x45, 0x60, 0x3a, 
+    0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6c, 0x61, 0x67, 
+    0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x77, 
+    0x69, 0x74, 0x68, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 
+    0x52, 0x45, 0x4e, 0x44, 0x45, 0x52, 0x60, 0x20, 0x74, 0x6f, 
+    0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x0a, 0x20, 0x20, 0x79, 0x6f, 0x75, 
+    0x20, 0x77, 0x61, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x72, 
+    0x65, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x20, 0x6f, 
+    0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x31, 0x2d, 
+    0x62, 0x69, 0x74, 0x20, 0x6d, 0x6f, 0x6e, 0x6f, 0x63, 0x68, 
+    0x72, 0x6f, 0x6d, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 
+    0x70, 0x0a, 0x20, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x2c, 
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x38, 0x20, 0x70, 0x69, 
+    0x78, 0x65, 0x6c, 0x73, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 
+    0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x65, 0x61, 0x63, 
+    0x68, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x20, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 
+    0x4e, 0x6f, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6e, 
+    0x6f, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x6f, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x69, 0x6e, 0x74, 
+    0x69, 0x6e, 0x67, 0x20, 0x61, 0x6c, 0x67, 0x6f, 0x72, 0x69, 
+    0x74, 0x68, 0x6d, 0x20, 0x75, 0x73, 0x65, 0x64, 0x2e, 0x20, 
+    0x59, 0x6f, 0x75, 0x0a, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x75, 
+    0x6c, 0x64, 0x20, 0x72, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 
+    0x75, 0x73, 0x65, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 
+    0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5f, 0x4d, 0x4f, 0x4e, 
+    0x4f, 0x60, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x61, 0x74, 
+    0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x6d, 0x6f, 0x6e, 
+    0x6f, 0x63, 0x68, 0x72, 0x6f, 0x6d, 0x65, 0x2d, 0x6f, 0x70, 
+    0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x68, 0x69, 
+    0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6c, 0x67, 0x6f, 
+    0x72, 0x69, 0x74, 0x68, 0x6d, 0x20, 0x69, 0x73, 0x20, 0x75, 
+    0x73, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4c, 
+    0x49, 0x4e, 0x45, 0x41, 0x52, 0x5f, 0x44, 0x45, 0x53, 0x49, 
+    0x47, 0x4e, 0x60, 0x3a, 0x20, 0x49, 0x6e, 0x64, 0x69, 0x63, 
+    0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x60, 0x6c, 0x69, 0x6e, 0x65, 0x61, 
+    0x72, 0x5f, 0x68, 0x6f, 0x72, 0x69, 0x5f, 0x61, 0x64, 0x76, 
+    0x61, 0x6e, 0x63, 0x65, 0x60, 0x20, 0x61, 0x6e, 0x64, 0x0a, 
+    0x20, 0x20, 0x60, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x72, 0x5f, 
+    0x76, 0x65, 0x72, 0x74, 0x5f, 0x61, 0x64, 0x76, 0x61, 0x6e, 
+    0x63, 0x65, 0x60, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x73, 
+    0x20, 0x6f, 0x66, 0x20, 0x60, 0x47, 0x6c, 0x79, 0x70, 0x68, 
+    0x60, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 
+    0x65, 0x20, 0x6b, 0x65, 0x70, 0x74, 0x20, 0x69, 0x6e, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x75, 0x6e, 0x69, 
+    0x74, 0x73, 0x2e, 0x20, 0x53, 0x65, 0x65, 0x20, 0x60, 0x47, 
+    0x6c, 0x79, 0x70, 0x68, 0x60, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+    0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 0x73, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x4e, 0x4f, 0x5f, 0x41, 0x55, 0x54, 0x4f, 
+    0x48, 0x49, 0x4e, 0x54, 0x60, 0x3a, 0x20, 0x44, 0x69, 0x73, 
+    0x61, 0x62, 0x6c, 0x65, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x2d, 
+    0x68, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x2e, 0x20, 0x53, 0x65, 
+    0x65, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6e, 0x6f, 0x74, 0x65, 0x20, 0x62, 0x65, 0x6c, 0x6f, 
+    0x77, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x66, 0x6f, 
+    0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6c, 
+    0x61, 0x67, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 
+    0x20, 0x61, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 
+    0x63, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 
+    0x61, 0x6c, 0x67, 0x6f, 0x72, 0x69, 0x74, 0x68, 0x6d, 0x20, 
+    0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x62, 0x79, 0x20, 
+    0x74, 0x68, 0x65, 0x0a, 0x68, 0x69, 0x6e, 0x74, 0x65, 0x72, 
+    0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x54, 0x41, 0x52, 0x47, 
+    0x45, 0x54, 0x5f, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x60, 
+    0x3a, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x63, 0x6f, 0x72, 
+    0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x74, 
+    0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 
+    0x75, 0x6c, 0x74, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x69, 0x6e, 
+    0x67, 0x20, 0x61, 0x6c, 0x67, 0x6f, 0x72, 0x69, 0x74, 0x68, 
+    0x6d, 0x2c, 0x0a, 0x20, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6d, 
+    0x69, 0x7a, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 
+    0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 0x64, 0x20, 0x67, 0x72, 
+    0x61, 0x79, 0x2d, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x20, 0x72, 
+    0x65, 0x6e, 0x64, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x20, 
+    0x46, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x6e, 0x6f, 0x63, 0x68, 
+    0x72, 0x6f, 0x6d, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 
+    0x74, 0x2c, 0x0a, 0x20, 0x20, 0x75, 0x73, 0x65, 0x20, 0x60, 
+    0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x54, 0x41, 0x52, 0x47, 0x45, 
+    0x54, 0x5f, 0x4d, 0x4f, 0x4e, 0x4f, 0x60, 0x20, 0x69, 0x6e, 
+    0x73, 0x74, 0x65, 0x61, 0x64, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5f, 0x4c, 0x49, 
+    0x47, 0x48, 0x54, 0x60, 0x3a, 0x20, 0x41, 0x20, 0x6c, 0x69, 
+    0x67, 0x68, 0x74, 0x65, 0x72, 0x20, 0x68, 0x69, 0x6e, 0x74, 
+    0x69, 0x6e, 0x67, 0x20, 0x61, 0x6c, 0x67, 0x6f, 0x72, 0x69, 
+    0x74, 0x68, 0x6d, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6e, 0x6f, 
+    0x6e, 0x2d, 0x6d, 0x6f, 0x6e, 0x6f, 0x63, 0x68, 0x72, 0x6f, 
+    0x6d, 0x65, 0x0a, 0x20, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x73, 
+    0x2e, 0x20, 0x4d, 0x61, 0x6e, 0x79, 0x20, 0x67, 0x65, 0x6e, 
+    0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6d, 0x6f, 
+    0x72, 0x65, 0x20, 0x66, 0x75, 0x7a, 0x7a, 0x79, 0x20, 0x62, 
+    0x75, 0x74, 0x20, 0x62, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 
+    0x72, 0x65, 0x73, 0x65, 0x6d, 0x62, 0x6c, 0x65, 0x20, 0x69, 
+    0x74, 0x73, 0x0a, 0x20, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 
+    0x6e, 0x61, 0x6c, 0x20, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2e, 
+    0x20, 0x41, 0x20, 0x62, 0x69, 0x74, 0x20, 0x6c, 0x69, 0x6b, 
+    0x65, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x69, 0x6e, 
+    0x67, 0x20, 0x6f, 0x6e, 0x20, 0x4d, 0x61, 0x63, 0x20, 0x4f, 
+    0x53, 0x20, 0x58, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x41, 0x73, 
+    0x20, 0x61, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 
+    0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+    0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x74, 0x61, 0x72, 
+    0x67, 0x65, 0x74, 0x20, 0x69, 0x6d, 0x70, 0x6c, 0x69, 0x65, 
+    0x73, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x46, 0x4f, 
+    0x52, 0x43, 0x45, 0x5f, 0x41, 0x55, 0x54, 0x4f, 0x48, 0x49, 
+    0x4e, 0x54, 0x60, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x54, 
+    0x41, 0x52, 0x47, 0x45, 0x54, 0x5f, 0x4d, 0x4f, 0x4e, 0x4f, 
+    0x60, 0x3a, 0x20, 0x53, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x20, 
+    0x68, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6c, 
+    0x67, 0x6f, 0x72, 0x69, 0x74, 0x68, 0x6d, 0x20, 0x74, 0x68, 
+    0x61, 0x74, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 
+    0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 
+    0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x0a, 0x20, 0x20, 0x6d, 
+    0x6f, 0x6e, 0x6f, 0x63, 0x68, 0x72, 0x6f, 0x6d, 0x65, 0x20, 
+    0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x20, 0x54, 0x68, 
+    0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x69, 
+    0x73, 0x20, 0x70, 0x72, 0x6f, 0x62, 0x61, 0x62, 0x6c, 0x79, 
+    0x20, 0x75, 0x6e, 0x70, 0x6c, 0x65, 0x61, 0x73, 0x61, 0x6e, 
+    0x74, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x73, 0x0a, 0x20, 0x20, 
+    0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 0x69, 
+    0x6e, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x6d, 0x6f, 0x6e, 0x6f, 
+    0x63, 0x68, 0x72, 0x6f, 0x6d, 0x65, 0x20, 0x6d, 0x6f, 0x64, 
+    0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x54, 0x41, 
+    0x52, 0x47, 0x45, 0x54, 0x5f, 0x4c, 0x43, 0x44, 0x60, 0x3a, 
+    0x20, 0x41, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x74, 
+    0x20, 0x6f, 0x66, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 
+    0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5f, 0x4e, 0x4f, 0x52, 
+    0x4d, 0x41, 0x4c, 0x60, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6d, 
+    0x69, 0x7a, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x0a, 0x20, 
+    0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 
+    0x6c, 0x6c, 0x79, 0x20, 0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 
+    0x74, 0x65, 0x64, 0x20, 0x4c, 0x43, 0x44, 0x20, 0x64, 0x69, 
+    0x73, 0x70, 0x6c, 0x61, 0x79, 0x73, 0x2e, 0x20, 0x20, 0x4f, 
+    0x6e, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x46, 0x72, 0x65, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6c, 
+    0x64, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x20, 
+    0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 
+    0x6c, 0x69, 0x74, 0x79, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 
+    0x62, 0x65, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 
+    0x64, 0x20, 0x64, 0x75, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x70, 
+    0x61, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x72, 0x65, 0x73, 0x74, 
+    0x72, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 
+    0x69, 0x6e, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x0a, 0x20, 
+    0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x69, 0x6e, 0x67, 0x20, 
+    0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x77, 0x69, 0x6c, 
+    0x6c, 0x20, 0x62, 0x65, 0x20, 0x67, 0x72, 0x61, 0x79, 0x73, 
+    0x63, 0x61, 0x6c, 0x65, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 
+    0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5f, 0x4c, 0x43, 0x44, 
+    0x5f, 0x56, 0x60, 0x3a, 0x20, 0x53, 0x74, 0x72, 0x6f, 0x6e, 
+    0x67, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 
+    0x61, 0x6c, 0x67, 0x6f, 0x72, 0x69, 0x74, 0x68, 0x6d, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 
+    0x64, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, 0x65, 0x20, 
+    0x75, 0x73, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x6d, 0x6f, 0x6e, 0x6f, 0x63, 0x68, 0x72, 0x6f, 0x6d, 
+    0x65, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2e, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 
+    0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x62, 0x61, 0x62, 
+    0x6c, 0x79, 0x20, 0x75, 0x6e, 0x70, 0x6c, 0x65, 0x61, 0x73, 
+    0x61, 0x6e, 0x74, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x0a, 0x20, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 
+    0x73, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x65, 0x64, 
+    0x20, 0x69, 0x6e, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x6d, 0x6f, 
+    0x6e, 0x6f, 0x63, 0x68, 0x72, 0x6f, 0x6d, 0x65, 0x20, 0x6d, 
+    0x6f, 0x64, 0x65, 0x73, 0x2e, 0x20, 0x4f, 0x6e, 0x20, 0x6d, 
+    0x61, 0x6e, 0x79, 0x20, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 
+    0x70, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x73, 0x2c, 
+    0x0a, 0x20, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x69, 0x74, 
+    0x79, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 
+    0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x64, 
+    0x75, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x61, 0x74, 0x65, 
+    0x6e, 0x74, 0x20, 0x72, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 
+    0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x0a, 
+    0x20, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x61, 
+    0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 
+    0x75, 0x6c, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x69, 0x74, 
+    0x6d, 0x61, 0x70, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 
+    0x65, 0x20, 0x67, 0x72, 0x61, 0x79, 0x73, 0x63, 0x61, 0x6c, 
+    0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_SIZE_REQUEST_TYPE[989] = {
+    0x4d, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+    0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6e, 0x67, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 
+    0x66, 0x20, 0x61, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x4e, 0x4f, 0x4d, 0x49, 0x4e, 0x41, 0x4c, 
+    0x60, 0x3a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x6d, 
+    0x69, 0x6e, 0x61, 0x6c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x2e, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 
+    0x2e, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x5f, 0x70, 0x65, 0x72, 
+    0x5f, 0x65, 0x6d, 0x60, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 
+    0x65, 0x64, 0x20, 0x74, 0x6f, 0x0a, 0x20, 0x20, 0x64, 0x65, 
+    0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x65, 0x20, 0x62, 0x6f, 
+    0x74, 0x68, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x52, 0x45, 0x41, 0x4c, 0x5f, 0x44, 0x49, 
+    0x4d, 0x60, 0x3a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 
+    0x61, 0x6c, 0x20, 0x64, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 
+    0x6f, 0x6e, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x75, 
+    0x6d, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x60, 0x7e, 0x46, 0x61, 0x63, 0x65, 0x2e, 
+    0x61, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x60, 0x0a, 
+    0x20, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x28, 0x6d, 0x69, 0x6e, 
+    0x75, 0x73, 0x20, 0x6f, 0x66, 0x29, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x60, 0x7e, 0x46, 0x61, 0x63, 0x65, 0x2e, 0x64, 0x65, 
+    0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x60, 0x20, 0x61, 
+    0x72, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 
+    0x20, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x65, 
+    0x20, 0x62, 0x6f, 0x74, 0x68, 0x0a, 0x20, 0x20, 0x73, 0x63, 
+    0x61, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+    0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x42, 0x42, 
+    0x4f, 0x58, 0x60, 0x3a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 
+    0x6e, 0x67, 0x20, 0x62, 0x6f, 0x78, 0x2e, 0x20, 0x54, 0x68, 
+    0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x60, 0x7e, 
+    0x46, 0x61, 0x63, 0x65, 0x2e, 0x62, 0x62, 0x6f, 0x78, 0x60, 
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 
+    0x74, 0x6f, 0x20, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6d, 0x69, 
+    0x6e, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x72, 
+    0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 
+    0x0a, 0x20, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x20, 0x72, 0x65, 
+    0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x6c, 0x79, 
+    0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x43, 0x45, 0x4c, 0x4c, 
+    0x60, 0x3a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x60, 0x7e, 0x46, 
+    0x61, 0x63, 0x65, 0x2e, 0x6d, 0x61, 0x78, 0x5f, 0x61, 0x64, 
+    0x76, 0x61, 0x6e, 0x63, 0x65, 0x5f, 0x77, 0x69, 0x64, 0x74, 
+    0x68, 0x60, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 
+    0x20, 0x74, 0x6f, 0x20, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6d, 
+    0x69, 0x6e, 0x65, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 
+    0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 
+    0x20, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x73, 
+    0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x76, 0x61, 0x6c, 
+    0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x64, 0x65, 0x74, 0x65, 
+    0x72, 0x6d, 0x69, 0x6e, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x77, 0x61, 
+    0x79, 0x20, 0x61, 0x73, 0x20, 0x60, 0x53, 0x49, 0x5a, 0x45, 
+    0x5f, 0x52, 0x45, 0x51, 0x55, 0x45, 0x53, 0x54, 0x5f, 0x54, 
+    0x59, 0x50, 0x45, 0x2e, 0x52, 0x45, 0x41, 0x4c, 0x5f, 0x44, 
+    0x49, 0x4d, 0x60, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x2e, 0x20, 
+    0x46, 0x69, 0x6e, 0x61, 0x6c, 0x6c, 0x79, 0x2c, 0x20, 0x62, 
+    0x6f, 0x74, 0x68, 0x0a, 0x20, 0x20, 0x73, 0x63, 0x61, 0x6c, 
+    0x69, 0x6e, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 
+    0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6d, 0x61, 0x6c, 
+    0x6c, 0x65, 0x72, 0x20, 0x6f, 0x6e, 0x65, 0x2e, 0x20, 0x54, 
+    0x68, 0x69, 0x73, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 
+    0x73, 0x20, 0x75, 0x73, 0x65, 0x66, 0x75, 0x6c, 0x20, 0x69, 
+    0x66, 0x0a, 0x20, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x77, 0x61, 
+    0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x70, 0x65, 0x63, 
+    0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x66, 0x6f, 
+    0x72, 0x2c, 0x20, 0x73, 0x61, 0x79, 0x2c, 0x20, 0x61, 0x20, 
+    0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x6f, 0x66, 0x20, 
+    0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x0a, 0x20, 0x20, 
+    0x64, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x38, 0x30, 0x78, 0x32, 0x34, 0x20, 
+    0x63, 0x65, 0x6c, 0x6c, 0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x53, 0x43, 0x41, 0x4c, 0x45, 0x53, 0x60, 0x3a, 0x20, 
+    0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x20, 
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x64, 0x69, 0x72, 
+    0x65, 0x63, 0x74, 0x6c, 0x79, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 
+    0x65, 0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x20, 0x64, 0x65, 
+    0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+    0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x70, 0x70, 0x6c, 
+    0x79, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x61, 
+    0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x73, 0x2e, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x62, 0x69, 0x74, 
+    0x6d, 0x61, 0x70, 0x0a, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x73, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x65, 0x68, 
+    0x61, 0x76, 0x69, 0x6f, 0x75, 0x72, 0x20, 0x69, 0x73, 0x20, 
+    0x75, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_STYLE_FLAG[164] = {
+    0x42, 0x69, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 
+    0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6e, 0x67, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 
+    0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x60, 0x46, 0x61, 0x63, 
+    0x65, 0x60, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x49, 0x54, 
+    0x41, 0x4c, 0x49, 0x43, 0x60, 0x3a, 0x20, 0x49, 0x6e, 0x64, 
+    0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 
+    0x74, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 
+    0x66, 0x61, 0x63, 0x65, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 
+    0x20, 0x69, 0x73, 0x20, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 
+    0x0a, 0x20, 0x20, 0x6f, 0x72, 0x20, 0x6f, 0x62, 0x6c, 0x69, 
+    0x71, 0x75, 0x65, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x42, 
+    0x4f, 0x4c, 0x44, 0x60, 0x3a, 0x20, 0x49, 0x6e, 0x64, 0x69, 
+    0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 
+    0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x66, 
+    0x61, 0x63, 0x65, 0x20, 0x69, 0x73, 0x20, 0x62, 0x6f, 0x6c, 
+    0x64, 0x2e, 0x0a, 0x00, 
+};
+
@@ -0,0 +1,87 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/face.py.
+*/
+
+#ifndef __DOC_FACE_H__
+#define __DOC_FACE_H__
+extern char doc_FACE_FLAG[3347];
+extern char doc_FSTYPE[1261];
+extern char doc_Face__init__[1878];
+extern char doc_Face_ascender[172];
+extern char doc_Face_attach[345];
+extern char doc_Face_available_sizes[70];
+extern char doc_Face_bbox[425];
+extern char doc_Face_charmap[33];
+extern char doc_Face_charmaps[30];
+extern char doc_Face_coverage[383];
+extern char doc_Face_descender[216];
+extern char doc_Face_face_flags[76];
+extern char doc_Face_face_index[100];
+extern char doc_Face_family_name[443];
+extern char doc_Face_filename[107];
+extern char doc_Face_get_char_index[969];
+extern char doc_Face_get_char_index_unicode[457];
+extern char doc_Face_get_char_indices[668];
+extern char doc_Face_get_char_map_arrays[541];
+extern char doc_Face_get_char_name[309];
+extern char doc_Face_get_char_variant_index[884];
+extern char doc_Face_get_chars[141];
+extern char doc_Face_get_fstype_flags[178];
+extern char doc_Face_get_glyph_name[502];
+extern char doc_Face_get_kerning[592];
+extern char doc_Face_get_kerning_batch[706];
+extern char doc_Face_get_name_index[263];
+extern char doc_Face_get_postscript_name[115];
+extern char doc_Face_get_track_kerning[688];
+extern char doc_Face_glyph[41];
+extern char doc_Face_has_horizontal[78];
+extern char doc_Face_has_kerning[85];
+extern char doc_Face_has_ps_glyph_names[197];
+extern char doc_Face_has_vertical[98];
+extern char doc_Face_height[211];
+extern char doc_Face_is_fixed_width[51];
+extern char doc_Face_is_scalable[106];
+extern char doc_Face_is_sfnt[133];
+extern char doc_Face_layout_many[1313];
+extern char doc_Face_load_char[552];
+extern char doc_Face_load_char_unicode[766];
+extern char doc_Face_load_glyph[2093];
+extern char doc_Face_max_advance_height[224];
+extern char doc_Face_max_advance_width[168];
+extern char doc_Face_measure_text[940];
+extern char doc_Face_num_faces[97];
+extern char doc_Face_num_fixed_sizes[153];
+extern char doc_Face_num_glyphs[214];
+extern char doc_Face_own_library[91];
+extern char doc_Face_render_glyphs[1294];
+extern char doc_Face_request_size[1255];
+extern char doc_Face_select_charmap[526];
+extern char doc_Face_select_size[144];
+extern char doc_Face_set_char_size[702];
+extern char doc_Face_set_charmap[193];
+extern char doc_Face_set_lcd_filter[389];
+extern char doc_Face_set_lcd_filter_weights[238];
+extern char doc_Face_set_transform[596];
+extern char doc_Face_sfnt_names[60];
+extern char doc_Face_size[28];
+extern char doc_Face_style_flags[63];
+extern char doc_Face_style_name[423];
+extern char doc_Face_tt_header[36];
+extern char doc_Face_tt_horiheader[126];
+extern char doc_Face_tt_os2[113];
+extern char doc_Face_tt_pclt[105];
+extern char doc_Face_tt_postscript[117];
+extern char doc_Face_tt_vertheader[124];
+extern char doc_Face_underline_position[131];
+extern char doc_Face_underline_thickness[85];
+extern char doc_Face_units_per_em[148];
+extern char doc_KERNING[226];
+extern char doc_LOAD[5714];
+extern char doc_SIZE_REQUEST_TYPE[989];
+extern char doc_STYLE_FLAG[164];
+
+#endif
+
@@ -0,0 +1,257 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/fallback_layout.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "fallback_layout.h"
+
+char doc_FallbackLayout__init__[762] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x4c, 0x61, 0x79, 0x73, 0x20, 0x6f, 0x75, 0x74, 0x20, 
+    0x6c, 0x65, 0x66, 0x74, 0x2d, 0x74, 0x6f, 0x2d, 0x72, 0x69, 
+    0x67, 0x68, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x75, 
+    0x73, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 0x6c, 0x69, 0x73, 
+    0x74, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x61, 0x63, 0x65, 0x73, 
+    0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x74, 0x65, 0x78, 
+    0x74, 0x20, 0x69, 0x73, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 
+    0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x72, 0x75, 0x6e, 0x73, 
+    0x20, 0x6f, 0x66, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+    0x74, 0x65, 0x72, 0x73, 0x2c, 0x20, 0x65, 0x61, 0x63, 0x68, 
+    0x20, 0x6f, 0x66, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 
+    0x69, 0x73, 0x20, 0x6c, 0x61, 0x69, 0x64, 0x20, 0x6f, 0x75, 
+    0x74, 0x0a, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x61, 0x63, 
+    0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x68, 0x61, 0x73, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x69, 
+    0x74, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x61, 0x74, 
+    0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x69, 0x6e, 0x0a, 0x6d, 
+    0x61, 0x6e, 0x79, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 
+    0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x6c, 
+    0x61, 0x69, 0x64, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x69, 0x6e, 
+    0x20, 0x6f, 0x6e, 0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x2e, 
+    0x20, 0x20, 0x43, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
+    0x72, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6e, 0x6f, 
+    0x6e, 0x65, 0x20, 0x6f, 0x66, 0x0a, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x61, 0x63, 0x65, 0x73, 0x20, 0x63, 0x6f, 0x76, 0x65, 
+    0x72, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6c, 0x61, 0x69, 0x64, 
+    0x20, 0x6f, 0x75, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 
+    0x66, 0x61, 0x63, 0x65, 0x2e, 0x0a, 0x0a, 0x57, 0x68, 0x69, 
+    0x63, 0x68, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x73, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66, 
+    0x61, 0x63, 0x65, 0x20, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x73, 
+    0x20, 0x69, 0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20, 
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 
+    0x2e, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x60, 
+    0x2c, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x6b, 0x65, 0x70, 0x74, 
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x61, 0x63, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6c, 
+    0x61, 0x74, 0x65, 0x72, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 
+    0x74, 0x73, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 
+    0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x66, 0x61, 0x63, 
+    0x65, 0x73, 0x20, 0x3a, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 
+    0x6e, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x46, 0x61, 0x63, 
+    0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 
+    0x66, 0x61, 0x63, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x75, 
+    0x73, 0x65, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x6f, 0x72, 0x64, 
+    0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x72, 0x65, 0x66, 
+    0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x2e, 0x20, 0x20, 0x45, 
+    0x61, 0x63, 0x68, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x68, 
+    0x61, 0x76, 0x65, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x60, 0x43, 
+    0x68, 0x61, 0x72, 0x4d, 0x61, 0x70, 0x60, 0x20, 0x73, 0x65, 
+    0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x74, 
+    0x65, 0x78, 0x74, 0x20, 0x3a, 0x20, 0x75, 0x6e, 0x69, 0x63, 
+    0x6f, 0x64, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 
+    0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x74, 0x6f, 0x20, 
+    0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x20, 0x69, 0x6e, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 
+    0x74, 0x2e, 0x0a, 0x0a, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x66, 
+    0x6c, 0x61, 0x67, 0x73, 0x20, 0x3a, 0x20, 0x60, 0x4c, 0x4f, 
+    0x41, 0x44, 0x60, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x2c, 
+    0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x41, 0x6e, 0x79, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x66, 
+    0x6c, 0x61, 0x67, 0x73, 0x2e, 0x20, 0x20, 0x60, 0x4c, 0x4f, 
+    0x41, 0x44, 0x2e, 0x56, 0x45, 0x52, 0x54, 0x49, 0x43, 0x41, 
+    0x4c, 0x5f, 0x4c, 0x41, 0x59, 0x4f, 0x55, 0x54, 0x60, 0x20, 
+    0x6c, 0x61, 0x79, 0x73, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 
+    0x6c, 0x79, 0x2c, 0x20, 0x61, 0x73, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x60, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x60, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_FallbackLayout_draw[558] = {
+    0x52, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 
+    0x20, 0x61, 0x6e, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2e, 
+    0x0a, 0x0a, 0x45, 0x61, 0x63, 0x68, 0x20, 0x72, 0x75, 0x6e, 
+    0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 
+    0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x74, 
+    0x73, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x66, 0x61, 0x63, 0x65, 
+    0x2e, 0x20, 0x20, 0x57, 0x68, 0x65, 0x72, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72, 
+    0x6c, 0x61, 0x70, 0x20, 0x65, 0x61, 0x63, 0x68, 0x0a, 0x6f, 
+    0x74, 0x68, 0x65, 0x72, 0x20, 0x6f, 0x72, 0x20, 0x65, 0x78, 
+    0x69, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6e, 
+    0x74, 0x65, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x76, 0x61, 
+    0x6c, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6b, 0x65, 0x70, 
+    0x74, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 
+    0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x62, 0x75, 0x66, 0x66, 
+    0x65, 0x72, 0x20, 0x3a, 0x20, 0x77, 0x72, 0x69, 0x74, 0x61, 
+    0x62, 0x6c, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x41, 0x20, 0x32, 0x2d, 0x64, 
+    0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6f, 0x66, 0x20, 
+    0x62, 0x79, 0x74, 0x65, 0x73, 0x2c, 0x20, 0x73, 0x75, 0x63, 
+    0x68, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x4e, 0x75, 0x6d, 
+    0x70, 0x79, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x60, 0x60, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x60, 0x60, 
+    0x2c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x6f, 0x77, 
+    0x73, 0x20, 0x72, 0x75, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x20, 
+    0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x6f, 0x70, 0x20, 0x74, 
+    0x6f, 0x20, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x2e, 0x0a, 
+    0x0a, 0x78, 0x2c, 0x20, 0x79, 0x20, 0x3a, 0x20, 0x66, 0x6c, 
+    0x6f, 0x61, 0x74, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+    0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 
+    0x65, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 
+    0x79, 0x6f, 0x75, 0x74, 0x27, 0x73, 0x20, 0x6f, 0x72, 0x69, 
+    0x67, 0x69, 0x6e, 0x20, 0x28, 0x74, 0x68, 0x65, 0x20, 0x73, 
+    0x74, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 
+    0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2c, 0x20, 
+    0x69, 0x6e, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x2e, 
+    0x0a, 0x0a, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x5f, 0x6d, 
+    0x6f, 0x64, 0x65, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x2c, 
+    0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x65, 0x20, 0x60, 0x52, 
+    0x45, 0x4e, 0x44, 0x45, 0x52, 0x5f, 0x4d, 0x4f, 0x44, 0x45, 
+    0x60, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 
+    0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x20, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x4c, 0x43, 0x44, 0x20, 0x6d, 0x6f, 
+    0x64, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 
+    0x6f, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_FallbackLayout_face_ids[110] = {
+    0x41, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x6f, 
+    0x66, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 
+    0x20, 0x33, 0x32, 0x2d, 0x62, 0x69, 0x74, 0x20, 0x69, 0x6e, 
+    0x74, 0x65, 0x67, 0x65, 0x72, 0x73, 0x20, 0x67, 0x69, 0x76, 
+    0x69, 0x6e, 0x67, 0x2c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 
+    0x61, 0x63, 0x68, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x2c, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 
+    0x0a, 0x69, 0x6e, 0x20, 0x60, 0x66, 0x61, 0x63, 0x65, 0x73, 
+    0x60, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x61, 0x63, 0x65, 0x20, 0x69, 0x74, 0x20, 0x63, 0x6f, 0x6d, 
+    0x65, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_FallbackLayout_faces[38] = {
+    0x54, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x73, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x79, 
+    0x6f, 0x75, 0x74, 0x2c, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 
+    0x74, 0x75, 0x70, 0x6c, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_FallbackLayout_ink_bbox[127] = {
+    0x54, 0x68, 0x65, 0x20, 0x74, 0x69, 0x67, 0x68, 0x74, 0x20, 
+    0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 
+    0x6f, 0x78, 0x20, 0x28, 0x60, 0x42, 0x42, 0x6f, 0x78, 0x60, 
+    0x29, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 
+    0x68, 0x79, 0x73, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x69, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 
+    0x75, 0x74, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6f, 
+    0x72, 0x69, 0x67, 0x69, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x61, 
+    0x74, 0x20, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 
+    0x74, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x69, 
+    0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_FallbackLayout_layout[227] = {
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x61, 0x20, 
+    0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x75, 
+    0x70, 0x6c, 0x65, 0x73, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 
+    0x69, 0x62, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x0a, 0x0a, 0x45, 
+    0x61, 0x63, 0x68, 0x20, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x20, 
+    0x69, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x2d, 
+    0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x3a, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x20, 
+    0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x63, 0x6f, 0x6e, 
+    0x74, 0x61, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x0a, 0x20, 0x20, 
+    0x2d, 0x20, 0x60, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x5f, 0x69, 
+    0x6e, 0x64, 0x65, 0x78, 0x60, 0x3a, 0x20, 0x54, 0x68, 0x65, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6e, 0x64, 
+    0x65, 0x78, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 
+    0x0a, 0x20, 0x20, 0x2d, 0x20, 0x60, 0x28, 0x78, 0x2c, 0x20, 
+    0x79, 0x29, 0x60, 0x3a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x78, 
+    0x2c, 0x20, 0x79, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 
+    0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x0a, 0x00, 
+};
+
+char doc_FallbackLayout_layout_bbox[148] = {
+    0x54, 0x68, 0x65, 0x20, 0x6c, 0x6f, 0x67, 0x69, 0x63, 0x61, 
+    0x6c, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 
+    0x20, 0x62, 0x6f, 0x78, 0x20, 0x28, 0x60, 0x42, 0x42, 0x6f, 
+    0x78, 0x60, 0x29, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x20, 0x20, 
+    0x56, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6c, 0x79, 
+    0x2c, 0x20, 0x69, 0x74, 0x0a, 0x69, 0x6e, 0x63, 0x6c, 0x75, 
+    0x64, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x73, 
+    0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x64, 
+    0x20, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 
+    0x20, 0x6f, 0x66, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 
+    0x66, 0x61, 0x63, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x2e, 
+    0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 
+    0x6c, 0x74, 0x0a, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x70, 
+    0x69, 0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_FallbackLayout_runs[204] = {
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x61, 0x20, 
+    0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x60, 0x60, 
+    0x28, 0x66, 0x61, 0x63, 0x65, 0x5f, 0x69, 0x64, 0x2c, 0x20, 
+    0x73, 0x74, 0x61, 0x72, 0x74, 0x2c, 0x20, 0x65, 0x6e, 0x64, 
+    0x29, 0x60, 0x60, 0x20, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x73, 
+    0x2c, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+    0x65, 0x61, 0x63, 0x68, 0x20, 0x72, 0x75, 0x6e, 0x0a, 0x6f, 
+    0x66, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x6c, 
+    0x61, 0x69, 0x64, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x77, 0x69, 
+    0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 
+    0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x2c, 0x20, 0x69, 0x6e, 
+    0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2e, 0x20, 0x20, 0x2a, 
+    0x66, 0x61, 0x63, 0x65, 0x5f, 0x69, 0x64, 0x2a, 0x20, 0x69, 
+    0x73, 0x20, 0x61, 0x6e, 0x0a, 0x69, 0x6e, 0x64, 0x65, 0x78, 
+    0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x60, 0x66, 0x61, 0x63, 
+    0x65, 0x73, 0x60, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x72, 0x75, 0x6e, 0x20, 0x63, 0x6f, 0x76, 
+    0x65, 0x72, 0x73, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 
+    0x20, 0x2a, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2a, 0x20, 0x74, 
+    0x6f, 0x20, 0x2a, 0x65, 0x6e, 0x64, 0x20, 0x2d, 0x20, 0x31, 
+    0x2a, 0x2e, 0x0a, 0x00, 
+};
+
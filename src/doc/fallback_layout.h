@@ -0,0 +1,20 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/fallback_layout.py.
+*/
+
+#ifndef __DOC_FALLBACK_LAYOUT_H__
+#define __DOC_FALLBACK_LAYOUT_H__
+extern char doc_FallbackLayout__init__[762];
+extern char doc_FallbackLayout_draw[558];
+extern char doc_FallbackLayout_face_ids[110];
+extern char doc_FallbackLayout_faces[38];
+extern char doc_FallbackLayout_ink_bbox[127];
+extern char doc_FallbackLayout_layout[227];
+extern char doc_FallbackLayout_layout_bbox[148];
+extern char doc_FallbackLayout_runs[204];
+
+#endif
+
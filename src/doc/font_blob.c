@@ -0,0 +1,84 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/font_blob.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "font_blob.h"
+
+char doc_font_blob_usage[673] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 
+    0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x75, 0x73, 0x65, 0x64, 
+    0x20, 0x62, 0x79, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x66, 
+    0x69, 0x6c, 0x65, 0x73, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 
+    0x64, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 
+    0x66, 0x61, 0x63, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x46, 0x6f, 
+    0x6e, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x6f, 
+    0x70, 0x65, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x70, 
+    0x61, 0x74, 0x68, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6d, 0x65, 
+    0x6d, 0x6f, 0x72, 0x79, 0x2d, 0x6d, 0x61, 0x70, 0x70, 0x65, 
+    0x64, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6f, 0x63, 
+    0x65, 0x73, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x73, 
+    0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 
+    0x6c, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x20, 0x6f, 0x62, 0x6a, 
+    0x65, 0x63, 0x74, 0x73, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x65, 
+    0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 
+    0x2e, 0x20, 0x20, 0x41, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x0a, 
+    0x69, 0x73, 0x20, 0x75, 0x6e, 0x6d, 0x61, 0x70, 0x70, 0x65, 
+    0x64, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6c, 0x61, 0x73, 0x74, 0x20, 0x66, 0x61, 0x63, 0x65, 
+    0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x74, 0x20, 
+    0x69, 0x73, 0x20, 0x66, 0x72, 0x65, 0x65, 0x64, 0x2e, 0x20, 
+    0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 
+    0x6c, 0x65, 0x20, 0x69, 0x73, 0x0a, 0x6d, 0x6f, 0x64, 0x69, 
+    0x66, 0x69, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x64, 0x69, 
+    0x73, 0x6b, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x61, 
+    0x63, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x6d, 
+    0x61, 0x70, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6e, 0x65, 0x77, 
+    0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x73, 0x2e, 
+    0x20, 0x20, 0x45, 0x78, 0x69, 0x73, 0x74, 0x69, 0x6e, 0x67, 
+    0x20, 0x66, 0x61, 0x63, 0x65, 0x73, 0x0a, 0x6b, 0x65, 0x65, 
+    0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x6c, 0x64, 0x20, 
+    0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x6f, 
+    0x6e, 0x6c, 0x79, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 
+    0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x64, 0x20, 0x62, 
+    0x79, 0x20, 0x72, 0x65, 0x6e, 0x61, 0x6d, 0x69, 0x6e, 0x67, 
+    0x20, 0x61, 0x20, 0x6e, 0x65, 0x77, 0x0a, 0x66, 0x69, 0x6c, 
+    0x65, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x69, 0x74, 0x3b, 
+    0x20, 0x73, 0x65, 0x65, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 
+    0x60, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x77, 0x68, 0x79, 0x20, 
+    0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x6d, 0x75, 0x73, 0x74, 
+    0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 
+    0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6e, 0x20, 0x69, 0x6e, 
+    0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x2e, 0x0a, 0x0a, 0x7c, 
+    0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 0x20, 
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 
+    0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x2d, 0x73, 
+    0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 0x66, 0x75, 
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x52, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x63, 0x6f, 0x75, 0x6e, 0x74, 
+    0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 
+    0x72, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 
+    0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x6d, 0x61, 0x70, 0x70, 0x65, 
+    0x64, 0x2e, 0x0a, 0x0a, 0x6e, 0x62, 0x79, 0x74, 0x65, 0x73, 
+    0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 
+    0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x68, 0x6f, 0x73, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 
+    0x2c, 0x20, 0x69, 0x6e, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 
+    0x2e, 0x0a, 0x00, 
+};
+
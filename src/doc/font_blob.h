@@ -0,0 +1,13 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/font_blob.py.
+*/
+
+#ifndef __DOC_FONT_BLOB_H__
+#define __DOC_FONT_BLOB_H__
+extern char doc_font_blob_usage[673];
+
+#endif
+
@@ -0,0 +1,12 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/freetypy.py.
+*/
+
+#ifndef __DOC_FREETYPY_H__
+#define __DOC_FREETYPY_H__
+
+#endif
+
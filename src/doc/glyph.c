@@ -0,0 +1,840 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/glyph.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "glyph.h"
+
+char doc_GLYPH_BBOX[319] = {
+    0x49, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 
+    0x68, 0x6f, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 
+    0x6c, 0x75, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x60, 0x47, 
+    0x6c, 0x79, 0x70, 0x68, 0x2e, 0x67, 0x65, 0x74, 0x5f, 0x63, 
+    0x62, 0x6f, 0x78, 0x60, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x55, 0x4e, 0x53, 0x43, 0x41, 0x4c, 0x45, 
+    0x44, 0x60, 0x3a, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+    0x20, 0x75, 0x6e, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x64, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 
+    0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x53, 0x55, 0x42, 0x50, 
+    0x49, 0x58, 0x45, 0x4c, 0x53, 0x60, 0x3a, 0x20, 0x52, 0x65, 
+    0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x6e, 0x66, 0x69, 0x74, 
+    0x74, 0x65, 0x64, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 
+    0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x63, 0x6f, 0x6f, 0x72, 0x64, 
+    0x69, 0x6e, 0x61, 0x74, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x2d, 
+    0x20, 0x60, 0x47, 0x52, 0x49, 0x44, 0x46, 0x49, 0x54, 0x60, 
+    0x3a, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x67, 
+    0x72, 0x69, 0x64, 0x2d, 0x66, 0x69, 0x74, 0x74, 0x65, 0x64, 
+    0x20, 0x66, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 
+    0x20, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 0x74, 
+    0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x54, 0x52, 
+    0x55, 0x4e, 0x43, 0x41, 0x54, 0x45, 0x60, 0x3a, 0x20, 0x52, 
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x63, 0x6f, 0x6f, 0x72, 
+    0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x73, 0x20, 0x69, 0x6e, 
+    0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x70, 
+    0x69, 0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x50, 0x49, 0x58, 0x45, 0x4c, 0x53, 0x60, 0x3a, 0x20, 
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x67, 0x72, 0x69, 
+    0x64, 0x2d, 0x66, 0x69, 0x74, 0x74, 0x65, 0x64, 0x20, 0x70, 
+    0x69, 0x78, 0x65, 0x6c, 0x20, 0x63, 0x6f, 0x6f, 0x72, 0x64, 
+    0x69, 0x6e, 0x61, 0x74, 0x65, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_GLYPH_FORMAT[909] = {
+    0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x73, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 
+    0x6e, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6d, 
+    0x61, 0x67, 0x65, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 
+    0x66, 0x20, 0x46, 0x72, 0x65, 0x65, 0x54, 0x79, 0x70, 0x65, 
+    0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x73, 0x75, 0x70, 0x70, 
+    0x6f, 0x72, 0x74, 0x73, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x69, 
+    0x6d, 0x61, 0x67, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 
+    0x74, 0x73, 0x2c, 0x0a, 0x65, 0x76, 0x65, 0x6e, 0x20, 0x74, 
+    0x68, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x66, 0x75, 0x74, 0x75, 
+    0x72, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x72, 
+    0x69, 0x76, 0x65, 0x72, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 
+    0x20, 0x62, 0x65, 0x20, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 
+    0x6f, 0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 
+    0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x6f, 0x77, 0x6e, 
+    0x0a, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x4e, 0x4f, 0x4e, 0x45, 0x60, 0x3a, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 
+    0x30, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 
+    0x76, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x43, 
+    0x4f, 0x4d, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x45, 0x60, 0x3a, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 
+    0x61, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x73, 0x69, 0x74, 
+    0x65, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x76, 0x65, 0x72, 
+    0x61, 0x6c, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x0a, 0x20, 
+    0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x73, 0x2e, 0x20, 0x54, 
+    0x68, 0x69, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x20, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x75, 
+    0x73, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x60, 
+    0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x4e, 0x4f, 0x5f, 0x52, 0x45, 
+    0x43, 0x55, 0x52, 0x53, 0x45, 0x60, 0x2c, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x75, 0x73, 0x65, 
+    0x64, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x72, 
+    0x74, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x75, 0x6e, 0x64, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x28, 0x6c, 
+    0x69, 0x6b, 0x65, 0x20, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 
+    0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x73, 0x29, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 
+    0x42, 0x49, 0x54, 0x4d, 0x41, 0x50, 0x60, 0x3a, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 
+    0x6d, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 
+    0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x2c, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x64, 
+    0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x64, 0x20, 0x61, 
+    0x73, 0x20, 0x61, 0x6e, 0x0a, 0x20, 0x20, 0x60, 0x42, 0x69, 
+    0x74, 0x6d, 0x61, 0x70, 0x60, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x4f, 0x55, 0x54, 0x4c, 0x49, 0x4e, 0x45, 0x60, 0x3a, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 
+    0x61, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x69, 0x61, 
+    0x6c, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 
+    0x6d, 0x61, 0x64, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6c, 0x69, 
+    0x6e, 0x65, 0x0a, 0x20, 0x20, 0x73, 0x65, 0x67, 0x6d, 0x65, 
+    0x6e, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x42, 0xc3, 
+    0xa9, 0x7a, 0x69, 0x65, 0x72, 0x20, 0x61, 0x72, 0x63, 0x73, 
+    0x3b, 0x20, 0x69, 0x74, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 
+    0x65, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 
+    0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x60, 0x4f, 
+    0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x60, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x50, 0x4c, 0x4f, 0x54, 0x54, 0x45, 0x52, 
+    0x60, 0x3a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x69, 
+    0x73, 0x20, 0x61, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 
+    0x69, 0x61, 0x6c, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x77, 
+    0x69, 0x74, 0x68, 0x20, 0x6e, 0x6f, 0x20, 0x69, 0x6e, 0x73, 
+    0x69, 0x64, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x20, 0x20, 
+    0x6f, 0x75, 0x74, 0x73, 0x69, 0x64, 0x65, 0x20, 0x63, 0x6f, 
+    0x6e, 0x74, 0x6f, 0x75, 0x72, 0x73, 0x2e, 0x20, 0x53, 0x6f, 
+    0x6d, 0x65, 0x20, 0x54, 0x79, 0x70, 0x65, 0x20, 0x31, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x6c, 0x69, 0x6b, 
+    0x65, 0x20, 0x74, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x69, 0x6e, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x48, 0x65, 0x72, 0x73, 0x68, 
+    0x65, 0x79, 0x0a, 0x20, 0x20, 0x66, 0x61, 0x6d, 0x69, 0x6c, 
+    0x79, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x69, 0x6e, 
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x6d, 
+    0x61, 0x74, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x73, 0x65, 0x20, 
+    0x61, 0x72, 0x65, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 
+    0x62, 0x65, 0x64, 0x20, 0x61, 0x73, 0x0a, 0x20, 0x20, 0x60, 
+    0x4f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x60, 0x2c, 0x20, 
+    0x62, 0x75, 0x74, 0x20, 0x46, 0x72, 0x65, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x20, 0x69, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x63, 
+    0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x6c, 0x79, 0x20, 0x63, 
+    0x61, 0x70, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 
+    0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x20, 
+    0x74, 0x68, 0x65, 0x6d, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x72, 
+    0x72, 0x65, 0x63, 0x74, 0x6c, 0x79, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph__init__[326] = {
+    0x49, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x70, 0x65, 0x72, 0x74, 0x61, 0x69, 0x6e, 0x69, 
+    0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x73, 0x69, 
+    0x6e, 0x67, 0x6c, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x49, 0x66, 0x20, 0x60, 0x46, 
+    0x61, 0x63, 0x65, 0x2e, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x60, 0x20, 0x69, 0x73, 0x20, 0x63, 
+    0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 
+    0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x66, 
+    0x6c, 0x61, 0x67, 0x73, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 
+    0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x44, 0x45, 0x46, 0x41, 
+    0x55, 0x4c, 0x54, 0x60, 0x29, 0x0a, 0x74, 0x68, 0x65, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6d, 0x61, 0x67, 
+    0x65, 0x20, 0x69, 0x73, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x65, 
+    0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x20, 
+    0x69, 0x6e, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6e, 0x61, 0x74, 
+    0x69, 0x76, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x0a, 0x28, 0x65, 0x2e, 0x67, 0x2e, 0x2c, 0x20, 0x61, 0x6e, 
+    0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x54, 
+    0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x54, 0x79, 0x70, 0x65, 0x20, 0x31, 0x20, 0x66, 
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x29, 0x2e, 0x0a, 0x0a, 
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 
+    0x20, 0x63, 0x61, 0x6e, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x72, 
+    0x20, 0x62, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 
+    0x74, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x61, 
+    0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x62, 0x79, 
+    0x20, 0x63, 0x61, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x0a, 0x60, 
+    0x47, 0x6c, 0x79, 0x70, 0x68, 0x2e, 0x72, 0x65, 0x6e, 0x64, 
+    0x65, 0x72, 0x60, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_advance[266] = {
+    0x54, 0x68, 0x65, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 
+    0x6f, 0x72, 0x6d, 0x65, 0x64, 0x20, 0x61, 0x64, 0x76, 0x61, 
+    0x6e, 0x63, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x28, 0x69, 0x6e, 0x20, 0x66, 0x72, 
+    0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x70, 
+    0x69, 0x78, 0x65, 0x6c, 0x73, 0x29, 0x2e, 0x20, 0x4d, 0x61, 
+    0x79, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x74, 
+    0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 
+    0x2c, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x69, 0x6e, 
+    0x67, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f, 0x66, 0x0a, 0x60, 0x4c, 
+    0x4f, 0x41, 0x44, 0x2e, 0x49, 0x47, 0x4e, 0x4f, 0x52, 0x45, 
+    0x5f, 0x54, 0x52, 0x41, 0x4e, 0x53, 0x46, 0x4f, 0x52, 0x4d, 
+    0x60, 0x2e, 0x20, 0x41, 0x73, 0x20, 0x73, 0x70, 0x65, 0x63, 
+    0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 
+    0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x56, 0x45, 0x52, 
+    0x54, 0x49, 0x43, 0x41, 0x4c, 0x5f, 0x4c, 0x41, 0x59, 0x4f, 
+    0x55, 0x54, 0x60, 0x2c, 0x20, 0x69, 0x74, 0x0a, 0x75, 0x73, 
+    0x65, 0x73, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x60, 0x68, 0x6f, 0x72, 0x69, 0x41, 
+    0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x60, 0x20, 0x6f, 0x72, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x76, 0x65, 0x72, 0x74, 
+    0x41, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x60, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x60, 0x6d, 
+    0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x60, 0x0a, 0x66, 0x69, 
+    0x65, 0x6c, 0x64, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_bitmap[61] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x42, 
+    0x69, 0x74, 0x6d, 0x61, 0x70, 0x60, 0x20, 0x66, 0x72, 0x6f, 
+    0x6d, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x60, 0x47, 0x6c, 
+    0x79, 0x70, 0x68, 0x60, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 
+    0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6e, 0x20, 
+    0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x65, 0x64, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Glyph_bitmap_left[126] = {
+    0x54, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x27, 0x73, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x62, 0x65, 
+    0x61, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x78, 0x70, 0x72, 
+    0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x69, 
+    0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x70, 0x69, 0x78, 
+    0x65, 0x6c, 0x73, 0x2e, 0x20, 0x4f, 0x66, 0x20, 0x63, 0x6f, 
+    0x75, 0x72, 0x73, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x0a, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x76, 
+    0x61, 0x6c, 0x69, 0x64, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x20, 0x69, 
+    0x73, 0x20, 0x60, 0x47, 0x4c, 0x59, 0x50, 0x48, 0x5f, 0x46, 
+    0x4f, 0x52, 0x4d, 0x41, 0x54, 0x2e, 0x42, 0x49, 0x54, 0x4d, 
+    0x41, 0x50, 0x60, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_bitmap_top[250] = {
+    0x54, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x27, 0x73, 0x20, 0x74, 0x6f, 0x70, 0x20, 0x62, 0x65, 0x61, 
+    0x72, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 
+    0x73, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x6e, 
+    0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x70, 0x69, 0x78, 0x65, 
+    0x6c, 0x73, 0x2e, 0x20, 0x52, 0x65, 0x6d, 0x65, 0x6d, 0x62, 
+    0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x0a, 0x74, 0x68, 
+    0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x66, 
+    0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 
+    0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x74, 0x6f, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x70, 0x2d, 0x6d, 0x6f, 
+    0x73, 0x74, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x73, 
+    0x63, 0x61, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x0a, 0x75, 
+    0x70, 0x77, 0x61, 0x72, 0x64, 0x73, 0x20, 0x2a, 0x79, 0x2a, 
+    0x20, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 0x74, 
+    0x65, 0x73, 0x20, 0x62, 0x65, 0x69, 0x6e, 0x67, 0x20, 0x70, 
+    0x6f, 0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x2e, 0x20, 0x4f, 
+    0x66, 0x20, 0x63, 0x6f, 0x75, 0x72, 0x73, 0x65, 0x2c, 0x20, 
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x6e, 
+    0x6c, 0x79, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x0a, 0x69, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 
+    0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x60, 0x47, 0x4c, 0x59, 
+    0x50, 0x48, 0x5f, 0x46, 0x4f, 0x52, 0x4d, 0x41, 0x54, 0x2e, 
+    0x42, 0x49, 0x54, 0x4d, 0x41, 0x50, 0x60, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_face[25] = {
+    0x54, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 
+    0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 
+    0x63, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_format[209] = {
+    0x54, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6d, 
+    0x61, 0x67, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x73, 0x6c, 0x6f, 
+    0x74, 0x2e, 0x20, 0x54, 0x79, 0x70, 0x69, 0x63, 0x61, 0x6c, 
+    0x6c, 0x79, 0x0a, 0x60, 0x47, 0x4c, 0x59, 0x50, 0x48, 0x5f, 
+    0x46, 0x4f, 0x52, 0x4d, 0x41, 0x54, 0x2e, 0x42, 0x49, 0x54, 
+    0x4d, 0x41, 0x50, 0x60, 0x2c, 0x20, 0x60, 0x47, 0x4c, 0x59, 
+    0x50, 0x48, 0x5f, 0x46, 0x4f, 0x52, 0x4d, 0x41, 0x54, 0x2e, 
+    0x4f, 0x55, 0x54, 0x4c, 0x49, 0x4e, 0x45, 0x60, 0x2c, 0x20, 
+    0x6f, 0x72, 0x0a, 0x60, 0x47, 0x4c, 0x59, 0x50, 0x48, 0x5f, 
+    0x46, 0x4f, 0x52, 0x4d, 0x41, 0x54, 0x2e, 0x43, 0x4f, 0x4d, 
+    0x50, 0x4f, 0x53, 0x49, 0x54, 0x45, 0x60, 0x2c, 0x20, 0x62, 
+    0x75, 0x74, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x73, 0x20, 
+    0x61, 0x72, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 
+    0x6c, 0x65, 0x2e, 0x0a, 0x0a, 0x53, 0x65, 0x65, 0x20, 0x60, 
+    0x47, 0x4c, 0x59, 0x50, 0x48, 0x5f, 0x46, 0x4f, 0x52, 0x4d, 
+    0x41, 0x54, 0x60, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x61, 
+    0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_get_cbox[1945] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x27, 0x73, 0x20, 0xe2, 0x80, 0x98, 0x63, 
+    0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x62, 0x6f, 0x78, 
+    0xe2, 0x80, 0x99, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 
+    0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x62, 0x6f, 
+    0x78, 0x20, 0x65, 0x6e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x73, 
+    0x20, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 
+    0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x27, 0x73, 0x20, 0x70, 
+    0x6f, 0x69, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x63, 
+    0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x42, 0xc3, 0xa9, 
+    0x7a, 0x69, 0x65, 0x72, 0x0a, 0x63, 0x6f, 0x6e, 0x74, 0x72, 
+    0x6f, 0x6c, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x2e, 
+    0x20, 0x54, 0x68, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x69, 0x74, 
+    0x20, 0x63, 0x6f, 0x69, 0x6e, 0x63, 0x69, 0x64, 0x65, 0x73, 
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x65, 0x78, 0x61, 0x63, 0x74, 0x20, 0x62, 0x6f, 0x75, 0x6e, 
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6f, 0x78, 0x20, 0x66, 
+    0x6f, 0x72, 0x0a, 0x6d, 0x6f, 0x73, 0x74, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x73, 0x2c, 0x20, 0x69, 0x74, 0x20, 0x63, 
+    0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x73, 0x6c, 0x69, 0x67, 
+    0x68, 0x74, 0x6c, 0x79, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 
+    0x72, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 
+    0x73, 0x69, 0x74, 0x75, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+    0x20, 0x28, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x77, 0x68, 0x65, 
+    0x6e, 0x0a, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6e, 0x67, 
+    0x20, 0x61, 0x6e, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x6f, 
+    0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x42, 0xc3, 0xa9, 
+    0x7a, 0x69, 0x65, 0x72, 0x20, 0x6f, 0x75, 0x74, 0x73, 0x69, 
+    0x64, 0x65, 0x20, 0x61, 0x72, 0x63, 0x73, 0x29, 0x2e, 0x0a, 
+    0x0a, 0x43, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 
+    0x6f, 0x6c, 0x20, 0x62, 0x6f, 0x78, 0x20, 0x69, 0x73, 0x20, 
+    0x76, 0x65, 0x72, 0x79, 0x20, 0x66, 0x61, 0x73, 0x74, 0x2c, 
+    0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x67, 0x65, 0x74, 
+    0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 
+    0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6f, 
+    0x78, 0x0a, 0x63, 0x61, 0x6e, 0x20, 0x74, 0x61, 0x6b, 0x65, 
+    0x20, 0x6d, 0x75, 0x63, 0x68, 0x20, 0x6d, 0x6f, 0x72, 0x65, 
+    0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x61, 0x73, 0x20, 0x69, 
+    0x74, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x73, 0x20, 0x74, 0x6f, 
+    0x20, 0x77, 0x61, 0x6c, 0x6b, 0x20, 0x6f, 0x76, 0x65, 0x72, 
+    0x20, 0x61, 0x6c, 0x6c, 0x20, 0x73, 0x65, 0x67, 0x6d, 0x65, 
+    0x6e, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x72, 
+    0x63, 0x73, 0x0a, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x0a, 0x0a, 
+    0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x3a, 0x20, 0x69, 
+    0x6e, 0x74, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+    0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 
+    0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x77, 0x68, 0x69, 0x63, 
+    0x68, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 
+    0x73, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x74, 0x6f, 0x20, 0x69, 
+    0x6e, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 
+    0x64, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x78, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x73, 0x2e, 0x20, 0x20, 0x46, 0x6f, 
+    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69, 
+    0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x70, 0x74, 0x69, 
+    0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x65, 0x20, 0x60, 
+    0x47, 0x4c, 0x59, 0x50, 0x48, 0x5f, 0x42, 0x42, 0x4f, 0x58, 
+    0x60, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+    0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 
+    0x62, 0x62, 0x6f, 0x78, 0x20, 0x3a, 0x20, 0x42, 0x42, 0x6f, 
+    0x78, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x63, 0x6f, 0x6f, 0x72, 
+    0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x20, 0x62, 0x6f, 0x75, 
+    0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6f, 0x78, 0x2e, 
+    0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x0a, 0x43, 0x6f, 0x6f, 0x72, 0x64, 0x69, 
+    0x6e, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 
+    0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x74, 
+    0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x2c, 0x20, 
+    0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x2a, 0x79, 0x2a, 0x20, 0x75, 0x70, 0x77, 0x61, 0x72, 0x64, 
+    0x73, 0x0a, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x6e, 0x74, 0x69, 
+    0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x49, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x68, 0x61, 
+    0x73, 0x20, 0x62, 0x65, 0x65, 0x6e, 0x20, 0x6c, 0x6f, 0x61, 
+    0x64, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x60, 
+    0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x4e, 0x4f, 0x5f, 0x53, 0x43, 
+    0x41, 0x4c, 0x45, 0x60, 0x2c, 0x20, 0x60, 0x6d, 0x6f, 0x64, 
+    0x65, 0x60, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 
+    0x20, 0x73, 0x65, 0x74, 0x0a, 0x74, 0x6f, 0x20, 0x60, 0x47, 
+    0x4c, 0x59, 0x50, 0x48, 0x5f, 0x42, 0x42, 0x4f, 0x58, 0x2e, 
+    0x55, 0x4e, 0x53, 0x43, 0x41, 0x4c, 0x45, 0x44, 0x60, 0x20, 
+    0x74, 0x6f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x75, 0x6e, 0x73, 
+    0x63, 0x61, 0x6c, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 
+    0x32, 0x36, 0x2e, 0x36, 0x0a, 0x66, 0x69, 0x78, 0x65, 0x64, 
+    0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x69, 0x78, 
+    0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2e, 
+    0x0a, 0x0a, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x69, 
+    0x63, 0x6b, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x68, 0x61, 
+    0x73, 0x20, 0x62, 0x65, 0x65, 0x6e, 0x20, 0x6c, 0x6f, 0x61, 
+    0x64, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x0a, 0x60, 
+    0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x4e, 0x4f, 0x5f, 0x53, 0x43, 
+    0x41, 0x4c, 0x45, 0x60, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x69, 0x6e, 0x67, 0x20, 
+    0x60, 0x42, 0x42, 0x6f, 0x78, 0x60, 0x20, 0x69, 0x73, 0x20, 
+    0x6d, 0x65, 0x61, 0x6e, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x73, 
+    0x73, 0x2e, 0x20, 0x54, 0x6f, 0x20, 0x67, 0x65, 0x74, 0x0a, 
+    0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x61, 0x62, 0x6c, 0x65, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x42, 0x42, 0x6f, 
+    0x78, 0x60, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6e, 
+    0x65, 0x63, 0x65, 0x73, 0x73, 0x61, 0x72, 0x79, 0x20, 0x74, 
+    0x6f, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x61, 0x74, 0x0a, 
+    0x61, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x20, 0x70, 0x70, 
+    0x65, 0x6d, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x28, 
+    0x73, 0x6f, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 
+    0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x70, 0x72, 0x6f, 
+    0x70, 0x65, 0x72, 0x6c, 0x79, 0x0a, 0x73, 0x68, 0x69, 0x66, 
+    0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x63, 0x61, 0x6c, 
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x73, 0x29, 0x2c, 0x20, 0x74, 0x68, 
+    0x65, 0x6e, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 
+    0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x42, 
+    0x42, 0x6f, 0x78, 0x60, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 
+    0x20, 0x63, 0x61, 0x6e, 0x0a, 0x62, 0x65, 0x20, 0x65, 0x76, 
+    0x65, 0x6e, 0x74, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x63, 
+    0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x62, 
+    0x61, 0x63, 0x6b, 0x20, 0x74, 0x6f, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x2e, 0x0a, 0x0a, 
+    0x4e, 0x6f, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 
+    0x6d, 0x20, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 
+    0x74, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x65, 0x78, 
+    0x63, 0x6c, 0x75, 0x73, 0x69, 0x76, 0x65, 0x2c, 0x20, 0x77, 
+    0x68, 0x69, 0x63, 0x68, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6f, 0x6e, 0x65, 0x0a, 
+    0x63, 0x61, 0x6e, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 
+    0x68, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 
+    0x68, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6d, 0x61, 0x67, 
+    0x65, 0x20, 0x61, 0x73, 0x3a, 0x3a, 0x0a, 0x0a, 0x20, 0x20, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x20, 0x3d, 0x20, 0x62, 
+    0x62, 0x6f, 0x78, 0x2e, 0x78, 0x4d, 0x61, 0x78, 0x20, 0x2d, 
+    0x20, 0x62, 0x62, 0x6f, 0x78, 0x2e, 0x78, 0x4d, 0x69, 0x6e, 
+    0x0a, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 
+    0x3d, 0x20, 0x62, 0x62, 0x6f, 0x78, 0x2e, 0x79, 0x4d, 0x61, 
+    0x78, 0x20, 0x2d, 0x20, 0x62, 0x62, 0x6f, 0x78, 0x2e, 0x79, 
+    0x4d, 0x69, 0x6e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x20, 
+    0x61, 0x6c, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x32, 0x36, 0x2e, 0x36, 0x20, 0x63, 
+    0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x73, 
+    0x2c, 0x20, 0x69, 0x66, 0x20, 0x60, 0x6d, 0x6f, 0x64, 0x65, 
+    0x60, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 
+    0x6f, 0x0a, 0x60, 0x47, 0x4c, 0x59, 0x50, 0x48, 0x5f, 0x42, 
+    0x42, 0x4f, 0x58, 0x2e, 0x47, 0x52, 0x49, 0x44, 0x46, 0x49, 
+    0x54, 0x60, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 
+    0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x73, 0x20, 
+    0x77, 0x69, 0x6c, 0x6c, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 
+    0x62, 0x65, 0x20, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x66, 0x69, 
+    0x74, 0x74, 0x65, 0x64, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 
+    0x68, 0x0a, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 
+    0x6e, 0x64, 0x73, 0x20, 0x74, 0x6f, 0x3a, 0x3a, 0x0a, 0x0a, 
+    0x20, 0x20, 0x62, 0x62, 0x6f, 0x78, 0x2e, 0x78, 0x4d, 0x69, 
+    0x6e, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 
+    0x62, 0x62, 0x6f, 0x78, 0x2e, 0x78, 0x4d, 0x69, 0x6e, 0x29, 
+    0x0a, 0x20, 0x20, 0x62, 0x62, 0x6f, 0x78, 0x2e, 0x79, 0x4d, 
+    0x69, 0x6e, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 
+    0x28, 0x62, 0x62, 0x6f, 0x78, 0x2e, 0x79, 0x4d, 0x69, 0x6e, 
+    0x29, 0x0a, 0x20, 0x20, 0x62, 0x62, 0x6f, 0x78, 0x2e, 0x78, 
+    0x4d, 0x61, 0x78, 0x20, 0x3d, 0x20, 0x63, 0x65, 0x69, 0x6c, 
+    0x28, 0x62, 0x62, 0x6f, 0x78, 0x2e, 0x78, 0x4d, 0x61, 0x78, 
+    0x29, 0x0a, 0x20, 0x20, 0x62, 0x62, 0x6f, 0x78, 0x2e, 0x79, 
+    0x4d, 0x61, 0x78, 0x20, 0x3d, 0x20, 0x63, 0x65, 0x69, 0x6c, 
+    0x28, 0x62, 0x62, 0x6f, 0x78, 0x2e, 0x79, 0x4d, 0x61, 0x78, 
+    0x29, 0x0a, 0x0a, 0x54, 0x6f, 0x20, 0x67, 0x65, 0x74, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x62, 0x62, 0x6f, 0x78, 0x20, 0x69, 
+    0x6e, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x20, 0x63, 0x6f, 
+    0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x73, 0x2c, 
+    0x20, 0x73, 0x65, 0x74, 0x20, 0x60, 0x6d, 0x6f, 0x64, 0x65, 
+    0x60, 0x20, 0x74, 0x6f, 0x0a, 0x60, 0x47, 0x4c, 0x59, 0x50, 
+    0x48, 0x5f, 0x42, 0x42, 0x4f, 0x58, 0x2e, 0x54, 0x52, 0x55, 
+    0x4e, 0x43, 0x41, 0x54, 0x45, 0x60, 0x2e, 0x0a, 0x0a, 0x54, 
+    0x6f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x62, 0x62, 0x6f, 0x78, 0x20, 0x69, 0x6e, 0x20, 0x67, 0x72, 
+    0x69, 0x64, 0x2d, 0x66, 0x69, 0x74, 0x74, 0x65, 0x64, 0x20, 
+    0x70, 0x69, 0x78, 0x65, 0x6c, 0x20, 0x63, 0x6f, 0x6f, 0x72, 
+    0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x73, 0x2c, 0x20, 0x73, 
+    0x65, 0x74, 0x20, 0x60, 0x6d, 0x6f, 0x64, 0x65, 0x60, 0x20, 
+    0x74, 0x6f, 0x0a, 0x60, 0x47, 0x4c, 0x59, 0x50, 0x48, 0x5f, 
+    0x42, 0x42, 0x4f, 0x58, 0x2e, 0x50, 0x49, 0x58, 0x45, 0x4c, 
+    0x53, 0x60, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_linear_hori_advance[243] = {
+    0x54, 0x68, 0x65, 0x20, 0x61, 0x64, 0x76, 0x61, 0x6e, 0x63, 
+    0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x6f, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x6e, 0x68, 0x69, 0x6e, 
+    0x74, 0x65, 0x64, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x2e, 
+    0x20, 0x49, 0x74, 0x73, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+    0x20, 0x69, 0x73, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 
+    0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x0a, 0x66, 0x72, 0x61, 
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 0x69, 
+    0x78, 0x65, 0x6c, 0x73, 0x2c, 0x20, 0x75, 0x6e, 0x6c, 0x65, 
+    0x73, 0x73, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x4c, 
+    0x49, 0x4e, 0x45, 0x41, 0x52, 0x5f, 0x44, 0x45, 0x53, 0x49, 
+    0x47, 0x4e, 0x60, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 
+    0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x6c, 0x6f, 0x61, 0x64, 
+    0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 
+    0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x63, 0x61, 0x6e, 0x20, 
+    0x62, 0x65, 0x20, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x61, 
+    0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x65, 0x72, 0x66, 
+    0x6f, 0x72, 0x6d, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x63, 
+    0x74, 0x20, 0x57, 0x59, 0x53, 0x49, 0x57, 0x59, 0x47, 0x0a, 
+    0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x20, 0x4f, 0x6e, 
+    0x6c, 0x79, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x76, 0x61, 0x6e, 
+    0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6f, 0x75, 0x74, 0x6c, 
+    0x69, 0x6e, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_linear_vert_advance[244] = {
+    0x54, 0x68, 0x65, 0x20, 0x61, 0x64, 0x76, 0x61, 0x6e, 0x63, 
+    0x65, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x6e, 0x68, 0x69, 
+    0x6e, 0x74, 0x65, 0x64, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x2e, 0x20, 0x49, 0x74, 0x73, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+    0x65, 0x20, 0x69, 0x73, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 
+    0x73, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x0a, 0x66, 0x72, 
+    0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 
+    0x69, 0x78, 0x65, 0x6c, 0x73, 0x2c, 0x20, 0x75, 0x6e, 0x6c, 
+    0x65, 0x73, 0x73, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 
+    0x4c, 0x49, 0x4e, 0x45, 0x41, 0x52, 0x5f, 0x44, 0x45, 0x53, 
+    0x49, 0x47, 0x4e, 0x60, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 
+    0x74, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x6c, 0x6f, 0x61, 
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 
+    0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x63, 0x61, 0x6e, 
+    0x20, 0x62, 0x65, 0x20, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 
+    0x61, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x65, 0x72, 
+    0x66, 0x6f, 0x72, 0x6d, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 
+    0x63, 0x74, 0x20, 0x57, 0x59, 0x53, 0x49, 0x57, 0x59, 0x47, 
+    0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x20, 0x4f, 
+    0x6e, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x76, 0x61, 
+    0x6e, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6f, 0x75, 0x74, 
+    0x6c, 0x69, 0x6e, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_lsb_delta[114] = {
+    0x54, 0x68, 0x65, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 
+    0x65, 0x6e, 0x63, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 
+    0x65, 0x6e, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x65, 0x64, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x75, 0x6e, 0x68, 0x69, 0x6e, 0x74, 
+    0x65, 0x64, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x73, 0x69, 
+    0x64, 0x65, 0x20, 0x62, 0x65, 0x61, 0x72, 0x69, 0x6e, 0x67, 
+    0x2e, 0x0a, 0x0a, 0x56, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x77, 
+    0x68, 0x65, 0x6e, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x68, 0x69, 
+    0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x61, 
+    0x63, 0x74, 0x69, 0x76, 0x65, 0x2e, 0x20, 0x5a, 0x65, 0x72, 
+    0x6f, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 
+    0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_metrics[263] = {
+    0x54, 0x68, 0x65, 0x20, 0x60, 0x47, 0x6c, 0x79, 0x70, 0x68, 
+    0x5f, 0x4d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x60, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x76, 0x61, 0x6c, 
+    0x75, 0x65, 0x73, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 
+    0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x6c, 0x61, 
+    0x73, 0x74, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x66, 0x6c, 
+    0x61, 0x67, 0x73, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x2e, 0x6c, 
+    0x6f, 0x61, 0x64, 0x5f, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x60, 
+    0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x29, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x0a, 
+    0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 
+    0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 
+    0x32, 0x36, 0x2e, 0x36, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 0x69, 0x78, 0x65, 
+    0x6c, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x2e, 0x0a, 0x0a, 0x4e, 
+    0x6f, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 
+    0x76, 0x65, 0x6e, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 
+    0x6d, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 
+    0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 0x2c, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 
+    0x63, 0x73, 0x20, 0x61, 0x72, 0x65, 0x0a, 0x6e, 0x6f, 0x74, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_outline[173] = {
+    0x54, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 
+    0x6f, 0x72, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 
+    0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 0x73, 0x20, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x74, 0x20, 0x69, 0x73, 0x0a, 0x60, 0x47, 
+    0x4c, 0x59, 0x50, 0x48, 0x5f, 0x46, 0x4f, 0x52, 0x4d, 0x41, 
+    0x54, 0x2e, 0x4f, 0x55, 0x54, 0x4c, 0x49, 0x4e, 0x45, 0x60, 
+    0x2e, 0x20, 0x4f, 0x6e, 0x63, 0x65, 0x20, 0x61, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x73, 0x20, 0x6c, 0x6f, 
+    0x61, 0x64, 0x65, 0x64, 0x2c, 0x20, 0x60, 0x6f, 0x75, 0x74, 
+    0x6c, 0x69, 0x6e, 0x65, 0x60, 0x20, 0x63, 0x61, 0x6e, 0x20, 
+    0x62, 0x65, 0x0a, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 
+    0x72, 0x6d, 0x65, 0x64, 0x2c, 0x20, 0x64, 0x69, 0x73, 0x74, 
+    0x6f, 0x72, 0x74, 0x65, 0x64, 0x2c, 0x20, 0x65, 0x6d, 0x62, 
+    0x6f, 0x6c, 0x64, 0x65, 0x64, 0x2c, 0x20, 0x65, 0x74, 0x63, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_render[697] = {
+    0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x61, 0x20, 
+    0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x74, 0x6f, 
+    0x20, 0x61, 0x20, 0x60, 0x42, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x60, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 
+    0x20, 0x73, 0x6f, 0x20, 0x62, 0x79, 0x20, 0x69, 0x6e, 0x73, 
+    0x70, 0x65, 0x63, 0x74, 0x69, 0x6e, 0x67, 0x0a, 0x74, 0x68, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6d, 
+    0x61, 0x67, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x2c, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x76, 0x61, 
+    0x6e, 0x74, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x65, 
+    0x72, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x76, 
+    0x6f, 0x6b, 0x69, 0x6e, 0x67, 0x0a, 0x69, 0x74, 0x2e, 0x0a, 
+    0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 
+    0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x0a, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x5f, 
+    0x6d, 0x6f, 0x64, 0x65, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 
+    0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 
+    0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6e, 
+    0x64, 0x65, 0x72, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x75, 
+    0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x6e, 
+    0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x20, 
+    0x69, 0x6e, 0x74, 0x6f, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x2e, 0x0a, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x65, 0x20, 0x60, 0x52, 
+    0x45, 0x4e, 0x44, 0x45, 0x52, 0x5f, 0x4d, 0x4f, 0x44, 0x45, 
+    0x60, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 
+    0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x0a, 0x0a, 
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x20, 0x3a, 0x20, 0x32, 
+    0x2d, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x20, 
+    0x6f, 0x66, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x73, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x28, 0x78, 
+    0x2c, 0x20, 0x79, 0x29, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 
+    0x6e, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 
+    0x6c, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 
+    0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x72, 0x65, 
+    0x6e, 0x64, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x0a, 0x0a, 
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x62, 0x69, 0x74, 0x6d, 
+    0x61, 0x70, 0x20, 0x3a, 0x20, 0x42, 0x69, 0x74, 0x6d, 0x61, 
+    0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 
+    0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 
+    0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x2e, 0x0a, 0x0a, 0x4e, 
+    0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x0a, 0x54, 0x68, 0x65, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 
+    0x74, 0x65, 0x64, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 
+    0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 
+    0x20, 0x61, 0x66, 0x66, 0x65, 0x63, 0x74, 0x73, 0x20, 0x76, 
+    0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x0a, 0x66, 0x6f, 
+    0x6e, 0x74, 0x2e, 0x20, 0x45, 0x6d, 0x62, 0x65, 0x64, 0x64, 
+    0x65, 0x64, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x73, 
+    0x20, 0x6f, 0x66, 0x74, 0x65, 0x6e, 0x20, 0x68, 0x61, 0x76, 
+    0x65, 0x20, 0x61, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 
+    0x65, 0x6e, 0x74, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x20, 
+    0x6d, 0x6f, 0x64, 0x65, 0x20, 0x6c, 0x69, 0x6b, 0x65, 0x0a, 
+    0x60, 0x50, 0x49, 0x58, 0x45, 0x4c, 0x5f, 0x4d, 0x4f, 0x44, 
+    0x45, 0x2e, 0x4d, 0x4f, 0x4e, 0x4f, 0x60, 0x2e, 0x20, 0x59, 
+    0x6f, 0x75, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x75, 0x73, 0x65, 
+    0x20, 0x60, 0x42, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x2e, 0x63, 
+    0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x60, 0x20, 0x74, 0x6f, 
+    0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 
+    0x20, 0x74, 0x68, 0x65, 0x6d, 0x0a, 0x69, 0x6e, 0x74, 0x6f, 
+    0x20, 0x38, 0x2d, 0x62, 0x69, 0x74, 0x20, 0x70, 0x69, 0x78, 
+    0x6d, 0x61, 0x70, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_rsb_delta[114] = {
+    0x54, 0x68, 0x65, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 
+    0x65, 0x6e, 0x63, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 
+    0x65, 0x6e, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x65, 0x64, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x75, 0x6e, 0x68, 0x69, 0x6e, 0x74, 
+    0x65, 0x64, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x73, 
+    0x69, 0x64, 0x65, 0x20, 0x62, 0x65, 0x61, 0x72, 0x69, 0x6e, 
+    0x67, 0x0a, 0x0a, 0x56, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x77, 
+    0x68, 0x65, 0x6e, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x68, 0x69, 
+    0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x61, 
+    0x63, 0x74, 0x69, 0x76, 0x65, 0x2e, 0x20, 0x5a, 0x65, 0x72, 
+    0x6f, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 
+    0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_subglyphs[112] = {
+    0x41, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 
+    0x20, 0x6f, 0x66, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 
+    0x6d, 0x61, 0x6b, 0x65, 0x20, 0x75, 0x70, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x2e, 0x0a, 0x0a, 
+    0x45, 0x6d, 0x70, 0x74, 0x79, 0x20, 0x75, 0x6e, 0x6c, 0x65, 
+    0x73, 0x73, 0x20, 0x60, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x60, 0x20, 0x69, 0x73, 0x20, 0x60, 0x47, 0x4c, 0x59, 0x50, 
+    0x48, 0x5f, 0x46, 0x4f, 0x52, 0x4d, 0x41, 0x54, 0x2e, 0x43, 
+    0x4f, 0x4d, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x45, 0x60, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_RENDER_MODE[1218] = {
+    0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x73, 0x20, 0x61, 0x20, 
+    0x60, 0x42, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x60, 0x20, 0x72, 
+    0x65, 0x6e, 0x64, 0x65, 0x72, 0x65, 0x72, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x60, 
+    0x3a, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 
+    0x74, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x6d, 
+    0x6f, 0x64, 0x65, 0x3b, 0x20, 0x69, 0x74, 0x20, 0x63, 0x6f, 
+    0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 0x73, 0x20, 
+    0x74, 0x6f, 0x20, 0x38, 0x2d, 0x62, 0x69, 0x74, 0x0a, 0x20, 
+    0x20, 0x61, 0x6e, 0x74, 0x69, 0x2d, 0x61, 0x6c, 0x69, 0x61, 
+    0x73, 0x65, 0x64, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4c, 0x49, 0x47, 
+    0x48, 0x54, 0x60, 0x3a, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 
+    0x69, 0x73, 0x20, 0x65, 0x71, 0x75, 0x69, 0x76, 0x61, 0x6c, 
+    0x65, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x60, 0x52, 0x45, 
+    0x4e, 0x44, 0x45, 0x52, 0x5f, 0x4d, 0x4f, 0x44, 0x45, 0x2e, 
+    0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x60, 0x2e, 0x20, 0x49, 
+    0x74, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x0a, 
+    0x20, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 
+    0x61, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 
+    0x61, 0x74, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 
+    0x62, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x20, 0x72, 0x65, 
+    0x6e, 0x64, 0x65, 0x72, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x73, 
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 
+    0x75, 0x73, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x64, 
+    0x69, 0x72, 0x65, 0x63, 0x74, 0x6c, 0x79, 0x20, 0x74, 0x6f, 
+    0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x68, 0x69, 
+    0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6c, 0x67, 0x6f, 
+    0x72, 0x69, 0x74, 0x68, 0x6d, 0x20, 0x73, 0x65, 0x6c, 0x65, 
+    0x63, 0x74, 0x6f, 0x72, 0x73, 0x2e, 0x20, 0x53, 0x65, 0x65, 
+    0x0a, 0x20, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 0x54, 
+    0x41, 0x52, 0x47, 0x45, 0x54, 0x5f, 0x58, 0x58, 0x58, 0x60, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x65, 0x74, 0x61, 0x69, 
+    0x6c, 0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4d, 0x4f, 
+    0x4e, 0x4f, 0x60, 0x3a, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 
+    0x6d, 0x6f, 0x64, 0x65, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 
+    0x73, 0x70, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x74, 0x6f, 0x20, 
+    0x31, 0x2d, 0x62, 0x69, 0x74, 0x20, 0x62, 0x69, 0x74, 0x6d, 
+    0x61, 0x70, 0x73, 0x20, 0x28, 0x77, 0x69, 0x74, 0x68, 0x20, 
+    0x32, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x73, 0x20, 0x6f, 
+    0x66, 0x0a, 0x20, 0x20, 0x6f, 0x70, 0x61, 0x63, 0x69, 0x74, 
+    0x79, 0x29, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4c, 0x43, 
+    0x44, 0x60, 0x3a, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6d, 
+    0x6f, 0x64, 0x65, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x73, 
+    0x70, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x68, 
+    0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 
+    0x52, 0x47, 0x42, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x42, 0x47, 
+    0x52, 0x20, 0x73, 0x75, 0x62, 0x2d, 0x70, 0x69, 0x78, 0x65, 
+    0x6c, 0x0a, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 
+    0x79, 0x73, 0x20, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x4c, 0x43, 
+    0x44, 0x20, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x73, 0x2e, 
+    0x20, 0x49, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 
+    0x65, 0x73, 0x20, 0x38, 0x2d, 0x62, 0x69, 0x74, 0x20, 0x62, 
+    0x69, 0x74, 0x6d, 0x61, 0x70, 0x73, 0x20, 0x74, 0x68, 0x61, 
+    0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x33, 0x0a, 0x20, 0x20, 
+    0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 
+    0x6c, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x6f, 0x75, 
+    0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x70, 
+    0x69, 0x78, 0x65, 0x6c, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 
+    0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x75, 
+    0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x50, 0x49, 
+    0x58, 0x45, 0x4c, 0x5f, 0x4d, 0x4f, 0x44, 0x45, 0x2e, 0x4c, 
+    0x43, 0x44, 0x60, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x2e, 0x20, 
+    0x20, 0x4f, 0x6e, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x66, 
+    0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x65, 0x20, 0x62, 0x75, 
+    0x69, 0x6c, 0x64, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x61, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x77, 0x69, 0x6c, 
+    0x6c, 0x20, 0x62, 0x65, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 
+    0x6c, 0x65, 0x64, 0x20, 0x64, 0x75, 0x65, 0x20, 0x74, 0x6f, 
+    0x20, 0x70, 0x61, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x72, 0x65, 
+    0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+    0x2c, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 
+    0x0a, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x69, 0x6e, 
+    0x67, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x77, 
+    0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x67, 0x72, 0x61, 
+    0x79, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x2e, 0x0a, 0x0a, 0x2d, 
+    0x20, 0x60, 0x4c, 0x43, 0x44, 0x5f, 0x56, 0x60, 0x3a, 0x20, 
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 
+    0x63, 0x6f, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x64, 
+    0x73, 0x20, 0x74, 0x6f, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 
+    0x63, 0x61, 0x6c, 0x20, 0x52, 0x47, 0x42, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x42, 0x47, 0x52, 0x20, 0x73, 0x75, 0x62, 0x2d, 
+    0x70, 0x69, 0x78, 0x65, 0x6c, 0x0a, 0x20, 0x20, 0x64, 0x69, 
+    0x73, 0x70, 0x6c, 0x61, 0x79, 0x73, 0x20, 0x28, 0x6c, 0x69, 
+    0x6b, 0x65, 0x20, 0x50, 0x44, 0x41, 0x20, 0x73, 0x63, 0x72, 
+    0x65, 0x65, 0x6e, 0x73, 0x2c, 0x20, 0x72, 0x6f, 0x74, 0x61, 
+    0x74, 0x65, 0x64, 0x20, 0x4c, 0x43, 0x44, 0x20, 0x64, 0x69, 
+    0x73, 0x70, 0x6c, 0x61, 0x79, 0x73, 0x2c, 0x20, 0x65, 0x74, 
+    0x63, 0x2e, 0x29, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x70, 0x72, 
+    0x6f, 0x64, 0x75, 0x63, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x38, 
+    0x2d, 0x62, 0x69, 0x74, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 
+    0x70, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 
+    0x65, 0x20, 0x33, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x72, 
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x0a, 0x20, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 
+    0x6e, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x69, 0x78, 0x65, 
+    0x6c, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x75, 0x73, 0x65, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x50, 0x49, 0x58, 0x45, 
+    0x4c, 0x5f, 0x4d, 0x4f, 0x44, 0x45, 0x2e, 0x4c, 0x43, 0x44, 
+    0x5f, 0x56, 0x60, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x2e, 0x20, 
+    0x4f, 0x6e, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x0a, 0x20, 0x20, 
+    0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x65, 0x20, 0x62, 
+    0x75, 0x69, 0x6c, 0x64, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x69, 
+    0x73, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x61, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x77, 0x69, 0x6c, 0x6c, 
+    0x20, 0x62, 0x65, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
+    0x65, 0x64, 0x20, 0x64, 0x75, 0x65, 0x20, 0x74, 0x6f, 0x20, 
+    0x70, 0x61, 0x74, 0x65, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x72, 
+    0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x73, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x69, 0x63, 
+    0x68, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x69, 0x6e, 0x67, 
+    0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x77, 0x69, 
+    0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x67, 0x72, 0x61, 0x79, 
+    0x73, 0x63, 0x61, 0x6c, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
@@ -0,0 +1,31 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/glyph.py.
+*/
+
+#ifndef __DOC_GLYPH_H__
+#define __DOC_GLYPH_H__
+extern char doc_GLYPH_BBOX[319];
+extern char doc_GLYPH_FORMAT[909];
+extern char doc_Glyph__init__[326];
+extern char doc_Glyph_advance[266];
+extern char doc_Glyph_bitmap[61];
+extern char doc_Glyph_bitmap_left[126];
+extern char doc_Glyph_bitmap_top[250];
+extern char doc_Glyph_face[25];
+extern char doc_Glyph_format[209];
+extern char doc_Glyph_get_cbox[1945];
+extern char doc_Glyph_linear_hori_advance[243];
+extern char doc_Glyph_linear_vert_advance[244];
+extern char doc_Glyph_lsb_delta[114];
+extern char doc_Glyph_metrics[263];
+extern char doc_Glyph_outline[173];
+extern char doc_Glyph_render[697];
+extern char doc_Glyph_rsb_delta[114];
+extern char doc_Glyph_subglyphs[112];
+extern char doc_RENDER_MODE[1218];
+
+#endif
+
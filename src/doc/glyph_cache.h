@@ -0,0 +1,20 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/glyph_cache.py.
+*/
+
+#ifndef __DOC_GLYPH_CACHE_H__
+#define __DOC_GLYPH_CACHE_H__
+extern char doc_GlyphCache__init__[810];
+extern char doc_GlyphCache_clear[84];
+extern char doc_GlyphCache_count[36];
+extern char doc_GlyphCache_hits[53];
+extern char doc_GlyphCache_load_glyph[487];
+extern char doc_GlyphCache_max_bytes[135];
+extern char doc_GlyphCache_misses[61];
+extern char doc_GlyphCache_nbytes[73];
+
+#endif
+
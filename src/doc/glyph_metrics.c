@@ -0,0 +1,121 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/glyph_metrics.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "glyph_metrics.h"
+
+char doc_Glyph_Metrics__init__[354] = {
+    0x4d, 0x6f, 0x64, 0x65, 0x6c, 0x73, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x20, 0x6f, 
+    0x66, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 
+    0x20, 0x60, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x60, 0x2e, 0x0a, 
+    0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x0a, 0x49, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x20, 
+    0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x77, 
+    0x69, 0x74, 0x68, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 
+    0x4e, 0x4f, 0x5f, 0x48, 0x49, 0x4e, 0x54, 0x49, 0x4e, 0x47, 
+    0x60, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 
+    0x75, 0x65, 0x73, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 
+    0x65, 0x6e, 0x74, 0x0a, 0x64, 0x69, 0x6d, 0x65, 0x6e, 0x73, 
+    0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x28, 0x69, 0x6e, 0x20, 0x63, 
+    0x61, 0x73, 0x65, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x69, 0x6e, 
+    0x67, 0x20, 0x69, 0x73, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 
+    0x63, 0x61, 0x62, 0x6c, 0x65, 0x29, 0x2e, 0x0a, 0x0a, 0x53, 
+    0x74, 0x72, 0x6f, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x77, 0x69, 0x74, 0x68, 
+    0x20, 0x61, 0x6e, 0x20, 0x6f, 0x75, 0x74, 0x73, 0x69, 0x64, 
+    0x65, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20, 0x64, 
+    0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x69, 0x6e, 
+    0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x0a, 0x60, 0x68, 0x6f, 
+    0x72, 0x69, 0x41, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x60, 
+    0x20, 0x6f, 0x72, 0x20, 0x60, 0x76, 0x65, 0x72, 0x74, 0x41, 
+    0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x60, 0x3b, 0x20, 0x79, 
+    0x6f, 0x75, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x74, 0x6f, 
+    0x20, 0x6d, 0x61, 0x6e, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 
+    0x61, 0x64, 0x6a, 0x75, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 
+    0x73, 0x65, 0x0a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 
+    0x74, 0x6f, 0x20, 0x61, 0x63, 0x63, 0x6f, 0x75, 0x6e, 0x74, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 
+    0x64, 0x64, 0x65, 0x64, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
+    0x20, 0x61, 0x6e, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
+    0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_Metrics_height[21] = {
+    0x54, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x27, 
+    0x73, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Glyph_Metrics_hori_advance[38] = {
+    0x41, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x68, 0x6f, 
+    0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x6c, 
+    0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_Metrics_hori_bearing_x[42] = {
+    0x4c, 0x65, 0x66, 0x74, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20, 
+    0x62, 0x65, 0x61, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 
+    0x61, 0x6c, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_Glyph_Metrics_hori_bearing_y[41] = {
+    0x54, 0x6f, 0x70, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20, 0x62, 
+    0x65, 0x61, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 
+    0x6c, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Glyph_Metrics_vert_advance[101] = {
+    0x41, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x68, 0x65, 
+    0x69, 0x67, 0x68, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x76, 
+    0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x6c, 0x61, 
+    0x79, 0x6f, 0x75, 0x74, 0x2e, 0x20, 0x50, 0x6f, 0x73, 0x69, 
+    0x74, 0x69, 0x76, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+    0x73, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x68, 0x61, 0x73, 
+    0x0a, 0x61, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x76, 
+    0x65, 0x20, 0x61, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x20, 
+    0x64, 0x6f, 0x77, 0x6e, 0x77, 0x61, 0x72, 0x64, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Glyph_Metrics_vert_bearing_x[40] = {
+    0x4c, 0x65, 0x66, 0x74, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20, 
+    0x62, 0x65, 0x61, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 
+    0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_Metrics_vert_bearing_y[108] = {
+    0x54, 0x6f, 0x70, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20, 0x62, 
+    0x65, 0x61, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 
+    0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x20, 0x4c, 0x61, 
+    0x72, 0x67, 0x65, 0x72, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 
+    0x69, 0x76, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 
+    0x20, 0x6d, 0x65, 0x61, 0x6e, 0x0a, 0x66, 0x75, 0x72, 0x74, 
+    0x68, 0x65, 0x72, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 
+    0x61, 0x6c, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x6f, 
+    0x72, 0x69, 0x67, 0x69, 0x6e, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Glyph_Metrics_width[20] = {
+    0x54, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x27, 
+    0x73, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2e, 0x0a, 0x00, 
+};
+
@@ -0,0 +1,21 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/glyph_metrics.py.
+*/
+
+#ifndef __DOC_GLYPH_METRICS_H__
+#define __DOC_GLYPH_METRICS_H__
+extern char doc_Glyph_Metrics__init__[354];
+extern char doc_Glyph_Metrics_height[21];
+extern char doc_Glyph_Metrics_hori_advance[38];
+extern char doc_Glyph_Metrics_hori_bearing_x[42];
+extern char doc_Glyph_Metrics_hori_bearing_y[41];
+extern char doc_Glyph_Metrics_vert_advance[101];
+extern char doc_Glyph_Metrics_vert_bearing_x[40];
+extern char doc_Glyph_Metrics_vert_bearing_y[108];
+extern char doc_Glyph_Metrics_width[20];
+
+#endif
+
@@ -0,0 +1,520 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/layout.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "layout.h"
+
+char doc_Layout__init__[570] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x4d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x73, 0x20, 0x76, 
+    0x65, 0x72, 0x79, 0x20, 0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65, 
+    0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 
+    0x20, 0x6c, 0x65, 0x66, 0x74, 0x2d, 0x74, 0x6f, 0x2d, 0x72, 
+    0x69, 0x67, 0x68, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2e, 
+    0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 
+    0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x65, 0x64, 
+    0x69, 0x74, 0x65, 0x64, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 
+    0x77, 0x61, 0x72, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 
+    0x60, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x60, 0x2c, 0x20, 
+    0x60, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x60, 0x20, 0x61, 
+    0x6e, 0x64, 0x0a, 0x60, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 
+    0x65, 0x60, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 
+    0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x6c, 0x61, 0x79, 0x20, 0x6f, 
+    0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 
+    0x6e, 0x67, 0x65, 0x64, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x78, 
+    0x74, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x2e, 0x0a, 0x0a, 
+    0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x66, 0x61, 0x63, 0x65, 0x20, 0x3a, 0x20, 0x46, 
+    0x61, 0x63, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 
+    0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 
+    0x74, 0x2e, 0x0a, 0x0a, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3a, 
+    0x20, 0x75, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x74, 0x65, 0x78, 
+    0x74, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 
+    0x61, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x0a, 0x0a, 0x6c, 
+    0x6f, 0x61, 0x64, 0x5f, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 
+    0x3a, 0x20, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x60, 0x20, 0x66, 
+    0x6c, 0x61, 0x67, 0x73, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 
+    0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x41, 
+    0x6e, 0x79, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x6c, 
+    0x6f, 0x61, 0x64, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x2e, 
+    0x20, 0x20, 0x57, 0x69, 0x74, 0x68, 0x20, 0x60, 0x4c, 0x4f, 
+    0x41, 0x44, 0x2e, 0x56, 0x45, 0x52, 0x54, 0x49, 0x43, 0x41, 
+    0x4c, 0x5f, 0x4c, 0x41, 0x59, 0x4f, 0x55, 0x54, 0x60, 0x2c, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 
+    0x72, 0x75, 0x6e, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x72, 0x6f, 0x6d, 0x20, 0x74, 0x6f, 0x70, 0x20, 0x74, 0x6f, 
+    0x20, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x2c, 0x20, 0x75, 
+    0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x73, 0x27, 0x20, 0x76, 0x65, 0x72, 
+    0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x6d, 0x65, 0x74, 0x72, 
+    0x69, 0x63, 0x73, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 
+    0x79, 0x6f, 0x75, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 
+    0x65, 0x6e, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x74, 0x6f, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20, 0x77, 0x68, 0x69, 
+    0x63, 0x68, 0x20, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20, 0x6f, 
+    0x6e, 0x20, 0x78, 0x20, 0x3d, 0x20, 0x30, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Layout_delete[221] = {
+    0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x20, 0x70, 0x61, 0x72, 
+    0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 
+    0x65, 0x78, 0x74, 0x2e, 0x0a, 0x0a, 0x4f, 0x6e, 0x6c, 0x79, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x73, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x74, 0x6f, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 
+    0x64, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x61, 0x72, 0x65, 
+    0x20, 0x6c, 0x61, 0x69, 0x64, 0x20, 0x6f, 0x75, 0x74, 0x20, 
+    0x61, 0x67, 0x61, 0x69, 0x6e, 0x2e, 0x20, 0x20, 0x54, 0x68, 
+    0x6f, 0x73, 0x65, 0x0a, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 
+    0x69, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6d, 0x6f, 0x76, 
+    0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 
+    0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x73, 0x74, 0x61, 
+    0x72, 0x74, 0x2c, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x3a, 0x20, 
+    0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 
+    0x65, 0x20, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x6f, 0x66, 
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 
+    0x73, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x65, 0x6c, 0x65, 0x74, 
+    0x65, 0x2c, 0x20, 0x61, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x60, 
+    0x60, 0x74, 0x65, 0x78, 0x74, 0x5b, 0x73, 0x74, 0x61, 0x72, 
+    0x74, 0x3a, 0x65, 0x6e, 0x64, 0x5d, 0x60, 0x60, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Layout_draw[778] = {
+    0x52, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 
+    0x20, 0x61, 0x6e, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2e, 
+    0x0a, 0x0a, 0x45, 0x76, 0x65, 0x72, 0x79, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x69, 0x73, 0x20, 0x6c, 0x6f, 0x61, 
+    0x64, 0x65, 0x64, 0x2c, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 
+    0x72, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 
+    0x6d, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x65, 0x64, 0x20, 0x69, 
+    0x6e, 0x20, 0x43, 0x2e, 0x20, 0x20, 0x57, 0x68, 0x65, 0x72, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x0a, 0x6f, 
+    0x76, 0x65, 0x72, 0x6c, 0x61, 0x70, 0x20, 0x65, 0x61, 0x63, 
+    0x68, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6f, 0x72, 
+    0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 
+    0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2c, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 
+    0x6b, 0x65, 0x70, 0x74, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 
+    0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x62, 
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x3a, 0x20, 0x77, 0x72, 
+    0x69, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x62, 0x75, 0x66, 
+    0x66, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x41, 0x20, 
+    0x32, 0x2d, 0x64, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f, 
+    0x6e, 0x61, 0x6c, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 
+    0x6f, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x2c, 0x20, 
+    0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 
+    0x4e, 0x75, 0x6d, 0x70, 0x79, 0x20, 0x61, 0x72, 0x72, 0x61, 
+    0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x60, 0x60, 0x75, 0x69, 0x6e, 0x74, 
+    0x38, 0x60, 0x60, 0x2c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 
+    0x72, 0x6f, 0x77, 0x73, 0x20, 0x72, 0x75, 0x6e, 0x6e, 0x69, 
+    0x6e, 0x67, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x6f, 
+    0x70, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x6f, 0x74, 0x74, 0x6f, 
+    0x6d, 0x2e, 0x0a, 0x0a, 0x78, 0x2c, 0x20, 0x79, 0x20, 0x3a, 
+    0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x2c, 0x20, 0x6f, 0x70, 
+    0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 
+    0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x27, 0x73, 0x20, 
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x20, 0x28, 0x74, 0x68, 
+    0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x73, 0x65, 0x6c, 
+    0x69, 0x6e, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6d, 0x61, 0x67, 
+    0x65, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x69, 0x78, 0x65, 
+    0x6c, 0x73, 0x2e, 0x20, 0x20, 0x47, 0x6c, 0x79, 0x70, 0x68, 
+    0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x6e, 0x64, 
+    0x65, 0x72, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x73, 0x75, 
+    0x62, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+    0x2e, 0x20, 0x20, 0x41, 0x6e, 0x79, 0x74, 0x68, 0x69, 0x6e, 
+    0x67, 0x20, 0x6f, 0x75, 0x74, 0x73, 0x69, 0x64, 0x65, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6d, 0x61, 
+    0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6c, 0x69, 0x70, 
+    0x70, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x72, 0x65, 0x6e, 0x64, 
+    0x65, 0x72, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x3a, 0x20, 
+    0x69, 0x6e, 0x74, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+    0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 
+    0x65, 0x20, 0x60, 0x52, 0x45, 0x4e, 0x44, 0x45, 0x52, 0x5f, 
+    0x4d, 0x4f, 0x44, 0x45, 0x60, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 
+    0x62, 0x6c, 0x65, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+    0x73, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x4c, 0x43, 
+    0x44, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x61, 0x72, 
+    0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x6f, 0x74, 0x20, 
+    0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x2e, 
+    0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 
+    0x65, 0x6e, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 0x75, 0x73, 
+    0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 
+    0x63, 0x65, 0x27, 0x73, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 
+    0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x6f, 0x61, 
+    0x64, 0x0a, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x20, 0x77, 
+    0x61, 0x73, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Layout_get_transformed[823] = {
+    0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 
+    0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x6d, 0x61, 0x74, 0x72, 
+    0x69, 0x78, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 
+    0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 
+    0x67, 0x20, 0x62, 0x6f, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x69, 0x72, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 
+    0x6e, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x0a, 0x74, 0x72, 
+    0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 0x20, 
+    0x69, 0x6e, 0x20, 0x43, 0x2c, 0x20, 0x75, 0x73, 0x69, 0x6e, 
+    0x67, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x73, 
+    0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x20, 0x6f, 0x6e, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x2c, 
+    0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 
+    0x73, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x73, 0x0a, 0x65, 0x78, 
+    0x61, 0x63, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 
+    0x74, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x69, 0x6e, 
+    0x67, 0x20, 0x6f, 0x72, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x69, 
+    0x6e, 0x67, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x50, 
+    0x79, 0x74, 0x68, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 
+    0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 
+    0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x20, 0x3a, 0x20, 0x32, 
+    0x78, 0x32, 0x20, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x73, 0x20, 0x6f, 
+    0x66, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x73, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x74, 0x72, 0x61, 
+    0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x2c, 0x20, 
+    0x61, 0x73, 0x20, 0x60, 0x60, 0x28, 0x28, 0x78, 0x78, 0x2c, 
+    0x20, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x28, 0x79, 0x78, 0x2c, 
+    0x20, 0x79, 0x79, 0x29, 0x29, 0x60, 0x60, 0x2e, 0x0a, 0x0a, 
+    0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3a, 0x20, 0x32, 
+    0x2d, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 
+    0x66, 0x6c, 0x6f, 0x61, 0x74, 0x73, 0x2c, 0x20, 0x6f, 0x70, 
+    0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x41, 0x64, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 
+    0x6f, 0x6e, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 
+    0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 
+    0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 
+    0x2c, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 
+    0x73, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+    0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 
+    0x78, 0x79, 0x73, 0x20, 0x3a, 0x20, 0x60, 0x41, 0x72, 0x72, 
+    0x61, 0x79, 0x60, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x6c, 0x6f, 
+    0x61, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 
+    0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 
+    0x65, 0x64, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x2c, 0x20, 0x6f, 0x66, 0x20, 
+    0x73, 0x68, 0x61, 0x70, 0x65, 0x20, 0x28, 0x2a, 0x6e, 0x2a, 
+    0x2c, 0x20, 0x32, 0x29, 0x2e, 0x0a, 0x0a, 0x69, 0x6e, 0x6b, 
+    0x5f, 0x62, 0x62, 0x6f, 0x78, 0x20, 0x3a, 0x20, 0x60, 0x42, 
+    0x42, 0x6f, 0x78, 0x60, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x74, 0x69, 0x67, 0x68, 0x74, 0x20, 0x62, 
+    0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6f, 
+    0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 
+    0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x2c, 0x20, 0x69, 
+    0x6e, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 
+    0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x79, 
+    0x6f, 0x75, 0x74, 0x20, 0x69, 0x74, 0x73, 0x65, 0x6c, 0x66, 
+    0x20, 0x69, 0x73, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x75, 
+    0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x2c, 0x20, 
+    0x73, 0x6f, 0x20, 0x69, 0x74, 0x20, 0x6d, 0x61, 0x79, 0x20, 
+    0x62, 0x65, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 
+    0x72, 0x6d, 0x65, 0x64, 0x20, 0x73, 0x65, 0x76, 0x65, 0x72, 
+    0x61, 0x6c, 0x0a, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x2e, 0x20, 
+    0x20, 0x41, 0x6e, 0x79, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 
+    0x66, 0x6f, 0x72, 0x6d, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6f, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x60, 0x46, 0x61, 0x63, 
+    0x65, 0x2e, 0x73, 0x65, 0x74, 0x5f, 0x74, 0x72, 0x61, 0x6e, 
+    0x73, 0x66, 0x6f, 0x72, 0x6d, 0x60, 0x20, 0x69, 0x73, 0x20, 
+    0x6e, 0x6f, 0x74, 0x0a, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x65, 
+    0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x68, 0x65, 0x72, 0x65, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Layout_glyph_indices[183] = {
+    0x41, 0x20, 0x60, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x76, 
+    0x69, 0x65, 0x77, 0x60, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6e, 
+    0x64, 0x65, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 
+    0x68, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6e, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 
+    0x74, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x76, 0x69, 
+    0x65, 0x77, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x73, 0x20, 
+    0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x77, 0x69, 0x74, 
+    0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x79, 0x6f, 
+    0x75, 0x74, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x6e, 0x6f, 0x74, 
+    0x68, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6f, 
+    0x70, 0x69, 0x65, 0x64, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 
+    0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x20, 0x63, 0x61, 
+    0x6e, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x65, 
+    0x64, 0x69, 0x74, 0x65, 0x64, 0x20, 0x77, 0x68, 0x69, 0x6c, 
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x69, 0x65, 0x77, 
+    0x20, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x75, 0x73, 0x65, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Layout_ink_bbox[127] = {
+    0x54, 0x68, 0x65, 0x20, 0x74, 0x69, 0x67, 0x68, 0x74, 0x20, 
+    0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 
+    0x6f, 0x78, 0x20, 0x28, 0x60, 0x42, 0x42, 0x6f, 0x78, 0x60, 
+    0x29, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 
+    0x68, 0x79, 0x73, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x69, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 
+    0x75, 0x74, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6f, 
+    0x72, 0x69, 0x67, 0x69, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x61, 
+    0x74, 0x20, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 
+    0x74, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x69, 
+    0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Layout_insert[281] = {
+    0x49, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x20, 0x74, 0x65, 0x78, 
+    0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x0a, 0x0a, 
+    0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 
+    0x65, 0x77, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 
+    0x6e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 0x72, 0x73, 0x20, 
+    0x61, 0x72, 0x65, 0x20, 0x6c, 0x61, 0x69, 0x64, 0x20, 0x6f, 
+    0x75, 0x74, 0x2c, 0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x27, 0x73, 
+    0x0a, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x73, 
+    0x69, 0x7a, 0x65, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x61, 0x66, 0x74, 
+    0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x61, 0x72, 
+    0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 
+    0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3a, 0x20, 
+    0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 
+    0x65, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 
+    0x77, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2c, 0x20, 0x61, 0x73, 
+    0x20, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x0a, 
+    0x0a, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3a, 0x20, 0x75, 0x6e, 
+    0x69, 0x63, 0x6f, 0x64, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x74, 
+    0x6f, 0x20, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Layout_layout[333] = {
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x61, 0x20, 
+    0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x75, 
+    0x70, 0x6c, 0x65, 0x73, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 
+    0x69, 0x62, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x0a, 0x0a, 0x45, 
+    0x61, 0x63, 0x68, 0x20, 0x74, 0x75, 0x70, 0x6c, 0x65, 0x20, 
+    0x69, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x2d, 
+    0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x3a, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x20, 
+    0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x63, 0x6f, 0x6e, 
+    0x74, 0x61, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x0a, 0x20, 0x20, 
+    0x2d, 0x20, 0x60, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x5f, 0x69, 
+    0x6e, 0x64, 0x65, 0x78, 0x60, 0x3a, 0x20, 0x54, 0x68, 0x65, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6e, 0x64, 
+    0x65, 0x78, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 
+    0x0a, 0x20, 0x20, 0x2d, 0x20, 0x60, 0x28, 0x78, 0x2c, 0x20, 
+    0x79, 0x29, 0x60, 0x3a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x78, 
+    0x2c, 0x20, 0x79, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 
+    0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x0a, 0x0a, 0x41, 0x20, 0x6e, 
+    0x65, 0x77, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x69, 0x73, 
+    0x20, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x20, 0x65, 0x76, 0x65, 
+    0x72, 0x79, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x2e, 0x20, 0x20, 
+    0x60, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x5f, 0x69, 0x6e, 0x64, 
+    0x69, 0x63, 0x65, 0x73, 0x60, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x60, 0x78, 0x79, 0x73, 0x60, 0x20, 0x67, 0x69, 0x76, 0x65, 
+    0x20, 0x74, 0x68, 0x65, 0x0a, 0x73, 0x61, 0x6d, 0x65, 0x20, 
+    0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 
+    0x63, 0x6f, 0x70, 0x79, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x74, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Layout_layout_bbox[150] = {
+    0x54, 0x68, 0x65, 0x20, 0x6c, 0x6f, 0x67, 0x69, 0x63, 0x61, 
+    0x6c, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 
+    0x20, 0x62, 0x6f, 0x78, 0x20, 0x28, 0x60, 0x42, 0x42, 0x6f, 
+    0x78, 0x60, 0x29, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x20, 0x20, 
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 
+    0x64, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x0a, 
+    0x74, 0x6f, 0x20, 0x6d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 
+    0x78, 0x74, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74, 
+    0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x65, 0x78, 
+    0x74, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 
+    0x73, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6e, 
+    0x0a, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Layout_replace[296] = {
+    0x52, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x20, 0x70, 0x61, 
+    0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x74, 0x65, 0x78, 0x74, 0x2e, 0x0a, 0x0a, 0x4f, 0x6e, 0x6c, 
+    0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x77, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x61, 0x6e, 0x64, 
+    0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x6e, 0x65, 0x69, 
+    0x67, 0x68, 0x62, 0x6f, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 
+    0x20, 0x6c, 0x61, 0x69, 0x64, 0x20, 0x6f, 0x75, 0x74, 0x2c, 
+    0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x61, 0x63, 0x65, 0x27, 0x73, 0x0a, 0x63, 0x75, 
+    0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 
+    0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 
+    0x74, 0x68, 0x65, 0x6d, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6d, 
+    0x6f, 0x76, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 
+    0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x73, 
+    0x74, 0x61, 0x72, 0x74, 0x2c, 0x20, 0x65, 0x6e, 0x64, 0x20, 
+    0x3a, 0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x20, 
+    0x6f, 0x66, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x70, 
+    0x6c, 0x61, 0x63, 0x65, 0x2c, 0x20, 0x61, 0x73, 0x20, 0x69, 
+    0x6e, 0x20, 0x60, 0x60, 0x74, 0x65, 0x78, 0x74, 0x5b, 0x73, 
+    0x74, 0x61, 0x72, 0x74, 0x3a, 0x65, 0x6e, 0x64, 0x5d, 0x60, 
+    0x60, 0x2e, 0x0a, 0x0a, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3a, 
+    0x20, 0x75, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 
+    0x6c, 0x61, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x74, 
+    0x65, 0x78, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Layout_text[46] = {
+    0x54, 0x68, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x79, 0x6f, 
+    0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 
+    0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x65, 0x64, 
+    0x69, 0x74, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Layout_to_points_and_codes[590] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 
+    0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x20, 0x74, 0x6f, 0x0a, 
+    0x61, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x70, 
+    0x61, 0x69, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x72, 0x72, 
+    0x61, 0x79, 0x73, 0x20, 0x28, 0x70, 0x6f, 0x69, 0x6e, 0x74, 
+    0x73, 0x2c, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x73, 0x29, 0x2c, 
+    0x20, 0x61, 0x73, 0x20, 0x60, 0x4f, 0x75, 0x74, 0x6c, 0x69, 
+    0x6e, 0x65, 0x2e, 0x74, 0x6f, 0x5f, 0x70, 0x6f, 0x69, 0x6e, 
+    0x74, 0x73, 0x5f, 0x61, 0x6e, 0x64, 0x5f, 0x63, 0x6f, 0x64, 
+    0x65, 0x73, 0x60, 0x0a, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x2e, 0x0a, 0x0a, 
+    0x45, 0x61, 0x63, 0x68, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x69, 0x73, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20, 
+    0x74, 0x6f, 0x20, 0x69, 0x74, 0x73, 0x20, 0x70, 0x6f, 0x73, 
+    0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2c, 
+    0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 
+    0x73, 0x75, 0x6c, 0x74, 0x20, 0x63, 0x61, 0x6e, 0x0a, 0x62, 
+    0x65, 0x20, 0x64, 0x72, 0x61, 0x77, 0x6e, 0x20, 0x61, 0x73, 
+    0x20, 0x6f, 0x6e, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 
+    0x62, 0x79, 0x20, 0x61, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6f, 
+    0x72, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x65, 0x6e, 0x64, 0x2e, 
+    0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x77, 0x68, 0x6f, 0x6c, 
+    0x65, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x69, 
+    0x6f, 0x6e, 0x20, 0x69, 0x73, 0x0a, 0x64, 0x6f, 0x6e, 0x65, 
+    0x20, 0x69, 0x6e, 0x20, 0x43, 0x2c, 0x20, 0x75, 0x73, 0x69, 
+    0x6e, 0x67, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 
+    0x73, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x20, 0x6f, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 
+    0x2e, 0x20, 0x20, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 
+    0x6e, 0x6f, 0x0a, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 
+    0x2c, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x73, 0x20, 
+    0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x73, 0x2c, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6c, 
+    0x65, 0x66, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x2e, 0x0a, 0x0a, 
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x61, 0x72, 0x72, 0x61, 
+    0x79, 0x73, 0x20, 0x3a, 0x20, 0x74, 0x75, 0x70, 0x6c, 0x65, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x41, 0x20, 0x28, 0x70, 0x6f, 
+    0x69, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x63, 0x6f, 0x64, 0x65, 
+    0x73, 0x29, 0x20, 0x70, 0x61, 0x69, 0x72, 0x2e, 0x20, 0x20, 
+    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x69, 0x73, 0x20, 
+    0x61, 0x6e, 0x20, 0x2a, 0x4e, 0x2a, 0x78, 0x32, 0x20, 0x60, 
+    0x41, 0x72, 0x72, 0x61, 0x79, 0x60, 0x20, 0x6f, 0x66, 0x20, 
+    0x66, 0x6c, 0x6f, 0x61, 0x74, 0x73, 0x2c, 0x20, 0x69, 0x6e, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 
+    0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x64, 
+    0x65, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x6c, 0x65, 
+    0x6e, 0x67, 0x74, 0x68, 0x20, 0x2a, 0x4e, 0x2a, 0x20, 0x60, 
+    0x41, 0x72, 0x72, 0x61, 0x79, 0x60, 0x20, 0x6f, 0x66, 0x20, 
+    0x60, 0x43, 0x4f, 0x44, 0x45, 0x53, 0x60, 0x20, 0x63, 0x6f, 
+    0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Layout_xys[222] = {
+    0x41, 0x20, 0x60, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x76, 
+    0x69, 0x65, 0x77, 0x60, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x20, 
+    0x20, 0x45, 0x61, 0x63, 0x68, 0x0a, 0x65, 0x6e, 0x74, 0x72, 
+    0x79, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x28, 0x78, 
+    0x2c, 0x20, 0x79, 0x29, 0x20, 0x70, 0x61, 0x69, 0x72, 0x2c, 
+    0x20, 0x69, 0x6e, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 
+    0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x76, 0x69, 0x65, 
+    0x77, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x73, 0x20, 0x6d, 
+    0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 
+    0x74, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x6e, 0x6f, 0x74, 0x68, 
+    0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6f, 0x70, 
+    0x69, 0x65, 0x64, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x0a, 
+    0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x20, 0x63, 0x61, 0x6e, 
+    0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x65, 0x64, 
+    0x69, 0x74, 0x65, 0x64, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 
+    0x69, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x75, 0x73, 0x65, 0x2e, 
+    0x0a, 0x00, 
+};
+
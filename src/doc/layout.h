@@ -0,0 +1,25 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/layout.py.
+*/
+
+#ifndef __DOC_LAYOUT_H__
+#define __DOC_LAYOUT_H__
+extern char doc_Layout__init__[570];
+extern char doc_Layout_delete[221];
+extern char doc_Layout_draw[778];
+extern char doc_Layout_get_transformed[823];
+extern char doc_Layout_glyph_indices[183];
+extern char doc_Layout_ink_bbox[127];
+extern char doc_Layout_insert[281];
+extern char doc_Layout_layout[333];
+extern char doc_Layout_layout_bbox[150];
+extern char doc_Layout_replace[296];
+extern char doc_Layout_text[46];
+extern char doc_Layout_to_points_and_codes[590];
+extern char doc_Layout_xys[222];
+
+#endif
+
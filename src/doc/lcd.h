@@ -0,0 +1,15 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/lcd.py.
+*/
+
+#ifndef __DOC_LCD_H__
+#define __DOC_LCD_H__
+extern char doc_LCD_FILTER[1575];
+extern char doc_set_lcd_filter[849];
+extern char doc_set_lcd_filter_weights[405];
+
+#endif
+
@@ -0,0 +1,31 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/matrix.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "matrix.h"
+
+char doc_Matrix__init__[88] = {
+    0x41, 0x20, 0x32, 0x78, 0x32, 0x20, 0x6d, 0x61, 0x74, 0x72, 
+    0x69, 0x78, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x63, 
+    0x6f, 0x6d, 0x70, 0x75, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 
+    0x20, 0x69, 0x73, 0x3a, 0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 
+    0x78, 0x27, 0x20, 0x3d, 0x20, 0x78, 0x2a, 0x78, 0x78, 0x20, 
+    0x2b, 0x20, 0x79, 0x2a, 0x78, 0x79, 0x0a, 0x20, 0x20, 0x20, 
+    0x79, 0x27, 0x20, 0x3d, 0x20, 0x78, 0x2a, 0x79, 0x78, 0x20, 
+    0x2b, 0x20, 0x79, 0x2a, 0x79, 0x79, 0x0a, 0x00, 
+};
+
+char doc_Matrix_coefficient[21] = {
+    0x4d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x20, 0x63, 0x6f, 0x65, 
+    0x66, 0x66, 0x69, 0x63, 0x69, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 
+    0x00, 
+};
+
@@ -0,0 +1,14 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/matrix.py.
+*/
+
+#ifndef __DOC_MATRIX_H__
+#define __DOC_MATRIX_H__
+extern char doc_Matrix__init__[88];
+extern char doc_Matrix_coefficient[21];
+
+#endif
+
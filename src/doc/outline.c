@@ -0,0 +1,1261 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/outline.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "outline.h"
+
+char doc_CODES[147] = {
+    0x43, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x60, 0x4f, 
+    0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x74, 0x6f, 0x5f, 
+    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5f, 0x61, 0x6e, 0x64, 
+    0x5f, 0x63, 0x6f, 0x64, 0x65, 0x73, 0x60, 0x3a, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x31, 0x3a, 0x20, 0x60, 0x4d, 0x4f, 0x56, 0x45, 
+    0x54, 0x4f, 0x60, 0x20, 0x28, 0x31, 0x20, 0x70, 0x6f, 0x69, 
+    0x6e, 0x74, 0x29, 0x0a, 0x2d, 0x20, 0x32, 0x3a, 0x20, 0x60, 
+    0x4c, 0x49, 0x4e, 0x45, 0x54, 0x4f, 0x60, 0x20, 0x28, 0x31, 
+    0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x29, 0x0a, 0x2d, 0x20, 
+    0x33, 0x3a, 0x20, 0x60, 0x43, 0x4f, 0x4e, 0x49, 0x43, 0x60, 
+    0x20, 0x28, 0x32, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 
+    0x29, 0x0a, 0x2d, 0x20, 0x34, 0x3a, 0x20, 0x60, 0x43, 0x55, 
+    0x42, 0x49, 0x43, 0x60, 0x20, 0x28, 0x33, 0x20, 0x70, 0x6f, 
+    0x69, 0x6e, 0x74, 0x73, 0x29, 0x0a, 0x00, 
+};
+
+char doc_ORIENTATION[832] = {
+    0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 
+    0x68, 0x6f, 0x77, 0x20, 0x61, 0x6e, 0x20, 0x60, 0x4f, 0x75, 
+    0x74, 0x6c, 0x69, 0x6e, 0x65, 0x60, 0x20, 0x69, 0x73, 0x20, 
+    0x6f, 0x72, 0x69, 0x65, 0x6e, 0x74, 0x65, 0x64, 0x2e, 0x0a, 
+    0x0a, 0x2d, 0x20, 0x60, 0x54, 0x52, 0x55, 0x45, 0x54, 0x59, 
+    0x50, 0x45, 0x60, 0x3a, 0x20, 0x41, 0x63, 0x63, 0x6f, 0x72, 
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 
+    0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x61, 
+    0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x63, 0x6c, 0x6f, 0x63, 
+    0x6b, 0x77, 0x69, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x63, 0x6f, 
+    0x6e, 0x74, 0x6f, 0x75, 0x72, 0x73, 0x20, 0x6d, 0x75, 0x73, 
+    0x74, 0x20, 0x62, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x65, 
+    0x64, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x75, 
+    0x6e, 0x74, 0x65, 0x72, 0x2d, 0x63, 0x6c, 0x6f, 0x63, 0x6b, 
+    0x77, 0x69, 0x73, 0x65, 0x20, 0x6f, 0x6e, 0x65, 0x73, 0x20, 
+    0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x0a, 0x20, 0x20, 
+    0x75, 0x6e, 0x66, 0x69, 0x6c, 0x6c, 0x65, 0x64, 0x2e, 0x0a, 
+    0x0a, 0x2d, 0x20, 0x60, 0x50, 0x4f, 0x53, 0x54, 0x53, 0x43, 
+    0x52, 0x49, 0x50, 0x54, 0x60, 0x3a, 0x20, 0x41, 0x63, 0x63, 
+    0x6f, 0x72, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x50, 0x6f, 0x73, 0x74, 0x53, 0x63, 
+    0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 
+    0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x0a, 
+    0x20, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x2d, 
+    0x63, 0x6c, 0x6f, 0x63, 0x6b, 0x77, 0x69, 0x73, 0x65, 0x20, 
+    0x63, 0x6f, 0x6e, 0x74, 0x6f, 0x75, 0x72, 0x73, 0x20, 0x6d, 
+    0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x66, 0x69, 0x6c, 
+    0x6c, 0x65, 0x64, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 
+    0x6c, 0x6f, 0x63, 0x6b, 0x77, 0x69, 0x73, 0x65, 0x20, 0x6f, 
+    0x6e, 0x65, 0x73, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x0a, 0x20, 
+    0x20, 0x62, 0x65, 0x20, 0x75, 0x6e, 0x66, 0x69, 0x6c, 0x6c, 
+    0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x46, 0x49, 
+    0x4c, 0x4c, 0x5f, 0x52, 0x49, 0x47, 0x48, 0x54, 0x60, 0x3a, 
+    0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x69, 
+    0x64, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x74, 
+    0x6f, 0x20, 0x60, 0x4f, 0x52, 0x49, 0x45, 0x4e, 0x54, 0x41, 
+    0x54, 0x49, 0x4f, 0x4e, 0x2e, 0x54, 0x52, 0x55, 0x45, 0x54, 
+    0x59, 0x50, 0x45, 0x60, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 
+    0x69, 0x73, 0x0a, 0x20, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 
+    0x74, 0x6f, 0x20, 0x72, 0x65, 0x6d, 0x65, 0x6d, 0x62, 0x65, 
+    0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x6e, 0x20, 
+    0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x2c, 0x20, 
+    0x65, 0x76, 0x65, 0x72, 0x79, 0x74, 0x68, 0x69, 0x6e, 0x67, 
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 
+    0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x69, 0x67, 0x68, 
+    0x74, 0x0a, 0x20, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x64, 0x72, 0x61, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x64, 
+    0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 
+    0x66, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x6f, 0x75, 
+    0x72, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 
+    0x66, 0x69, 0x6c, 0x6c, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x2d, 
+    0x20, 0x60, 0x46, 0x49, 0x4c, 0x4c, 0x5f, 0x4c, 0x45, 0x46, 
+    0x54, 0x60, 0x3a, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 
+    0x73, 0x20, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 
+    0x6c, 0x20, 0x74, 0x6f, 0x20, 0x60, 0x4f, 0x52, 0x49, 0x45, 
+    0x4e, 0x54, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x2e, 0x50, 0x4f, 
+    0x53, 0x54, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x60, 0x2c, 
+    0x20, 0x62, 0x75, 0x74, 0x20, 0x69, 0x73, 0x0a, 0x20, 0x20, 
+    0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 
+    0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 
+    0x74, 0x20, 0x69, 0x6e, 0x20, 0x50, 0x6f, 0x73, 0x74, 0x53, 
+    0x63, 0x72, 0x69, 0x70, 0x74, 0x2c, 0x20, 0x65, 0x76, 0x65, 
+    0x72, 0x79, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 
+    0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x0a, 0x20, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x72, 0x61, 
+    0x77, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 
+    0x63, 0x6f, 0x6e, 0x74, 0x6f, 0x75, 0x72, 0x20, 0x6d, 0x75, 
+    0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x6c, 
+    0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4e, 0x4f, 
+    0x4e, 0x45, 0x60, 0x3a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6f, 
+    0x72, 0x69, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 
+    0x20, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x65, 
+    0x64, 0x2e, 0x20, 0x54, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 
+    0x2c, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 
+    0x74, 0x0a, 0x20, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x64, 0x69, 
+    0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x72, 
+    0x69, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_OUTLINE[2407] = {
+    0x42, 0x69, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 
+    0x74, 0x6f, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x69, 0x7a, 0x65, 0x20, 0x61, 0x6e, 0x20, 0x60, 
+    0x4f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x60, 0x2e, 0x0a, 
+    0x0a, 0x2d, 0x20, 0x60, 0x4e, 0x4f, 0x4e, 0x45, 0x60, 0x3a, 
+    0x20, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x30, 0x20, 0x69, 
+    0x73, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 
+    0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4f, 0x57, 0x4e, 0x45, 
+    0x52, 0x60, 0x3a, 0x20, 0x49, 0x66, 0x20, 0x73, 0x65, 0x74, 
+    0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6c, 0x61, 
+    0x67, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 
+    0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x27, 0x73, 
+    0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x61, 0x72, 0x72, 
+    0x61, 0x79, 0x73, 0x0a, 0x20, 0x20, 0x28, 0x69, 0x2e, 0x65, 
+    0x2e, 0x2c, 0x20, 0x60, 0x7e, 0x4f, 0x75, 0x74, 0x6c, 0x69, 
+    0x6e, 0x65, 0x2e, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x60, 
+    0x2c, 0x20, 0x60, 0x7e, 0x4f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x60, 0x2c, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x60, 0x7e, 0x4f, 0x75, 0x74, 0x6c, 
+    0x69, 0x6e, 0x65, 0x2e, 0x63, 0x6f, 0x6e, 0x74, 0x6f, 0x75, 
+    0x72, 0x73, 0x60, 0x29, 0x0a, 0x20, 0x20, 0x61, 0x72, 0x65, 
+    0x20, 0xe2, 0x80, 0x98, 0x6f, 0x77, 0x6e, 0x65, 0x64, 0xe2, 
+    0x80, 0x99, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x6f, 0x62, 
+    0x6a, 0x65, 0x63, 0x74, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x74, 0x68, 0x75, 
+    0x73, 0x20, 0x62, 0x65, 0x20, 0x66, 0x72, 0x65, 0x65, 0x64, 
+    0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x69, 0x74, 0x0a, 0x20, 
+    0x20, 0x69, 0x73, 0x20, 0x64, 0x65, 0x73, 0x74, 0x72, 0x6f, 
+    0x79, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x45, 
+    0x56, 0x45, 0x4e, 0x5f, 0x4f, 0x44, 0x44, 0x5f, 0x46, 0x49, 
+    0x4c, 0x4c, 0x60, 0x3a, 0x20, 0x42, 0x79, 0x20, 0x64, 0x65, 
+    0x66, 0x61, 0x75, 0x6c, 0x74, 0x2c, 0x20, 0x6f, 0x75, 0x74, 
+    0x6c, 0x69, 0x6e, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 
+    0x66, 0x69, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x75, 0x73, 0x69, 
+    0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x6e, 
+    0x2d, 0x7a, 0x65, 0x72, 0x6f, 0x0a, 0x20, 0x20, 0x77, 0x69, 
+    0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x72, 0x75, 0x6c, 0x65, 
+    0x2e, 0x20, 0x49, 0x66, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 
+    0x6f, 0x20, 0x31, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 
+    0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x77, 0x69, 0x6c, 
+    0x6c, 0x20, 0x62, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x65, 
+    0x64, 0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 
+    0x65, 0x0a, 0x20, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x2d, 0x6f, 
+    0x64, 0x64, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x20, 0x72, 0x75, 
+    0x6c, 0x65, 0x20, 0x28, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x77, 
+    0x6f, 0x72, 0x6b, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x6d, 0x6f, 0x6f, 0x74, 0x68, 
+    0x20, 0x72, 0x61, 0x73, 0x74, 0x65, 0x72, 0x69, 0x7a, 0x65, 
+    0x72, 0x29, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x52, 0x45, 
+    0x56, 0x45, 0x52, 0x53, 0x45, 0x5f, 0x46, 0x49, 0x4c, 0x4c, 
+    0x60, 0x3a, 0x20, 0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 
+    0x75, 0x6c, 0x74, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x73, 0x69, 
+    0x64, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x6f, 0x75, 0x72, 
+    0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x20, 0x6f, 0x75, 
+    0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61, 0x72, 0x65, 0x0a, 
+    0x20, 0x20, 0x6f, 0x72, 0x69, 0x65, 0x6e, 0x74, 0x65, 0x64, 
+    0x20, 0x69, 0x6e, 0x20, 0x63, 0x6c, 0x6f, 0x63, 0x6b, 0x2d, 
+    0x77, 0x69, 0x73, 0x65, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 
+    0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x61, 0x73, 0x20, 0x64, 
+    0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x0a, 0x20, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 
+    0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 
+    0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x69, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6f, 0x70, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x65, 0x0a, 
+    0x20, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x28, 0x74, 0x79, 0x70, 0x69, 0x63, 0x61, 0x6c, 
+    0x6c, 0x79, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x54, 0x79, 0x70, 
+    0x65, 0x20, 0x31, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x29, 
+    0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6c, 0x61, 
+    0x67, 0x20, 0x69, 0x73, 0x20, 0x69, 0x67, 0x6e, 0x6f, 0x72, 
+    0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x0a, 
+    0x20, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 
+    0x76, 0x65, 0x72, 0x74, 0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x2d, 
+    0x20, 0x60, 0x49, 0x47, 0x4e, 0x4f, 0x52, 0x45, 0x5f, 0x44, 
+    0x52, 0x4f, 0x50, 0x4f, 0x55, 0x54, 0x53, 0x60, 0x3a, 0x20, 
+    0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 
+    0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x63, 0x61, 0x6e, 
+    0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x72, 
+    0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x74, 0x72, 0x79, 0x20, 
+    0x74, 0x6f, 0x20, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x0a, 
+    0x20, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x2d, 0x6f, 0x75, 0x74, 
+    0x73, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6e, 0x20, 0x6f, 0x75, 
+    0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x63, 0x6f, 0x72, 0x72, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x62, 0x69, 
+    0x74, 0x6d, 0x61, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x65, 0x6e, 
+    0x73, 0x75, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 
+    0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x68, 
+    0x61, 0x70, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 
+    0x75, 0x69, 0x74, 0x79, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x73, 
+    0x65, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 
+    0x6c, 0x61, 0x67, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x73, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x2d, 0x6c, 
+    0x69, 0x6e, 0x65, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x76, 
+    0x65, 0x72, 0x74, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x69, 
+    0x67, 0x6e, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x75, 0x63, 0x68, 
+    0x20, 0x63, 0x61, 0x73, 0x65, 0x73, 0x2e, 0x20, 0x53, 0x65, 
+    0x65, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x66, 
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 
+    0x0a, 0x2d, 0x20, 0x60, 0x53, 0x4d, 0x41, 0x52, 0x54, 0x5f, 
+    0x44, 0x52, 0x4f, 0x50, 0x4f, 0x55, 0x54, 0x53, 0x60, 0x3a, 
+    0x20, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x73, 0x6d, 
+    0x61, 0x72, 0x74, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x6f, 0x75, 
+    0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x2e, 
+    0x20, 0x49, 0x66, 0x20, 0x75, 0x6e, 0x73, 0x65, 0x74, 0x2c, 
+    0x20, 0x75, 0x73, 0x65, 0x20, 0x73, 0x69, 0x6d, 0x70, 0x6c, 
+    0x65, 0x0a, 0x20, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x6f, 0x75, 
+    0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x2e, 
+    0x20, 0x49, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x64, 0x20, 0x69, 
+    0x66, 0x20, 0x60, 0x4f, 0x55, 0x54, 0x4c, 0x49, 0x4e, 0x45, 
+    0x2e, 0x49, 0x47, 0x4e, 0x4f, 0x52, 0x45, 0x5f, 0x44, 0x52, 
+    0x4f, 0x50, 0x4f, 0x55, 0x54, 0x53, 0x60, 0x20, 0x69, 0x73, 
+    0x20, 0x73, 0x65, 0x74, 0x2e, 0x20, 0x53, 0x65, 0x65, 0x0a, 
+    0x20, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x66, 
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 
+    0x0a, 0x2d, 0x20, 0x60, 0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 
+    0x45, 0x5f, 0x53, 0x54, 0x55, 0x42, 0x53, 0x60, 0x3a, 0x20, 
+    0x49, 0x66, 0x20, 0x73, 0x65, 0x74, 0x2c, 0x20, 0x74, 0x75, 
+    0x72, 0x6e, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x20, 
+    0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0xe2, 0x80, 0x98, 
+    0x73, 0x74, 0x75, 0x62, 0x73, 0xe2, 0x80, 0x99, 0x2c, 0x20, 
+    0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x0a, 
+    0x20, 0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 
+    0x74, 0x68, 0x65, 0x6d, 0x2e, 0x20, 0x49, 0x67, 0x6e, 0x6f, 
+    0x72, 0x65, 0x64, 0x20, 0x69, 0x66, 0x20, 0x60, 0x4f, 0x55, 
+    0x54, 0x4c, 0x49, 0x4e, 0x45, 0x2e, 0x49, 0x47, 0x4e, 0x4f, 
+    0x52, 0x45, 0x5f, 0x44, 0x52, 0x4f, 0x50, 0x4f, 0x55, 0x54, 
+    0x53, 0x60, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x2e, 
+    0x20, 0x53, 0x65, 0x65, 0x0a, 0x20, 0x20, 0x62, 0x65, 0x6c, 
+    0x6f, 0x77, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x72, 
+    0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x48, 
+    0x49, 0x47, 0x48, 0x5f, 0x50, 0x52, 0x45, 0x43, 0x49, 0x53, 
+    0x49, 0x4f, 0x4e, 0x60, 0x3a, 0x20, 0x54, 0x68, 0x69, 0x73, 
+    0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x69, 0x6e, 0x64, 0x69, 
+    0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x2d, 
+    0x6c, 0x69, 0x6e, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 
+    0x72, 0x74, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x73, 0x68, 0x6f, 
+    0x75, 0x6c, 0x64, 0x20, 0x74, 0x72, 0x79, 0x20, 0x74, 0x6f, 
+    0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 
+    0x70, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x73, 0x74, 0x0a, 
+    0x20, 0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 
+    0x20, 0x71, 0x75, 0x61, 0x6c, 0x69, 0x74, 0x79, 0x2e, 0x20, 
+    0x49, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x79, 0x70, 0x69, 
+    0x63, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x73, 0x65, 0x74, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x0a, 
+    0x20, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x2e, 0x20, 0x4e, 
+    0x6f, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 
+    0x79, 0x20, 0x61, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x20, 0x74, 
+    0x68, 0x61, 0x74, 0x20, 0x6d, 0x69, 0x67, 0x68, 0x74, 0x20, 
+    0x62, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 
+    0x65, 0x6c, 0x79, 0x0a, 0x20, 0x20, 0x69, 0x67, 0x6e, 0x6f, 
+    0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x67, 
+    0x69, 0x76, 0x65, 0x6e, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x2d, 
+    0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x72, 0x2e, 
+    0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x53, 0x49, 0x4e, 0x47, 0x4c, 
+    0x45, 0x5f, 0x50, 0x41, 0x53, 0x53, 0x60, 0x3a, 0x20, 0x54, 
+    0x68, 0x69, 0x73, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x69, 
+    0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x66, 
+    0x6f, 0x72, 0x63, 0x65, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 
+    0x65, 0x6e, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x2d, 0x63, 0x6f, 
+    0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x72, 0x20, 0x74, 0x6f, 
+    0x0a, 0x20, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x75, 0x73, 
+    0x65, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 
+    0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 
+    0x6e, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x6e, 0x64, 
+    0x65, 0x72, 0x20, 0x61, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 
+    0x70, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x0a, 0x20, 0x20, 
+    0x69, 0x6d, 0x61, 0x67, 0x65, 0x2e, 0x20, 0x4e, 0x6f, 0x72, 
+    0x6d, 0x61, 0x6c, 0x6c, 0x79, 0x2c, 0x20, 0x69, 0x74, 0x20, 
+    0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x76, 0x65, 0x72, 0x79, 0x20, 0x6c, 0x61, 0x72, 0x67, 
+    0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
+    0x72, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x2e, 0x20, 0x49, 
+    0x74, 0x20, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x6f, 0x6e, 0x6c, 
+    0x79, 0x20, 0x61, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x20, 0x74, 
+    0x68, 0x61, 0x74, 0x20, 0x6d, 0x69, 0x67, 0x68, 0x74, 0x20, 
+    0x62, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 
+    0x65, 0x6c, 0x79, 0x20, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65, 
+    0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 
+    0x65, 0x6e, 0x0a, 0x20, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x2d, 
+    0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x72, 0x2e, 
+    0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x66, 0x6c, 
+    0x61, 0x67, 0x73, 0x20, 0x60, 0x4f, 0x55, 0x54, 0x4c, 0x49, 
+    0x4e, 0x45, 0x2e, 0x49, 0x47, 0x4e, 0x4f, 0x52, 0x45, 0x5f, 
+    0x44, 0x52, 0x4f, 0x50, 0x4f, 0x55, 0x54, 0x53, 0x60, 0x2c, 
+    0x20, 0x60, 0x4f, 0x55, 0x54, 0x4c, 0x49, 0x4e, 0x45, 0x2e, 
+    0x53, 0x4d, 0x41, 0x52, 0x54, 0x5f, 0x44, 0x52, 0x4f, 0x50, 
+    0x4f, 0x55, 0x54, 0x53, 0x60, 0x2c, 0x20, 0x61, 0x6e, 0x64, 
+    0x0a, 0x60, 0x4f, 0x55, 0x54, 0x4c, 0x49, 0x4e, 0x45, 0x2e, 
+    0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 0x45, 0x5f, 0x53, 0x54, 
+    0x55, 0x42, 0x53, 0x60, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 
+    0x67, 0x6e, 0x6f, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x6d, 0x6f, 0x6f, 0x74, 0x68, 
+    0x20, 0x72, 0x61, 0x73, 0x74, 0x65, 0x72, 0x69, 0x7a, 0x65, 
+    0x72, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x72, 0x65, 0x20, 
+    0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x61, 0x20, 0x73, 
+    0x65, 0x63, 0x6f, 0x6e, 0x64, 0x20, 0x6d, 0x65, 0x63, 0x68, 
+    0x61, 0x6e, 0x69, 0x73, 0x6d, 0x20, 0x74, 0x6f, 0x20, 0x70, 
+    0x61, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x72, 
+    0x6f, 0x70, 0x2d, 0x6f, 0x75, 0x74, 0x20, 0x6d, 0x6f, 0x64, 
+    0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x42, 
+    0x2f, 0x57, 0x0a, 0x72, 0x61, 0x73, 0x74, 0x65, 0x72, 0x69, 
+    0x7a, 0x65, 0x72, 0x3b, 0x20, 0x73, 0x65, 0x65, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x60, 0x4f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x2e, 0x74, 0x61, 0x67, 0x73, 0x60, 0x2e, 0x0a, 0x0a, 
+    0x50, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x72, 0x65, 0x66, 
+    0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0xe2, 
+    0x80, 0x98, 0x53, 0x43, 0x41, 0x4e, 0x54, 0x59, 0x50, 0x45, 
+    0xe2, 0x80, 0x99, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x0a, 0x4f, 0x70, 0x65, 0x6e, 0x54, 0x79, 0x70, 
+    0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x69, 0x6e, 0x20, 
+    0x66, 0x69, 0x6c, 0x65, 0x20, 0xe2, 0x80, 0x98, 0x74, 0x74, 
+    0x69, 0x6e, 0x73, 0x74, 0x31, 0x2e, 0x64, 0x6f, 0x63, 0xe2, 
+    0x80, 0x99, 0x29, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x73, 0x69, 
+    0x6d, 0x70, 0x6c, 0x65, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x2d, 
+    0x6f, 0x75, 0x74, 0x73, 0x2c, 0x0a, 0x73, 0x6d, 0x61, 0x72, 
+    0x74, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x2d, 0x6f, 0x75, 0x74, 
+    0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x74, 0x75, 
+    0x62, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x64, 0x65, 0x66, 
+    0x69, 0x6e, 0x65, 0x64, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Outline__init__[24] = {
+    0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x73, 
+    0x20, 0x61, 0x6e, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Outline_check[96] = {
+    0x43, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x6f, 
+    0x66, 0x20, 0x61, 0x6e, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 
+    0x6e, 0x65, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 
+    0x74, 0x6f, 0x72, 0x2e, 0x0a, 0x0a, 0x52, 0x61, 0x69, 0x73, 
+    0x65, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x78, 0x63, 0x65, 
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 
+    0x20, 0x68, 0x61, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x62, 0x6c, 
+    0x65, 0x6d, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Outline_codes[178] = {
+    0x41, 0x20, 0x60, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x76, 
+    0x69, 0x65, 0x77, 0x60, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 
+    0x64, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x64, 0x65, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x73, 
+    0x65, 0x64, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 
+    0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 
+    0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x0a, 0x45, 0x61, 0x63, 0x68, 
+    0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 
+    0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x3a, 0x0a, 0x0a, 0x2d, 
+    0x20, 0x31, 0x3a, 0x20, 0x4d, 0x4f, 0x56, 0x45, 0x54, 0x4f, 
+    0x20, 0x28, 0x31, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x29, 
+    0x0a, 0x2d, 0x20, 0x32, 0x3a, 0x20, 0x4c, 0x49, 0x4e, 0x45, 
+    0x54, 0x4f, 0x20, 0x28, 0x31, 0x20, 0x70, 0x6f, 0x69, 0x6e, 
+    0x74, 0x29, 0x0a, 0x2d, 0x20, 0x33, 0x3a, 0x20, 0x43, 0x4f, 
+    0x4e, 0x49, 0x43, 0x20, 0x28, 0x32, 0x20, 0x70, 0x6f, 0x69, 
+    0x6e, 0x74, 0x73, 0x29, 0x0a, 0x2d, 0x20, 0x34, 0x3a, 0x20, 
+    0x43, 0x55, 0x42, 0x49, 0x43, 0x20, 0x28, 0x33, 0x20, 0x70, 
+    0x6f, 0x69, 0x6e, 0x74, 0x73, 0x29, 0x0a, 0x00, 
+};
+
+char doc_Outline_contours[373] = {
+    0x41, 0x20, 0x60, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x76, 
+    0x69, 0x65, 0x77, 0x60, 0x20, 0x67, 0x69, 0x76, 0x69, 0x6e, 
+    0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6e, 0x64, 0x20, 
+    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x65, 
+    0x61, 0x63, 0x68, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x6f, 0x75, 
+    0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x0a, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 
+    0x2e, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6d, 
+    0x70, 0x6c, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x69, 0x72, 0x73, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x6f, 
+    0x75, 0x72, 0x20, 0x69, 0x73, 0x20, 0x64, 0x65, 0x66, 0x69, 
+    0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x60, 0x30, 
+    0x60, 0x0a, 0x74, 0x6f, 0x20, 0x60, 0x63, 0x6f, 0x6e, 0x74, 
+    0x6f, 0x75, 0x72, 0x73, 0x5b, 0x30, 0x5d, 0x60, 0x2c, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 
+    0x20, 0x6f, 0x6e, 0x65, 0x20, 0x69, 0x73, 0x20, 0x64, 0x65, 
+    0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 
+    0x60, 0x63, 0x6f, 0x6e, 0x74, 0x6f, 0x75, 0x72, 0x73, 0x5b, 
+    0x30, 0x5d, 0x0a, 0x2b, 0x20, 0x31, 0x60, 0x20, 0x74, 0x6f, 
+    0x20, 0x60, 0x63, 0x6f, 0x6e, 0x74, 0x6f, 0x75, 0x72, 0x73, 
+    0x5b, 0x31, 0x5d, 0x60, 0x2c, 0x20, 0x65, 0x74, 0x63, 0x2e, 
+    0x0a, 0x0a, 0x49, 0x66, 0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 
+    0x20, 0x6e, 0x75, 0x6d, 0x70, 0x79, 0x2c, 0x20, 0x79, 0x6f, 
+    0x75, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x77, 0x61, 0x6e, 0x74, 
+    0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 
+    0x69, 0x73, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x4e, 0x75, 
+    0x6d, 0x70, 0x79, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 
+    0x61, 0x73, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x73, 
+    0x3a, 0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3e, 0x3e, 
+    0x3e, 0x20, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x6e, 
+    0x75, 0x6d, 0x70, 0x79, 0x20, 0x61, 0x73, 0x20, 0x6e, 0x70, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x3e, 0x3e, 0x3e, 0x20, 0x61, 
+    0x20, 0x3d, 0x20, 0x6e, 0x70, 0x2e, 0x61, 0x73, 0x61, 0x72, 
+    0x72, 0x61, 0x79, 0x28, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x2e, 0x63, 0x6f, 0x6e, 0x74, 0x6f, 0x75, 0x72, 0x73, 
+    0x29, 0x0a, 0x00, 
+};
+
+char doc_Outline_decompose[2034] = {
+    0x44, 0x65, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x73, 0x65, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x69, 0x6e, 0x64, 
+    0x69, 0x76, 0x69, 0x64, 0x75, 0x61, 0x6c, 0x20, 0x73, 0x65, 
+    0x67, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 
+    0x20, 0x42, 0xc3, 0xa9, 0x7a, 0x69, 0x65, 0x72, 0x20, 0x61, 
+    0x72, 0x63, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x0a, 
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 
+    0x6c, 0x73, 0x6f, 0x20, 0x65, 0x6d, 0x69, 0x74, 0x73, 0x20, 
+    0xe2, 0x80, 0x98, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x74, 0x6f, 
+    0xe2, 0x80, 0x99, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6e, 
+    0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 
+    0x6e, 0x65, 0x77, 0x0a, 0x63, 0x6f, 0x6e, 0x74, 0x6f, 0x75, 
+    0x72, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x0a, 0x0a, 
+    0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 
+    0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6e, 
+    0x74, 0x65, 0x78, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x70, 0x61, 0x73, 
+    0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x20, 
+    0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x0a, 0x77, 0x69, 0x6c, 
+    0x6c, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x62, 
+    0x65, 0x20, 0x69, 0x6e, 0x20, 0x32, 0x36, 0x2e, 0x36, 0x2c, 
+    0x20, 0x31, 0x36, 0x2e, 0x31, 0x36, 0x20, 0x6f, 0x72, 0x20, 
+    0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x2e, 0x0a, 0x0a, 
+    0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 
+    0x5f, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x3a, 0x20, 
+    0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x41, 0x20, 0x50, 0x79, 0x74, 0x68, 0x6f, 0x6e, 0x20, 
+    0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x63, 0x6f, 0x6e, 
+    0x74, 0x61, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x6d, 0x65, 
+    0x74, 0x68, 0x6f, 0x64, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 
+    0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x63, 
+    0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x65, 
+    0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6d, 0x65, 
+    0x74, 0x68, 0x6f, 0x64, 0x73, 0x20, 0x61, 0x72, 0x65, 0x3a, 
+    0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x2d, 0x20, 0x60, 0x6d, 0x6f, 0x76, 0x65, 0x5f, 0x74, 0x6f, 
+    0x28, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x29, 0x60, 0x0a, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x20, 
+    0x60, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x74, 0x6f, 0x28, 0x70, 
+    0x6f, 0x69, 0x6e, 0x74, 0x29, 0x60, 0x0a, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x20, 0x60, 0x63, 
+    0x6f, 0x6e, 0x69, 0x63, 0x5f, 0x74, 0x6f, 0x28, 0x63, 0x6f, 
+    0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x2c, 0x20, 0x65, 0x6e, 0x64, 
+    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x29, 0x60, 0x0a, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x20, 0x60, 
+    0x63, 0x75, 0x62, 0x69, 0x63, 0x5f, 0x74, 0x6f, 0x28, 0x63, 
+    0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x31, 0x2c, 0x20, 0x63, 
+    0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x32, 0x2c, 0x20, 0x65, 
+    0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x29, 0x60, 0x0a, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x66, 0x72, 0x65, 0x65, 
+    0x74, 0x79, 0x70, 0x79, 0x7c, 0x20, 0x49, 0x66, 0x20, 0x60, 
+    0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x5f, 0x6f, 
+    0x62, 0x6a, 0x65, 0x63, 0x74, 0x60, 0x20, 0x64, 0x6f, 0x65, 
+    0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 
+    0x20, 0x61, 0x20, 0x60, 0x63, 0x6f, 0x6e, 0x69, 0x63, 0x5f, 
+    0x74, 0x6f, 0x60, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 
+    0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x69, 
+    0x63, 0x20, 0x63, 0x75, 0x72, 0x76, 0x65, 0x73, 0x20, 0x77, 
+    0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x63, 0x6f, 0x6e, 
+    0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 
+    0x63, 0x75, 0x62, 0x69, 0x63, 0x20, 0x6f, 0x6e, 0x65, 0x73, 
+    0x20, 0x61, 0x6e, 0x64, 0x20, 0x60, 0x63, 0x75, 0x62, 0x69, 
+    0x63, 0x5f, 0x74, 0x6f, 0x60, 0x20, 0x77, 0x69, 0x6c, 0x6c, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x65, 0x20, 0x63, 0x61, 
+    0x6c, 0x6c, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x73, 0x68, 0x69, 
+    0x66, 0x74, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 
+    0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 
+    0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x69, 0x74, 
+    0x73, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 
+    0x20, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 0x74, 
+    0x65, 0x73, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 
+    0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 
+    0x65, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6d, 0x69, 0x74, 0x74, 
+    0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x64, 0x65, 0x6c, 0x74, 0x61, 
+    0x20, 0x3a, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x6f, 0x70, 
+    0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x64, 0x65, 0x6c, 0x74, 0x61, 
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 
+    0x70, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 
+    0x63, 0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 
+    0x73, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x74, 
+    0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x65, 
+    0x6e, 0x74, 0x20, 0x74, 0x6f, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x65, 0x6d, 0x69, 0x74, 0x74, 0x65, 
+    0x72, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x61, 0x66, 0x74, 
+    0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x68, 0x69, 
+    0x66, 0x74, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x70, 
+    0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x73, 
+    0x68, 0x69, 0x66, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 
+    0x65, 0x6c, 0x74, 0x61, 0x20, 0x69, 0x73, 0x3a, 0x3a, 0x0a, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 
+    0x27, 0x20, 0x3d, 0x20, 0x28, 0x78, 0x20, 0x3c, 0x3c, 0x20, 
+    0x73, 0x68, 0x69, 0x66, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x64, 
+    0x65, 0x6c, 0x74, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x79, 0x27, 0x20, 0x3d, 0x20, 0x28, 0x79, 
+    0x20, 0x3c, 0x3c, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x29, 
+    0x20, 0x2d, 0x20, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x0a, 0x0a, 
+    0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x0a, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x0a, 0x3a, 
+    0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6c, 0x61, 
+    0x73, 0x73, 0x20, 0x44, 0x65, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 
+    0x73, 0x65, 0x72, 0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 
+    0x29, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x64, 0x65, 0x66, 0x20, 0x5f, 0x5f, 0x69, 0x6e, 0x69, 
+    0x74, 0x5f, 0x5f, 0x28, 0x73, 0x65, 0x6c, 0x66, 0x29, 0x3a, 
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x65, 0x6c, 0x66, 0x2e, 0x65, 0x6e, 
+    0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x5b, 0x5d, 
+    0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x64, 0x65, 0x66, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x5f, 0x74, 
+    0x6f, 0x28, 0x73, 0x65, 0x6c, 0x66, 0x2c, 0x20, 0x70, 0x6f, 
+    0x69, 0x6e, 0x74, 0x29, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 
+    0x6c, 0x66, 0x2e, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 
+    0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x28, 0x27, 
+    0x6d, 0x6f, 0x76, 0x65, 0x5f, 0x74, 0x6f, 0x27, 0x2c, 0x20, 
+    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x29, 0x29, 0x0a, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x66, 
+    0x20, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x74, 0x6f, 0x28, 0x73, 
+    0x65, 0x6c, 0x66, 0x2c, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 
+    0x29, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6c, 0x66, 0x2e, 
+    0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x2e, 0x61, 0x70, 
+    0x70, 0x65, 0x6e, 0x64, 0x28, 0x28, 0x27, 0x6c, 0x69, 0x6e, 
+    0x65, 0x5f, 0x74, 0x6f, 0x27, 0x2c, 0x20, 0x70, 0x6f, 0x69, 
+    0x6e, 0x74, 0x29, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x66, 0x20, 0x63, 0x6f, 
+    0x6e, 0x69, 0x63, 0x5f, 0x74, 0x6f, 0x28, 0x73, 0x65, 0x6c, 
+    0x66, 0x2c, 0x20, 0x61, 0x2c, 0x20, 0x62, 0x29, 0x3a, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x65, 0x6c, 0x66, 0x2e, 0x65, 0x6e, 0x74, 
+    0x72, 0x69, 0x65, 0x73, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 
+    0x64, 0x28, 0x28, 0x27, 0x63, 0x6f, 0x6e, 0x69, 0x63, 0x5f, 
+    0x74, 0x6f, 0x27, 0x2c, 0x20, 0x61, 0x2c, 0x20, 0x62, 0x29, 
+    0x29, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x64, 0x65, 0x66, 0x20, 0x63, 0x75, 0x62, 0x69, 0x63, 
+    0x5f, 0x74, 0x6f, 0x28, 0x73, 0x65, 0x6c, 0x66, 0x2c, 0x20, 
+    0x61, 0x2c, 0x20, 0x62, 0x2c, 0x20, 0x63, 0x29, 0x3a, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x65, 0x6c, 0x66, 0x2e, 0x65, 0x6e, 0x74, 
+    0x72, 0x69, 0x65, 0x73, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 
+    0x64, 0x28, 0x28, 0x27, 0x63, 0x75, 0x62, 0x69, 0x63, 0x5f, 
+    0x74, 0x6f, 0x27, 0x2c, 0x20, 0x61, 0x2c, 0x20, 0x62, 0x2c, 
+    0x20, 0x63, 0x29, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x61, 0x63, 0x65, 0x20, 0x3d, 0x20, 0x66, 0x74, 0x2e, 
+    0x46, 0x61, 0x63, 0x65, 0x28, 0x22, 0x56, 0x65, 0x72, 0x61, 
+    0x2e, 0x74, 0x74, 0x66, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x66, 0x61, 0x63, 0x65, 0x2e, 0x73, 0x65, 0x74, 0x5f, 
+    0x63, 0x68, 0x61, 0x72, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 
+    0x31, 0x32, 0x2c, 0x20, 0x31, 0x32, 0x2c, 0x20, 0x33, 0x30, 
+    0x30, 0x2c, 0x20, 0x33, 0x30, 0x30, 0x29, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x3d, 0x20, 
+    0x66, 0x61, 0x63, 0x65, 0x2e, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 
+    0x63, 0x68, 0x61, 0x72, 0x28, 0x6f, 0x72, 0x64, 0x28, 0x27, 
+    0x42, 0x27, 0x29, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x64, 0x20, 0x3d, 0x20, 0x44, 0x65, 0x63, 0x6f, 0x6d, 0x70, 
+    0x6f, 0x73, 0x65, 0x72, 0x28, 0x29, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x2e, 0x6f, 0x75, 0x74, 
+    0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x64, 0x65, 0x63, 0x6f, 0x6d, 
+    0x70, 0x6f, 0x73, 0x65, 0x28, 0x64, 0x29, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x28, 0x64, 0x2e, 
+    0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x29, 0x0a, 0x0a, 
+    0x4e, 0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x69, 0x6e, 
+    0x74, 0x20, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 
+    0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6e, 0x74, 0x20, 0x74, 
+    0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6d, 0x69, 0x74, 
+    0x74, 0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 
+    0x72, 0x6d, 0x65, 0x64, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 
+    0x6f, 0x6e, 0x0a, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x63, 
+    0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x73, 
+    0x20, 0x28, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 
+    0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x61, 0x6e, 0x74, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x68, 0x69, 0x67, 0x68, 0x20, 0x61, 
+    0x63, 0x63, 0x75, 0x72, 0x61, 0x63, 0x79, 0x0a, 0x64, 0x75, 
+    0x72, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x2d, 
+    0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 
+    0x29, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x74, 0x72, 0x61, 
+    0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x69, 0x73, 0x20, 0x73, 0x69, 0x6d, 0x70, 0x6c, 
+    0x65, 0x3a, 0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x78, 
+    0x20, 0x3d, 0x20, 0x28, 0x78, 0x20, 0x3c, 0x3c, 0x20, 0x73, 
+    0x68, 0x69, 0x66, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x64, 0x65, 
+    0x6c, 0x74, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x79, 0x20, 
+    0x3d, 0x20, 0x28, 0x79, 0x20, 0x3c, 0x3c, 0x20, 0x73, 0x68, 
+    0x69, 0x66, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x64, 0x65, 0x6c, 
+    0x74, 0x61, 0x0a, 0x00, 
+};
+
+char doc_Outline_decomposed_points[84] = {
+    0x41, 0x20, 0x60, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x76, 
+    0x69, 0x65, 0x77, 0x60, 0x20, 0x6f, 0x66, 0x20, 0x64, 0x65, 
+    0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x73, 0x65, 0x64, 0x20, 0x70, 
+    0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 
+    0x2e, 0x20, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x65, 0x6e, 
+    0x74, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6e, 0x0a, 
+    0x28, 0x78, 0x2c, 0x20, 0x79, 0x29, 0x20, 0x70, 0x61, 0x69, 
+    0x72, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Outline_embolden[640] = {
+    0x45, 0x6d, 0x62, 0x6f, 0x6c, 0x64, 0x65, 0x6e, 0x20, 0x61, 
+    0x6e, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x6f, 
+    0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x77, 0x69, 0x6c, 
+    0x6c, 0x20, 0x62, 0x65, 0x20, 0x61, 0x74, 0x20, 0x6d, 0x6f, 
+    0x73, 0x74, 0x20, 0x34, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 
+    0x0a, 0x60, 0x73, 0x74, 0x72, 0x65, 0x6e, 0x67, 0x74, 0x68, 
+    0x60, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x20, 0x77, 
+    0x69, 0x64, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x68, 
+    0x69, 0x67, 0x68, 0x65, 0x72, 0x2e, 0x20, 0x59, 0x6f, 0x75, 
+    0x20, 0x6d, 0x61, 0x79, 0x20, 0x74, 0x68, 0x69, 0x6e, 0x6b, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x65, 
+    0x66, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x62, 0x6f, 0x74, 
+    0x74, 0x6f, 0x6d, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 
+    0x73, 0x20, 0x61, 0x73, 0x20, 0x75, 0x6e, 0x63, 0x68, 0x61, 
+    0x6e, 0x67, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x4e, 0x65, 0x67, 
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x60, 0x73, 0x74, 0x72, 
+    0x65, 0x6e, 0x67, 0x74, 0x68, 0x60, 0x20, 0x76, 0x61, 0x6c, 
+    0x75, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x64, 
+    0x75, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 
+    0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x74, 0x68, 0x69, 0x63, 
+    0x6b, 0x6e, 0x65, 0x73, 0x73, 0x20, 0x61, 0x72, 0x65, 0x0a, 
+    0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x61, 
+    0x6c, 0x73, 0x6f, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 
+    0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x73, 0x74, 
+    0x72, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3a, 0x20, 0x66, 
+    0x6c, 0x6f, 0x61, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x48, 
+    0x6f, 0x77, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x69, 0x73, 0x20, 0x65, 0x6d, 0x62, 0x6f, 0x6c, 0x64, 0x65, 
+    0x6e, 0x65, 0x64, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 
+    0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x54, 0x68, 
+    0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x61, 0x6c, 0x67, 
+    0x6f, 0x72, 0x69, 0x74, 0x68, 0x6d, 0x20, 0x74, 0x6f, 0x20, 
+    0x69, 0x6e, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x20, 0x6f, 
+    0x72, 0x20, 0x64, 0x65, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x68, 0x69, 0x63, 0x6b, 
+    0x6e, 0x65, 0x73, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x0a, 0x64, 0x6f, 
+    0x65, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x63, 0x68, 0x61, 0x6e, 
+    0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 
+    0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x6f, 0x69, 
+    0x6e, 0x74, 0x73, 0x3b, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 
+    0x20, 0x63, 0x65, 0x72, 0x74, 0x61, 0x69, 0x6e, 0x0a, 0x73, 
+    0x69, 0x74, 0x75, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 
+    0x6c, 0x69, 0x6b, 0x65, 0x20, 0x61, 0x63, 0x75, 0x74, 0x65, 
+    0x20, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x73, 0x20, 0x6f, 0x72, 
+    0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 
+    0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 
+    0x6f, 0x6d, 0x65, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 0x68, 
+    0x61, 0x6e, 0x64, 0x6c, 0x65, 0x64, 0x0a, 0x69, 0x6e, 0x63, 
+    0x6f, 0x72, 0x72, 0x65, 0x63, 0x74, 0x6c, 0x79, 0x2e, 0x0a, 
+    0x0a, 0x49, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x6e, 0x65, 
+    0x65, 0x64, 0x20, 0xe2, 0x80, 0x98, 0x62, 0x65, 0x74, 0x74, 
+    0x65, 0x72, 0xe2, 0x80, 0x99, 0x20, 0x6d, 0x65, 0x74, 0x72, 
+    0x69, 0x63, 0x73, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 
+    0x20, 0x79, 0x6f, 0x75, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 
+    0x64, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x60, 0x4f, 0x75, 
+    0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x67, 0x65, 0x74, 0x5f, 
+    0x63, 0x62, 0x6f, 0x78, 0x60, 0x0a, 0x6f, 0x72, 0x20, 0x60, 
+    0x4f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x67, 0x65, 
+    0x74, 0x5f, 0x62, 0x62, 0x6f, 0x78, 0x60, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Outline_embolden_xy[413] = {
+    0x45, 0x6d, 0x62, 0x6f, 0x6c, 0x64, 0x65, 0x6e, 0x20, 0x61, 
+    0x6e, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x69, 0x66, 0x66, 
+    0x65, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x2a, 0x78, 0x2a, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x2a, 0x79, 0x2a, 0x20, 0x61, 0x6d, 
+    0x6f, 0x75, 0x6e, 0x74, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 
+    0x20, 0x6e, 0x65, 0x77, 0x0a, 0x6f, 0x75, 0x74, 0x6c, 0x69, 
+    0x6e, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 
+    0x20, 0x60, 0x78, 0x73, 0x74, 0x72, 0x65, 0x6e, 0x67, 0x74, 
+    0x68, 0x60, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x20, 
+    0x77, 0x69, 0x64, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x60, 0x79, 0x73, 0x74, 0x72, 0x65, 0x6e, 0x67, 0x74, 0x68, 
+    0x60, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x0a, 0x68, 
+    0x69, 0x67, 0x68, 0x65, 0x72, 0x2e, 0x20, 0x4f, 0x74, 0x68, 
+    0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2c, 0x20, 0x69, 0x74, 
+    0x20, 0x69, 0x73, 0x20, 0x73, 0x69, 0x6d, 0x69, 0x6c, 0x61, 
+    0x72, 0x20, 0x74, 0x6f, 0x20, 0x60, 0x4f, 0x75, 0x74, 0x6c, 
+    0x69, 0x6e, 0x65, 0x2e, 0x65, 0x6d, 0x62, 0x6f, 0x6c, 0x64, 
+    0x65, 0x6e, 0x60, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 
+    0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x0a, 
+    0x73, 0x61, 0x6d, 0x65, 0x20, 0x73, 0x74, 0x72, 0x65, 0x6e, 
+    0x67, 0x74, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x62, 0x6f, 0x74, 
+    0x68, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x73, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 
+    0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x78, 0x73, 0x74, 
+    0x72, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3a, 0x20, 0x66, 
+    0x6c, 0x6f, 0x61, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x48, 
+    0x6f, 0x77, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x69, 0x73, 0x20, 0x65, 0x6d, 0x62, 0x6f, 0x6c, 0x64, 0x65, 
+    0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x78, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 
+    0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x79, 0x73, 0x74, 0x72, 0x65, 
+    0x6e, 0x67, 0x74, 0x68, 0x20, 0x3a, 0x20, 0x66, 0x6c, 0x6f, 
+    0x61, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x48, 0x6f, 0x77, 
+    0x20, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x73, 
+    0x20, 0x65, 0x6d, 0x62, 0x6f, 0x6c, 0x64, 0x65, 0x6e, 0x65, 
+    0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x79, 
+    0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Outline_flags[137] = {
+    0x41, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x60, 
+    0x4f, 0x55, 0x54, 0x4c, 0x49, 0x4e, 0x45, 0x60, 0x20, 0x66, 
+    0x6c, 0x61, 0x67, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 
+    0x74, 0x6f, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x69, 0x7a, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x20, 0x20, 
+    0x47, 0x69, 0x76, 0x65, 0x73, 0x0a, 0x68, 0x69, 0x6e, 0x74, 
+    0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 
+    0x63, 0x61, 0x6e, 0x2d, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 
+    0x74, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x68, 0x69, 
+    0x6e, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x6e, 0x20, 0x68, 0x6f, 
+    0x77, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 
+    0x72, 0x74, 0x2f, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x66, 0x69, 
+    0x74, 0x20, 0x69, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Outline_get_bbox[715] = {
+    0x43, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x65, 0x78, 0x61, 0x63, 0x74, 0x20, 0x62, 0x6f, 
+    0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6f, 0x78, 
+    0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x20, 0x6f, 0x75, 0x74, 
+    0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x69, 
+    0x73, 0x20, 0x69, 0x73, 0x20, 0x73, 0x6c, 0x6f, 0x77, 0x65, 
+    0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x0a, 0x63, 0x6f, 0x6d, 
+    0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x62, 
+    0x6f, 0x78, 0x2e, 0x20, 0x20, 0x48, 0x6f, 0x77, 0x65, 0x76, 
+    0x65, 0x72, 0x2c, 0x20, 0x69, 0x74, 0x20, 0x75, 0x73, 0x65, 
+    0x73, 0x20, 0x61, 0x6e, 0x20, 0x61, 0x64, 0x76, 0x61, 0x6e, 
+    0x63, 0x65, 0x64, 0x20, 0x61, 0x6c, 0x67, 0x6f, 0x72, 0x69, 
+    0x74, 0x68, 0x6d, 0x0a, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x76, 0x65, 
+    0x72, 0x79, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x6c, 0x79, 
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x74, 0x77, 0x6f, 0x20, 0x62, 0x6f, 0x78, 0x65, 0x73, 0x20, 
+    0x63, 0x6f, 0x69, 0x6e, 0x63, 0x69, 0x64, 0x65, 0x2e, 0x20, 
+    0x20, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 
+    0x2c, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 
+    0x69, 0x6e, 0x65, 0x20, 0x42, 0xc3, 0xa9, 0x7a, 0x69, 0x65, 
+    0x72, 0x20, 0x61, 0x72, 0x63, 0x73, 0x20, 0x61, 0x72, 0x65, 
+    0x20, 0x74, 0x72, 0x61, 0x76, 0x65, 0x72, 0x73, 0x65, 0x64, 
+    0x20, 0x74, 0x6f, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 
+    0x74, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x65, 0x78, 
+    0x74, 0x72, 0x65, 0x6d, 0x61, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 
+    0x74, 0x75, 0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x0a, 0x62, 0x62, 0x6f, 0x78, 0x20, 0x3a, 
+    0x20, 0x42, 0x42, 0x6f, 0x78, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x27, 0x73, 0x20, 0x65, 0x78, 0x61, 0x63, 0x74, 0x20, 
+    0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 
+    0x6f, 0x78, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x49, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x69, 
+    0x73, 0x20, 0x74, 0x72, 0x69, 0x63, 0x6b, 0x79, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 
+    0x6e, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x20, 0x77, 
+    0x69, 0x74, 0x68, 0x0a, 0x60, 0x4c, 0x4f, 0x41, 0x44, 0x2e, 
+    0x4e, 0x4f, 0x5f, 0x53, 0x43, 0x41, 0x4c, 0x45, 0x60, 0x2c, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 
+    0x74, 0x69, 0x6e, 0x67, 0x20, 0x60, 0x42, 0x42, 0x6f, 0x78, 
+    0x60, 0x20, 0x69, 0x73, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x69, 
+    0x6e, 0x67, 0x6c, 0x65, 0x73, 0x73, 0x2e, 0x20, 0x54, 0x6f, 
+    0x20, 0x67, 0x65, 0x74, 0x0a, 0x72, 0x65, 0x61, 0x73, 0x6f, 
+    0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+    0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x60, 0x42, 0x42, 0x6f, 0x78, 0x60, 0x20, 0x69, 0x74, 
+    0x20, 0x69, 0x73, 0x20, 0x6e, 0x65, 0x63, 0x65, 0x73, 0x73, 
+    0x61, 0x72, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x6f, 0x61, 
+    0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x20, 0x61, 0x74, 0x0a, 0x61, 0x20, 0x6c, 0x61, 0x72, 
+    0x67, 0x65, 0x20, 0x70, 0x70, 0x65, 0x6d, 0x20, 0x76, 0x61, 
+    0x6c, 0x75, 0x65, 0x20, 0x28, 0x73, 0x6f, 0x20, 0x74, 0x68, 
+    0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x69, 0x6e, 
+    0x74, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x72, 
+    0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x63, 0x61, 
+    0x6e, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x6c, 0x79, 
+    0x0a, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x61, 0x6e, 0x64, 
+    0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x73, 0x75, 0x62, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 
+    0x29, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x65, 0x78, 
+    0x74, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x60, 0x42, 0x42, 0x6f, 0x78, 0x60, 0x20, 
+    0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x61, 0x6e, 0x0a, 
+    0x62, 0x65, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x75, 0x61, 
+    0x6c, 0x6c, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 
+    0x74, 0x65, 0x64, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x74, 
+    0x6f, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x75, 0x6e, 0x69, 
+    0x74, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Outline_get_cbox[501] = {
+    0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 
+    0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x62, 0x6f, 0x78, 0x2e, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 
+    0x6f, 0x6c, 0x20, 0x62, 0x6f, 0x78, 0x20, 0x65, 0x6e, 0x63, 
+    0x6c, 0x6f, 0x73, 0x65, 0x73, 0x20, 0x61, 0x6c, 0x6c, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 
+    0x65, 0x27, 0x73, 0x0a, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 
+    0x2c, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 
+    0x67, 0x20, 0x42, 0xc3, 0xa9, 0x7a, 0x69, 0x65, 0x72, 0x20, 
+    0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x70, 0x6f, 
+    0x69, 0x6e, 0x74, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x6f, 0x75, 
+    0x67, 0x68, 0x20, 0x69, 0x74, 0x20, 0x63, 0x6f, 0x69, 0x6e, 
+    0x63, 0x69, 0x64, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 
+    0x20, 0x74, 0x68, 0x65, 0x0a, 0x65, 0x78, 0x61, 0x63, 0x74, 
+    0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 
+    0x62, 0x6f, 0x78, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 
+    0x73, 0x74, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x2c, 
+    0x20, 0x69, 0x74, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 
+    0x20, 0x73, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x6c, 0x79, 0x20, 
+    0x6c, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 
+    0x73, 0x6f, 0x6d, 0x65, 0x0a, 0x73, 0x69, 0x74, 0x75, 0x61, 
+    0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x28, 0x6c, 0x69, 0x6b, 
+    0x65, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x72, 0x6f, 0x74, 
+    0x61, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x20, 0x6f, 
+    0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x77, 0x68, 0x69, 
+    0x63, 0x68, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 
+    0x73, 0x20, 0x42, 0xc3, 0xa9, 0x7a, 0x69, 0x65, 0x72, 0x0a, 
+    0x6f, 0x75, 0x74, 0x73, 0x69, 0x64, 0x65, 0x20, 0x61, 0x72, 
+    0x63, 0x73, 0x29, 0x2e, 0x0a, 0x0a, 0x43, 0x6f, 0x6d, 0x70, 
+    0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x62, 0x6f, 
+    0x78, 0x20, 0x69, 0x73, 0x20, 0x76, 0x65, 0x72, 0x79, 0x20, 
+    0x66, 0x61, 0x73, 0x74, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x6c, 
+    0x65, 0x20, 0x67, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 
+    0x6e, 0x67, 0x20, 0x62, 0x6f, 0x78, 0x0a, 0x63, 0x61, 0x6e, 
+    0x20, 0x74, 0x61, 0x6b, 0x65, 0x20, 0x6d, 0x75, 0x63, 0x68, 
+    0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 
+    0x20, 0x61, 0x73, 0x20, 0x69, 0x74, 0x20, 0x6e, 0x65, 0x65, 
+    0x64, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x77, 0x61, 0x6c, 0x6b, 
+    0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x61, 0x6c, 0x6c, 0x20, 
+    0x73, 0x65, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x61, 0x72, 0x63, 0x73, 0x0a, 0x69, 0x6e, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 
+    0x6e, 0x65, 0x2e, 0x0a, 0x0a, 0x53, 0x65, 0x65, 0x20, 0x60, 
+    0x47, 0x6c, 0x79, 0x70, 0x68, 0x2e, 0x67, 0x65, 0x74, 0x5f, 
+    0x63, 0x62, 0x6f, 0x78, 0x60, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+    0x61, 0x20, 0x64, 0x69, 0x73, 0x63, 0x75, 0x73, 0x73, 0x69, 
+    0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x72, 0x69, 0x63, 
+    0x6b, 0x79, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_Outline_get_orientation[316] = {
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 
+    0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x61, 0x6c, 0x79, 0x7a, 
+    0x65, 0x73, 0x20, 0x61, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x74, 
+    0x6f, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x20, 
+    0x69, 0x74, 0x73, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x0a, 0x6f, 
+    0x72, 0x69, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 
+    0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 
+    0x64, 0x6f, 0x6e, 0x65, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6f, 
+    0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 
+    0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x0a, 0x68, 0x6f, 0x72, 
+    0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x61, 0x6e, 
+    0x64, 0x2f, 0x6f, 0x72, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 
+    0x63, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x74, 0x72, 0x65, 0x6d, 
+    0x61, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 
+    0x2e, 0x0a, 0x0a, 0x53, 0x65, 0x65, 0x20, 0x60, 0x4f, 0x52, 
+    0x49, 0x45, 0x4e, 0x54, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x60, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x6c, 0x69, 0x73, 
+    0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 
+    0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+    0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x77, 0x69, 0x6c, 0x6c, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6e, 0x20, 0x60, 0x4f, 0x52, 0x49, 0x45, 0x4e, 0x54, 0x41, 
+    0x54, 0x49, 0x4f, 0x4e, 0x2e, 0x54, 0x52, 0x55, 0x45, 0x54, 
+    0x59, 0x50, 0x45, 0x60, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 
+    0x6d, 0x70, 0x74, 0x79, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 
+    0x6e, 0x65, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Outline_n_contours[40] = {
+    0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 
+    0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x6f, 0x75, 
+    0x72, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Outline_n_points[38] = {
+    0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 
+    0x20, 0x6f, 0x66, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 
+    0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 
+    0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Outline_points[73] = {
+    0x41, 0x20, 0x60, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x76, 
+    0x69, 0x65, 0x77, 0x60, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x6f, 
+    0x69, 0x6e, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 
+    0x20, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x65, 0x6e, 0x74, 
+    0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x28, 
+    0x78, 0x2c, 0x20, 0x79, 0x29, 0x0a, 0x70, 0x61, 0x69, 0x72, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Outline_reverse[297] = {
+    0x52, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x64, 0x72, 0x61, 0x77, 0x69, 0x6e, 0x67, 0x20, 
+    0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+    0x6f, 0x66, 0x20, 0x61, 0x6e, 0x20, 0x6f, 0x75, 0x74, 0x6c, 
+    0x69, 0x6e, 0x65, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 
+    0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 
+    0x6f, 0x20, 0x65, 0x6e, 0x73, 0x75, 0x72, 0x65, 0x0a, 0x63, 
+    0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x74, 0x20, 
+    0x66, 0x69, 0x6c, 0x6c, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 
+    0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x6d, 0x69, 0x72, 0x72, 0x6f, 0x72, 0x65, 0x64, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x2e, 0x0a, 0x0a, 0x4e, 
+    0x6f, 0x74, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x0a, 0x54, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 
+    0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x4f, 0x55, 0x54, 
+    0x4c, 0x49, 0x4e, 0x45, 0x2e, 0x52, 0x45, 0x56, 0x45, 0x52, 
+    0x53, 0x45, 0x5f, 0x46, 0x49, 0x4c, 0x4c, 0x60, 0x20, 0x62, 
+    0x69, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x69, 0x6e, 
+    0x0a, 0x60, 0x4f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 
+    0x66, 0x6c, 0x61, 0x67, 0x73, 0x60, 0x2e, 0x0a, 0x0a, 0x49, 
+    0x74, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x6e, 0x27, 
+    0x74, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 
+    0x62, 0x79, 0x20, 0x61, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 
+    0x6c, 0x20, 0x63, 0x6c, 0x69, 0x65, 0x6e, 0x74, 0x20, 0x61, 
+    0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 
+    0x2c, 0x20, 0x75, 0x6e, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x69, 
+    0x74, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x73, 0x0a, 0x77, 0x68, 
+    0x61, 0x74, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x64, 
+    0x6f, 0x69, 0x6e, 0x67, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Outline_tags[573] = {
+    0x41, 0x20, 0x60, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x76, 
+    0x69, 0x65, 0x77, 0x60, 0x20, 0x6f, 0x66, 0x20, 0x60, 0x6e, 
+    0x5f, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x60, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x73, 0x2c, 0x20, 0x67, 0x69, 0x76, 
+    0x69, 0x6e, 0x67, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6f, 
+    0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x70, 0x6f, 0x69, 
+    0x6e, 0x74, 0x27, 0x73, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2e, 
+    0x0a, 0x0a, 0x2d, 0x20, 0x49, 0x66, 0x20, 0x62, 0x69, 0x74, 
+    0x20, 0x30, 0x20, 0x69, 0x73, 0x20, 0x75, 0x6e, 0x73, 0x65, 
+    0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x69, 
+    0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 0xe2, 0x80, 0x98, 0x6f, 
+    0x66, 0x66, 0xe2, 0x80, 0x99, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x63, 0x75, 0x72, 0x76, 0x65, 0x2c, 0x20, 0x69, 0x2e, 0x65, 
+    0x2e, 0x2c, 0x20, 0x61, 0x20, 0x42, 0xc3, 0xa9, 0x7a, 0x69, 
+    0x65, 0x72, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 
+    0x6f, 0x6c, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2c, 0x20, 
+    0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x69, 0x74, 0x20, 0x69, 
+    0x73, 0x20, 0xe2, 0x80, 0x98, 0x6f, 0x6e, 0xe2, 0x80, 0x99, 
+    0x20, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x42, 0x69, 0x74, 0x20, 0x31, 0x20, 0x69, 0x73, 
+    0x20, 0x6d, 0x65, 0x61, 0x6e, 0x69, 0x6e, 0x67, 0x66, 0x75, 
+    0x6c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0xe2, 0x80, 0x98, 0x6f, 
+    0x66, 0x66, 0xe2, 0x80, 0x99, 0x20, 0x70, 0x6f, 0x69, 0x6e, 
+    0x74, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x2e, 0x20, 0x49, 
+    0x66, 0x20, 0x73, 0x65, 0x74, 0x2c, 0x20, 0x69, 0x74, 0x20, 
+    0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 
+    0x61, 0x0a, 0x20, 0x20, 0x74, 0x68, 0x69, 0x72, 0x64, 0x2d, 
+    0x6f, 0x72, 0x64, 0x65, 0x72, 0x20, 0x42, 0xc3, 0xa9, 0x7a, 
+    0x69, 0x65, 0x72, 0x20, 0x61, 0x72, 0x63, 0x20, 0x63, 0x6f, 
+    0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x70, 0x6f, 0x69, 0x6e, 
+    0x74, 0x3b, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x20, 0x73, 
+    0x65, 0x63, 0x6f, 0x6e, 0x64, 0x2d, 0x6f, 0x72, 0x64, 0x65, 
+    0x72, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x0a, 
+    0x20, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x66, 
+    0x20, 0x75, 0x6e, 0x73, 0x65, 0x74, 0x2e, 0x0a, 0x0a, 0x2d, 
+    0x20, 0x49, 0x66, 0x20, 0x62, 0x69, 0x74, 0x20, 0x32, 0x20, 
+    0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x2c, 0x20, 0x62, 0x69, 
+    0x74, 0x73, 0x20, 0x35, 0x2d, 0x37, 0x20, 0x63, 0x6f, 0x6e, 
+    0x74, 0x61, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 
+    0x72, 0x6f, 0x70, 0x2d, 0x6f, 0x75, 0x74, 0x20, 0x6d, 0x6f, 
+    0x64, 0x65, 0x20, 0x28, 0x61, 0x73, 0x20, 0x64, 0x65, 0x66, 
+    0x69, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x0a, 0x20, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x54, 0x79, 
+    0x70, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x69, 0x73, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 
+    0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 
+    0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x0a, 0x20, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x53, 0x43, 0x41, 0x4e, 
+    0x4d, 0x4f, 0x44, 0x45, 0x60, 0x20, 0x69, 0x6e, 0x73, 0x74, 
+    0x72, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x2e, 0x0a, 
+    0x0a, 0x2d, 0x20, 0x42, 0x69, 0x74, 0x73, 0x20, 0x33, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x34, 0x20, 0x61, 0x72, 0x65, 0x20, 
+    0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 
+    0x6c, 0x20, 0x70, 0x75, 0x72, 0x70, 0x6f, 0x73, 0x65, 0x73, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_Outline_to_points_and_codes[334] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 
+    0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x70, 0x61, 0x69, 0x72, 
+    0x20, 0x6f, 0x66, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 
+    0x20, 0x28, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x2c, 0x20, 
+    0x63, 0x6f, 0x64, 0x65, 0x73, 0x29, 0x2e, 0x0a, 0x0a, 0x2d, 
+    0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x69, 0x73, 
+    0x20, 0x61, 0x6e, 0x20, 0x4e, 0x78, 0x32, 0x20, 0x61, 0x72, 
+    0x72, 0x61, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x6c, 0x6f, 
+    0x61, 0x74, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x61, 
+    0x63, 0x68, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x0a, 0x2d, 
+    0x20, 0x63, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 
+    0x61, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x4e, 
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6f, 0x66, 0x20, 
+    0x60, 0x43, 0x4f, 0x44, 0x45, 0x53, 0x60, 0x20, 0x63, 0x6f, 
+    0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x3a, 0x0a, 0x0a, 
+    0x20, 0x20, 0x2d, 0x20, 0x30, 0x3a, 0x20, 0x60, 0x4d, 0x4f, 
+    0x56, 0x45, 0x54, 0x4f, 0x60, 0x20, 0x28, 0x31, 0x20, 0x70, 
+    0x6f, 0x69, 0x6e, 0x74, 0x29, 0x0a, 0x20, 0x20, 0x2d, 0x20, 
+    0x31, 0x3a, 0x20, 0x60, 0x4c, 0x49, 0x4e, 0x45, 0x54, 0x4f, 
+    0x60, 0x20, 0x28, 0x31, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 
+    0x29, 0x0a, 0x20, 0x20, 0x2d, 0x20, 0x32, 0x3a, 0x20, 0x60, 
+    0x43, 0x55, 0x42, 0x49, 0x43, 0x60, 0x20, 0x28, 0x32, 0x20, 
+    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x29, 0x0a, 0x20, 0x20, 
+    0x2d, 0x20, 0x33, 0x3a, 0x20, 0x60, 0x43, 0x4f, 0x4e, 0x49, 
+    0x43, 0x60, 0x20, 0x28, 0x33, 0x20, 0x70, 0x6f, 0x69, 0x6e, 
+    0x74, 0x73, 0x29, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 0x72, 
+    0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x0a, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x20, 0x3a, 0x20, 
+    0x74, 0x75, 0x70, 0x6c, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x41, 0x20, 0x28, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x2c, 
+    0x20, 0x63, 0x6f, 0x64, 0x65, 0x73, 0x29, 0x20, 0x70, 0x61, 
+    0x69, 0x72, 0x0a, 0x00, 
+};
+
+char doc_Outline_to_string[988] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 
+    0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x74, 0x65, 0x78, 0x74, 
+    0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x20, 0x73, 0x74, 
+    0x72, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 
+    0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x73, 0x2e, 0x0a, 0x54, 0x68, 
+    0x69, 0x73, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x20, 0x69, 0x73, 0x20, 0x66, 0x6c, 0x65, 0x78, 0x69, 
+    0x62, 0x6c, 0x65, 0x20, 0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 
+    0x20, 0x74, 0x6f, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 
+    0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 
+    0x61, 0x6e, 0x64, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x50, 
+    0x44, 0x46, 0x2c, 0x0a, 0x50, 0x6f, 0x73, 0x74, 0x63, 0x72, 
+    0x69, 0x70, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x53, 0x56, 
+    0x47, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 
+    0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x6d, 0x6f, 0x76, 0x65, 
+    0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x3a, 
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x72, 0x20, 0x63, 0x6f, 
+    0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x75, 
+    0x73, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x22, 0x6d, 0x6f, 
+    0x76, 0x65, 0x20, 0x74, 0x6f, 0x22, 0x20, 0x63, 0x6f, 0x6d, 
+    0x6d, 0x61, 0x6e, 0x64, 0x73, 0x2e, 0x0a, 0x0a, 0x6c, 0x69, 
+    0x6e, 0x65, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 
+    0x20, 0x3a, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x72, 0x20, 
+    0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 
+    0x20, 0x75, 0x73, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x22, 
+    0x6c, 0x69, 0x6e, 0x65, 0x20, 0x74, 0x6f, 0x22, 0x20, 0x63, 
+    0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x73, 0x2e, 0x0a, 0x0a, 
+    0x63, 0x75, 0x62, 0x69, 0x63, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 
+    0x61, 0x6e, 0x64, 0x20, 0x3a, 0x20, 0x62, 0x79, 0x74, 0x65, 
+    0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 
+    0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 
+    0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x22, 0x63, 0x75, 0x62, 0x69, 0x63, 0x20, 0x63, 
+    0x75, 0x72, 0x76, 0x65, 0x22, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 
+    0x61, 0x6e, 0x64, 0x73, 0x2e, 0x0a, 0x0a, 0x63, 0x6f, 0x6e, 
+    0x69, 0x63, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 
+    0x20, 0x3a, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x2c, 0x20, 
+    0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x72, 0x20, 
+    0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 
+    0x20, 0x75, 0x73, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x22, 
+    0x63, 0x6f, 0x6e, 0x69, 0x63, 0x20, 0x63, 0x75, 0x72, 0x76, 
+    0x65, 0x22, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 
+    0x73, 0x2e, 0x20, 0x20, 0x49, 0x66, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x6f, 0x6e, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 
+    0x74, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 
+    0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x69, 0x63, 0x20, 0x63, 0x75, 
+    0x72, 0x76, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 
+    0x62, 0x65, 0x20, 0x69, 0x6d, 0x70, 0x6c, 0x69, 0x63, 0x69, 
+    0x74, 0x6c, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 
+    0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x63, 0x75, 0x62, 0x69, 0x63, 0x20, 0x63, 0x75, 0x72, 
+    0x76, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x72, 0x65, 0x6c, 0x61, 
+    0x74, 0x69, 0x76, 0x65, 0x20, 0x3a, 0x20, 0x62, 0x6f, 0x6f, 
+    0x6c, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 
+    0x6c, 0x0a, 0x0a, 0x0a, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 
+    0x20, 0x3a, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x2c, 0x20, 0x6f, 
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x49, 0x66, 0x20, 0x60, 0x54, 0x72, 0x75, 0x65, 
+    0x60, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 
+    0x6d, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 
+    0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x20, 0x62, 0x65, 0x66, 
+    0x6f, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6f, 
+    0x69, 0x6e, 0x74, 0x73, 0x20, 0x69, 0x74, 0x20, 0x72, 0x65, 
+    0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x2e, 0x0a, 0x20, 
+    0x20, 0x20, 0x20, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 
+    0x73, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 
+    0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x73, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x74, 0x6f, 
+    0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x20, 0x61, 0x66, 
+    0x74, 0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 
+    0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x3a, 
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 
+    0x20, 0x41, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x62, 0x61, 
+    0x73, 0x65, 0x64, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+    0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 
+    0x64, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x6e, 0x64, 
+    0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x45, 
+    0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x0a, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x54, 0x6f, 0x20, 
+    0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x61, 
+    0x20, 0x50, 0x44, 0x46, 0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 
+    0x74, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 
+    0x3a, 0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x75, 
+    0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x74, 0x6f, 0x5f, 0x73, 
+    0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x22, 0x20, 0x6d, 0x20, 
+    0x22, 0x2c, 0x20, 0x22, 0x20, 0x6c, 0x20, 0x22, 0x2c, 0x20, 
+    0x22, 0x20, 0x63, 0x20, 0x22, 0x29, 0x0a, 0x00, 
+};
+
+char doc_Outline_transform[248] = {
+    0x41, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x61, 0x20, 0x73, 0x69, 
+    0x6d, 0x70, 0x6c, 0x65, 0x20, 0x32, 0x78, 0x32, 0x20, 0x6d, 
+    0x61, 0x74, 0x72, 0x69, 0x78, 0x20, 0x74, 0x6f, 0x20, 0x61, 
+    0x6c, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x20, 0x6f, 
+    0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x27, 0x73, 0x20, 0x70, 
+    0x6f, 0x69, 0x6e, 0x74, 0x73, 0x2e, 0x20, 0x55, 0x73, 0x65, 
+    0x66, 0x75, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x0a, 0x61, 0x70, 
+    0x70, 0x6c, 0x79, 0x69, 0x6e, 0x67, 0x20, 0x72, 0x6f, 0x74, 
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x73, 0x6c, 
+    0x61, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x66, 0x6c, 
+    0x69, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x65, 0x74, 
+    0x63, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 
+    0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x6d, 0x61, 0x74, 0x72, 
+    0x69, 0x78, 0x20, 0x3a, 0x20, 0x32, 0x78, 0x32, 0x20, 0x73, 
+    0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x6f, 0x66, 
+    0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x73, 0x2c, 0x20, 0x6f, 
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x20, 0x20, 
+    0x20, 0x20, 0x41, 0x20, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 
+    0x72, 0x6d, 0x3a, 0x3a, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x2e, 0x20, 0x5b, 0x5b, 0x78, 0x78, 
+    0x2c, 0x20, 0x78, 0x79, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x2e, 0x20, 0x20, 0x5b, 0x79, 0x78, 
+    0x2c, 0x20, 0x79, 0x79, 0x5d, 0x5d, 0x0a, 0x00, 
+};
+
+char doc_Outline_translate[161] = {
+    0x41, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x61, 0x20, 0x73, 0x69, 
+    0x6d, 0x70, 0x6c, 0x65, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 
+    0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 
+    0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x20, 0x6f, 0x75, 0x74, 
+    0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x0a, 0x0a, 0x50, 0x61, 0x72, 
+    0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2d, 0x2d, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x78, 
+    0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3a, 0x20, 0x69, 
+    0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 
+    0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 
+    0x6c, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2e, 0x0a, 
+    0x0a, 0x79, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3a, 
+    0x20, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 
+    0x6c, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2e, 0x0a, 
+    0x00, 
+};
+
@@ -0,0 +1,36 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/outline.py.
+*/
+
+#ifndef __DOC_OUTLINE_H__
+#define __DOC_OUTLINE_H__
+extern char doc_CODES[147];
+extern char doc_ORIENTATION[832];
+extern char doc_OUTLINE[2407];
+extern char doc_Outline__init__[24];
+extern char doc_Outline_check[96];
+extern char doc_Outline_codes[178];
+extern char doc_Outline_contours[373];
+extern char doc_Outline_decompose[2034];
+extern char doc_Outline_decomposed_points[84];
+extern char doc_Outline_embolden[640];
+extern char doc_Outline_embolden_xy[413];
+extern char doc_Outline_flags[137];
+extern char doc_Outline_get_bbox[715];
+extern char doc_Outline_get_cbox[501];
+extern char doc_Outline_get_orientation[316];
+extern char doc_Outline_n_contours[40];
+extern char doc_Outline_n_points[38];
+extern char doc_Outline_points[73];
+extern char doc_Outline_reverse[297];
+extern char doc_Outline_tags[573];
+extern char doc_Outline_to_points_and_codes[334];
+extern char doc_Outline_to_string[988];
+extern char doc_Outline_transform[248];
+extern char doc_Outline_translate[161];
+
+#endif
+
@@ -0,0 +1,18 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/paragraph_layout.py.
+*/
+
+#ifndef __DOC_PARAGRAPH_LAYOUT_H__
+#define __DOC_PARAGRAPH_LAYOUT_H__
+extern char doc_ParagraphLayout__init__[884];
+extern char doc_ParagraphLayout_draw[449];
+extern char doc_ParagraphLayout_ink_bbox[170];
+extern char doc_ParagraphLayout_layout[274];
+extern char doc_ParagraphLayout_layout_bbox[174];
+extern char doc_ParagraphLayout_lines[482];
+
+#endif
+
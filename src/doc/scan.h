@@ -0,0 +1,13 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/scan.py.
+*/
+
+#ifndef __DOC_SCAN_H__
+#define __DOC_SCAN_H__
+extern char doc_scan_fonts[1968];
+
+#endif
+
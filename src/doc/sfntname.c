@@ -0,0 +1,125 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/sfntname.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "sfntname.h"
+
+char doc_SfntName__init__[33] = {
+    0x41, 0x6e, 0x20, 0x53, 0x46, 0x4e, 0x54, 0x20, 0xe2, 0x80, 
+    0x98, 0x6e, 0x61, 0x6d, 0x65, 0xe2, 0x80, 0x99, 0x20, 0x74, 
+    0x61, 0x62, 0x6c, 0x65, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_SfntName_encoding_id[167] = {
+    0x54, 0x68, 0x65, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 
+    0x6e, 0x67, 0x20, 0x49, 0x44, 0x2e, 0x0a, 0x0a, 0x44, 0x65, 
+    0x70, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x6e, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+    0x20, 0x6f, 0x66, 0x20, 0x60, 0x70, 0x6c, 0x61, 0x74, 0x66, 
+    0x6f, 0x72, 0x6d, 0x5f, 0x69, 0x64, 0x60, 0x2c, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 
+    0x65, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 
+    0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x60, 0x54, 0x54, 0x5f, 
+    0x41, 0x50, 0x50, 0x4c, 0x45, 0x5f, 0x49, 0x44, 0x60, 0x2c, 
+    0x20, 0x60, 0x54, 0x54, 0x5f, 0x4d, 0x41, 0x43, 0x5f, 0x49, 
+    0x44, 0x60, 0x2c, 0x20, 0x60, 0x54, 0x54, 0x5f, 0x49, 0x53, 
+    0x4f, 0x5f, 0x49, 0x44, 0x60, 0x2c, 0x20, 0x60, 0x54, 0x54, 
+    0x5f, 0x4d, 0x53, 0x5f, 0x49, 0x44, 0x60, 0x20, 0x6f, 0x72, 
+    0x0a, 0x60, 0x54, 0x54, 0x5f, 0x41, 0x44, 0x4f, 0x42, 0x45, 
+    0x5f, 0x49, 0x44, 0x60, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_SfntName_language_id[132] = {
+    0x54, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 
+    0x67, 0x65, 0x20, 0x49, 0x44, 0x2e, 0x0a, 0x0a, 0x44, 0x65, 
+    0x70, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x6e, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+    0x20, 0x6f, 0x66, 0x20, 0x60, 0x70, 0x6c, 0x61, 0x74, 0x66, 
+    0x6f, 0x72, 0x6d, 0x5f, 0x69, 0x64, 0x60, 0x2c, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 
+    0x65, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 
+    0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x60, 0x54, 0x54, 0x5f, 
+    0x4d, 0x41, 0x43, 0x5f, 0x4c, 0x41, 0x4e, 0x47, 0x49, 0x44, 
+    0x60, 0x20, 0x6f, 0x72, 0x20, 0x60, 0x54, 0x54, 0x5f, 0x4d, 
+    0x53, 0x5f, 0x4c, 0x41, 0x4e, 0x47, 0x49, 0x44, 0x60, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_SfntName_name_id[82] = {
+    0x54, 0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6f, 
+    0x66, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x73, 0x74, 
+    0x6f, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x60, 0x73, 
+    0x74, 0x72, 0x69, 0x6e, 0x67, 0x60, 0x2e, 0x20, 0x20, 0x53, 
+    0x65, 0x65, 0x20, 0x60, 0x54, 0x54, 0x5f, 0x4e, 0x41, 0x4d, 
+    0x45, 0x5f, 0x49, 0x44, 0x60, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+    0x74, 0x68, 0x65, 0x0a, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 
+    0x6c, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_SfntName_platform_id[41] = {
+    0x54, 0x68, 0x65, 0x20, 0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 
+    0x72, 0x6d, 0x20, 0x49, 0x44, 0x2e, 0x20, 0x20, 0x4f, 0x6e, 
+    0x65, 0x20, 0x6f, 0x66, 0x20, 0x60, 0x54, 0x54, 0x5f, 0x50, 
+    0x4c, 0x41, 0x54, 0x46, 0x4f, 0x52, 0x4d, 0x60, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_SfntName_string[228] = {
+    0x54, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x53, 0x66, 
+    0x6e, 0x74, 0x4e, 0x61, 0x6d, 0x65, 0x60, 0x20, 0x65, 0x6e, 
+    0x74, 0x72, 0x79, 0x2e, 0x0a, 0x0a, 0x7c, 0x66, 0x72, 0x65, 
+    0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 0x3a, 0x20, 0x55, 0x6e, 
+    0x6c, 0x69, 0x6b, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 
+    0x61, 0x77, 0x20, 0x43, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 
+    0x66, 0x61, 0x63, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 
+    0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x64, 0x65, 0x63, 
+    0x6f, 0x64, 0x65, 0x64, 0x0a, 0x69, 0x6e, 0x74, 0x6f, 0x20, 
+    0x61, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x20, 
+    0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x73, 0x6f, 
+    0x20, 0x75, 0x73, 0x65, 0x72, 0x73, 0x20, 0x64, 0x6f, 0x20, 
+    0x6e, 0x6f, 0x74, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x20, 0x74, 
+    0x6f, 0x20, 0x77, 0x6f, 0x72, 0x72, 0x79, 0x20, 0x61, 0x62, 
+    0x6f, 0x75, 0x74, 0x20, 0x69, 0x74, 0x73, 0x0a, 0x65, 0x6e, 
+    0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x20, 0x54, 
+    0x6f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x75, 0x6e, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x20, 
+    0x62, 0x79, 0x74, 0x65, 0x73, 0x2c, 0x20, 0x75, 0x73, 0x65, 
+    0x20, 0x60, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x62, 
+    0x79, 0x74, 0x65, 0x73, 0x60, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_SfntName_string_bytes[188] = {
+    0x54, 0x68, 0x65, 0x20, 0x72, 0x61, 0x77, 0x20, 0x75, 0x6e, 
+    0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x20, 0x62, 0x79, 
+    0x74, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x60, 0x53, 0x66, 0x6e, 0x74, 0x4e, 
+    0x61, 0x6d, 0x65, 0x60, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 
+    0x2e, 0x0a, 0x0a, 0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 
+    0x70, 0x79, 0x7c, 0x3a, 0x20, 0x4d, 0x6f, 0x73, 0x74, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x69, 0x6d, 
+    0x65, 0x2c, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x77, 0x69, 0x6c, 
+    0x6c, 0x20, 0x77, 0x61, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 
+    0x75, 0x73, 0x65, 0x20, 0x60, 0x73, 0x74, 0x72, 0x69, 0x6e, 
+    0x67, 0x60, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 
+    0x2c, 0x0a, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61, 0x75, 
+    0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6c, 
+    0x79, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x73, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x69, 
+    0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x62, 0x79, 0x74, 0x65, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
@@ -0,0 +1,19 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/sfntname.py.
+*/
+
+#ifndef __DOC_SFNTNAME_H__
+#define __DOC_SFNTNAME_H__
+extern char doc_SfntName__init__[33];
+extern char doc_SfntName_encoding_id[167];
+extern char doc_SfntName_language_id[132];
+extern char doc_SfntName_name_id[82];
+extern char doc_SfntName_platform_id[41];
+extern char doc_SfntName_string[228];
+extern char doc_SfntName_string_bytes[188];
+
+#endif
+
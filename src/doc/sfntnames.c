@@ -0,0 +1,66 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/sfntnames.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "sfntnames.h"
+
+char doc_SfntNames__init__[39] = {
+    0x41, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 
+    0x20, 0x6f, 0x66, 0x20, 0x53, 0x46, 0x4e, 0x54, 0x20, 0x6e, 
+    0x61, 0x6d, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 
+    0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_SfntNames_get_name[423] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 
+    0x65, 0x73, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 
+    0x62, 0x6c, 0x65, 0x20, 0x53, 0x46, 0x4e, 0x54, 0x20, 0x6e, 
+    0x61, 0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x67, 
+    0x69, 0x76, 0x65, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2e, 
+    0x0a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x73, 0x65, 0x61, 
+    0x72, 0x63, 0x68, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x53, 0x46, 0x4e, 0x54, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 
+    0x20, 0x74, 0x6f, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 
+    0x66, 0x69, 0x6e, 0x64, 0x20, 0x61, 0x20, 0x55, 0x6e, 0x69, 
+    0x63, 0x6f, 0x64, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 
+    0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 
+    0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x61, 
+    0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x2c, 0x20, 
+    0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 
+    0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x67, 0x69, 
+    0x76, 0x65, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x20, 
+    0x20, 0x52, 0x61, 0x69, 0x73, 0x65, 0x73, 0x20, 0x60, 0x4b, 
+    0x65, 0x79, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x60, 0x20, 0x69, 
+    0x66, 0x20, 0x6e, 0x6f, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 
+    0x65, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x77, 0x61, 
+    0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x2e, 0x0a, 0x0a, 
+    0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 
+    0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3a, 0x20, 0x69, 
+    0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x41, 0x20, 0x60, 
+    0x54, 0x54, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x5f, 0x49, 0x44, 
+    0x60, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 
+    0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6e, 
+    0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 
+    0x20, 0x6f, 0x66, 0x20, 0x53, 0x46, 0x4e, 0x54, 0x20, 0x6e, 
+    0x61, 0x6d, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6e, 0x2e, 0x0a, 0x0a, 0x52, 0x65, 0x74, 0x75, 
+    0x72, 0x6e, 0x73, 0x0a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+    0x2d, 0x0a, 0x73, 0x66, 0x6e, 0x74, 0x5f, 0x6e, 0x61, 0x6d, 
+    0x65, 0x20, 0x3a, 0x20, 0x60, 0x53, 0x66, 0x6e, 0x74, 0x4e, 
+    0x61, 0x6d, 0x65, 0x60, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 
+    0x74, 0x0a, 0x00, 
+};
+
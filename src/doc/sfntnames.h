@@ -0,0 +1,14 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/sfntnames.py.
+*/
+
+#ifndef __DOC_SFNTNAMES_H__
+#define __DOC_SFNTNAMES_H__
+extern char doc_SfntNames__init__[39];
+extern char doc_SfntNames_get_name[423];
+
+#endif
+
@@ -0,0 +1,34 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/size.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "size.h"
+
+char doc_Size__init__[34] = {
+    0x41, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x20, 0x6f, 
+    0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x61, 0x74, 0x20, 0x61, 
+    0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x73, 0x69, 0x7a, 
+    0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Size_face[27] = {
+    0x54, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 
+    0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x20, 0x6f, 0x62, 
+    0x6a, 0x65, 0x63, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Size_metrics[48] = {
+    0x4d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x20, 0x28, 0x60, 
+    0x53, 0x69, 0x7a, 0x65, 0x5f, 0x4d, 0x65, 0x74, 0x72, 0x69, 
+    0x63, 0x73, 0x60, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 
+    0x62, 0x6a, 0x65, 0x63, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
@@ -0,0 +1,15 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/size.py.
+*/
+
+#ifndef __DOC_SIZE_H__
+#define __DOC_SIZE_H__
+extern char doc_Size__init__[34];
+extern char doc_Size_face[27];
+extern char doc_Size_metrics[48];
+
+#endif
+
@@ -0,0 +1,175 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/size_metrics.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "size_metrics.h"
+
+char doc_Size_Metrics__init__[674] = {
+    0x54, 0x68, 0x65, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 
+    0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x73, 0x69, 0x7a, 
+    0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2e, 0x0a, 
+    0x0a, 0x54, 0x68, 0x65, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x69, 
+    0x6e, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x2c, 
+    0x20, 0x69, 0x66, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x76, 0x61, 
+    0x6e, 0x74, 0x2c, 0x20, 0x61, 0x72, 0x65, 0x20, 0x64, 0x65, 
+    0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x66, 
+    0x69, 0x72, 0x73, 0x74, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6e, 
+    0x67, 0x20, 0x61, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x0a, 0x63, 
+    0x68, 0x61, 0x6e, 0x67, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x70, 
+    0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x69, 
+    0x6e, 0x67, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x73, 0x20, 
+    0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x73, 
+    0x65, 0x74, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x0a, 
+    0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x2e, 0x20, 0x46, 0x6f, 
+    0x72, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x61, 0x62, 0x6c, 0x65, 
+    0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x2c, 0x20, 
+    0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 
+    0x73, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x73, 0x65, 0x74, 
+    0x20, 0x74, 0x6f, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x64, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x6f, 0x66, 
+    0x0a, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 
+    0x73, 0x70, 0x6f, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x66, 
+    0x69, 0x65, 0x6c, 0x64, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x60, 
+    0x46, 0x61, 0x63, 0x65, 0x60, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 
+    0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 0x75, 
+    0x65, 0x20, 0x74, 0x6f, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x68, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x2c, 0x20, 
+    0x74, 0x68, 0x65, 0x73, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+    0x65, 0x73, 0x20, 0x6d, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6e, 
+    0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x65, 0x78, 0x61, 0x63, 
+    0x74, 0x20, 0x66, 0x6f, 0x72, 0x0a, 0x63, 0x65, 0x72, 0x74, 
+    0x61, 0x69, 0x6e, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2e, 
+    0x20, 0x54, 0x68, 0x75, 0x73, 0x20, 0x74, 0x68, 0x65, 0x79, 
+    0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x74, 
+    0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 
+    0x75, 0x6e, 0x72, 0x65, 0x6c, 0x69, 0x61, 0x62, 0x6c, 0x65, 
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x6e, 0x20, 0x65, 
+    0x72, 0x72, 0x6f, 0x72, 0x0a, 0x6d, 0x61, 0x72, 0x67, 0x69, 
+    0x6e, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x74, 0x20, 0x6c, 0x65, 
+    0x61, 0x73, 0x74, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x70, 0x69, 
+    0x78, 0x65, 0x6c, 0x21, 0x0a, 0x0a, 0x49, 0x6e, 0x64, 0x65, 
+    0x65, 0x64, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x6e, 
+    0x6c, 0x79, 0x20, 0x77, 0x61, 0x79, 0x20, 0x74, 0x6f, 0x20, 
+    0x67, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 
+    0x61, 0x63, 0x74, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 
+    0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 
+    0x6e, 0x64, 0x65, 0x72, 0x20, 0x61, 0x6c, 0x6c, 0x0a, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x73, 0x2e, 0x20, 0x41, 0x73, 0x20, 
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x77, 0x6f, 0x75, 0x6c, 0x64, 
+    0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x64, 0x65, 0x66, 0x69, 
+    0x6e, 0x69, 0x74, 0x65, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x68, 0x69, 0x74, 
+    0x2c, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x75, 0x70, 
+    0x20, 0x74, 0x6f, 0x0a, 0x63, 0x6c, 0x69, 0x65, 0x6e, 0x74, 
+    0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 
+    0x6f, 0x6e, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x65, 0x72, 
+    0x66, 0x6f, 0x72, 0x6d, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 
+    0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x73, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x60, 
+    0x53, 0x69, 0x7a, 0x65, 0x5f, 0x4d, 0x65, 0x74, 0x72, 0x69, 
+    0x63, 0x73, 0x60, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 
+    0x20, 0x69, 0x73, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x6c, 0x73, 
+    0x6f, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Size_Metrics_ascender[36] = {
+    0x54, 0x68, 0x65, 0x20, 0x61, 0x73, 0x63, 0x65, 0x6e, 0x64, 
+    0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x66, 0x72, 0x61, 0x63, 
+    0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 0x69, 0x78, 
+    0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Size_Metrics_descender[37] = {
+    0x54, 0x68, 0x65, 0x20, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 
+    0x64, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x66, 0x72, 0x61, 
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 0x69, 
+    0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Size_Metrics_height[34] = {
+    0x54, 0x68, 0x65, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
+    0x20, 0x69, 0x6e, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 
+    0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 
+    0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Size_Metrics_max_advance[49] = {
+    0x54, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 
+    0x6d, 0x20, 0x61, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x20, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x66, 
+    0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 
+    0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Size_Metrics_x_ppem[94] = {
+    0x54, 0x68, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x63, 0x61, 
+    0x6c, 0x65, 0x64, 0x20, 0x45, 0x4d, 0x20, 0x73, 0x71, 0x75, 
+    0x61, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x69, 0x78, 
+    0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x0a, 0x49, 0x74, 0x20, 0x69, 
+    0x73, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x72, 0x65, 0x66, 
+    0x65, 0x72, 0x72, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x61, 
+    0x73, 0x20, 0xe2, 0x80, 0x98, 0x6e, 0x6f, 0x6d, 0x69, 0x6e, 
+    0x61, 0x6c, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0xe2, 0x80, 
+    0x99, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Size_Metrics_x_scale[150] = {
+    0x41, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x61, 0x6c, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x0a, 0x0a, 0x55, 
+    0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 
+    0x76, 0x65, 0x72, 0x74, 0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 
+    0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x6d, 0x65, 0x74, 0x72, 
+    0x69, 0x63, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 
+    0x74, 0x6f, 0x20, 0x32, 0x36, 0x2e, 0x36, 0x20, 0x66, 0x72, 
+    0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x70, 
+    0x69, 0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x0a, 0x4f, 0x6e, 
+    0x6c, 0x79, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x76, 0x61, 0x6e, 
+    0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x63, 0x61, 0x6c, 
+    0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 
+    0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Size_Metrics_y_ppem[96] = {
+    0x54, 0x68, 0x65, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x63, 
+    0x61, 0x6c, 0x65, 0x64, 0x20, 0x45, 0x4d, 0x20, 0x73, 0x71, 
+    0x75, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x69, 
+    0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x0a, 0x49, 0x74, 0x20, 
+    0x69, 0x73, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x72, 0x65, 
+    0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 
+    0x61, 0x73, 0x20, 0xe2, 0x80, 0x98, 0x6e, 0x6f, 0x6d, 0x69, 
+    0x6e, 0x61, 0x6c, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
+    0xe2, 0x80, 0x99, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Size_Metrics_y_scale[150] = {
+    0x41, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x61, 0x6c, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x0a, 0x0a, 0x55, 
+    0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 
+    0x76, 0x65, 0x72, 0x74, 0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 
+    0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x6d, 0x65, 0x74, 0x72, 
+    0x69, 0x63, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 
+    0x74, 0x6f, 0x20, 0x32, 0x36, 0x2e, 0x36, 0x20, 0x66, 0x72, 
+    0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x70, 
+    0x69, 0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x0a, 0x4f, 0x6e, 
+    0x6c, 0x79, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x76, 0x61, 0x6e, 
+    0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x63, 0x61, 0x6c, 
+    0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 
+    0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
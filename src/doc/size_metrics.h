@@ -0,0 +1,21 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/size_metrics.py.
+*/
+
+#ifndef __DOC_SIZE_METRICS_H__
+#define __DOC_SIZE_METRICS_H__
+extern char doc_Size_Metrics__init__[674];
+extern char doc_Size_Metrics_ascender[36];
+extern char doc_Size_Metrics_descender[37];
+extern char doc_Size_Metrics_height[34];
+extern char doc_Size_Metrics_max_advance[49];
+extern char doc_Size_Metrics_x_ppem[94];
+extern char doc_Size_Metrics_x_scale[150];
+extern char doc_Size_Metrics_y_ppem[96];
+extern char doc_Size_Metrics_y_scale[150];
+
+#endif
+
@@ -0,0 +1,132 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/subglyph.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "subglyph.h"
+
+char doc_SUBGLYPH_FLAG[717] = {
+    0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x73, 0x20, 
+    0x73, 0x75, 0x62, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x2e, 
+    0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x41, 0x52, 0x47, 0x53, 0x5f, 
+    0x41, 0x52, 0x45, 0x5f, 0x57, 0x4f, 0x52, 0x44, 0x53, 0x60, 
+    0x3a, 0x20, 0x49, 0x66, 0x20, 0x73, 0x65, 0x74, 0x2c, 0x20, 
+    0x60, 0x53, 0x75, 0x62, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x2e, 
+    0x61, 0x72, 0x67, 0x31, 0x60, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x60, 0x53, 0x75, 0x62, 0x47, 0x6c, 0x79, 0x70, 0x68, 0x2e, 
+    0x61, 0x72, 0x67, 0x32, 0x60, 0x0a, 0x20, 0x20, 0x61, 0x72, 
+    0x65, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x2c, 0x20, 0x65, 
+    0x6c, 0x73, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x2e, 
+    0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x41, 0x52, 0x47, 0x53, 0x5f, 
+    0x41, 0x52, 0x45, 0x5f, 0x58, 0x59, 0x5f, 0x56, 0x41, 0x4c, 
+    0x55, 0x45, 0x53, 0x60, 0x3a, 0x20, 0x49, 0x66, 0x20, 0x73, 
+    0x65, 0x74, 0x2c, 0x20, 0x60, 0x53, 0x75, 0x62, 0x47, 0x6c, 
+    0x79, 0x70, 0x68, 0x2e, 0x61, 0x72, 0x67, 0x31, 0x60, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x60, 0x53, 0x75, 0x62, 0x47, 0x6c, 
+    0x79, 0x70, 0x68, 0x2e, 0x61, 0x72, 0x67, 0x32, 0x60, 0x0a, 
+    0x20, 0x20, 0x61, 0x72, 0x65, 0x20, 0x78, 0x79, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x52, 0x4f, 0x55, 0x4e, 0x44, 0x5f, 0x58, 0x59, 0x5f, 
+    0x54, 0x4f, 0x5f, 0x47, 0x52, 0x49, 0x44, 0x60, 0x3a, 0x20, 
+    0x49, 0x66, 0x20, 0x73, 0x65, 0x74, 0x2c, 0x20, 0x72, 0x6f, 
+    0x75, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x78, 0x79, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x74, 0x6f, 
+    0x20, 0x67, 0x72, 0x69, 0x64, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x53, 0x43, 0x41, 0x4c, 0x45, 0x60, 0x3a, 0x20, 0x49, 
+    0x66, 0x20, 0x73, 0x65, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 
+    0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x69, 
+    0x6d, 0x70, 0x6c, 0x65, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 
+    0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 
+    0x0a, 0x2d, 0x20, 0x60, 0x58, 0x59, 0x5f, 0x53, 0x43, 0x41, 
+    0x4c, 0x45, 0x60, 0x3a, 0x20, 0x49, 0x66, 0x20, 0x73, 0x65, 
+    0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x78, 0x20, 0x64, 
+    0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 
+    0x69, 0x6c, 0x6c, 0x20, 0x75, 0x73, 0x65, 0x20, 0x61, 0x20, 
+    0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x20, 
+    0x73, 0x63, 0x61, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6e, 
+    0x0a, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x79, 0x20, 0x64, 
+    0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 
+    0x0a, 0x2d, 0x20, 0x60, 0x54, 0x57, 0x4f, 0x58, 0x54, 0x57, 
+    0x4f, 0x60, 0x3a, 0x20, 0x49, 0x66, 0x20, 0x73, 0x65, 0x74, 
+    0x2c, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x73, 
+    0x20, 0x61, 0x20, 0x32, 0x2d, 0x62, 0x79, 0x2d, 0x32, 0x20, 
+    0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x61, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 
+    0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x0a, 0x20, 0x20, 
+    0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x63, 
+    0x61, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 
+    0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x2e, 0x20, 0x28, 
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x6e, 
+    0x61, 0x6d, 0x65, 0x64, 0x20, 0x60, 0x32, 0x58, 0x32, 0x60, 
+    0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 
+    0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x79, 0x69, 0x6e, 0x67, 
+    0x20, 0x46, 0x72, 0x65, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 
+    0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2c, 0x20, 0x62, 
+    0x75, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x72, 0x65, 0x6e, 
+    0x61, 0x6d, 0x65, 0x64, 0x20, 0x68, 0x65, 0x72, 0x65, 0x20, 
+    0x73, 0x6f, 0x20, 0x69, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 
+    0x6e, 0x27, 0x74, 0x0a, 0x20, 0x20, 0x62, 0x65, 0x67, 0x69, 
+    0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x64, 
+    0x69, 0x67, 0x69, 0x74, 0x2e, 0x29, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x55, 0x53, 0x45, 0x5f, 0x4d, 0x59, 0x5f, 0x4d, 0x45, 
+    0x54, 0x52, 0x49, 0x43, 0x53, 0x60, 0x3a, 0x20, 0x55, 0x73, 
+    0x65, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x20, 
+    0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 
+    0x6d, 0x70, 0x6f, 0x75, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_SubGlyph__init__[36] = {
+    0x41, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 
+    0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x67, 
+    0x69, 0x76, 0x65, 0x6e, 0x20, 0x73, 0x75, 0x62, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_SubGlyph_arg1[41] = {
+    0x54, 0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x27, 0x73, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 
+    0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 
+    0x28, 0x69, 0x66, 0x20, 0x61, 0x6e, 0x79, 0x29, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_SubGlyph_arg2[42] = {
+    0x54, 0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x27, 0x73, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 
+    0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
+    0x20, 0x28, 0x69, 0x66, 0x20, 0x61, 0x6e, 0x79, 0x29, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_SubGlyph_flags[31] = {
+    0x54, 0x68, 0x65, 0x20, 0x60, 0x53, 0x55, 0x42, 0x47, 0x4c, 
+    0x59, 0x50, 0x48, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x60, 0x20, 
+    0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_SubGlyph_index[34] = {
+    0x54, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_SubGlyph_transform[39] = {
+    0x54, 0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 
+    0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x69, 
+    0x66, 0x20, 0x61, 0x6e, 0x79, 0x29, 0x2e, 0x0a, 0x00, 
+};
+
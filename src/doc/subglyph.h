@@ -0,0 +1,19 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/subglyph.py.
+*/
+
+#ifndef __DOC_SUBGLYPH_H__
+#define __DOC_SUBGLYPH_H__
+extern char doc_SUBGLYPH_FLAG[717];
+extern char doc_SubGlyph__init__[36];
+extern char doc_SubGlyph_arg1[41];
+extern char doc_SubGlyph_arg2[42];
+extern char doc_SubGlyph_flags[31];
+extern char doc_SubGlyph_index[34];
+extern char doc_SubGlyph_transform[39];
+
+#endif
+
@@ -0,0 +1,19 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/subglyphs.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "subglyphs.h"
+
+char doc_SubGlyphs__init__[26] = {
+    0x41, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 
+    0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x62, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
@@ -0,0 +1,13 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/subglyphs.py.
+*/
+
+#ifndef __DOC_SUBGLYPHS_H__
+#define __DOC_SUBGLYPHS_H__
+extern char doc_SubGlyphs__init__[26];
+
+#endif
+
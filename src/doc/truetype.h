@@ -0,0 +1,21 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/truetype.py.
+*/
+
+#ifndef __DOC_TRUETYPE_H__
+#define __DOC_TRUETYPE_H__
+extern char doc_TT_ADOBE_ID[183];
+extern char doc_TT_APPLE_ID[421];
+extern char doc_TT_ISO_ID[120];
+extern char doc_TT_MAC_ID[467];
+extern char doc_TT_MAC_LANGID[134];
+extern char doc_TT_MS_ID[772];
+extern char doc_TT_MS_LANGID[137];
+extern char doc_TT_NAME_ID[526];
+extern char doc_TT_PLATFORM[1226];
+
+#endif
+
@@ -0,0 +1,283 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/tt_header.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "tt_header.h"
+
+char doc_TT_HEADER_FLAGS[1193] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x42, 0x69, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 
+    0x6c, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x20, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x20, 
+    0x61, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 0x60, 0x2e, 0x0a, 
+    0x0a, 0x2d, 0x20, 0x60, 0x42, 0x41, 0x53, 0x45, 0x4c, 0x49, 
+    0x4e, 0x45, 0x5f, 0x41, 0x54, 0x5f, 0x5a, 0x45, 0x52, 0x4f, 
+    0x60, 0x3a, 0x20, 0x49, 0x66, 0x20, 0x73, 0x65, 0x74, 0x2c, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x73, 0x65, 0x6c, 
+    0x69, 0x6e, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x69, 0x73, 
+    0x20, 0x61, 0x74, 0x20, 0x2a, 0x79, 0x2a, 0x20, 0x3d, 0x20, 
+    0x30, 0x0a, 0x20, 0x20, 0x28, 0x74, 0x68, 0x61, 0x74, 0x20, 
+    0x69, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x2a, 0x78, 
+    0x2a, 0x2d, 0x61, 0x78, 0x69, 0x73, 0x29, 0x0a, 0x0a, 0x2d, 
+    0x20, 0x60, 0x4c, 0x45, 0x46, 0x54, 0x5f, 0x42, 0x4c, 0x41, 
+    0x43, 0x4b, 0x5f, 0x42, 0x49, 0x54, 0x5f, 0x49, 0x53, 0x5f, 
+    0x4c, 0x53, 0x42, 0x60, 0x3a, 0x20, 0x49, 0x66, 0x20, 0x73, 
+    0x65, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x2a, 0x78, 
+    0x2a, 0x2d, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x65, 
+    0x66, 0x74, 0x6d, 0x6f, 0x73, 0x74, 0x0a, 0x20, 0x20, 0x62, 
+    0x6c, 0x61, 0x63, 0x6b, 0x20, 0x62, 0x69, 0x74, 0x20, 0x69, 
+    0x73, 0x20, 0x61, 0x73, 0x73, 0x75, 0x6d, 0x65, 0x64, 0x20, 
+    0x74, 0x6f, 0x20, 0x62, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6c, 0x65, 0x66, 0x74, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20, 
+    0x62, 0x65, 0x61, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x4e, 0x4f, 0x4e, 0x4c, 0x49, 0x4e, 0x45, 
+    0x41, 0x52, 0x5f, 0x53, 0x43, 0x41, 0x4c, 0x45, 0x60, 0x3a, 
+    0x20, 0x49, 0x66, 0x20, 0x73, 0x65, 0x74, 0x2c, 0x20, 0x69, 
+    0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x73, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x75, 0x73, 0x65, 0x20, 
+    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 
+    0x0a, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6c, 0x69, 0x63, 0x69, 
+    0x74, 0x6c, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x6c, 0x61, 
+    0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x69, 0x78, 0x65, 
+    0x6c, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x65, 0x6d, 0x2e, 
+    0x20, 0x53, 0x63, 0x61, 0x6c, 0x65, 0x64, 0x20, 0x70, 0x6f, 
+    0x69, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x61, 0x63, 0x74, 0x75, 0x61, 0x6c, 0x0a, 
+    0x20, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x69, 
+    0x7a, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x64, 0x69, 
+    0x66, 0x66, 0x65, 0x72, 0x20, 0x28, 0x69, 0x2e, 0x65, 0x2e, 
+    0x20, 0x32, 0x34, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x64, 0x69, 0x66, 0x66, 
+    0x65, 0x72, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x31, 
+    0x32, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x0a, 0x20, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x73, 0x63, 0x61, 0x6c, 
+    0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x66, 0x61, 0x63, 0x74, 
+    0x6f, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x32, 0x29, 0x2e, 0x0a, 
+    0x0a, 0x2d, 0x20, 0x60, 0x49, 0x4e, 0x54, 0x45, 0x47, 0x45, 
+    0x52, 0x5f, 0x53, 0x43, 0x41, 0x4c, 0x49, 0x4e, 0x47, 0x60, 
+    0x3a, 0x20, 0x55, 0x73, 0x65, 0x20, 0x69, 0x6e, 0x74, 0x65, 
+    0x67, 0x65, 0x72, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 
+    0x67, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 
+    0x6f, 0x66, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 
+    0x6e, 0x61, 0x6c, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x56, 
+    0x45, 0x52, 0x54, 0x49, 0x43, 0x41, 0x4c, 0x60, 0x3a, 0x20, 
+    0x53, 0x65, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 
+    0x65, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 
+    0x20, 0x74, 0x6f, 0x20, 0x6e, 0x65, 0x20, 0x6c, 0x61, 0x69, 
+    0x64, 0x20, 0x6f, 0x75, 0x74, 0x0a, 0x20, 0x20, 0x76, 0x65, 
+    0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6c, 0x79, 0x2c, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x69, 
+    0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x62, 
+    0x65, 0x65, 0x6e, 0x20, 0x64, 0x72, 0x61, 0x77, 0x6e, 0x20, 
+    0x73, 0x75, 0x63, 0x68, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 
+    0x61, 0x6e, 0x0a, 0x20, 0x20, 0x2a, 0x78, 0x2a, 0x2d, 0x63, 
+    0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x20, 
+    0x6f, 0x66, 0x20, 0x30, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 
+    0x73, 0x70, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x74, 0x6f, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 
+    0x64, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 
+    0x20, 0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 
+    0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x52, 0x45, 0x51, 0x55, 0x49, 
+    0x52, 0x45, 0x53, 0x5f, 0x4c, 0x41, 0x59, 0x4f, 0x55, 0x54, 
+    0x60, 0x3a, 0x20, 0x53, 0x65, 0x74, 0x20, 0x69, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x72, 
+    0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x20, 0x6c, 0x61, 
+    0x79, 0x6f, 0x75, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63, 
+    0x6f, 0x72, 0x72, 0x65, 0x63, 0x74, 0x0a, 0x20, 0x20, 0x6c, 
+    0x69, 0x6e, 0x67, 0x75, 0x69, 0x73, 0x74, 0x69, 0x63, 0x20, 
+    0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x20, 
+    0x28, 0x65, 0x2e, 0x67, 0x2e, 0x20, 0x41, 0x72, 0x61, 0x62, 
+    0x69, 0x63, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x29, 0x2e, 
+    0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4d, 0x45, 0x54, 0x41, 0x4d, 
+    0x4f, 0x52, 0x50, 0x48, 0x4f, 0x53, 0x49, 0x53, 0x5f, 0x45, 
+    0x46, 0x46, 0x45, 0x43, 0x54, 0x53, 0x60, 0x3a, 0x20, 0x53, 
+    0x65, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x47, 
+    0x58, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x77, 0x68, 0x69, 
+    0x63, 0x68, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6f, 0x6e, 0x65, 
+    0x20, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x0a, 0x20, 
+    0x20, 0x6d, 0x65, 0x74, 0x61, 0x6d, 0x6f, 0x72, 0x70, 0x68, 
+    0x6f, 0x73, 0x69, 0x73, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 
+    0x74, 0x73, 0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6e, 0x61, 
+    0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x68, 0x61, 0x70, 
+    0x70, 0x65, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x79, 0x20, 
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x2e, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x52, 0x49, 0x47, 0x48, 0x54, 0x5f, 0x54, 
+    0x4f, 0x5f, 0x4c, 0x45, 0x46, 0x54, 0x5f, 0x47, 0x4c, 0x59, 
+    0x50, 0x48, 0x53, 0x60, 0x3a, 0x20, 0x53, 0x65, 0x74, 0x20, 
+    0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 
+    0x20, 0x61, 0x6e, 0x79, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6e, 
+    0x67, 0x0a, 0x20, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2d, 
+    0x74, 0x6f, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x73, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 
+    0x49, 0x4e, 0x44, 0x49, 0x43, 0x5f, 0x52, 0x45, 0x41, 0x52, 
+    0x52, 0x41, 0x4e, 0x47, 0x45, 0x4d, 0x45, 0x4e, 0x54, 0x5f, 
+    0x45, 0x46, 0x46, 0x45, 0x43, 0x54, 0x53, 0x60, 0x3a, 0x20, 
+    0x53, 0x65, 0x74, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 
+    0x61, 0x69, 0x6e, 0x73, 0x20, 0x49, 0x6e, 0x64, 0x69, 0x63, 
+    0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x0a, 0x20, 0x20, 0x72, 
+    0x65, 0x61, 0x72, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x6d, 0x65, 
+    0x6e, 0x74, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x73, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Header__init__[18] = {
+    0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x68, 
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Header_checksum_adjust[28] = {
+    0x41, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Header_created[32] = {
+    0x54, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x65, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x77, 0x61, 
+    0x73, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_TT_Header_flags[63] = {
+    0x60, 0x54, 0x54, 0x5f, 0x48, 0x45, 0x41, 0x44, 0x45, 0x52, 
+    0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x60, 0x20, 0x62, 0x69, 
+    0x74, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x74, 0x68, 0x61, 
+    0x74, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x74, 0x6f, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x65, 0x20, 
+    0x61, 0x73, 0x20, 0x61, 0x20, 0x77, 0x68, 0x6f, 0x6c, 0x65, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Header_font_direction[222] = {
+    0x54, 0x68, 0x65, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 
+    0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x30, 0x3a, 0x20, 0x4d, 0x69, 0x78, 0x65, 0x64, 0x20, 0x64, 
+    0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x0a, 0x0a, 0x2d, 
+    0x20, 0x31, 0x3a, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x73, 
+    0x74, 0x72, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x65, 0x66, 0x74, 
+    0x20, 0x74, 0x6f, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x32, 0x3a, 0x20, 0x4c, 0x69, 0x6b, 0x65, 0x20, 0x31, 0x2c, 
+    0x20, 0x62, 0x75, 0x74, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 
+    0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x6e, 
+    0x65, 0x75, 0x74, 0x72, 0x61, 0x6c, 0x73, 0x0a, 0x0a, 0x2d, 
+    0x20, 0x2d, 0x31, 0x3a, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 
+    0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x20, 0x72, 0x69, 0x67, 
+    0x68, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x65, 0x66, 0x74, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x73, 0x0a, 0x0a, 0x2d, 
+    0x20, 0x2d, 0x32, 0x3a, 0x20, 0x4c, 0x69, 0x6b, 0x65, 0x20, 
+    0x2d, 0x31, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x61, 0x6c, 
+    0x73, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 
+    0x73, 0x20, 0x6e, 0x65, 0x75, 0x74, 0x72, 0x61, 0x6c, 0x73, 
+    0x0a, 0x00, 
+};
+
+char doc_TT_Header_font_revision[57] = {
+    0x54, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 
+    0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x2e, 0x20, 0x20, 0x53, 0x65, 0x74, 0x20, 
+    0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x6d, 0x61, 0x6e, 0x75, 0x66, 0x61, 0x63, 0x74, 
+    0x75, 0x72, 0x65, 0x72, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Header_lowest_rec_ppem[39] = {
+    0x54, 0x68, 0x65, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x65, 
+    0x73, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x61, 0x62, 0x6c, 
+    0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x69, 0x6e, 0x20, 
+    0x70, 0x69, 0x78, 0x65, 0x6c, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Header_mac_style[26] = {
+    0x60, 0x54, 0x54, 0x5f, 0x4d, 0x41, 0x43, 0x5f, 0x53, 0x54, 
+    0x59, 0x4c, 0x45, 0x60, 0x20, 0x62, 0x69, 0x74, 0x66, 0x6c, 
+    0x61, 0x67, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Header_magic_number[20] = {
+    0x41, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x30, 0x78, 0x35, 
+    0x46, 0x30, 0x46, 0x33, 0x43, 0x46, 0x35, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Header_modified[33] = {
+    0x54, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x65, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x77, 0x61, 
+    0x73, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Header_table_version[37] = {
+    0x54, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 
+    0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x54, 
+    0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x68, 0x65, 
+    0x61, 0x64, 0x65, 0x72, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Header_units_per_em[41] = {
+    0x55, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 
+    0x65, 0x6d, 0x2e, 0x20, 0x20, 0x49, 0x6e, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x36, 0x34, 
+    0x20, 0x2d, 0x20, 0x31, 0x36, 0x33, 0x38, 0x34, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_TT_Header_x_max[39] = {
+    0x54, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 
+    0x6d, 0x20, 0x78, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6c, 
+    0x6c, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 
+    0x20, 0x62, 0x6f, 0x78, 0x65, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Header_x_min[39] = {
+    0x54, 0x68, 0x65, 0x20, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 
+    0x6d, 0x20, 0x78, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6c, 
+    0x6c, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 
+    0x20, 0x62, 0x6f, 0x78, 0x65, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Header_y_max[39] = {
+    0x54, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 
+    0x6d, 0x20, 0x79, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6c, 
+    0x6c, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 
+    0x20, 0x62, 0x6f, 0x78, 0x65, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Header_y_min[39] = {
+    0x54, 0x68, 0x65, 0x20, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 
+    0x6d, 0x20, 0x79, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6c, 
+    0x6c, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 
+    0x20, 0x62, 0x6f, 0x78, 0x65, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_MAC_STYLE[129] = {
+    0x42, 0x69, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 
+    0x79, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x61, 0x63, 0x65, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x42, 0x4f, 0x4c, 0x44, 0x60, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x49, 0x54, 0x41, 0x4c, 0x49, 0x43, 0x60, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x55, 0x4e, 0x44, 0x45, 0x52, 0x4c, 0x49, 
+    0x4e, 0x45, 0x60, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4f, 0x55, 
+    0x54, 0x4c, 0x49, 0x4e, 0x45, 0x60, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x53, 0x48, 0x41, 0x44, 0x4f, 0x57, 0x60, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x43, 0x4f, 0x4e, 0x44, 0x45, 0x4e, 0x53, 
+    0x45, 0x44, 0x60, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x45, 0x58, 
+    0x54, 0x45, 0x4e, 0x44, 0x45, 0x44, 0x60, 0x0a, 0x00, 
+};
+
@@ -0,0 +1,30 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/tt_header.py.
+*/
+
+#ifndef __DOC_TT_HEADER_H__
+#define __DOC_TT_HEADER_H__
+extern char doc_TT_HEADER_FLAGS[1193];
+extern char doc_TT_Header__init__[18];
+extern char doc_TT_Header_checksum_adjust[28];
+extern char doc_TT_Header_created[32];
+extern char doc_TT_Header_flags[63];
+extern char doc_TT_Header_font_direction[222];
+extern char doc_TT_Header_font_revision[57];
+extern char doc_TT_Header_lowest_rec_ppem[39];
+extern char doc_TT_Header_mac_style[26];
+extern char doc_TT_Header_magic_number[20];
+extern char doc_TT_Header_modified[33];
+extern char doc_TT_Header_table_version[37];
+extern char doc_TT_Header_units_per_em[41];
+extern char doc_TT_Header_x_max[39];
+extern char doc_TT_Header_x_min[39];
+extern char doc_TT_Header_y_max[39];
+extern char doc_TT_Header_y_min[39];
+extern char doc_TT_MAC_STYLE[129];
+
+#endif
+
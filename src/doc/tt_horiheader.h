@@ -0,0 +1,26 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/tt_horiheader.py.
+*/
+
+#ifndef __DOC_TT_HORIHEADER_H__
+#define __DOC_TT_HORIHEADER_H__
+extern char doc_TT_HoriHeader__init__[42];
+extern char doc_TT_HoriHeader_advance_width_max[144];
+extern char doc_TT_HoriHeader_ascender[372];
+extern char doc_TT_HoriHeader_caret_offset[1];
+extern char doc_TT_HoriHeader_caret_slope_rise[76];
+extern char doc_TT_HoriHeader_caret_slope_run[44];
+extern char doc_TT_HoriHeader_descender[385];
+extern char doc_TT_HoriHeader_line_gap[148];
+extern char doc_TT_HoriHeader_metric_data_format[11];
+extern char doc_TT_HoriHeader_min_left_side_bearing[62];
+extern char doc_TT_HoriHeader_min_right_side_bearing[63];
+extern char doc_TT_HoriHeader_number_of_hmetrics[126];
+extern char doc_TT_HoriHeader_version[20];
+extern char doc_TT_HoriHeader_xmax_extent[109];
+
+#endif
+
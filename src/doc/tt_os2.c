@@ -0,0 +1,2050 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/tt_os2.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "tt_os2.h"
+
+char doc_TT_FS_SELECTION[107] = {
+    0x42, 0x69, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x73, 0x74, 
+    0x79, 0x6c, 0x65, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x49, 
+    0x54, 0x41, 0x4c, 0x49, 0x43, 0x60, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x55, 0x4e, 0x44, 0x45, 0x52, 0x53, 0x43, 0x4f, 0x52, 
+    0x45, 0x60, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4e, 0x45, 0x47, 
+    0x41, 0x54, 0x49, 0x56, 0x45, 0x60, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x4f, 0x55, 0x54, 0x4c, 0x49, 0x4e, 0x45, 0x44, 0x60, 
+    0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x53, 0x54, 0x52, 0x49, 0x4b, 
+    0x45, 0x4f, 0x55, 0x54, 0x60, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 
+    0x42, 0x4f, 0x4c, 0x44, 0x60, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2__init__[202] = {
+    0x49, 0x6e, 0x66, 0x20, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2c, 0x20, 0x75, 
+    0x73, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x4f, 0x53, 0x2f, 
+    0x32, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x4d, 0x69, 0x63, 0x72, 
+    0x6f, 0x73, 0x6f, 0x66, 0x74, 0x20, 0x57, 0x69, 0x6e, 0x64, 
+    0x6f, 0x77, 0x73, 0x2e, 0x0a, 0x0a, 0x4e, 0x6f, 0x74, 0x65, 
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x65, 0x20, 0x6e, 
+    0x6f, 0x77, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 
+    0x20, 0x6f, 0x6c, 0x64, 0x20, 0x4d, 0x61, 0x63, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x73, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 
+    0x20, 0x64, 0x6f, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x69, 0x6e, 
+    0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x61, 0x6e, 0x20, 0x4f, 
+    0x53, 0x2f, 0x32, 0x0a, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 
+    0x20, 0x20, 0x49, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x63, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x60, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x60, 0x20, 
+    0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x69, 0x73, 0x20, 0x61, 
+    0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 
+    0x74, 0x6f, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_TT_OS2_break_char[365] = {
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x20, 
+    0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x57, 0x69, 0x6e, 
+    0x64, 0x6f, 0x77, 0x73, 0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 
+    0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x62, 0x72, 0x65, 
+    0x61, 0x6b, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x62, 0x72, 
+    0x65, 0x61, 0x6b, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+    0x74, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 
+    0x64, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 
+    0x61, 0x74, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x20, 
+    0x61, 0x6e, 0x64, 0x0a, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 
+    0x79, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2e, 0x20, 0x4d, 0x6f, 
+    0x73, 0x74, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 0x73, 
+    0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x27, 0x73, 0x70, 
+    0x61, 0x63, 0x65, 0x27, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x2e, 0x20, 0x54, 
+    0x68, 0x69, 0x73, 0x0a, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 
+    0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x72, 0x65, 0x70, 
+    0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x75, 0x70, 
+    0x70, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x72, 0x79, 
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x28, 0x63, 
+    0x6f, 0x64, 0x65, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x0a, 
+    0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 
+    0x61, 0x6e, 0x20, 0x60, 0x60, 0x30, 0x78, 0x46, 0x46, 0x46, 
+    0x46, 0x60, 0x60, 0x29, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x73, 0x6f, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 
+    0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 
+    0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x6c, 0x79, 0x20, 0x64, 
+    0x69, 0x73, 0x63, 0x6f, 0x75, 0x72, 0x61, 0x67, 0x65, 0x64, 
+    0x0a, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x75, 0x73, 0x69, 0x6e, 
+    0x67, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 0x65, 
+    0x6c, 0x64, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_cap_height[776] = {
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 
+    0x63, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x69, 0x73, 0x74, 
+    0x61, 0x6e, 0x63, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 
+    0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x73, 
+    0x65, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x74, 0x68, 0x65, 0x0a, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x78, 
+    0x69, 0x6d, 0x61, 0x74, 0x65, 0x20, 0x68, 0x65, 0x69, 0x67, 
+    0x68, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x75, 0x70, 0x70, 0x65, 
+    0x72, 0x63, 0x61, 0x73, 0x65, 0x20, 0x6c, 0x65, 0x74, 0x74, 
+    0x65, 0x72, 0x73, 0x20, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 
+    0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x2e, 0x20, 0x54, 0x68, 
+    0x69, 0x73, 0x0a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x77, 
+    0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 
+    0x6c, 0x6c, 0x79, 0x20, 0x62, 0x65, 0x20, 0x73, 0x70, 0x65, 
+    0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 
+    0x61, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x64, 0x65, 0x73, 
+    0x69, 0x67, 0x6e, 0x65, 0x72, 0x20, 0x62, 0x75, 0x74, 0x20, 
+    0x69, 0x6e, 0x20, 0x73, 0x69, 0x74, 0x75, 0x61, 0x74, 0x69, 
+    0x6f, 0x6e, 0x73, 0x0a, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 
+    0x74, 0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 
+    0x2c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6d, 
+    0x70, 0x6c, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x61, 
+    0x20, 0x6c, 0x65, 0x67, 0x61, 0x63, 0x79, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 0x62, 0x65, 0x69, 0x6e, 
+    0x67, 0x0a, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 
+    0x64, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 
+    0x75, 0x65, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 
+    0x73, 0x65, 0x74, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x20, 
+    0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x70, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x6e, 
+    0x73, 0x63, 0x61, 0x6c, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 
+    0x0a, 0x75, 0x6e, 0x68, 0x69, 0x6e, 0x74, 0x65, 0x64, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x62, 0x6f, 0x75, 0x6e, 
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6f, 0x78, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x20, 
+    0x61, 0x74, 0x20, 0x60, 0x60, 0x55, 0x2b, 0x30, 0x30, 0x34, 
+    0x38, 0x60, 0x60, 0x20, 0x28, 0x60, 0x60, 0x4c, 0x41, 0x54, 
+    0x49, 0x4e, 0x0a, 0x43, 0x41, 0x50, 0x49, 0x54, 0x41, 0x4c, 
+    0x20, 0x4c, 0x45, 0x54, 0x54, 0x45, 0x52, 0x20, 0x48, 0x60, 
+    0x60, 0x29, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x6e, 0x6f, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x73, 0x20, 0x65, 
+    0x6e, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 
+    0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 
+    0x65, 0x6c, 0x64, 0x0a, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 
+    0x20, 0x62, 0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 
+    0x20, 0x30, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 
+    0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x2c, 0x20, 0x69, 0x66, 
+    0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 
+    0x2c, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x75, 
+    0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x79, 0x73, 
+    0x74, 0x65, 0x6d, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 
+    0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x79, 
+    0x70, 0x65, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x62, 0x79, 
+    0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x68, 
+    0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x6d, 0x65, 0x61, 0x73, 
+    0x75, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x6d, 0x69, 
+    0x6c, 0x6c, 0x69, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x2e, 
+    0x20, 0x49, 0x74, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x61, 0x6c, 
+    0x73, 0x6f, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 
+    0x20, 0x61, 0x73, 0x0a, 0x61, 0x6e, 0x20, 0x61, 0x6c, 0x69, 
+    0x67, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6d, 0x65, 0x74, 
+    0x72, 0x69, 0x63, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 
+    0x6f, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x64, 0x72, 
+    0x6f, 0x70, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 
+    0x2c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x73, 0x74, 
+    0x61, 0x6e, 0x63, 0x65, 0x2c, 0x20, 0x63, 0x61, 0x6e, 0x20, 
+    0x62, 0x65, 0x0a, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x65, 0x64, 
+    0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x63, 
+    0x61, 0x70, 0x5f, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x60, 
+    0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x20, 0x6f, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 
+    0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x65, 0x78, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_default_char[458] = {
+    0x57, 0x68, 0x65, 0x6e, 0x65, 0x76, 0x65, 0x72, 0x20, 0x61, 
+    0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x20, 0x69, 
+    0x73, 0x20, 0x6d, 0x61, 0x64, 0x65, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 
+    0x20, 0x6e, 0x6f, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2c, 0x0a, 0x57, 0x69, 
+    0x6e, 0x64, 0x6f, 0x77, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x76, 
+    0x69, 0x64, 0x65, 0x73, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x2e, 0x20, 0x49, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+    0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x69, 0x73, 0x0a, 0x7a, 
+    0x65, 0x72, 0x6f, 0x2c, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x49, 0x44, 0x20, 0x30, 0x20, 0x69, 0x73, 0x20, 0x74, 
+    0x6f, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 
+    0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 
+    0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x74, 0x68, 0x65, 
+    0x72, 0x77, 0x69, 0x73, 0x65, 0x0a, 0x74, 0x68, 0x69, 0x73, 
+    0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x55, 0x6e, 
+    0x69, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x65, 0x6e, 0x63, 0x6f, 
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x74, 0x68, 
+    0x61, 0x74, 0x20, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 
+    0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 0x61, 0x73, 0x20, 0x74, 
+    0x68, 0x65, 0x0a, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 
+    0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 0x65, 
+    0x6c, 0x64, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 
+    0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x20, 
+    0x73, 0x75, 0x70, 0x70, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 
+    0x61, 0x72, 0x79, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+    0x74, 0x65, 0x72, 0x0a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 
+    0x20, 0x28, 0x63, 0x6f, 0x64, 0x65, 0x70, 0x6f, 0x69, 0x6e, 
+    0x74, 0x73, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 
+    0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x60, 0x60, 0x30, 0x78, 
+    0x46, 0x46, 0x46, 0x46, 0x60, 0x60, 0x29, 0x2c, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x73, 0x6f, 0x20, 0x61, 0x70, 0x70, 0x6c, 
+    0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 
+    0x72, 0x65, 0x0a, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x6c, 
+    0x79, 0x20, 0x64, 0x69, 0x73, 0x63, 0x6f, 0x75, 0x72, 0x61, 
+    0x67, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x75, 
+    0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x66, 0x69, 0x65, 0x6c, 0x64, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_family_class[432] = {
+    0x43, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x65, 0x73, 
+    0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x65, 
+    0x73, 0x69, 0x67, 0x6e, 0x20, 0x61, 0x73, 0x20, 0x74, 0x6f, 
+    0x20, 0x69, 0x74, 0x73, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 
+    0x72, 0x61, 0x6e, 0x63, 0x65, 0x2e, 0x20, 0x20, 0x49, 0x74, 
+    0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 
+    0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x79, 0x0a, 0x74, 
+    0x68, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 
+    0x63, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x66, 0x61, 0x6d, 
+    0x69, 0x6c, 0x79, 0x2c, 0x20, 0x74, 0x79, 0x70, 0x65, 0x66, 
+    0x61, 0x63, 0x65, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 
+    0x6e, 0x65, 0x72, 0x2c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6c, 
+    0x69, 0x65, 0x72, 0x2c, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x2c, 
+    0x20, 0x6f, 0x72, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 
+    0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x64, 0x69, 0x66, 
+    0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x73, 0x2e, 0x20, 
+    0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x68, 0x69, 0x67, 0x68, 0x20, 0x62, 0x79, 
+    0x74, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 
+    0x60, 0x73, 0x46, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x43, 0x6c, 
+    0x61, 0x73, 0x73, 0x60, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 
+    0x2e, 0x0a, 0x0a, 0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 
+    0x70, 0x79, 0x7c, 0x20, 0x54, 0x68, 0x65, 0x20, 0x75, 0x73, 
+    0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x69, 0x73, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 
+    0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 
+    0x6e, 0x6f, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 
+    0x65, 0x64, 0x0a, 0x61, 0x73, 0x20, 0x65, 0x6e, 0x75, 0x6d, 
+    0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x20, 
+    0x20, 0x53, 0x65, 0x65, 0x20, 0x60, 0x74, 0x68, 0x65, 0x20, 
+    0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x73, 
+    0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 
+    0x6f, 0x6e, 0x0a, 0x3c, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 
+    0x2f, 0x2f, 0x64, 0x65, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 
+    0x72, 0x2e, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 
+    0x6d, 0x2f, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2f, 0x54, 0x54, 
+    0x52, 0x65, 0x66, 0x4d, 0x61, 0x6e, 0x2f, 0x52, 0x4d, 0x30, 
+    0x36, 0x2f, 0x43, 0x68, 0x61, 0x70, 0x36, 0x4f, 0x53, 0x32, 
+    0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x60, 0x5f, 0x20, 0x66, 
+    0x6f, 0x72, 0x0a, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x69, 0x6e, 
+    0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_TT_OS2_family_subclass[431] = {
+    0x43, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x65, 0x73, 
+    0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x65, 
+    0x73, 0x69, 0x67, 0x6e, 0x20, 0x61, 0x73, 0x20, 0x74, 0x6f, 
+    0x20, 0x69, 0x74, 0x73, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 
+    0x72, 0x61, 0x6e, 0x63, 0x65, 0x2e, 0x20, 0x20, 0x49, 0x74, 
+    0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 
+    0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x79, 0x0a, 0x74, 
+    0x68, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 
+    0x63, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x66, 0x61, 0x6d, 
+    0x69, 0x6c, 0x79, 0x2c, 0x20, 0x74, 0x79, 0x70, 0x65, 0x66, 
+    0x61, 0x63, 0x65, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 
+    0x6e, 0x65, 0x72, 0x2c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6c, 
+    0x69, 0x65, 0x72, 0x2c, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x2c, 
+    0x20, 0x6f, 0x72, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 
+    0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x64, 0x69, 0x66, 
+    0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x73, 0x2e, 0x20, 
+    0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6c, 0x6f, 0x77, 0x20, 0x62, 0x79, 0x74, 
+    0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x60, 
+    0x73, 0x46, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x43, 0x6c, 0x61, 
+    0x73, 0x73, 0x60, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x2e, 
+    0x0a, 0x0a, 0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 
+    0x79, 0x7c, 0x20, 0x54, 0x68, 0x65, 0x20, 0x75, 0x73, 0x65, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 
+    0x73, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 0x2c, 
+    0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 
+    0x6c, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 
+    0x6f, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 
+    0x64, 0x0a, 0x61, 0x73, 0x20, 0x65, 0x6e, 0x75, 0x6d, 0x65, 
+    0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x20, 0x20, 
+    0x53, 0x65, 0x65, 0x20, 0x60, 0x74, 0x68, 0x65, 0x20, 0x54, 
+    0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x73, 0x70, 
+    0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x0a, 0x3c, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 
+    0x2f, 0x64, 0x65, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x72, 
+    0x2e, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 
+    0x2f, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2f, 0x54, 0x54, 0x52, 
+    0x65, 0x66, 0x4d, 0x61, 0x6e, 0x2f, 0x52, 0x4d, 0x30, 0x36, 
+    0x2f, 0x43, 0x68, 0x61, 0x70, 0x36, 0x4f, 0x53, 0x32, 0x2e, 
+    0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x60, 0x5f, 0x20, 0x66, 0x6f, 
+    0x72, 0x0a, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x66, 
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_TT_OS2_first_char_index[41] = {
+    0x54, 0x68, 0x65, 0x20, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 
+    0x6d, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x20, 
+    0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_TT_OS2_last_char_index[41] = {
+    0x54, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 
+    0x6d, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x20, 
+    0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_TT_OS2_max_context[633] = {
+    0x54, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 
+    0x6d, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x6f, 
+    0x66, 0x20, 0x61, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x63, 0x6f, 0x6e, 
+    0x74, 0x65, 0x78, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 
+    0x6e, 0x79, 0x20, 0x66, 0x65, 0x61, 0x74, 0x75, 0x72, 0x65, 
+    0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x66, 
+    0x6f, 0x6e, 0x74, 0x2e, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x65, 
+    0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2c, 0x20, 0x61, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 
+    0x20, 0x68, 0x61, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 
+    0x61, 0x20, 0x70, 0x61, 0x69, 0x72, 0x20, 0x6b, 0x65, 0x72, 
+    0x6e, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x65, 0x61, 0x74, 0x75, 
+    0x72, 0x65, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x0a, 
+    0x73, 0x65, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 
+    0x69, 0x65, 0x6c, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x32, 0x2e, 
+    0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x68, 0x61, 
+    0x73, 0x20, 0x61, 0x20, 0x6c, 0x69, 0x67, 0x61, 0x74, 0x75, 
+    0x72, 0x65, 0x20, 0x66, 0x65, 0x61, 0x74, 0x75, 0x72, 0x65, 
+    0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x0a, 
+    0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x22, 
+    0x66, 0x20, 0x66, 0x20, 0x69, 0x22, 0x20, 0x69, 0x73, 0x20, 
+    0x73, 0x75, 0x62, 0x73, 0x74, 0x69, 0x74, 0x75, 0x74, 0x65, 
+    0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 
+    0x69, 0x67, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x22, 0xef, 
+    0xac, 0x83, 0x22, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 
+    0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 
+    0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x33, 0x2e, 
+    0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 0x65, 0x6c, 
+    0x64, 0x20, 0x63, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 
+    0x20, 0x75, 0x73, 0x65, 0x66, 0x75, 0x6c, 0x20, 0x74, 0x6f, 
+    0x0a, 0x73, 0x6f, 0x70, 0x68, 0x69, 0x73, 0x74, 0x69, 0x63, 
+    0x61, 0x74, 0x65, 0x64, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 
+    0x62, 0x72, 0x65, 0x61, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x65, 
+    0x6e, 0x67, 0x69, 0x6e, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 
+    0x64, 0x65, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x69, 0x6e, 
+    0x67, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x66, 0x61, 0x72, 0x20, 
+    0x74, 0x68, 0x65, 0x79, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 
+    0x64, 0x0a, 0x6c, 0x6f, 0x6f, 0x6b, 0x20, 0x61, 0x68, 0x65, 
+    0x61, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x65, 0x73, 0x74, 
+    0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x73, 
+    0x6f, 0x6d, 0x65, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x63, 
+    0x6f, 0x75, 0x6c, 0x64, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 
+    0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x66, 0x66, 
+    0x65, 0x63, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x6c, 
+    0x69, 0x6e, 0x65, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x69, 
+    0x6e, 0x67, 0x2e, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x63, 0x68, 
+    0x61, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6e, 
+    0x74, 0x65, 0x78, 0x74, 0x75, 0x61, 0x6c, 0x20, 0x6c, 0x6f, 
+    0x6f, 0x6b, 0x75, 0x70, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x6f, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 
+    0x67, 0x20, 0x28, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x29, 0x20, 0x2b, 0x20, 
+    0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x73, 0x65, 0x71, 
+    0x75, 0x65, 0x6e, 0x63, 0x65, 0x29, 0x20, 0x2b, 0x20, 0x28, 
+    0x6c, 0x6f, 0x6f, 0x6b, 0x61, 0x68, 0x65, 0x61, 0x64, 0x20, 
+    0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x29, 0x0a, 
+    0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 
+    0x63, 0x6f, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x72, 0x65, 0x64, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_panose[524] = {
+    0x54, 0x68, 0x65, 0x20, 0x50, 0x41, 0x4e, 0x4f, 0x53, 0x45, 
+    0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x63, 
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6e, 0x75, 0x6d, 0x62, 
+    0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x7c, 0x66, 0x72, 0x65, 0x65, 
+    0x74, 0x79, 0x70, 0x79, 0x7c, 0x20, 0x54, 0x68, 0x65, 0x20, 
+    0x75, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 
+    0x73, 0x20, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 
+    0x65, 0x64, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 
+    0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x76, 
+    0x69, 0x64, 0x65, 0x64, 0x0a, 0x61, 0x73, 0x20, 0x65, 0x6e, 
+    0x75, 0x6d, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+    0x2e, 0x20, 0x20, 0x53, 0x65, 0x65, 0x20, 0x60, 0x74, 0x68, 
+    0x65, 0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 
+    0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x61, 
+    0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x3c, 0x68, 0x74, 0x74, 0x70, 
+    0x73, 0x3a, 0x2f, 0x2f, 0x64, 0x65, 0x76, 0x65, 0x6c, 0x6f, 
+    0x70, 0x65, 0x72, 0x2e, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2e, 
+    0x63, 0x6f, 0x6d, 0x2f, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2f, 
+    0x54, 0x54, 0x52, 0x65, 0x66, 0x4d, 0x61, 0x6e, 0x2f, 0x52, 
+    0x4d, 0x30, 0x36, 0x2f, 0x43, 0x68, 0x61, 0x70, 0x36, 0x4f, 
+    0x53, 0x32, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x60, 0x5f, 
+    0x20, 0x66, 0x6f, 0x72, 0x0a, 0x6d, 0x6f, 0x72, 0x65, 0x20, 
+    0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x2e, 0x20, 0x20, 0x41, 0x20, 0x6d, 0x6f, 0x72, 0x65, 
+    0x20, 0x50, 0x79, 0x74, 0x68, 0x6f, 0x6e, 0x69, 0x63, 0x20, 
+    0x69, 0x6e, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 
+    0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x70, 0x72, 0x6f, 
+    0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x0a, 0x66, 0x75, 0x74, 0x75, 0x72, 0x65, 0x20, 
+    0x69, 0x66, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x65, 0x64, 0x2e, 
+    0x0a, 0x0a, 0x49, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 
+    0x31, 0x30, 0x2d, 0x62, 0x79, 0x74, 0x65, 0x20, 0x73, 0x74, 
+    0x72, 0x69, 0x6e, 0x67, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 
+    0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x62, 0x79, 0x74, 0x65, 
+    0x20, 0x69, 0x73, 0x20, 0x61, 0x73, 0x20, 0x66, 0x6f, 0x6c, 
+    0x6c, 0x6f, 0x77, 0x73, 0x3a, 0x0a, 0x0a, 0x2d, 0x20, 0x30, 
+    0x3a, 0x20, 0x46, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x20, 0x74, 
+    0x79, 0x70, 0x65, 0x0a, 0x2d, 0x20, 0x31, 0x3a, 0x20, 0x53, 
+    0x65, 0x72, 0x69, 0x66, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 
+    0x0a, 0x2d, 0x20, 0x32, 0x3a, 0x20, 0x57, 0x65, 0x69, 0x67, 
+    0x68, 0x74, 0x0a, 0x2d, 0x20, 0x33, 0x3a, 0x20, 0x50, 0x72, 
+    0x6f, 0x70, 0x6f, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x2d, 
+    0x20, 0x34, 0x3a, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x61, 
+    0x73, 0x74, 0x0a, 0x2d, 0x20, 0x35, 0x3a, 0x20, 0x53, 0x74, 
+    0x72, 0x6f, 0x6b, 0x65, 0x20, 0x56, 0x61, 0x72, 0x69, 0x61, 
+    0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x2d, 0x20, 0x36, 0x3a, 0x20, 
+    0x41, 0x72, 0x6d, 0x20, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x0a, 
+    0x2d, 0x20, 0x37, 0x3a, 0x20, 0x4c, 0x65, 0x74, 0x74, 0x65, 
+    0x72, 0x66, 0x6f, 0x72, 0x6d, 0x0a, 0x2d, 0x20, 0x38, 0x3a, 
+    0x20, 0x4d, 0x69, 0x64, 0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x2d, 
+    0x20, 0x39, 0x3a, 0x20, 0x78, 0x20, 0x68, 0x65, 0x69, 0x67, 
+    0x68, 0x74, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_selection[30] = {
+    0x41, 0x20, 0x60, 0x54, 0x54, 0x5f, 0x46, 0x53, 0x5f, 0x53, 
+    0x45, 0x4c, 0x45, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x60, 0x20, 
+    0x62, 0x69, 0x74, 0x66, 0x6c, 0x61, 0x67, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_type[68] = {
+    0x60, 0x46, 0x53, 0x54, 0x59, 0x50, 0x45, 0x60, 0x20, 0x62, 
+    0x69, 0x74, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x69, 0x6e, 
+    0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x69, 
+    0x6e, 0x67, 0x20, 0x72, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 
+    0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x61, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_typo_ascender[1161] = {
+    0x54, 0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x6f, 0x67, 0x72, 
+    0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x61, 0x73, 0x63, 0x65, 
+    0x6e, 0x64, 0x65, 0x72, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x20, 
+    0x52, 0x65, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x74, 
+    0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 
+    0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x74, 0x68, 0x65, 0x0a, 
+    0x73, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x73, 0x20, 0x60, 0x54, 
+    0x54, 0x5f, 0x48, 0x6f, 0x72, 0x69, 0x48, 0x65, 0x61, 0x64, 
+    0x65, 0x72, 0x2e, 0x61, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 
+    0x72, 0x60, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 
+    0x41, 0x70, 0x70, 0x6c, 0x65, 0x20, 0x64, 0x65, 0x66, 0x69, 
+    0x6e, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x66, 
+    0x61, 0x72, 0x0a, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 
+    0x6e, 0x74, 0x20, 0x6d, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x2e, 
+    0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x73, 0x75, 0x67, 0x67, 
+    0x65, 0x73, 0x74, 0x65, 0x64, 0x20, 0x75, 0x73, 0x61, 0x67, 
+    0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x60, 0x74, 0x79, 0x70, 
+    0x6f, 0x5f, 0x61, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 
+    0x60, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 
+    0x69, 0x74, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 
+    0x20, 0x69, 0x6e, 0x0a, 0x63, 0x6f, 0x6e, 0x6a, 0x75, 0x6e, 
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 
+    0x20, 0x60, 0x54, 0x54, 0x5f, 0x48, 0x65, 0x61, 0x64, 0x65, 
+    0x72, 0x2e, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x5f, 0x70, 0x65, 
+    0x72, 0x5f, 0x65, 0x6d, 0x60, 0x20, 0x74, 0x6f, 0x20, 0x63, 
+    0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x20, 0x61, 0x20, 0x74, 
+    0x79, 0x70, 0x6f, 0x67, 0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 
+    0x61, 0x6c, 0x6c, 0x79, 0x0a, 0x63, 0x6f, 0x72, 0x72, 0x65, 
+    0x63, 0x74, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 
+    0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x73, 0x70, 0x61, 0x63, 
+    0x69, 0x6e, 0x67, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x67, 
+    0x6f, 0x61, 0x6c, 0x20, 0x69, 0x73, 0x20, 0x74, 0x6f, 0x20, 
+    0x66, 0x72, 0x65, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x66, 0x72, 
+    0x6f, 0x6d, 0x0a, 0x4d, 0x61, 0x63, 0x69, 0x6e, 0x74, 0x6f, 
+    0x73, 0x68, 0x20, 0x6f, 0x72, 0x20, 0x57, 0x69, 0x6e, 0x64, 
+    0x6f, 0x77, 0x73, 0x2d, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 
+    0x69, 0x63, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 
+    0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61, 0x72, 0x65, 
+    0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x61, 0x69, 0x6e, 
+    0x65, 0x64, 0x20, 0x62, 0x79, 0x0a, 0x62, 0x61, 0x63, 0x6b, 
+    0x77, 0x61, 0x72, 0x64, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x61, 
+    0x74, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x72, 
+    0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 
+    0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x73, 0x65, 0x20, 0x6e, 
+    0x65, 0x77, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 
+    0x2c, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x63, 0x6f, 0x6d, 
+    0x62, 0x69, 0x6e, 0x65, 0x64, 0x0a, 0x77, 0x69, 0x74, 0x68, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 
+    0x6e, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x73, 0x2c, 0x20, 
+    0x77, 0x69, 0x6c, 0x6c, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 
+    0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 
+    0x6f, 0x6e, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x61, 0x79, 
+    0x20, 0x6f, 0x75, 0x74, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
+    0x65, 0x6e, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 
+    0x74, 0x79, 0x70, 0x6f, 0x67, 0x72, 0x61, 0x70, 0x68, 0x69, 
+    0x63, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x63, 0x6f, 0x72, 0x72, 
+    0x65, 0x63, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x6f, 
+    0x72, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x61, 0x73, 
+    0x68, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x46, 0x6f, 0x72, 
+    0x20, 0x43, 0x4a, 0x4b, 0x20, 0x28, 0x43, 0x68, 0x69, 0x6e, 
+    0x65, 0x73, 0x65, 0x2c, 0x20, 0x4a, 0x61, 0x70, 0x61, 0x6e, 
+    0x65, 0x73, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x4b, 
+    0x6f, 0x72, 0x65, 0x61, 0x6e, 0x29, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 
+    0x65, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 
+    0x20, 0x74, 0x6f, 0x20, 0x62, 0x65, 0x0a, 0x75, 0x73, 0x65, 
+    0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x76, 0x65, 0x72, 0x74, 
+    0x69, 0x63, 0x61, 0x6c, 0x20, 0x77, 0x72, 0x69, 0x74, 0x69, 
+    0x6e, 0x67, 0x20, 0x28, 0x69, 0x6e, 0x20, 0x61, 0x64, 0x64, 
+    0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x68, 
+    0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 
+    0x77, 0x72, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x29, 0x2c, 0x20, 
+    0x74, 0x68, 0x65, 0x0a, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 
+    0x65, 0x64, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x60, 0x74, 0x79, 0x70, 0x6f, 0x5f, 0x61, 
+    0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x60, 0x20, 0x69, 
+    0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x68, 0x69, 
+    0x63, 0x68, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 
+    0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6f, 0x70, 
+    0x20, 0x6f, 0x66, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x64, 0x65, 0x6f, 0x67, 
+    0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x65, 0x6d, 0x2d, 
+    0x62, 0x6f, 0x78, 0x2e, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x65, 
+    0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2c, 0x20, 0x69, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x64, 0x65, 0x6f, 0x67, 
+    0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x65, 0x6d, 0x2d, 
+    0x62, 0x6f, 0x78, 0x0a, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x65, 0x78, 0x74, 0x65, 
+    0x6e, 0x64, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x63, 
+    0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x73, 
+    0x20, 0x30, 0x2c, 0x2d, 0x31, 0x32, 0x30, 0x20, 0x74, 0x6f, 
+    0x20, 0x31, 0x30, 0x30, 0x30, 0x2c, 0x38, 0x38, 0x30, 0x20, 
+    0x28, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x2c, 0x20, 
+    0x61, 0x0a, 0x31, 0x30, 0x30, 0x30, 0x78, 0x31, 0x30, 0x30, 
+    0x30, 0x20, 0x62, 0x6f, 0x78, 0x20, 0x73, 0x65, 0x74, 0x20, 
+    0x31, 0x32, 0x30, 0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6e, 
+    0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x62, 0x65, 0x6c, 
+    0x6f, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x61, 0x74, 
+    0x69, 0x6e, 0x20, 0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 
+    0x65, 0x29, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x0a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f, 
+    0x66, 0x20, 0x60, 0x74, 0x79, 0x70, 0x6f, 0x5f, 0x61, 0x73, 
+    0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x60, 0x20, 0x6d, 0x75, 
+    0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 
+    0x74, 0x6f, 0x20, 0x38, 0x38, 0x30, 0x2e, 0x20, 0x46, 0x61, 
+    0x69, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x61, 
+    0x64, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 
+    0x68, 0x65, 0x73, 0x65, 0x0a, 0x72, 0x65, 0x71, 0x75, 0x69, 
+    0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x77, 0x69, 
+    0x6c, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 
+    0x69, 0x6e, 0x20, 0x69, 0x6e, 0x63, 0x6f, 0x72, 0x72, 0x65, 
+    0x63, 0x74, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 
+    0x6c, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_TT_OS2_typo_descender[1174] = {
+    0x54, 0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x6f, 0x67, 0x72, 
+    0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x64, 0x65, 0x73, 0x63, 
+    0x65, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 
+    0x20, 0x52, 0x65, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x74, 0x68, 0x65, 
+    0x0a, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x73, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x60, 0x54, 0x54, 0x5f, 0x48, 0x6f, 0x72, 
+    0x69, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2e, 0x64, 0x65, 
+    0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x60, 0x2c, 0x20, 
+    0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x41, 0x70, 0x70, 0x6c, 
+    0x65, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x73, 0x20, 
+    0x69, 0x6e, 0x20, 0x61, 0x20, 0x66, 0x61, 0x72, 0x0a, 0x64, 
+    0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x6d, 
+    0x61, 0x6e, 0x6e, 0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 
+    0x65, 0x20, 0x73, 0x75, 0x67, 0x67, 0x65, 0x73, 0x74, 0x65, 
+    0x64, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x60, 0x74, 0x79, 0x70, 0x6f, 0x5f, 0x64, 0x65, 
+    0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x60, 0x20, 0x69, 
+    0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x74, 0x20, 
+    0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 
+    0x0a, 0x63, 0x6f, 0x6e, 0x6a, 0x75, 0x6e, 0x63, 0x74, 0x69, 
+    0x6f, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x60, 0x54, 
+    0x54, 0x5f, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2e, 0x75, 
+    0x6e, 0x69, 0x74, 0x73, 0x5f, 0x70, 0x65, 0x72, 0x5f, 0x65, 
+    0x6d, 0x60, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6d, 0x70, 
+    0x75, 0x74, 0x65, 0x20, 0x61, 0x20, 0x74, 0x79, 0x70, 0x6f, 
+    0x67, 0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x61, 0x6c, 0x6c, 
+    0x79, 0x0a, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x63, 0x74, 0x20, 
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x6c, 0x69, 
+    0x6e, 0x65, 0x20, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 
+    0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x67, 0x6f, 0x61, 0x6c, 
+    0x20, 0x69, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x66, 0x72, 0x65, 
+    0x65, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x0a, 
+    0x4d, 0x61, 0x63, 0x69, 0x6e, 0x74, 0x6f, 0x73, 0x68, 0x20, 
+    0x6f, 0x72, 0x20, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 
+    0x2d, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 
+    0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x20, 0x77, 0x68, 
+    0x69, 0x63, 0x68, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6f, 
+    0x6e, 0x73, 0x74, 0x72, 0x61, 0x69, 0x6e, 0x65, 0x64, 0x20, 
+    0x62, 0x79, 0x0a, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 
+    0x64, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x61, 0x62, 
+    0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x72, 0x65, 0x71, 0x75, 
+    0x69, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x20, 
+    0x54, 0x68, 0x65, 0x73, 0x65, 0x20, 0x6e, 0x65, 0x77, 0x20, 
+    0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x2c, 0x20, 0x77, 
+    0x68, 0x65, 0x6e, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 
+    0x65, 0x64, 0x0a, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
+    0x72, 0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6e, 0x20, 0x77, 
+    0x69, 0x64, 0x74, 0x68, 0x73, 0x2c, 0x20, 0x77, 0x69, 0x6c, 
+    0x6c, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x20, 0x61, 0x70, 
+    0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+    0x20, 0x74, 0x6f, 0x20, 0x6c, 0x61, 0x79, 0x20, 0x6f, 0x75, 
+    0x74, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 
+    0x73, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x74, 0x79, 0x70, 
+    0x6f, 0x67, 0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x61, 0x6c, 
+    0x6c, 0x79, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x63, 0x74, 
+    0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x6f, 0x72, 0x74, 0x61, 
+    0x62, 0x6c, 0x65, 0x20, 0x66, 0x61, 0x73, 0x68, 0x69, 0x6f, 
+    0x6e, 0x2e, 0x0a, 0x0a, 0x46, 0x6f, 0x72, 0x20, 0x43, 0x4a, 
+    0x4b, 0x20, 0x28, 0x43, 0x68, 0x69, 0x6e, 0x65, 0x73, 0x65, 
+    0x2c, 0x20, 0x4a, 0x61, 0x70, 0x61, 0x6e, 0x65, 0x73, 0x65, 
+    0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x4b, 0x6f, 0x72, 0x65, 
+    0x61, 0x6e, 0x29, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 
+    0x6e, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6f, 
+    0x20, 0x62, 0x65, 0x0a, 0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 
+    0x6c, 0x20, 0x77, 0x72, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x20, 
+    0x28, 0x69, 0x6e, 0x20, 0x61, 0x64, 0x64, 0x69, 0x74, 0x69, 
+    0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x68, 0x6f, 0x72, 0x69, 
+    0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x77, 0x72, 0x69, 
+    0x74, 0x69, 0x6e, 0x67, 0x29, 0x2c, 0x20, 0x74, 0x68, 0x65, 
+    0x0a, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+    0x60, 0x74, 0x79, 0x70, 0x6f, 0x5f, 0x64, 0x65, 0x73, 0x63, 
+    0x65, 0x6e, 0x64, 0x65, 0x72, 0x60, 0x20, 0x69, 0x73, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 
+    0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x73, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6f, 0x74, 0x74, 0x6f, 
+    0x6d, 0x0a, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x64, 0x65, 0x6f, 
+    0x67, 0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x65, 0x6d, 
+    0x2d, 0x62, 0x6f, 0x78, 0x2e, 0x20, 0x46, 0x6f, 0x72, 0x20, 
+    0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2c, 0x20, 0x69, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x64, 0x65, 0x6f, 
+    0x67, 0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x0a, 0x65, 0x6d, 
+    0x2d, 0x62, 0x6f, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x65, 0x78, 0x74, 
+    0x65, 0x6e, 0x64, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 
+    0x63, 0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 
+    0x73, 0x20, 0x30, 0x2c, 0x2d, 0x31, 0x32, 0x30, 0x20, 0x74, 
+    0x6f, 0x20, 0x31, 0x30, 0x30, 0x30, 0x2c, 0x38, 0x38, 0x30, 
+    0x20, 0x28, 0x74, 0x68, 0x61, 0x74, 0x0a, 0x69, 0x73, 0x2c, 
+    0x20, 0x61, 0x20, 0x31, 0x30, 0x30, 0x30, 0x78, 0x31, 0x30, 
+    0x30, 0x30, 0x20, 0x62, 0x6f, 0x78, 0x20, 0x73, 0x65, 0x74, 
+    0x20, 0x31, 0x32, 0x30, 0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 
+    0x6e, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x62, 0x65, 
+    0x6c, 0x6f, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x61, 
+    0x74, 0x69, 0x6e, 0x20, 0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 
+    0x6e, 0x65, 0x29, 0x2c, 0x0a, 0x74, 0x68, 0x65, 0x6e, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 
+    0x6f, 0x66, 0x20, 0x60, 0x74, 0x79, 0x70, 0x6f, 0x5f, 0x64, 
+    0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x60, 0x20, 
+    0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x73, 0x65, 
+    0x74, 0x20, 0x74, 0x6f, 0x20, 0x2d, 0x31, 0x32, 0x30, 0x2e, 
+    0x20, 0x46, 0x61, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x74, 
+    0x6f, 0x0a, 0x61, 0x64, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 
+    0x6f, 0x20, 0x74, 0x68, 0x65, 0x73, 0x65, 0x20, 0x72, 0x65, 
+    0x71, 0x75, 0x69, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 
+    0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x75, 
+    0x6c, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x6e, 0x63, 0x6f, 
+    0x72, 0x72, 0x65, 0x63, 0x74, 0x20, 0x76, 0x65, 0x72, 0x74, 
+    0x69, 0x63, 0x61, 0x6c, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 
+    0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_typo_line_gap[663] = {
+    0x54, 0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x6f, 0x67, 0x72, 
+    0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x6c, 0x69, 0x6e, 0x65, 
+    0x20, 0x67, 0x61, 0x70, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x20, 
+    0x52, 0x65, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x74, 
+    0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 
+    0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x74, 0x68, 0x65, 0x0a, 
+    0x73, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x73, 0x20, 0x60, 0x54, 
+    0x54, 0x5f, 0x48, 0x6f, 0x72, 0x69, 0x48, 0x65, 0x61, 0x64, 
+    0x65, 0x72, 0x2e, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x67, 0x61, 
+    0x70, 0x60, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 
+    0x41, 0x70, 0x70, 0x6c, 0x65, 0x20, 0x64, 0x65, 0x66, 0x69, 
+    0x6e, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x66, 
+    0x61, 0x72, 0x0a, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 
+    0x6e, 0x74, 0x20, 0x6d, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x2e, 
+    0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x73, 0x75, 0x67, 0x67, 
+    0x65, 0x73, 0x74, 0x65, 0x64, 0x20, 0x75, 0x73, 0x61, 0x67, 
+    0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x60, 0x74, 0x79, 0x70, 
+    0x6f, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x67, 0x61, 0x70, 
+    0x60, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 
+    0x69, 0x74, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 
+    0x20, 0x69, 0x6e, 0x0a, 0x63, 0x6f, 0x6e, 0x6a, 0x75, 0x6e, 
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 
+    0x20, 0x60, 0x54, 0x54, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 
+    0x2e, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x5f, 0x70, 0x65, 0x72, 
+    0x5f, 0x65, 0x6d, 0x60, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 
+    0x6d, 0x70, 0x75, 0x74, 0x65, 0x20, 0x61, 0x20, 0x74, 0x79, 
+    0x70, 0x6f, 0x67, 0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x61, 
+    0x6c, 0x6c, 0x79, 0x0a, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x63, 
+    0x74, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 
+    0x6c, 0x69, 0x6e, 0x65, 0x20, 0x73, 0x70, 0x61, 0x63, 0x69, 
+    0x6e, 0x67, 0x2e, 0x20, 0x54, 0x79, 0x70, 0x69, 0x63, 0x61, 
+    0x6c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61, 
+    0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x20, 0x37, 0x2d, 0x31, 
+    0x30, 0x25, 0x20, 0x6f, 0x66, 0x20, 0x75, 0x6e, 0x69, 0x74, 
+    0x73, 0x0a, 0x70, 0x65, 0x72, 0x20, 0x65, 0x6d, 0x2e, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x67, 0x6f, 0x61, 0x6c, 0x20, 0x69, 
+    0x73, 0x20, 0x74, 0x6f, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 
+    0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x4d, 0x61, 
+    0x63, 0x69, 0x6e, 0x74, 0x6f, 0x73, 0x68, 0x20, 0x6f, 0x72, 
+    0x0a, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x2d, 0x73, 
+    0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 0x6d, 0x65, 
+    0x74, 0x72, 0x69, 0x63, 0x73, 0x20, 0x77, 0x68, 0x69, 0x63, 
+    0x68, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x73, 
+    0x74, 0x72, 0x61, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 
+    0x20, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x0a, 
+    0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x61, 0x62, 0x69, 0x6c, 
+    0x69, 0x74, 0x79, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x20, 0x54, 0x68, 
+    0x65, 0x73, 0x65, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x6d, 0x65, 
+    0x74, 0x72, 0x69, 0x63, 0x73, 0x2c, 0x20, 0x77, 0x68, 0x65, 
+    0x6e, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x0a, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 
+    0x64, 0x65, 0x73, 0x69, 0x67, 0x6e, 0x20, 0x77, 0x69, 0x64, 
+    0x74, 0x68, 0x73, 0x2c, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 
+    0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x20, 0x61, 0x70, 0x70, 0x6c, 
+    0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x74, 
+    0x6f, 0x20, 0x6c, 0x61, 0x79, 0x20, 0x6f, 0x75, 0x74, 0x20, 
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x0a, 
+    0x69, 0x6e, 0x20, 0x61, 0x20, 0x74, 0x79, 0x70, 0x6f, 0x67, 
+    0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x61, 0x6c, 0x6c, 0x79, 
+    0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x63, 0x74, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x70, 0x6f, 0x72, 0x74, 0x61, 0x62, 0x6c, 
+    0x65, 0x20, 0x66, 0x61, 0x73, 0x68, 0x69, 0x6f, 0x6e, 0x2e, 
+    0x20, 0x20, 0x00, 
+};
+
+char doc_TT_OS2_vend_id[622] = {
+    0x49, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x76, 0x65, 0x6e, 0x64, 0x6f, 0x72, 0x2e, 0x0a, 0x0a, 
+    0x49, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x72, 0x6f, 0x79, 0x61, 0x6c, 0x74, 
+    0x79, 0x20, 0x6f, 0x77, 0x6e, 0x65, 0x72, 0x20, 0x6f, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 
+    0x6e, 0x61, 0x6c, 0x20, 0x61, 0x72, 0x74, 0x77, 0x6f, 0x72, 
+    0x6b, 0x20, 0x62, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x63, 0x6f, 0x6d, 0x70, 0x61, 0x6e, 0x79, 0x0a, 0x72, 0x65, 
+    0x73, 0x70, 0x6f, 0x6e, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 
+    0x72, 0x6b, 0x65, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x66, 0x61, 0x63, 0x65, 
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x0a, 0x62, 
+    0x65, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 
+    0x69, 0x66, 0x69, 0x65, 0x64, 0x2e, 0x20, 0x49, 0x74, 0x20, 
+    0x69, 0x73, 0x20, 0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x61, 
+    0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x73, 0x73, 
+    0x75, 0x6d, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 
+    0x68, 0x65, 0x72, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 
+    0x62, 0x65, 0x20, 0x36, 0x0a, 0x76, 0x65, 0x6e, 0x64, 0x6f, 
+    0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x49, 0x54, 0x43, 0x20, 
+    0x5a, 0x61, 0x70, 0x66, 0x20, 0x44, 0x69, 0x6e, 0x67, 0x62, 
+    0x61, 0x74, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x75, 0x73, 
+    0x65, 0x20, 0x6f, 0x6e, 0x20, 0x64, 0x65, 0x73, 0x6b, 0x74, 
+    0x6f, 0x70, 0x20, 0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 
+    0x6d, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6e, 0x65, 0x61, 0x72, 0x0a, 0x66, 0x75, 0x74, 0x75, 0x72, 
+    0x65, 0x20, 0x28, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x20, 
+    0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x29, 0x2e, 0x20, 
+    0x49, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6c, 0x73, 0x6f, 
+    0x20, 0x6c, 0x69, 0x6b, 0x65, 0x6c, 0x79, 0x20, 0x74, 0x68, 
+    0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x65, 0x6e, 
+    0x64, 0x6f, 0x72, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 
+    0x68, 0x61, 0x76, 0x65, 0x0a, 0x6f, 0x74, 0x68, 0x65, 0x72, 
+    0x20, 0x69, 0x6e, 0x68, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x20, 
+    0x62, 0x65, 0x6e, 0x65, 0x66, 0x69, 0x74, 0x73, 0x20, 0x69, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x73, 0x20, 0x28, 0x6d, 0x6f, 0x72, 0x65, 0x20, 
+    0x6b, 0x65, 0x72, 0x6e, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 
+    0x2c, 0x20, 0x75, 0x6e, 0x72, 0x65, 0x67, 0x75, 0x6c, 0x61, 
+    0x72, 0x69, 0x7a, 0x65, 0x64, 0x0a, 0x64, 0x61, 0x74, 0x61, 
+    0x2c, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x20, 0x68, 0x69, 0x6e, 
+    0x74, 0x65, 0x64, 0x2c, 0x20, 0x65, 0x74, 0x63, 0x2e, 0x29, 
+    0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x64, 0x65, 
+    0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x20, 0x77, 0x69, 
+    0x6c, 0x6c, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x72, 
+    0x72, 0x65, 0x63, 0x74, 0x0a, 0x76, 0x65, 0x6e, 0x64, 0x6f, 
+    0x72, 0x73, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x74, 0x6f, 
+    0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x6f, 
+    0x76, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x6f, 0x74, 0x68, 0x65, 
+    0x72, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 
+    0x79, 0x20, 0x69, 0x6e, 0x66, 0x65, 0x72, 0x69, 0x6f, 0x72, 
+    0x2c, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x0a, 0x66, 0x69, 0x6c, 
+    0x65, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x73, 0x65, 0x20, 0x69, 
+    0x64, 0x27, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 
+    0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 
+    0x4d, 0x69, 0x63, 0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_TT_OS2_version[133] = {
+    0x54, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 
+    0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 
+    0x54, 0x54, 0x5f, 0x4f, 0x53, 0x32, 0x60, 0x20, 0x74, 0x61, 
+    0x62, 0x6c, 0x65, 0x2e, 0x0a, 0x0a, 0x49, 0x66, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 
+    0x77, 0x61, 0x73, 0x20, 0x73, 0x79, 0x6e, 0x74, 0x68, 0x65, 
+    0x73, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 
+    0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x74, 0x68, 
+    0x61, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6e, 0x6f, 0x20, 
+    0x4f, 0x53, 0x2f, 0x32, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 
+    0x2c, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x76, 0x65, 0x72, 0x73, 
+    0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 
+    0x20, 0x74, 0x6f, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_weight_class[134] = {
+    0x41, 0x20, 0x60, 0x54, 0x54, 0x5f, 0x57, 0x45, 0x49, 0x47, 
+    0x48, 0x54, 0x5f, 0x43, 0x4c, 0x41, 0x53, 0x53, 0x60, 0x20, 
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x20, 0x20, 0x49, 0x6e, 
+    0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x76, 0x69, 0x73, 0x75, 0x61, 0x6c, 0x20, 0x77, 
+    0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x28, 0x64, 0x65, 0x67, 
+    0x72, 0x65, 0x65, 0x20, 0x6f, 0x66, 0x0a, 0x62, 0x6c, 0x61, 
+    0x63, 0x6b, 0x6e, 0x65, 0x73, 0x73, 0x20, 0x6f, 0x72, 0x20, 
+    0x74, 0x68, 0x69, 0x63, 0x6b, 0x6e, 0x65, 0x73, 0x73, 0x20, 
+    0x6f, 0x66, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x73, 
+    0x29, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 
+    0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_width_class[632] = {
+    0x41, 0x20, 0x60, 0x54, 0x54, 0x5f, 0x57, 0x49, 0x44, 0x54, 
+    0x48, 0x5f, 0x43, 0x4c, 0x41, 0x53, 0x53, 0x60, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x2e, 0x20, 0x20, 0x49, 0x6e, 0x64, 
+    0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x72, 
+    0x65, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x63, 0x68, 
+    0x61, 0x6e, 0x67, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 
+    0x0a, 0x61, 0x73, 0x70, 0x65, 0x63, 0x74, 0x20, 0x72, 0x61, 
+    0x74, 0x69, 0x6f, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 
+    0x20, 0x74, 0x6f, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
+    0x20, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x29, 0x20, 0x61, 0x73, 
+    0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 
+    0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x72, 0x0a, 
+    0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 
+    0x79, 0x70, 0x68, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x0a, 0x0a, 0x41, 0x6c, 0x74, 
+    0x68, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x65, 0x76, 0x65, 0x72, 
+    0x79, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
+    0x72, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x68, 0x61, 0x76, 0x65, 
+    0x20, 0x61, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 
+    0x6e, 0x74, 0x20, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 
+    0x20, 0x61, 0x73, 0x70, 0x65, 0x63, 0x74, 0x0a, 0x72, 0x61, 
+    0x74, 0x69, 0x6f, 0x2c, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 
+    0x69, 0x6e, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 
+    0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x68, 0x61, 0x73, 0x20, 
+    0x61, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 
+    0x20, 0x61, 0x73, 0x70, 0x65, 0x63, 0x74, 0x0a, 0x72, 0x61, 
+    0x74, 0x69, 0x6f, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x6e, 0x65, 
+    0x2e, 0x20, 0x57, 0x68, 0x65, 0x6e, 0x20, 0x61, 0x20, 0x6e, 
+    0x65, 0x77, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x73, 0x74, 
+    0x79, 0x6c, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x72, 0x65, 
+    0x61, 0x74, 0x65, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 
+    0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x20, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x0a, 0x63, 0x6c, 0x61, 0x73, 
+    0x73, 0x20, 0x28, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 
+    0x62, 0x79, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 
+    0x64, 0x65, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x72, 0x20, 0x6f, 
+    0x72, 0x20, 0x62, 0x79, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 
+    0x61, 0x75, 0x74, 0x6f, 0x6d, 0x61, 0x74, 0x65, 0x64, 0x20, 
+    0x6d, 0x65, 0x61, 0x6e, 0x73, 0x29, 0x20, 0x74, 0x68, 0x65, 
+    0x0a, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 
+    0x61, 0x73, 0x70, 0x65, 0x63, 0x74, 0x20, 0x72, 0x61, 0x74, 
+    0x69, 0x6f, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 
+    0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 
+    0x77, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 
+    0x73, 0x6f, 0x6d, 0x65, 0x0a, 0x70, 0x65, 0x72, 0x63, 0x65, 
+    0x6e, 0x74, 0x61, 0x67, 0x65, 0x20, 0x67, 0x72, 0x65, 0x61, 
+    0x74, 0x65, 0x72, 0x20, 0x6f, 0x72, 0x20, 0x6c, 0x65, 0x73, 
+    0x73, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x74, 0x68, 0x6f, 
+    0x73, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x69, 
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 
+    0x61, 0x6c, 0x0a, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x69, 0x74, 
+    0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x64, 
+    0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x20, 
+    0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_TT_OS2_win_ascent[1167] = {
+    0x54, 0x68, 0x65, 0x20, 0x61, 0x73, 0x63, 0x65, 0x6e, 0x64, 
+    0x65, 0x72, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 
+    0x73, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x2c, 0x20, 0x74, 
+    0x6f, 0x6f, 0x2c, 0x20, 0x69, 0x73, 0x20, 0x64, 0x69, 0x73, 
+    0x74, 0x69, 0x6e, 0x63, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 
+    0x20, 0x41, 0x70, 0x70, 0x6c, 0x65, 0x27, 0x73, 0x0a, 0x60, 
+    0x54, 0x54, 0x5f, 0x48, 0x6f, 0x72, 0x69, 0x48, 0x65, 0x61, 
+    0x64, 0x65, 0x72, 0x2e, 0x61, 0x73, 0x63, 0x65, 0x6e, 0x64, 
+    0x65, 0x72, 0x60, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x60, 0x74, 0x79, 0x70, 0x6f, 0x5f, 0x61, 
+    0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x60, 0x0a, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x73, 0x2e, 0x20, 0x60, 0x77, 0x69, 
+    0x6e, 0x5f, 0x61, 0x73, 0x63, 0x65, 0x6e, 0x74, 0x60, 0x20, 
+    0x69, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 
+    0x64, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 
+    0x60, 0x79, 0x5f, 0x6d, 0x61, 0x78, 0x60, 0x60, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x69, 0x6e, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x69, 0x6e, 0x64, 0x6f, 
+    0x77, 0x73, 0x20, 0x41, 0x4e, 0x53, 0x49, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x73, 0x65, 
+    0x74, 0x2e, 0x20, 0x60, 0x77, 0x69, 0x6e, 0x5f, 0x61, 0x73, 
+    0x63, 0x65, 0x6e, 0x74, 0x60, 0x20, 0x69, 0x73, 0x20, 0x75, 
+    0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6d, 
+    0x70, 0x75, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x57, 
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x61, 
+    0x6e, 0x64, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 
+    0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x73, 0x70, 0x61, 0x63, 
+    0x69, 0x6e, 0x67, 0x2e, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x70, 
+    0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x33, 0x20, 
+    0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x0a, 0x30, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x69, 0x74, 
+    0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 
+    0x6d, 0x65, 0x20, 0x61, 0x73, 0x20, 0x60, 0x54, 0x54, 0x5f, 
+    0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2e, 0x79, 0x5f, 0x6d, 
+    0x61, 0x78, 0x60, 0x2e, 0x20, 0x57, 0x69, 0x6e, 0x64, 0x6f, 
+    0x77, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x63, 0x6c, 
+    0x69, 0x70, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x62, 0x69, 0x74, 
+    0x6d, 0x61, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x79, 
+    0x20, 0x70, 0x6f, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 
+    0x66, 0x20, 0x61, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 
+    0x72, 0x73, 0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 
+    0x20, 0x53, 0x6f, 0x6d, 0x65, 0x0a, 0x61, 0x70, 0x70, 0x6c, 
+    0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x75, 
+    0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x76, 0x61, 
+    0x6c, 0x75, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x65, 0x74, 
+    0x65, 0x72, 0x6d, 0x69, 0x6e, 0x65, 0x20, 0x64, 0x65, 0x66, 
+    0x61, 0x75, 0x6c, 0x74, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 
+    0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x54, 
+    0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x0a, 0x73, 0x74, 0x72, 
+    0x6f, 0x6e, 0x67, 0x6c, 0x79, 0x20, 0x64, 0x69, 0x73, 0x63, 
+    0x6f, 0x75, 0x72, 0x61, 0x67, 0x65, 0x64, 0x2e, 0x20, 0x54, 
+    0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x6f, 0x67, 0x72, 0x61, 
+    0x70, 0x68, 0x69, 0x63, 0x20, 0x61, 0x73, 0x63, 0x65, 0x6e, 
+    0x64, 0x65, 0x72, 0x2c, 0x20, 0x64, 0x65, 0x73, 0x63, 0x65, 
+    0x6e, 0x64, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6c, 
+    0x69, 0x6e, 0x65, 0x20, 0x67, 0x61, 0x70, 0x0a, 0x66, 0x69, 
+    0x65, 0x6c, 0x64, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x63, 0x6f, 
+    0x6e, 0x6a, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x60, 0x54, 0x54, 0x5f, 0x48, 
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x2e, 0x75, 0x6e, 0x69, 0x74, 
+    0x73, 0x5f, 0x70, 0x65, 0x72, 0x5f, 0x65, 0x6d, 0x60, 0x20, 
+    0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 
+    0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x0a, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x70, 0x75, 0x72, 0x70, 0x6f, 0x73, 
+    0x65, 0x2e, 0x20, 0x44, 0x65, 0x76, 0x65, 0x6c, 0x6f, 0x70, 
+    0x65, 0x72, 0x73, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 
+    0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x6b, 0x65, 0x65, 0x70, 
+    0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x62, 
+    0x6f, 0x76, 0x65, 0x0a, 0x66, 0x61, 0x63, 0x74, 0x6f, 0x72, 
+    0x73, 0x20, 0x69, 0x6e, 0x20, 0x6d, 0x69, 0x6e, 0x64, 0x2e, 
+    0x0a, 0x0a, 0x49, 0x66, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x63, 
+    0x6c, 0x69, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 
+    0x20, 0x75, 0x6e, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x61, 
+    0x62, 0x6c, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 
+    0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 
+    0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x0a, 0x60, 0x54, 0x54, 
+    0x5f, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2e, 0x79, 0x5f, 
+    0x6d, 0x61, 0x78, 0x60, 0x2e, 0x0a, 0x0a, 0x48, 0x6f, 0x77, 
+    0x65, 0x76, 0x65, 0x72, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x61, 
+    0x20, 0x64, 0x65, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x72, 
+    0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x73, 0x20, 0x74, 
+    0x6f, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x20, 
+    0x61, 0x70, 0x70, 0x72, 0x6f, 0x70, 0x72, 0x69, 0x61, 0x74, 
+    0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 
+    0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x73, 0x70, 0x61, 0x63, 0x69, 
+    0x6e, 0x67, 0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x2c, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x6f, 0x73, 0x65, 
+    0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 
+    0x6f, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 
+    0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x20, 0x74, 0x6f, 
+    0x20, 0x75, 0x73, 0x65, 0x0a, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+    0x64, 0x6f, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x6f, 0x20, 0x28, 
+    0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74, 0x20, 0x4f, 0x70, 
+    0x65, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x20, 0x72, 0x65, 0x63, 
+    0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x73, 0x29, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 
+    0x74, 0x68, 0x65, 0x0a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 
+    0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 
+    0x73, 0x65, 0x74, 0x20, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x70, 
+    0x72, 0x69, 0x61, 0x74, 0x65, 0x6c, 0x79, 0x2e, 0x20, 0x49, 
+    0x6e, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x20, 0x63, 
+    0x61, 0x73, 0x65, 0x2c, 0x20, 0x69, 0x74, 0x20, 0x6d, 0x61, 
+    0x79, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x69, 
+    0x6e, 0x0a, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x73, 
+    0x20, 0x62, 0x65, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6c, 0x69, 
+    0x70, 0x70, 0x65, 0x64, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_win_descent[1154] = {
+    0x54, 0x68, 0x65, 0x20, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 
+    0x64, 0x65, 0x72, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x57, 0x69, 0x6e, 0x64, 0x6f, 
+    0x77, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x2c, 0x20, 
+    0x74, 0x6f, 0x6f, 0x2c, 0x20, 0x69, 0x73, 0x20, 0x64, 0x69, 
+    0x73, 0x74, 0x69, 0x6e, 0x63, 0x74, 0x20, 0x66, 0x72, 0x6f, 
+    0x6d, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x65, 0x27, 0x73, 0x0a, 
+    0x60, 0x54, 0x54, 0x5f, 0x48, 0x6f, 0x72, 0x69, 0x48, 0x65, 
+    0x61, 0x64, 0x65, 0x72, 0x2e, 0x64, 0x65, 0x73, 0x63, 0x65, 
+    0x6e, 0x64, 0x65, 0x72, 0x60, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+    0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 
+    0x20, 0x74, 0x68, 0x65, 0x0a, 0x60, 0x74, 0x79, 0x70, 0x6f, 
+    0x5f, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 
+    0x60, 0x2e, 0x20, 0x60, 0x77, 0x69, 0x6e, 0x5f, 0x64, 0x65, 
+    0x73, 0x63, 0x65, 0x6e, 0x74, 0x60, 0x20, 0x69, 0x73, 0x20, 
+    0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x20, 0x61, 
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x60, 0x2d, 0x79, 
+    0x5f, 0x6d, 0x69, 0x6e, 0x60, 0x60, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x61, 0x6c, 0x6c, 0x0a, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 
+    0x20, 0x41, 0x4e, 0x53, 0x49, 0x20, 0x63, 0x68, 0x61, 0x72, 
+    0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x73, 0x65, 0x74, 0x2e, 
+    0x20, 0x60, 0x77, 0x69, 0x6e, 0x5f, 0x64, 0x65, 0x73, 0x63, 
+    0x65, 0x6e, 0x74, 0x60, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 
+    0x65, 0x64, 0x20, 0x74, 0x6f, 0x0a, 0x63, 0x6f, 0x6d, 0x70, 
+    0x75, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x69, 
+    0x6e, 0x64, 0x6f, 0x77, 0x73, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 
+    0x6c, 0x69, 0x6e, 0x65, 0x20, 0x73, 0x70, 0x61, 0x63, 0x69, 
+    0x6e, 0x67, 0x2e, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x70, 0x6c, 
+    0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 0x0a, 0x33, 0x20, 0x65, 
+    0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x30, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x69, 0x74, 0x20, 
+    0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 
+    0x65, 0x20, 0x61, 0x73, 0x20, 0x60, 0x60, 0x2d, 0x54, 0x54, 
+    0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2e, 0x79, 0x5f, 0x6d, 
+    0x69, 0x6e, 0x60, 0x60, 0x2e, 0x20, 0x57, 0x69, 0x6e, 0x64, 
+    0x6f, 0x77, 0x73, 0x0a, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x63, 
+    0x6c, 0x69, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 
+    0x74, 0x6d, 0x61, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 
+    0x79, 0x20, 0x70, 0x6f, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+    0x6f, 0x66, 0x20, 0x61, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x70, 0x70, 0x65, 
+    0x61, 0x72, 0x73, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x20, 
+    0x74, 0x68, 0x69, 0x73, 0x0a, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+    0x2e, 0x20, 0x53, 0x6f, 0x6d, 0x65, 0x20, 0x61, 0x70, 0x70, 
+    0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 
+    0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x65, 
+    0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x65, 0x20, 0x64, 0x65, 
+    0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x6c, 0x69, 0x6e, 0x65, 
+    0x0a, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x2e, 0x20, 
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 
+    0x72, 0x6f, 0x6e, 0x67, 0x6c, 0x79, 0x20, 0x64, 0x69, 0x73, 
+    0x63, 0x6f, 0x75, 0x72, 0x61, 0x67, 0x65, 0x64, 0x2e, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x6f, 0x67, 0x72, 
+    0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x61, 0x73, 0x63, 0x65, 
+    0x6e, 0x64, 0x65, 0x72, 0x2c, 0x0a, 0x64, 0x65, 0x73, 0x63, 
+    0x65, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x6c, 0x69, 0x6e, 0x65, 0x20, 0x67, 0x61, 0x70, 0x20, 0x66, 
+    0x69, 0x65, 0x6c, 0x64, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x63, 
+    0x6f, 0x6e, 0x6a, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x75, 0x6e, 0x69, 0x74, 
+    0x73, 0x50, 0x65, 0x72, 0x45, 0x6d, 0x20, 0x73, 0x68, 0x6f, 
+    0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x0a, 0x75, 0x73, 0x65, 
+    0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x20, 0x70, 0x75, 0x72, 0x70, 0x6f, 0x73, 0x65, 0x2e, 0x20, 
+    0x44, 0x65, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x72, 0x73, 
+    0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x73, 0x65, 
+    0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 0x65, 
+    0x6c, 0x64, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x69, 0x6e, 0x67, 
+    0x20, 0x74, 0x68, 0x65, 0x0a, 0x61, 0x62, 0x6f, 0x76, 0x65, 
+    0x20, 0x66, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x73, 0x20, 0x69, 
+    0x6e, 0x20, 0x6d, 0x69, 0x6e, 0x64, 0x2e, 0x0a, 0x0a, 0x49, 
+    0x66, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x63, 0x6c, 0x69, 0x70, 
+    0x70, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x75, 0x6e, 
+    0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x61, 0x62, 0x6c, 0x65, 
+    0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x73, 0x68, 0x6f, 
+    0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x73, 0x65, 0x74, 
+    0x20, 0x74, 0x6f, 0x0a, 0x60, 0x54, 0x54, 0x5f, 0x48, 0x65, 
+    0x61, 0x64, 0x65, 0x72, 0x2e, 0x79, 0x5f, 0x6d, 0x69, 0x6e, 
+    0x60, 0x2e, 0x0a, 0x0a, 0x48, 0x6f, 0x77, 0x65, 0x76, 0x65, 
+    0x72, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x61, 0x20, 0x64, 0x65, 
+    0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x72, 0x20, 0x64, 0x65, 
+    0x73, 0x69, 0x72, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x70, 
+    0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x20, 0x61, 0x70, 0x70, 
+    0x72, 0x6f, 0x70, 0x72, 0x69, 0x61, 0x74, 0x65, 0x20, 0x64, 
+    0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x6c, 0x69, 0x6e, 
+    0x65, 0x0a, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x20, 
+    0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x2c, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x74, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x61, 0x70, 
+    0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 
+    0x69, 0x6e, 0x75, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 
+    0x65, 0x0a, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 0x65, 
+    0x6c, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x6f, 0x69, 
+    0x6e, 0x67, 0x20, 0x73, 0x6f, 0x20, 0x28, 0x61, 0x67, 0x61, 
+    0x69, 0x6e, 0x73, 0x74, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x54, 
+    0x79, 0x70, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x6d, 0x6d, 
+    0x65, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 
+    0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 
+    0x0a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x73, 0x68, 0x6f, 
+    0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x73, 0x65, 0x74, 
+    0x20, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x70, 0x72, 0x69, 0x61, 
+    0x74, 0x65, 0x6c, 0x79, 0x2e, 0x20, 0x49, 0x6e, 0x20, 0x73, 
+    0x75, 0x63, 0x68, 0x20, 0x61, 0x20, 0x63, 0x61, 0x73, 0x65, 
+    0x2c, 0x20, 0x69, 0x74, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x72, 
+    0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x6e, 0x0a, 0x73, 
+    0x6f, 0x6d, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x73, 0x20, 0x62, 0x65, 
+    0x69, 0x6e, 0x67, 0x20, 0x63, 0x6c, 0x69, 0x70, 0x70, 0x65, 
+    0x64, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_x_avg_char_width[487] = {
+    0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x69, 0x74, 0x68, 0x6d, 
+    0x65, 0x74, 0x69, 0x63, 0x20, 0x61, 0x76, 0x65, 0x72, 0x61, 
+    0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x61, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6c, 0x6c, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x32, 0x36, 
+    0x0a, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x63, 0x61, 0x73, 0x65, 
+    0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x73, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x61, 0x74, 0x69, 
+    0x6e, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x62, 0x65, 0x74, 
+    0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 
+    0x70, 0x61, 0x63, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x2e, 0x20, 0x49, 0x66, 0x0a, 0x61, 
+    0x6e, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x32, 0x36, 0x20, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x63, 0x61, 
+    0x73, 0x65, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x73, 
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x70, 
+    0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x68, 
+    0x69, 0x73, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 
+    0x65, 0x72, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x0a, 
+    0x65, 0x71, 0x75, 0x61, 0x6c, 0x20, 0x7a, 0x65, 0x72, 0x6f, 
+    0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x70, 0x61, 
+    0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x20, 0x69, 0x73, 
+    0x20, 0x61, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 
+    0x74, 0x69, 0x76, 0x65, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 
+    0x62, 0x75, 0x74, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x74, 0x68, 0x61, 
+    0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 
+    0x73, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x61, 0x63, 
+    0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x75, 0x73, 
+    0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6d, 
+    0x70, 0x61, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x6e, 0x65, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x61, 
+    0x6e, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x66, 0x6f, 0x72, 
+    0x0a, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x6f, 0x72, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x69, 
+    0x74, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x46, 0x6f, 
+    0x72, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x6f, 0x72, 0x74, 0x69, 
+    0x6f, 0x6e, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x73, 0x70, 0x61, 
+    0x63, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2c, 
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x76, 0x61, 0x6c, 0x75, 
+    0x65, 0x0a, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x66, 0x75, 
+    0x6c, 0x20, 0x69, 0x6e, 0x20, 0x65, 0x73, 0x74, 0x69, 0x6d, 
+    0x61, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x65, 0x78, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_x_height[671] = {
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 
+    0x63, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x69, 0x73, 0x74, 
+    0x61, 0x6e, 0x63, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 
+    0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x73, 
+    0x65, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x74, 0x68, 0x65, 0x0a, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x78, 
+    0x69, 0x6d, 0x61, 0x74, 0x65, 0x20, 0x68, 0x65, 0x69, 0x67, 
+    0x68, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 
+    0x61, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 
+    0x6c, 0x6f, 0x77, 0x65, 0x72, 0x63, 0x61, 0x73, 0x65, 0x20, 
+    0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x73, 0x20, 0x6d, 0x65, 
+    0x61, 0x73, 0x75, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x0a, 0x75, 0x6e, 0x69, 0x74, 0x73, 
+    0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x76, 0x61, 0x6c, 
+    0x75, 0x65, 0x20, 0x77, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6e, 
+    0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x62, 0x65, 
+    0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 
+    0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x74, 0x79, 0x70, 0x65, 
+    0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x72, 0x20, 
+    0x62, 0x75, 0x74, 0x0a, 0x69, 0x6e, 0x20, 0x73, 0x69, 0x74, 
+    0x75, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x77, 0x68, 
+    0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 
+    0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x73, 
+    0x69, 0x62, 0x6c, 0x65, 0x2c, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+    0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x77, 0x68, 
+    0x65, 0x6e, 0x20, 0x61, 0x20, 0x6c, 0x65, 0x67, 0x61, 0x63, 
+    0x79, 0x0a, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 
+    0x62, 0x65, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6e, 0x76, 
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x2c, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6d, 0x61, 0x79, 
+    0x20, 0x62, 0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x65, 0x71, 
+    0x75, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x74, 0x6f, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x0a, 0x75, 0x6e, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x64, 
+    0x20, 0x61, 0x6e, 0x64, 0x20, 0x75, 0x6e, 0x68, 0x69, 0x6e, 
+    0x74, 0x65, 0x64, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 
+    0x62, 0x6f, 0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 
+    0x6f, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x65, 0x6e, 0x63, 0x6f, 
+    0x64, 0x65, 0x64, 0x20, 0x61, 0x74, 0x0a, 0x60, 0x60, 0x55, 
+    0x2b, 0x30, 0x30, 0x37, 0x38, 0x60, 0x60, 0x20, 0x28, 0x60, 
+    0x60, 0x4c, 0x41, 0x54, 0x49, 0x4e, 0x20, 0x53, 0x4d, 0x41, 
+    0x4c, 0x4c, 0x20, 0x4c, 0x45, 0x54, 0x54, 0x45, 0x52, 0x20, 
+    0x58, 0x60, 0x60, 0x29, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x6e, 
+    0x6f, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x69, 0x73, 
+    0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x20, 0x69, 
+    0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x70, 0x6f, 0x73, 
+    0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x73, 0x68, 0x6f, 0x75, 
+    0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 
+    0x74, 0x6f, 0x20, 0x30, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x69, 
+    0x73, 0x20, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x2c, 0x20, 
+    0x69, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 
+    0x65, 0x64, 0x2c, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 
+    0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x69, 
+    0x74, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x74, 0x68, 
+    0x65, 0x0a, 0x60, 0x78, 0x5f, 0x68, 0x65, 0x69, 0x67, 0x68, 
+    0x74, 0x60, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f, 
+    0x66, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x73, 0x63, 
+    0x61, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x70, 
+    0x70, 0x72, 0x6f, 0x78, 0x69, 0x6d, 0x61, 0x74, 0x65, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x61, 0x70, 0x70, 0x61, 0x72, 0x65, 
+    0x6e, 0x74, 0x0a, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 0x66, 
+    0x20, 0x61, 0x6e, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_TT_OS2_y_strikeout_position[417] = {
+    0x54, 0x68, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 
+    0x69, 0x6b, 0x65, 0x6f, 0x75, 0x74, 0x20, 0x6c, 0x69, 0x6e, 
+    0x65, 0x2e, 0x20, 0x20, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 
+    0x76, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 
+    0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x20, 
+    0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x0a, 
+    0x61, 0x62, 0x6f, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20, 
+    0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x6e, 0x65, 0x67, 0x61, 
+    0x74, 0x69, 0x76, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+    0x73, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 
+    0x74, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 
+    0x73, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x0a, 0x74, 0x68, 
+    0x65, 0x20, 0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 
+    0x2e, 0x20, 0x41, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 
+    0x6f, 0x66, 0x20, 0x7a, 0x65, 0x72, 0x6f, 0x20, 0x66, 0x61, 
+    0x6c, 0x6c, 0x73, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 
+    0x6c, 0x79, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20, 
+    0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x61, 0x0a, 0x76, 0x61, 
+    0x6c, 0x75, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x6e, 0x65, 
+    0x20, 0x66, 0x61, 0x6c, 0x6c, 0x73, 0x20, 0x6f, 0x6e, 0x65, 
+    0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x20, 0x61, 0x62, 0x6f, 
+    0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x73, 
+    0x65, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x65, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f, 0x66, 0x0a, 
+    0x73, 0x74, 0x72, 0x69, 0x6b, 0x65, 0x6f, 0x75, 0x74, 0x20, 
+    0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 
+    0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6e, 0x6f, 0x74, 0x20, 
+    0x69, 0x6e, 0x74, 0x65, 0x72, 0x66, 0x65, 0x72, 0x65, 0x20, 
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 
+    0x65, 0x63, 0x6f, 0x67, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x6f, 0x66, 0x0a, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x61, 
+    0x72, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 
+    0x68, 0x65, 0x72, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x73, 
+    0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6e, 0x6f, 0x74, 0x20, 
+    0x6c, 0x69, 0x6e, 0x65, 0x20, 0x75, 0x70, 0x20, 0x77, 0x69, 
+    0x74, 0x68, 0x20, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x62, 0x61, 
+    0x72, 0x73, 0x0a, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_y_strikeout_size[362] = {
+    0x54, 0x68, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 
+    0x6b, 0x65, 0x6f, 0x75, 0x74, 0x20, 0x6c, 0x69, 0x6e, 0x65, 
+    0x2e, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 
+    0x65, 0x6c, 0x64, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 
+    0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x6c, 0x79, 0x20, 
+    0x62, 0x65, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x77, 0x69, 0x64, 
+    0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x65, 0x6d, 0x2d, 0x64, 0x61, 0x73, 0x68, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 
+    0x65, 0x6e, 0x74, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x20, 
+    0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x7a, 
+    0x65, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x65, 0x2c, 0x20, 
+    0x74, 0x68, 0x65, 0x0a, 0x73, 0x74, 0x72, 0x69, 0x6b, 0x65, 
+    0x6f, 0x75, 0x74, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x77, 
+    0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x72, 0x65, 0x70, 0x72, 
+    0x65, 0x73, 0x65, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6b, 
+    0x65, 0x6f, 0x75, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 
+    0x69, 0x6f, 0x6e, 0x0a, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x2e, 
+    0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 
+    0x6c, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x74, 0x77, 0x6f, 
+    0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 
+    0x6b, 0x65, 0x6f, 0x75, 0x74, 0x20, 0x6c, 0x69, 0x6e, 0x65, 
+    0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x72, 0x65, 
+    0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x65, 0x64, 0x20, 
+    0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 
+    0x69, 0x6b, 0x65, 0x6f, 0x75, 0x74, 0x20, 0x70, 0x6f, 0x73, 
+    0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x69, 
+    0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x6c, 0x79, 
+    0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x0a, 0x74, 0x68, 0x65, 
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6b, 0x65, 0x6f, 0x75, 0x74, 
+    0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_TT_OS2_y_subscript_x_offset[705] = {
+    0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 
+    0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x65, 0x73, 
+    0x69, 0x67, 0x6e, 0x65, 0x72, 0x27, 0x73, 0x20, 0x72, 0x65, 
+    0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 
+    0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 
+    0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x66, 0x6f, 
+    0x72, 0x0a, 0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 
+    0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
+    0x72, 0x73, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x69, 0x73, 0x20, 
+    0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x6f, 
+    0x72, 0x69, 0x67, 0x69, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x74, 0x6f, 
+    0x0a, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 
+    0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 
+    0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x27, 0x73, 
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 
+    0x2e, 0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 
+    0x0a, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x61, 
+    0x6c, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 0x73, 
+    0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x61, 0x6e, 0x20, 0x61, 0x70, 0x70, 
+    0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x0a, 
+    0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x70, 
+    0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+    0x63, 0x61, 0x6e, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x69, 
+    0x74, 0x75, 0x74, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x69, 
+    0x73, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 
+    0x72, 0x0a, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6f, 
+    0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x68, 0x6f, 
+    0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x70, 
+    0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x72, 
+    0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x0a, 0x65, 0x73, 0x63, 
+    0x61, 0x70, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x70, 0x6f, 
+    0x69, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x6c, 0x61, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 
+    0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x62, 0x65, 0x66, 0x6f, 
+    0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 
+    0x73, 0x74, 0x20, 0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 
+    0x70, 0x74, 0x0a, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x2e, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x75, 0x70, 
+    0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 
+    0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x20, 0x74, 0x68, 
+    0x69, 0x73, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x69, 
+    0x73, 0x20, 0x75, 0x73, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 
+    0x7a, 0x65, 0x72, 0x6f, 0x3b, 0x0a, 0x68, 0x6f, 0x77, 0x65, 
+    0x76, 0x65, 0x72, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
+    0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x6e, 
+    0x20, 0x69, 0x6e, 0x63, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x28, 
+    0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x0a, 0x63, 0x68, 0x61, 
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x29, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 
+    0x63, 0x65, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 
+    0x70, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x73, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x75, 
+    0x61, 0x6c, 0x6c, 0x79, 0x0a, 0x61, 0x64, 0x6a, 0x75, 0x73, 
+    0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6d, 
+    0x70, 0x65, 0x6e, 0x73, 0x61, 0x74, 0x65, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x6e, 0x67, 0x6c, 
+    0x65, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x69, 
+    0x6e, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_y_subscript_x_size[826] = {
+    0x4d, 0x61, 0x70, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x65, 0x6d, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 
+    0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x62, 
+    0x65, 0x69, 0x6e, 0x67, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x73, 0x75, 0x62, 0x73, 
+    0x63, 0x72, 0x69, 0x70, 0x74, 0x2e, 0x20, 0x20, 0x49, 0x66, 
+    0x0a, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x68, 0x61, 
+    0x73, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x72, 0x65, 0x63, 0x6f, 
+    0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x73, 0x69, 
+    0x7a, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x75, 
+    0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x73, 0x2c, 0x20, 
+    0x65, 0x2e, 0x67, 0x2e, 0x2c, 0x20, 0x6e, 0x75, 0x6d, 0x65, 
+    0x72, 0x69, 0x63, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x6f, 
+    0x74, 0x68, 0x65, 0x72, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x20, 0x73, 0x69, 
+    0x7a, 0x65, 0x73, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 
+    0x20, 0x62, 0x65, 0x20, 0x73, 0x74, 0x72, 0x65, 0x73, 0x73, 
+    0x65, 0x64, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x68, 
+    0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x0a, 
+    0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 
+    0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x65, 0x73, 
+    0x69, 0x67, 0x6e, 0x65, 0x72, 0x27, 0x73, 0x20, 0x72, 0x65, 
+    0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 
+    0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 
+    0x20, 0x66, 0x6f, 0x72, 0x0a, 0x73, 0x75, 0x62, 0x73, 0x63, 
+    0x72, 0x69, 0x70, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 
+    0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 
+    0x68, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 
+    0x74, 0x0a, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 
+    0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 
+    0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6e, 0x20, 0x61, 0x70, 
+    0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 
+    0x0a, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 
+    0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 
+    0x20, 0x63, 0x61, 0x6e, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 
+    0x69, 0x74, 0x75, 0x74, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 
+    0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x62, 0x79, 0x20, 
+    0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
+    0x72, 0x0a, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x6f, 0x72, 0x20, 0x62, 0x79, 0x20, 0x73, 0x75, 
+    0x62, 0x73, 0x74, 0x69, 0x74, 0x75, 0x74, 0x69, 0x6e, 0x67, 
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 
+    0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x61, 0x6e, 0x6f, 
+    0x74, 0x68, 0x65, 0x72, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2c, 
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x70, 0x61, 0x72, 0x61, 
+    0x6d, 0x65, 0x74, 0x65, 0x72, 0x20, 0x73, 0x70, 0x65, 0x63, 
+    0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x72, 0x65, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 
+    0x64, 0x20, 0x65, 0x6d, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 
+    0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x6f, 0x73, 
+    0x65, 0x20, 0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 
+    0x74, 0x0a, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
+    0x72, 0x73, 0x2e, 0x20, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x65, 
+    0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2c, 0x20, 0x69, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6d, 0x20, 0x73, 0x71, 
+    0x75, 0x61, 0x72, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 0x32, 
+    0x30, 0x34, 0x38, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x60, 0x79, 
+    0x5f, 0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 
+    0x5f, 0x78, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x60, 0x20, 0x69, 
+    0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x32, 
+    0x30, 0x35, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 
+    0x74, 0x61, 0x6c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x61, 0x0a, 0x73, 0x69, 0x6d, 0x75, 0x6c, 
+    0x61, 0x74, 0x65, 0x64, 0x20, 0x73, 0x75, 0x62, 0x73, 0x63, 
+    0x72, 0x69, 0x70, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x20, 0x77, 0x6f, 0x75, 0x6c, 0x64, 
+    0x20, 0x62, 0x65, 0x20, 0x31, 0x2f, 0x31, 0x30, 0x74, 0x68, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x72, 
+    0x6d, 0x61, 0x6c, 0x0a, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+    0x74, 0x65, 0x72, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_y_subscript_y_offset[432] = {
+    0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 
+    0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x65, 0x73, 
+    0x69, 0x67, 0x6e, 0x65, 0x72, 0x27, 0x73, 0x20, 0x72, 0x65, 
+    0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 
+    0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x6f, 
+    0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 
+    0x20, 0x74, 0x68, 0x65, 0x0a, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x20, 0x62, 0x61, 0x73, 0x65, 0x6c, 
+    0x69, 0x6e, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 
+    0x20, 0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 
+    0x69, 0x70, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+    0x74, 0x65, 0x72, 0x73, 0x0a, 0x61, 0x73, 0x73, 0x6f, 0x63, 
+    0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x2e, 0x20, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61, 
+    0x72, 0x65, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 
+    0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x70, 0x6f, 
+    0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x20, 0x6f, 0x66, 0x66, 
+    0x73, 0x65, 0x74, 0x0a, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+    0x74, 0x65, 0x72, 0x20, 0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 
+    0x6e, 0x65, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 
+    0x6f, 0x74, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 
+    0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x0a, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 
+    0x20, 0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6e, 0x20, 0x61, 0x70, 
+    0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x61, 0x72, 0x61, 
+    0x6d, 0x65, 0x74, 0x65, 0x72, 0x20, 0x73, 0x70, 0x65, 0x63, 
+    0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x0a, 
+    0x72, 0x65, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 
+    0x64, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 
+    0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 
+    0x62, 0x65, 0x6c, 0x6f, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 
+    0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x74, 0x68, 0x6f, 0x73, 0x65, 0x0a, 0x73, 
+    0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x2e, 
+    0x0a, 0x00, 
+};
+
+char doc_TT_OS2_y_subscript_y_size[830] = {
+    0x4d, 0x61, 0x70, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x65, 0x6d, 0x48, 0x65, 0x69, 0x67, 0x68, 0x74, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x20, 0x62, 0x65, 0x69, 0x6e, 0x67, 0x20, 0x75, 
+    0x73, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 
+    0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x2e, 
+    0x20, 0x20, 0x49, 0x66, 0x20, 0x61, 0x0a, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x68, 0x61, 0x73, 0x20, 0x74, 0x77, 0x6f, 0x20, 
+    0x72, 0x65, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 
+    0x64, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 
+    0x74, 0x73, 0x2c, 0x20, 0x65, 0x2e, 0x67, 0x2e, 0x20, 0x6e, 
+    0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x73, 0x20, 0x61, 0x6e, 
+    0x64, 0x0a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x2c, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 
+    0x20, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x20, 0x73, 0x68, 0x6f, 
+    0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x73, 0x74, 0x72, 
+    0x65, 0x73, 0x73, 0x65, 0x64, 0x2e, 0x20, 0x54, 0x68, 0x65, 
+    0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 
+    0x6c, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a, 
+    0x65, 0x0a, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 
+    0x73, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 
+    0x65, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x72, 0x27, 0x73, 0x20, 
+    0x72, 0x65, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x61, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x68, 
+    0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 
+    0x6f, 0x66, 0x0a, 0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 
+    0x70, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 
+    0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 
+    0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x0a, 
+    0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x61, 0x6c, 
+    0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 
+    0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 0x73, 0x75, 
+    0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x61, 0x6e, 0x20, 0x61, 0x70, 0x70, 0x6c, 
+    0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x0a, 0x61, 
+    0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x70, 0x70, 
+    0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 
+    0x61, 0x6e, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x69, 0x74, 
+    0x75, 0x74, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+    0x74, 0x65, 0x72, 0x73, 0x20, 0x62, 0x79, 0x20, 0x73, 0x63, 
+    0x61, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x0a, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 
+    0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x6f, 0x72, 0x20, 0x62, 0x79, 0x20, 0x73, 0x75, 0x62, 
+    0x73, 0x74, 0x69, 0x74, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 
+    0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x61, 0x6e, 0x6f, 0x74, 
+    0x68, 0x65, 0x72, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2c, 0x0a, 
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d, 
+    0x65, 0x74, 0x65, 0x72, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 
+    0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 
+    0x65, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x64, 
+    0x20, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 
+    0x6c, 0x20, 0x45, 0x6d, 0x49, 0x6e, 0x63, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x74, 0x68, 0x6f, 0x73, 0x65, 0x0a, 0x73, 0x75, 
+    0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x2e, 0x20, 
+    0x20, 0x46, 0x6f, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x70, 
+    0x6c, 0x65, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x65, 0x6d, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x69, 0x73, 0x0a, 0x32, 0x30, 0x34, 0x38, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x60, 0x79, 0x5f, 0x73, 0x75, 0x62, 
+    0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x5f, 0x79, 0x5f, 0x73, 
+    0x69, 0x7a, 0x65, 0x60, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 
+    0x74, 0x20, 0x74, 0x6f, 0x20, 0x32, 0x30, 0x35, 0x2c, 0x20, 
+    0x74, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 
+    0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x73, 0x69, 
+    0x7a, 0x65, 0x0a, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x73, 
+    0x69, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x20, 0x73, 
+    0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x77, 
+    0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x31, 0x2f, 
+    0x31, 0x30, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 
+    0x69, 0x7a, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x0a, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_y_superscript_x_offset[655] = {
+    0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 
+    0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x65, 0x73, 
+    0x69, 0x67, 0x6e, 0x65, 0x72, 0x27, 0x73, 0x20, 0x72, 0x65, 
+    0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 
+    0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 
+    0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x73, 0x75, 0x70, 0x65, 
+    0x72, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x61, 
+    0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x20, 0x20, 0x49, 0x74, 0x20, 
+    0x69, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 
+    0x65, 0x0a, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
+    0x72, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x20, 0x74, 
+    0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x70, 0x65, 
+    0x72, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x27, 0x73, 0x20, 
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x2e, 0x20, 0x49, 0x66, 
+    0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x6f, 
+    0x65, 0x73, 0x0a, 0x6e, 0x6f, 0x74, 0x20, 0x69, 0x6e, 0x63, 
+    0x6c, 0x75, 0x64, 0x65, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 
+    0x69, 0x72, 0x65, 0x64, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 
+    0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x61, 0x6e, 0x0a, 0x61, 0x70, 0x70, 0x6c, 0x69, 
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x74, 0x68, 
+    0x69, 0x73, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 
+    0x65, 0x72, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 
+    0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x63, 
+    0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x68, 
+    0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x0a, 
+    0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 
+    0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x73, 
+    0x63, 0x61, 0x70, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x70, 
+    0x6f, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
+    0x72, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x0a, 0x73, 
+    0x75, 0x70, 0x65, 0x72, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 
+    0x2e, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x75, 0x70, 0x72, 0x69, 
+    0x67, 0x68, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+    0x74, 0x65, 0x72, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 
+    0x75, 0x73, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x0a, 0x7a, 0x65, 
+    0x72, 0x6f, 0x3b, 0x20, 0x68, 0x6f, 0x77, 0x65, 0x76, 0x65, 
+    0x72, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 
+    0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x20, 0x69, 
+    0x6e, 0x63, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x28, 0x69, 0x74, 
+    0x61, 0x6c, 0x69, 0x63, 0x0a, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x73, 0x29, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 
+    0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 0x73, 0x63, 0x72, 0x69, 
+    0x70, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x73, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x75, 
+    0x61, 0x6c, 0x6c, 0x79, 0x0a, 0x61, 0x64, 0x6a, 0x75, 0x73, 
+    0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6d, 
+    0x70, 0x65, 0x6e, 0x73, 0x61, 0x74, 0x65, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x6e, 0x67, 0x6c, 
+    0x65, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x69, 
+    0x6e, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_y_superscript_x_size[833] = {
+    0x4d, 0x61, 0x70, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x65, 0x6d, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 
+    0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x62, 
+    0x65, 0x69, 0x6e, 0x67, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 
+    0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x73, 0x75, 0x62, 0x73, 
+    0x63, 0x72, 0x69, 0x70, 0x74, 0x2e, 0x20, 0x20, 0x49, 0x66, 
+    0x0a, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x68, 0x61, 
+    0x73, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x72, 0x65, 0x63, 0x6f, 
+    0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x73, 0x69, 
+    0x7a, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x75, 
+    0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x73, 0x2c, 0x20, 
+    0x65, 0x2e, 0x67, 0x2e, 0x2c, 0x20, 0x6e, 0x75, 0x6d, 0x65, 
+    0x72, 0x69, 0x63, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x6f, 
+    0x74, 0x68, 0x65, 0x72, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x20, 0x73, 0x69, 
+    0x7a, 0x65, 0x73, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 
+    0x20, 0x62, 0x65, 0x20, 0x73, 0x74, 0x72, 0x65, 0x73, 0x73, 
+    0x65, 0x64, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x68, 
+    0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x0a, 
+    0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 
+    0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x65, 0x73, 
+    0x69, 0x67, 0x6e, 0x65, 0x72, 0x27, 0x73, 0x20, 0x72, 0x65, 
+    0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 
+    0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 
+    0x20, 0x66, 0x6f, 0x72, 0x0a, 0x73, 0x75, 0x70, 0x65, 0x72, 
+    0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x61, 0x73, 
+    0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 
+    0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 
+    0x6e, 0x6f, 0x74, 0x0a, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 
+    0x65, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 
+    0x64, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 0x73, 0x63, 0x72, 
+    0x69, 0x70, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+    0x74, 0x65, 0x72, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 
+    0x6e, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 
+    0x69, 0x6f, 0x6e, 0x2c, 0x0a, 0x61, 0x6e, 0x64, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x73, 
+    0x75, 0x62, 0x73, 0x74, 0x69, 0x74, 0x75, 0x74, 0x65, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 
+    0x20, 0x62, 0x79, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 
+    0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 
+    0x61, 0x63, 0x74, 0x65, 0x72, 0x0a, 0x6f, 0x66, 0x20, 0x61, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x6f, 0x72, 0x20, 0x62, 
+    0x79, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x69, 0x74, 0x75, 
+    0x74, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 
+    0x20, 0x61, 0x6e, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x20, 
+    0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x6d, 0x6d, 
+    0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x65, 0x6d, 0x20, 0x73, 
+    0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+    0x74, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x73, 0x75, 0x70, 0x65, 
+    0x72, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x0a, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x2e, 0x20, 
+    0x20, 0x46, 0x6f, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x70, 
+    0x6c, 0x65, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x65, 0x6d, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 
+    0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x20, 0x69, 0x73, 0x20, 0x32, 0x30, 0x34, 0x38, 0x20, 
+    0x61, 0x6e, 0x64, 0x0a, 0x60, 0x79, 0x53, 0x75, 0x70, 0x65, 
+    0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x58, 0x53, 0x69, 
+    0x7a, 0x65, 0x60, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 
+    0x20, 0x74, 0x6f, 0x20, 0x32, 0x30, 0x35, 0x2c, 0x20, 0x74, 
+    0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 
+    0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x73, 
+    0x69, 0x7a, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x0a, 
+    0x73, 0x69, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x20, 
+    0x73, 0x75, 0x70, 0x65, 0x72, 0x73, 0x63, 0x72, 0x69, 0x70, 
+    0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
+    0x72, 0x20, 0x77, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 
+    0x20, 0x31, 0x2f, 0x31, 0x30, 0x74, 0x68, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 
+    0x0a, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_OS2_y_superscript_y_offset[491] = {
+    0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 
+    0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x65, 0x73, 
+    0x69, 0x67, 0x6e, 0x65, 0x72, 0x27, 0x73, 0x20, 0x72, 0x65, 
+    0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 
+    0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x6f, 
+    0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x0a, 
+    0x73, 0x75, 0x70, 0x65, 0x72, 0x73, 0x63, 0x72, 0x69, 0x70, 
+    0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x65, 0x74, 
+    0x65, 0x72, 0x73, 0x2e, 0x20, 0x20, 0x49, 0x74, 0x20, 0x69, 
+    0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 
+    0x20, 0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x20, 
+    0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x73, 0x75, 0x70, 
+    0x65, 0x72, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x27, 0x73, 
+    0x20, 0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x20, 
+    0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x20, 0x56, 0x61, 0x6c, 
+    0x75, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x0a, 0x74, 0x68, 
+    0x69, 0x73, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 
+    0x65, 0x72, 0x20, 0x61, 0x72, 0x65, 0x20, 0x65, 0x78, 0x70, 
+    0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 
+    0x61, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 
+    0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x61, 0x62, 
+    0x6f, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x0a, 0x62, 0x61, 
+    0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x20, 0x49, 0x66, 
+    0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x6f, 
+    0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x69, 0x6e, 0x63, 
+    0x6c, 0x75, 0x64, 0x65, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 
+    0x69, 0x72, 0x65, 0x64, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 
+    0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x0a, 0x63, 0x68, 0x61, 
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x61, 0x6e, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x74, 0x68, 
+    0x69, 0x73, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 
+    0x65, 0x72, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 
+    0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x72, 0x65, 0x63, 
+    0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x76, 
+    0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x64, 0x69, 
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x61, 0x62, 0x6f, 
+    0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x62, 0x61, 0x73, 
+    0x65, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+    0x74, 0x68, 0x6f, 0x73, 0x65, 0x0a, 0x73, 0x75, 0x70, 0x65, 
+    0x72, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_TT_OS2_y_superscript_y_size[817] = {
+    0x4d, 0x61, 0x70, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x65, 0x6d, 0x48, 0x65, 0x69, 0x67, 0x68, 0x74, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x20, 0x62, 0x65, 0x69, 0x6e, 0x67, 0x20, 0x75, 
+    0x73, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 
+    0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x2e, 
+    0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+    0x0a, 0x68, 0x61, 0x73, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x72, 
+    0x65, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x64, 
+    0x20, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 
+    0x73, 0x2c, 0x20, 0x65, 0x2e, 0x67, 0x2e, 0x2c, 0x20, 0x6e, 
+    0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x73, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x2c, 0x0a, 0x74, 
+    0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 
+    0x20, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x20, 0x73, 0x68, 0x6f, 
+    0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x73, 0x74, 0x72, 
+    0x65, 0x73, 0x73, 0x65, 0x64, 0x2e, 0x20, 0x54, 0x68, 0x65, 
+    0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 
+    0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x0a, 
+    0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x64, 0x65, 0x73, 
+    0x69, 0x67, 0x6e, 0x65, 0x72, 0x27, 0x73, 0x20, 0x72, 0x65, 
+    0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 
+    0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 0x73, 0x63, 
+    0x72, 0x69, 0x70, 0x74, 0x0a, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 
+    0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 
+    0x68, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x66, 0x6f, 
+    0x6e, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 
+    0x74, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 
+    0x61, 0x6c, 0x6c, 0x0a, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 
+    0x73, 0x75, 0x70, 0x65, 0x72, 0x73, 0x63, 0x72, 0x69, 0x70, 
+    0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 
+    0x72, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6e, 0x20, 
+    0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 
+    0x6e, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 
+    0x0a, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 
+    0x6f, 0x6e, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x73, 0x75, 0x62, 
+    0x73, 0x74, 0x69, 0x74, 0x75, 0x74, 0x65, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x62, 
+    0x79, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+    0x74, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x0a, 0x66, 
+    0x6f, 0x6e, 0x74, 0x20, 0x6f, 0x72, 0x20, 0x62, 0x79, 0x20, 
+    0x73, 0x75, 0x62, 0x73, 0x74, 0x69, 0x74, 0x75, 0x74, 0x69, 
+    0x6e, 0x67, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+    0x65, 0x72, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x61, 
+    0x6e, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x61, 
+    0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x0a, 0x73, 0x70, 
+    0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 
+    0x64, 0x65, 0x64, 0x20, 0x45, 0x6d, 0x48, 0x65, 0x69, 0x67, 
+    0x68, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x6f, 
+    0x73, 0x65, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 0x73, 0x63, 
+    0x72, 0x69, 0x70, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x73, 0x2e, 0x0a, 0x46, 0x6f, 0x72, 
+    0x20, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2c, 0x20, 
+    0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6d, 0x20, 
+    0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x66, 0x6f, 0x72, 
+    0x20, 0x61, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x69, 0x73, 
+    0x20, 0x32, 0x30, 0x34, 0x38, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+    0x60, 0x79, 0x53, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 
+    0x69, 0x70, 0x74, 0x59, 0x53, 0x69, 0x7a, 0x65, 0x60, 0x0a, 
+    0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x20, 
+    0x32, 0x30, 0x35, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 
+    0x61, 0x6c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6d, 0x75, 0x6c, 0x61, 
+    0x74, 0x65, 0x64, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 0x73, 
+    0x63, 0x72, 0x69, 0x70, 0x74, 0x0a, 0x63, 0x68, 0x61, 0x72, 
+    0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x77, 0x6f, 0x75, 0x6c, 
+    0x64, 0x20, 0x62, 0x65, 0x20, 0x31, 0x2f, 0x31, 0x30, 0x74, 
+    0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 
+    0x72, 0x6d, 0x61, 0x6c, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 
+    0x63, 0x74, 0x65, 0x72, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_WEIGHT_CLASS[218] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x57, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x76, 0x61, 
+    0x6c, 0x75, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x60, 0x54, 0x54, 0x5f, 0x4f, 0x53, 0x32, 
+    0x2e, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x63, 0x6c, 
+    0x61, 0x73, 0x73, 0x60, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x65, 
+    0x72, 0x74, 0x79, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x55, 
+    0x4c, 0x54, 0x52, 0x41, 0x5f, 0x4c, 0x49, 0x47, 0x48, 0x54, 
+    0x60, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x45, 0x58, 0x54, 0x52, 
+    0x41, 0x5f, 0x4c, 0x49, 0x47, 0x48, 0x54, 0x60, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x4c, 0x49, 0x47, 0x48, 0x54, 0x60, 0x0a, 
+    0x0a, 0x2d, 0x20, 0x60, 0x53, 0x45, 0x4d, 0x49, 0x5f, 0x4c, 
+    0x49, 0x47, 0x48, 0x54, 0x60, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 
+    0x4d, 0x45, 0x44, 0x49, 0x55, 0x4d, 0x60, 0x20, 0x28, 0x61, 
+    0x6c, 0x69, 0x61, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 
+    0x60, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x60, 0x29, 0x0a, 
+    0x0a, 0x2d, 0x20, 0x60, 0x53, 0x45, 0x4d, 0x49, 0x5f, 0x42, 
+    0x4f, 0x4c, 0x44, 0x60, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x42, 
+    0x4f, 0x4c, 0x44, 0x60, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x45, 
+    0x58, 0x54, 0x52, 0x41, 0x5f, 0x42, 0x4f, 0x4c, 0x44, 0x60, 
+    0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x55, 0x4c, 0x54, 0x52, 0x41, 
+    0x5f, 0x42, 0x4f, 0x4c, 0x44, 0x60, 0x0a, 0x00, 
+};
+
+char doc_TT_WIDTH_CLASS[394] = {
+    0x7c, 0x66, 0x72, 0x65, 0x65, 0x74, 0x79, 0x70, 0x79, 0x7c, 
+    0x20, 0x57, 0x69, 0x64, 0x74, 0x68, 0x20, 0x76, 0x61, 0x6c, 
+    0x75, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x60, 0x54, 0x54, 0x5f, 0x4f, 0x53, 0x32, 0x2e, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x5f, 0x63, 0x6c, 0x61, 0x73, 
+    0x73, 0x60, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 
+    0x79, 0x2e, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x55, 0x4c, 0x54, 
+    0x52, 0x41, 0x5f, 0x43, 0x4f, 0x4e, 0x44, 0x45, 0x4e, 0x53, 
+    0x45, 0x44, 0x60, 0x3a, 0x20, 0x35, 0x30, 0x25, 0x20, 0x6f, 
+    0x66, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x0a, 0x0a, 
+    0x2d, 0x20, 0x60, 0x45, 0x58, 0x54, 0x52, 0x41, 0x5f, 0x43, 
+    0x4f, 0x4e, 0x44, 0x45, 0x4e, 0x53, 0x45, 0x44, 0x60, 0x3a, 
+    0x20, 0x36, 0x32, 0x2e, 0x35, 0x25, 0x20, 0x6f, 0x66, 0x20, 
+    0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x43, 0x4f, 0x4e, 0x44, 0x45, 0x4e, 0x53, 0x45, 0x44, 
+    0x60, 0x3a, 0x20, 0x37, 0x35, 0x25, 0x20, 0x6f, 0x66, 0x20, 
+    0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x53, 0x45, 0x4d, 0x49, 0x5f, 0x43, 0x4f, 0x4e, 0x44, 
+    0x45, 0x4e, 0x53, 0x45, 0x44, 0x60, 0x3a, 0x20, 0x38, 0x37, 
+    0x2e, 0x35, 0x25, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x72, 
+    0x6d, 0x61, 0x6c, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x4d, 0x45, 
+    0x44, 0x49, 0x55, 0x4d, 0x60, 0x3a, 0x20, 0x31, 0x30, 0x30, 
+    0x25, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 
+    0x6c, 0x20, 0x28, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x65, 0x64, 
+    0x20, 0x74, 0x6f, 0x20, 0x60, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 
+    0x4c, 0x60, 0x29, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x53, 0x45, 
+    0x4d, 0x49, 0x5f, 0x45, 0x58, 0x50, 0x41, 0x4e, 0x44, 0x45, 
+    0x44, 0x60, 0x3a, 0x20, 0x31, 0x31, 0x32, 0x2e, 0x35, 0x25, 
+    0x20, 0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 
+    0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x45, 0x58, 0x50, 0x41, 0x4e, 
+    0x44, 0x45, 0x44, 0x60, 0x3a, 0x20, 0x31, 0x32, 0x35, 0x25, 
+    0x20, 0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 
+    0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x45, 0x58, 0x54, 0x52, 0x41, 
+    0x5f, 0x45, 0x58, 0x50, 0x41, 0x4e, 0x44, 0x45, 0x44, 0x60, 
+    0x3a, 0x20, 0x31, 0x35, 0x30, 0x25, 0x20, 0x6f, 0x66, 0x20, 
+    0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x0a, 0x0a, 0x2d, 0x20, 
+    0x60, 0x55, 0x4c, 0x54, 0x52, 0x41, 0x5f, 0x45, 0x58, 0x50, 
+    0x41, 0x4e, 0x44, 0x45, 0x44, 0x60, 0x3a, 0x20, 0x32, 0x30, 
+    0x30, 0x25, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 
+    0x61, 0x6c, 0x0a, 0x00, 
+};
+
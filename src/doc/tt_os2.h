@@ -0,0 +1,48 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/tt_os2.py.
+*/
+
+#ifndef __DOC_TT_OS2_H__
+#define __DOC_TT_OS2_H__
+extern char doc_TT_FS_SELECTION[107];
+extern char doc_TT_OS2__init__[202];
+extern char doc_TT_OS2_break_char[365];
+extern char doc_TT_OS2_cap_height[776];
+extern char doc_TT_OS2_default_char[458];
+extern char doc_TT_OS2_family_class[432];
+extern char doc_TT_OS2_family_subclass[431];
+extern char doc_TT_OS2_first_char_index[41];
+extern char doc_TT_OS2_last_char_index[41];
+extern char doc_TT_OS2_max_context[633];
+extern char doc_TT_OS2_panose[524];
+extern char doc_TT_OS2_selection[30];
+extern char doc_TT_OS2_type[68];
+extern char doc_TT_OS2_typo_ascender[1161];
+extern char doc_TT_OS2_typo_descender[1174];
+extern char doc_TT_OS2_typo_line_gap[663];
+extern char doc_TT_OS2_vend_id[622];
+extern char doc_TT_OS2_version[133];
+extern char doc_TT_OS2_weight_class[134];
+extern char doc_TT_OS2_width_class[632];
+extern char doc_TT_OS2_win_ascent[1167];
+extern char doc_TT_OS2_win_descent[1154];
+extern char doc_TT_OS2_x_avg_char_width[487];
+extern char doc_TT_OS2_x_height[671];
+extern char doc_TT_OS2_y_strikeout_position[417];
+extern char doc_TT_OS2_y_strikeout_size[362];
+extern char doc_TT_OS2_y_subscript_x_offset[705];
+extern char doc_TT_OS2_y_subscript_x_size[826];
+extern char doc_TT_OS2_y_subscript_y_offset[432];
+extern char doc_TT_OS2_y_subscript_y_size[830];
+extern char doc_TT_OS2_y_superscript_x_offset[655];
+extern char doc_TT_OS2_y_superscript_x_size[833];
+extern char doc_TT_OS2_y_superscript_y_offset[491];
+extern char doc_TT_OS2_y_superscript_y_size[817];
+extern char doc_TT_WEIGHT_CLASS[218];
+extern char doc_TT_WIDTH_CLASS[394];
+
+#endif
+
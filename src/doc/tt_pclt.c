@@ -0,0 +1,37 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/tt_pclt.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "tt_pclt.h"
+
+char doc_TT_Pclt__init__[202] = {
+    0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x50, 
+    0x43, 0x4c, 0x54, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 
+    0x0a, 0x0a, 0x41, 0x6c, 0x6c, 0x20, 0x66, 0x69, 0x65, 0x6c, 
+    0x64, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x79, 0x20, 
+    0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x54, 0x72, 0x75, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 
+    0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 
+    0x0a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 0x65, 
+    0x6c, 0x64, 0x20, 0x69, 0x73, 0x20, 0x64, 0x69, 0x73, 0x63, 
+    0x6f, 0x75, 0x72, 0x61, 0x67, 0x65, 0x64, 0x20, 0x69, 0x6e, 
+    0x20, 0x4f, 0x70, 0x65, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x20, 
+    0x61, 0x6e, 0x64, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x72, 0x6e, 
+    0x20, 0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x73, 0x6f, 0x20, 
+    0x69, 0x74, 0x0a, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 
+    0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x73, 0x70, 
+    0x61, 0x72, 0x69, 0x6e, 0x67, 0x6c, 0x79, 0x20, 0x61, 0x6e, 
+    0x64, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x73, 0x73, 0x75, 
+    0x6d, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x65, 0x20, 
+    0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x2e, 
+    0x0a, 0x00, 
+};
+
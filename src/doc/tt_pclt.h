@@ -0,0 +1,13 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/tt_pclt.py.
+*/
+
+#ifndef __DOC_TT_PCLT_H__
+#define __DOC_TT_PCLT_H__
+extern char doc_TT_Pclt__init__[202];
+
+#endif
+
@@ -0,0 +1,90 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/tt_postscript.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "tt_postscript.h"
+
+char doc_TT_Postscript__init__[28] = {
+    0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x50, 
+    0x6f, 0x73, 0x74, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 
+    0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Postscript_format_type[23] = {
+    0x46, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x20, 0x6f, 0x66, 0x20, 
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Postscript_is_fixed_pitch[36] = {
+    0x49, 0x66, 0x20, 0x60, 0x54, 0x72, 0x75, 0x65, 0x60, 0x2c, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 
+    0x69, 0x73, 0x20, 0x6d, 0x6f, 0x6e, 0x6f, 0x73, 0x70, 0x61, 
+    0x63, 0x65, 0x64, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Postscript_italic_angle[26] = {
+    0x49, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x20, 0x61, 0x6e, 0x67, 
+    0x6c, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x65, 0x67, 0x72, 
+    0x65, 0x65, 0x73, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Postscript_max_mem_type1[68] = {
+    0x4d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x6d, 0x65, 
+    0x6d, 0x6f, 0x72, 0x79, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 
+    0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 0x64, 0x6f, 
+    0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x20, 0x61, 
+    0x73, 0x20, 0x61, 0x20, 0x54, 0x79, 0x70, 0x65, 0x20, 0x31, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Postscript_max_mem_type42[69] = {
+    0x4d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x6d, 0x65, 
+    0x6d, 0x6f, 0x72, 0x79, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 
+    0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 0x64, 0x6f, 
+    0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x20, 0x61, 
+    0x73, 0x20, 0x61, 0x20, 0x54, 0x79, 0x70, 0x65, 0x20, 0x34, 
+    0x32, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Postscript_min_mem_type1[68] = {
+    0x4d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x6d, 0x65, 
+    0x6d, 0x6f, 0x72, 0x79, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 
+    0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 0x64, 0x6f, 
+    0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x20, 0x61, 
+    0x73, 0x20, 0x61, 0x20, 0x54, 0x79, 0x70, 0x65, 0x20, 0x31, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Postscript_min_mem_type42[69] = {
+    0x4d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x6d, 0x65, 
+    0x6d, 0x6f, 0x72, 0x79, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 
+    0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x6f, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 0x64, 0x6f, 
+    0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x20, 0x61, 
+    0x73, 0x20, 0x61, 0x20, 0x54, 0x79, 0x70, 0x65, 0x20, 0x34, 
+    0x32, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_Postscript_underline_position[21] = {
+    0x55, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x20, 
+    0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_TT_Postscript_underline_thickness[22] = {
+    0x55, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x20, 
+    0x74, 0x68, 0x69, 0x63, 0x6b, 0x6e, 0x65, 0x73, 0x73, 0x2e, 
+    0x0a, 0x00, 
+};
+
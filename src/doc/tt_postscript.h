@@ -0,0 +1,22 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/tt_postscript.py.
+*/
+
+#ifndef __DOC_TT_POSTSCRIPT_H__
+#define __DOC_TT_POSTSCRIPT_H__
+extern char doc_TT_Postscript__init__[28];
+extern char doc_TT_Postscript_format_type[23];
+extern char doc_TT_Postscript_is_fixed_pitch[36];
+extern char doc_TT_Postscript_italic_angle[26];
+extern char doc_TT_Postscript_max_mem_type1[68];
+extern char doc_TT_Postscript_max_mem_type42[69];
+extern char doc_TT_Postscript_min_mem_type1[68];
+extern char doc_TT_Postscript_min_mem_type42[69];
+extern char doc_TT_Postscript_underline_position[21];
+extern char doc_TT_Postscript_underline_thickness[22];
+
+#endif
+
@@ -0,0 +1,221 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/tt_vertheader.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "tt_vertheader.h"
+
+char doc_TT_VertHeader__init__[40] = {
+    0x54, 0x72, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x76, 
+    0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x68, 0x65, 
+    0x61, 0x64, 0x65, 0x72, 0x20, 0x28, 0xe2, 0x80, 0x98, 0x76, 
+    0x68, 0x65, 0x61, 0xe2, 0x80, 0x99, 0x29, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_VertHeader_advance_height_max[146] = {
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 
+    0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 
+    0x78, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x61, 
+    0x6c, 0x6c, 0x20, 0x61, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 
+    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x66, 
+    0x6f, 0x75, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x20, 0x49, 0x74, 
+    0x0a, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 
+    0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6d, 0x70, 
+    0x75, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 
+    0x78, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x68, 0x65, 0x69, 0x67, 
+    0x68, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x20, 0x61, 
+    0x72, 0x62, 0x69, 0x74, 0x72, 0x61, 0x72, 0x79, 0x20, 0x73, 
+    0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x0a, 0x74, 
+    0x65, 0x78, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_VertHeader_ascender[370] = {
+    0x54, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x27, 0x73, 
+    0x20, 0x61, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x2c, 
+    0x20, 0x69, 0x2e, 0x65, 0x2e, 0x2c, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 
+    0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 
+    0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x74, 0x6f, 
+    0x20, 0x74, 0x68, 0x65, 0x0a, 0x74, 0x6f, 0x70, 0x2d, 0x6d, 
+    0x6f, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6c, 0x6c, 
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x70, 0x6f, 0x69, 
+    0x6e, 0x74, 0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20, 
+    0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6e, 
+    0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x6d, 
+    0x61, 0x6e, 0x79, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2c, 
+    0x20, 0x61, 0x73, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 
+    0x75, 0x73, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x73, 0x65, 
+    0x74, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x0a, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6e, 
+    0x65, 0x72, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6f, 0x66, 
+    0x74, 0x65, 0x6e, 0x20, 0x72, 0x65, 0x66, 0x6c, 0x65, 0x63, 
+    0x74, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x20, 
+    0x70, 0x6f, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x69, 0x6e, 
+    0x20, 0x74, 0x68, 0x65, 0x0a, 0x66, 0x6f, 0x6e, 0x74, 0x20, 
+    0x28, 0x6d, 0x61, 0x79, 0x62, 0x65, 0x20, 0x41, 0x53, 0x43, 
+    0x49, 0x49, 0x29, 0x2e, 0x0a, 0x0a, 0x59, 0x6f, 0x75, 0x20, 
+    0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x75, 0x73, 0x65, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 
+    0x2e, 0x67, 0x65, 0x74, 0x5f, 0x6f, 0x73, 0x32, 0x5f, 0x74, 
+    0x61, 0x62, 0x6c, 0x65, 0x28, 0x29, 0x2e, 0x73, 0x54, 0x79, 
+    0x70, 0x6f, 0x41, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 
+    0x60, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 
+    0x69, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x0a, 0x77, 0x61, 0x6e, 
+    0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x72, 0x72, 
+    0x65, 0x63, 0x74, 0x20, 0x6f, 0x6e, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_VertHeader_caret_offset[1] = {
+    0x00, 
+};
+
+char doc_TT_VertHeader_caret_slope_rise[76] = {
+    0x54, 0x68, 0x65, 0x20, 0x72, 0x69, 0x73, 0x65, 0x20, 0x63, 
+    0x6f, 0x65, 0x66, 0x66, 0x69, 0x63, 0x69, 0x65, 0x6e, 0x74, 
+    0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 
+    0x72, 0x73, 0x6f, 0x72, 0x27, 0x73, 0x20, 0x73, 0x6c, 0x6f, 
+    0x70, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x0a, 0x28, 0x73, 0x6c, 
+    0x6f, 0x70, 0x65, 0x3d, 0x72, 0x69, 0x73, 0x65, 0x2f, 0x72, 
+    0x75, 0x6e, 0x29, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_VertHeader_caret_slope_run[44] = {
+    0x54, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6e, 0x20, 0x63, 0x6f, 
+    0x65, 0x66, 0x66, 0x69, 0x63, 0x69, 0x65, 0x6e, 0x74, 0x20, 
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 
+    0x73, 0x6f, 0x72, 0x27, 0x73, 0x20, 0x73, 0x6c, 0x6f, 0x70, 
+    0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_VertHeader_descender[383] = {
+    0x54, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x27, 0x73, 
+    0x20, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 
+    0x2c, 0x20, 0x69, 0x2e, 0x65, 0x2e, 0x2c, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 
+    0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x74, 
+    0x6f, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x62, 0x6f, 0x74, 0x74, 
+    0x6f, 0x6d, 0x2d, 0x6d, 0x6f, 0x73, 0x74, 0x20, 0x6f, 0x66, 
+    0x20, 0x61, 0x6c, 0x6c, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x66, 0x6f, 
+    0x75, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x20, 0x49, 0x74, 0x20, 
+    0x69, 0x73, 0x20, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 
+    0x65, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x69, 0x73, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6e, 
+    0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x6d, 
+    0x61, 0x6e, 0x79, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x73, 0x2c, 
+    0x20, 0x61, 0x73, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 
+    0x75, 0x73, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x73, 0x65, 
+    0x74, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x0a, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6e, 
+    0x65, 0x72, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6f, 0x66, 
+    0x74, 0x65, 0x6e, 0x20, 0x72, 0x65, 0x66, 0x6c, 0x65, 0x63, 
+    0x74, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x20, 
+    0x70, 0x6f, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x69, 0x6e, 
+    0x20, 0x74, 0x68, 0x65, 0x0a, 0x66, 0x6f, 0x6e, 0x74, 0x20, 
+    0x28, 0x6d, 0x61, 0x79, 0x62, 0x65, 0x20, 0x41, 0x53, 0x43, 
+    0x49, 0x49, 0x29, 0x2e, 0x0a, 0x0a, 0x59, 0x6f, 0x75, 0x20, 
+    0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x75, 0x73, 0x65, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x46, 0x61, 0x63, 0x65, 
+    0x2e, 0x67, 0x65, 0x74, 0x5f, 0x6f, 0x73, 0x32, 0x5f, 0x74, 
+    0x61, 0x62, 0x6c, 0x65, 0x28, 0x29, 0x2e, 0x73, 0x54, 0x79, 
+    0x70, 0x6f, 0x44, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x65, 
+    0x72, 0x60, 0x20, 0x69, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 
+    0x77, 0x61, 0x6e, 0x74, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x63, 
+    0x6f, 0x72, 0x72, 0x65, 0x63, 0x74, 0x20, 0x6f, 0x6e, 0x65, 
+    0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_VertHeader_line_gap[148] = {
+    0x54, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x27, 0x73, 
+    0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x67, 0x61, 0x70, 0x2c, 
+    0x20, 0x69, 0x2e, 0x65, 0x2e, 0x2c, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 
+    0x74, 0x6f, 0x20, 0x61, 0x64, 0x64, 0x20, 0x74, 0x6f, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x61, 0x73, 0x63, 0x65, 0x6e, 0x64, 
+    0x65, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x64, 0x65, 0x73, 
+    0x63, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 
+    0x67, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x42, 0x54, 
+    0x42, 0x2c, 0x20, 0x69, 0x2e, 0x65, 0x2e, 0x2c, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x62, 0x61, 0x73, 0x65, 0x6c, 0x69, 0x6e, 
+    0x65, 0x2d, 0x74, 0x6f, 0x2d, 0x62, 0x61, 0x73, 0x65, 0x6c, 
+    0x69, 0x6e, 0x65, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 
+    0x63, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x0a, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_VertHeader_metric_data_format[11] = {
+    0x41, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x30, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_TT_VertHeader_min_bottom_side_bearing[64] = {
+    0x54, 0x68, 0x65, 0x20, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 
+    0x6d, 0x20, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x20, 0x73, 
+    0x69, 0x64, 0x65, 0x20, 0x62, 0x65, 0x61, 0x72, 0x69, 0x6e, 
+    0x67, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x67, 
+    0x6c, 0x79, 0x70, 0x68, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 
+    0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 
+    0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_VertHeader_min_top_side_bearing[61] = {
+    0x54, 0x68, 0x65, 0x20, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 
+    0x6d, 0x20, 0x74, 0x6f, 0x70, 0x20, 0x73, 0x69, 0x64, 0x65, 
+    0x20, 0x62, 0x65, 0x61, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x6f, 
+    0x66, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x67, 0x6c, 0x79, 0x70, 
+    0x68, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x0a, 
+    0x00, 
+};
+
+char doc_TT_VertHeader_number_of_vmetrics[126] = {
+    0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 
+    0x56, 0x4d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73, 0x20, 0x65, 
+    0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0xe2, 0x80, 0x98, 0x68, 0x6d, 0x74, 
+    0x78, 0xe2, 0x80, 0x99, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 
+    0x20, 0x2d, 0x2d, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x76, 
+    0x61, 0x6c, 0x75, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 
+    0x65, 0x0a, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x20, 
+    0x74, 0x68, 0x61, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 
+    0x6f, 0x74, 0x61, 0x6c, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 
+    0x72, 0x20, 0x6f, 0x66, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 
+    0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
+    0x6f, 0x6e, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_VertHeader_version[20] = {
+    0x54, 0x68, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 
+    0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_TT_VertHeader_ymax_extent[108] = {
+    0x54, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 
+    0x6d, 0x20, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 
+    0x20, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x28, 0x69, 
+    0x2e, 0x65, 0x2e, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0xe2, 
+    0x80, 0x98, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0xe2, 0x80, 
+    0x99, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x27, 0x73, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 
+    0x69, 0x6e, 0x67, 0x0a, 0x62, 0x6f, 0x78, 0x29, 0x20, 0x66, 
+    0x6f, 0x72, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x67, 0x6c, 0x79, 
+    0x70, 0x68, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2e, 0x0a, 0x00, 
+};
+
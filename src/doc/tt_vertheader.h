@@ -0,0 +1,26 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/tt_vertheader.py.
+*/
+
+#ifndef __DOC_TT_VERTHEADER_H__
+#define __DOC_TT_VERTHEADER_H__
+extern char doc_TT_VertHeader__init__[40];
+extern char doc_TT_VertHeader_advance_height_max[146];
+extern char doc_TT_VertHeader_ascender[370];
+extern char doc_TT_VertHeader_caret_offset[1];
+extern char doc_TT_VertHeader_caret_slope_rise[76];
+extern char doc_TT_VertHeader_caret_slope_run[44];
+extern char doc_TT_VertHeader_descender[383];
+extern char doc_TT_VertHeader_line_gap[148];
+extern char doc_TT_VertHeader_metric_data_format[11];
+extern char doc_TT_VertHeader_min_bottom_side_bearing[64];
+extern char doc_TT_VertHeader_min_top_side_bearing[61];
+extern char doc_TT_VertHeader_number_of_vmetrics[126];
+extern char doc_TT_VertHeader_version[20];
+extern char doc_TT_VertHeader_ymax_extent[108];
+
+#endif
+
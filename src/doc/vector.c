@@ -0,0 +1,37 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/vector.py
+
+We use numeric array initializers rather than string literals here,
+because some C compilers, notably MSVC, do not support string literals
+greater than 256 characters.
+*/
+
+#include "vector.h"
+
+char doc_Vector__init__[109] = {
+    0x41, 0x20, 0x32, 0x44, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6f, 
+    0x72, 0x2e, 0x0a, 0x0a, 0x60, 0x56, 0x65, 0x63, 0x74, 0x6f, 
+    0x72, 0x60, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x77, 0x6f, 
+    0x72, 0x6b, 0x73, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x50, 
+    0x79, 0x74, 0x68, 0x6f, 0x6e, 0x20, 0x73, 0x65, 0x71, 0x75, 
+    0x65, 0x6e, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6c, 0x65, 
+    0x6e, 0x67, 0x74, 0x68, 0x20, 0x32, 0x2c, 0x20, 0x73, 0x6f, 
+    0x20, 0x69, 0x74, 0x27, 0x73, 0x20, 0x65, 0x61, 0x73, 0x79, 
+    0x20, 0x74, 0x6f, 0x0a, 0x64, 0x6f, 0x3a, 0x3a, 0x0a, 0x0a, 
+    0x20, 0x20, 0x20, 0x20, 0x78, 0x2c, 0x20, 0x79, 0x20, 0x3d, 
+    0x20, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x0a, 0x00, 
+};
+
+char doc_Vector_x[19] = {
+    0x54, 0x68, 0x65, 0x20, 0x78, 0x20, 0x63, 0x6f, 0x6f, 0x72, 
+    0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
+char doc_Vector_y[19] = {
+    0x54, 0x68, 0x65, 0x20, 0x79, 0x20, 0x63, 0x6f, 0x6f, 0x72, 
+    0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x2e, 0x0a, 0x00, 
+};
+
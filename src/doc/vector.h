@@ -0,0 +1,15 @@
+/*
+DO NOT EDIT!
+
+This file is autogenerated by setup.py.  To edit its contents, edit
+docstrings/vector.py.
+*/
+
+#ifndef __DOC_VECTOR_H__
+#define __DOC_VECTOR_H__
+extern char doc_Vector__init__[109];
+extern char doc_Vector_x[19];
+extern char doc_Vector_y[19];
+
+#endif
+
@@ -30,14 +30,20 @@ either expressed or implied, of the FreeBSD Project.
 #include "face.h"
 #include "doc/face.h"
 
+#include "array.h"
 #include "bbox.h"
 #include "bitmap_size.h"
 #include "chariter.h"
 #include "charmap.h"
 #include "constants.h"
+#include "coverage.h"
 #include "encoding.h"
 #include "glyph.h"
+#include "metrics_cache.h"
+#include "outline_cache.h"
+#include "render.h"
 #include "sfntnames.h"
+#include "simple_layout.h"
 #include "size.h"
 #include "tt_header.h"
 #include "tt_horiheader.h"
@@ -129,10 +135,43 @@ static int _py_file_to_open_args(
     memset((void *)open_args, 0, sizeof(FT_Open_Args));
 
     if (PyBytes_Check(py_file_arg) || PyUnicode_Check(py_file_arg)) {
+        /* Paths are memory-mapped where possible, so the font's pages
+           are shared between faces and processes and nothing is
+           copied */
+        if (meta->blob == NULL &&
+            !ftpy_font_blob_acquire(py_file_arg, &meta->blob)) {
+            open_args->flags = FT_OPEN_MEMORY;
+            open_args->memory_base = meta->blob->data;
+            open_args->memory_size = meta->blob->size;
+            open_args->stream = NULL;
+
+            result = 0;
+            goto exit;
+        }
+
         if ((py_file = ftpy_PyFile_OpenFile(py_file_arg, (char *)"rb")) == NULL) {
             goto exit;
         }
         close_file = 1;
+    } else if (PyObject_CheckBuffer(py_file_arg)) {
+        /* Read directly from the object's memory, which stays valid
+           (and can't be resized) while the view is held */
+        if (meta->has_view) {
+            PyBuffer_Release(&meta->view);
+            meta->has_view = 0;
+        }
+        if (PyObject_GetBuffer(py_file_arg, &meta->view, PyBUF_SIMPLE)) {
+            goto exit;
+        }
+        meta->has_view = 1;
+
+        open_args->flags = FT_OPEN_MEMORY;
+        open_args->memory_base = meta->view.buf;
+        open_args->memory_size = meta->view.len;
+        open_args->stream = NULL;
+
+        result = 0;
+        goto exit;
     } else {
         Py_INCREF(py_file_arg);
         py_file = py_file_arg;
@@ -204,7 +243,7 @@ static int _py_file_to_open_args(
     if (result && !PyErr_Occurred()) {
         PyErr_SetString(
             PyExc_TypeError,
-            "First argument must be a path or file object reading bytes");
+            "First argument must be a path, buffer or file object reading bytes");
     }
 
     Py_XDECREF(read_string);
@@ -226,11 +265,30 @@ Py_Face_dealloc(Py_Face* self)
     if (self->x) {
         FT_Done_Face(self->x);
     }
+    if (self->owns_library) {
+        FT_Done_FreeType(self->library);
+    }
     Py_XDECREF(self->main.py_file);
     free(self->main.mem);
+    ftpy_font_blob_release(self->main.blob);
+    if (self->main.has_view) {
+        PyBuffer_Release(&self->main.view);
+    }
     Py_XDECREF(self->attach.py_file);
     free(self->attach.mem);
+    ftpy_font_blob_release(self->attach.blob);
+    if (self->attach.has_view) {
+        PyBuffer_Release(&self->attach.view);
+    }
     Py_XDECREF(self->filename);
+    if (self->lock) {
+        PyThread_free_lock(self->lock);
+    }
+    ftpy_LRU_done(&self->metrics_cache);
+    ftpy_LRU_done(&self->outline_cache);
+    ftpy_kerning_cache_done(&self->kerning_cache);
+    ftpy_charmap_cache_done(&self->charmap_cache);
+    Py_XDECREF(self->coverage);
     Py_TYPE(self)->tp_clear((PyObject*)self);
     Py_TYPE(self)->tp_free((PyObject*)self);
 }
@@ -248,10 +306,32 @@ Py_Face_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     Py_INCREF(freetypy_module);
     self->base.owner = freetypy_module;
     self->x = NULL;
+    self->library = NULL;
+    self->owns_library = 0;
     self->load_flags = 0;
     self->filename = NULL;
+    self->transform.xx = self->transform.yy = 0x10000;
+    self->transform.xy = self->transform.yx = 0;
+    self->delta.x = self->delta.y = 0;
     memset(&self->main, 0, sizeof(Py_Face_Stream_Meta));
     memset(&self->attach, 0, sizeof(Py_Face_Stream_Meta));
+    memset(&self->metrics_cache, 0, sizeof(ftpy_LRU));
+    memset(&self->outline_cache, 0, sizeof(ftpy_LRU));
+    memset(&self->kerning_cache, 0, sizeof(ftpy_Kerning_Cache));
+    memset(&self->charmap_cache, 0, sizeof(ftpy_Charmap_Cache));
+    self->coverage = NULL;
+    self->lock = PyThread_allocate_lock();
+    if (self->lock == NULL) {
+        Py_DECREF(self);
+        PyErr_SetString(PyExc_MemoryError, "Unable to allocate lock");
+        return NULL;
+    }
+    if (ftpy_metrics_cache_init(&self->metrics_cache) ||
+        ftpy_outline_cache_init(&self->outline_cache) ||
+        ftpy_kerning_cache_init(&self->kerning_cache)) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
     return (PyObject *)self;
 }
 
@@ -259,16 +339,18 @@ Py_Face_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 static int
 Py_Face_init(Py_Face *self, PyObject *args, PyObject *kwds)
 {
-    static char *kwlist[] = {"file", "face_index"};
+    static char *kwlist[] = {"file", "face_index", "own_library", NULL};
     PyObject *py_file_arg = NULL;
     long face_index = 0;
+    int own_library = 0;
     FT_Open_Args open_args;
 
     int result = -1;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|l:Face.__init__", kwlist,
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|li:Face.__init__", kwlist,
                                      &py_file_arg,
-                                     &face_index)) {
+                                     &face_index,
+                                     &own_library)) {
         goto exit;
     }
 
@@ -276,9 +358,18 @@ Py_Face_init(Py_Face *self, PyObject *args, PyObject *kwds)
         goto exit;
     }
 
+    if (own_library) {
+        if (ftpy_exc(ftpy_new_library(&self->library))) {
+            goto exit;
+        }
+        self->owns_library = 1;
+    } else {
+        self->library = get_ft_library();
+    }
+
     if (ftpy_exc(
             FT_Open_Face(
-                get_ft_library(), &open_args, face_index, &self->x))) {
+                self->library, &open_args, face_index, &self->x))) {
         goto exit;
     }
 
@@ -404,7 +495,13 @@ MAKE_FACE_GETTER(underline_thickness, PyLong_FromLong, self->x->underline_thickn
 
 static PyObject *glyph_get(Py_Face *self, PyObject *closure)
 {
-    return Py_Glyph_cnew(self->x->glyph, (PyObject *)self, self->load_flags);
+    PyObject *result;
+
+    FTPY_FACE_LOCK(self);
+    result = Py_Glyph_cnew(self->x->glyph, (PyObject *)self, self->load_flags);
+    FTPY_FACE_UNLOCK(self);
+
+    return result;
 }
 
 
@@ -434,6 +531,9 @@ MAKE_FACE_GETTER(is_sfnt, PyBool_FromLong, FT_IS_SFNT(self->x))
 MAKE_FACE_GETTER(is_fixed_width, PyBool_FromLong, FT_IS_FIXED_WIDTH(self->x))
 
 
+MAKE_FACE_GETTER(own_library, PyBool_FromLong, self->owns_library)
+
+
 static PyObject *filename_get(Py_Face *self, PyObject *closure)
 {
     Py_INCREF(self->filename);
@@ -507,6 +607,7 @@ static PyGetSetDef Py_Face_getset[] = {
     DEF_FACE_GETTER(is_sfnt),
     DEF_FACE_GETTER(is_fixed_width),
     DEF_FACE_GETTER(filename),
+    DEF_FACE_GETTER(own_library),
     DEF_FACE_GETTER(tt_header),
     DEF_FACE_GETTER(tt_horiheader),
     DEF_FACE_GETTER(tt_os2),
@@ -527,6 +628,7 @@ Py_Face_attach(Py_Face *self, PyObject *args, PyObject *kwds)
 {
     PyObject *py_file_arg = NULL;
     FT_Open_Args open_args;
+    FT_Error error;
 
     static char *kwlist[] = {"file", NULL};
 
@@ -539,8 +641,11 @@ Py_Face_attach(Py_Face *self, PyObject *args, PyObject *kwds)
         return NULL;
     }
 
-    if (ftpy_exc(
-            FT_Attach_Stream(self->x, &open_args))) {
+    FTPY_FACE_LOCK(self);
+    error = FT_Attach_Stream(self->x, &open_args);
+    FTPY_FACE_UNLOCK(self);
+
+    if (ftpy_exc(error)) {
         return NULL;
     }
 
@@ -548,6 +653,127 @@ Py_Face_attach(Py_Face *self, PyObject *args, PyObject *kwds)
 }
 
 
+PyObject *
+Py_Face_get_coverage(Py_Face *self)
+{
+    ftpy_Coverage coverage;
+    PyObject *result;
+    FT_Error error;
+
+    if (self->coverage == NULL) {
+        FTPY_FACE_LOCK(self);
+        Py_BEGIN_ALLOW_THREADS
+        error = ftpy_coverage_build(self->x, &coverage);
+        Py_END_ALLOW_THREADS
+        FTPY_FACE_UNLOCK(self);
+
+        if (ftpy_exc(error)) {
+            return NULL;
+        }
+
+        result = Py_Coverage_cnew(&coverage);
+        if (result == NULL) {
+            return NULL;
+        }
+
+        /* Another thread may have got here first while the GIL was
+           released */
+        if (self->coverage == NULL) {
+            self->coverage = result;
+        } else {
+            Py_DECREF(result);
+        }
+    }
+
+    Py_INCREF(self->coverage);
+    return self->coverage;
+}
+
+
+static PyObject*
+Py_Face_coverage(Py_Face *self, PyObject *args, PyObject *kwds)
+{
+    return Py_Face_get_coverage(self);
+}
+
+
+static PyObject*
+Py_Face_get_char_map_arrays(Py_Face *self, PyObject *args, PyObject *kwds)
+{
+    uint32_t *charcodes = NULL;
+    uint32_t *glyph_indices = NULL;
+    uint32_t *new_charcodes;
+    uint32_t *new_glyph_indices;
+    size_t n = 0;
+    size_t capacity;
+    FT_ULong charcode;
+    FT_UInt glyph_index;
+    int out_of_memory = 0;
+    PyObject *charcodes_array;
+    PyObject *glyph_indices_array;
+
+    FTPY_FACE_LOCK(self);
+    Py_BEGIN_ALLOW_THREADS
+
+    /* Most charmaps map about one char code per glyph */
+    capacity = self->x->num_glyphs > 0 ? (size_t)self->x->num_glyphs : 1;
+    charcodes = malloc(sizeof(uint32_t) * capacity);
+    glyph_indices = malloc(sizeof(uint32_t) * capacity);
+    if (charcodes == NULL || glyph_indices == NULL) {
+        out_of_memory = 1;
+    } else if (self->x->charmap != NULL) {
+        charcode = FT_Get_First_Char(self->x, &glyph_index);
+        while (glyph_index != 0) {
+            if (n == capacity) {
+                capacity *= 2;
+                new_charcodes = realloc(charcodes, sizeof(uint32_t) * capacity);
+                if (new_charcodes != NULL) {
+                    charcodes = new_charcodes;
+                }
+                new_glyph_indices = realloc(
+                    glyph_indices, sizeof(uint32_t) * capacity);
+                if (new_glyph_indices != NULL) {
+                    glyph_indices = new_glyph_indices;
+                }
+                if (new_charcodes == NULL || new_glyph_indices == NULL) {
+                    out_of_memory = 1;
+                    break;
+                }
+            }
+            charcodes[n] = (uint32_t)charcode;
+            glyph_indices[n] = glyph_index;
+            ++n;
+            charcode = FT_Get_Next_Char(self->x, charcode, &glyph_index);
+        }
+    }
+
+    Py_END_ALLOW_THREADS
+    FTPY_FACE_UNLOCK(self);
+
+    if (out_of_memory) {
+        free(charcodes);
+        free(glyph_indices);
+        return PyErr_NoMemory();
+    }
+
+    charcodes_array = ftpy_Array_cnew_from_data(
+        charcodes, "I", sizeof(uint32_t), 1, n, 0);
+    if (charcodes_array == NULL) {
+        free(glyph_indices);
+        return NULL;
+    }
+
+    glyph_indices_array = ftpy_Array_cnew_from_data(
+        glyph_indices, "I", sizeof(uint32_t), 1, n, 0);
+    if (glyph_indices_array == NULL) {
+        Py_DECREF(charcodes_array);
+        return NULL;
+    }
+
+    return Py_BuildValue("(NN)", charcodes_array, glyph_indices_array);
+}
+
+
 static PyObject*
 Py_Face_get_chars(Py_Face *self, PyObject *args, PyObject *kwds)
 {
@@ -569,7 +795,9 @@ Py_Face_get_char_index(Py_Face *self, PyObject *args, PyObject *kwds)
         return NULL;
     }
 
+    FTPY_FACE_LOCK(self);
     glyph_index = FT_Get_Char_Index(self->x, charcode);
+    FTPY_FACE_UNLOCK(self);
 
     return PyLong_FromUnsignedLong(glyph_index);
 }
@@ -598,18 +826,87 @@ Py_Face_get_char_index_unicode(Py_Face *self, PyObject *args, PyObject *kwds)
         return NULL;
     }
 
+    FTPY_FACE_LOCK(self);
     glyph_index = FT_Get_Char_Index(self->x, charcode);
+    FTPY_FACE_UNLOCK(self);
 
     return PyLong_FromUnsignedLong(glyph_index);
 }
 
 
+static PyObject*
+Py_Face_get_char_indices(Py_Face *self, PyObject *args, PyObject *kwds)
+{
+    PyObject *text_obj;
+    PyObject *decoded_text = NULL;
+    uint32_t *charcodes = NULL;
+    Py_ssize_t n;
+    PyObject *result = NULL;
+    FT_Error error;
+
+    const char* keywords[] = {"text", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "O:get_char_indices", (char **)keywords,
+            &text_obj)) {
+        return NULL;
+    }
+
+    if (PyUnicode_Check(text_obj)) {
+        if (self->x->charmap == NULL ||
+            self->x->charmap->encoding != FT_ENCODING_UNICODE) {
+            PyErr_SetString(
+                PyExc_ValueError,
+                "Mapping a str requires a Unicode character map");
+            goto exit;
+        }
+
+        decoded_text = ftpy_PyUnicode_AsUTF32(text_obj, &charcodes, &n);
+        if (decoded_text == NULL) {
+            goto exit;
+        }
+    } else {
+        if (ftpy_PyObject_AsUInt32Array(text_obj, &charcodes, &n)) {
+            goto exit;
+        }
+    }
+
+    result = ftpy_Array_cnew("I", sizeof(uint32_t), 1, n, 0);
+    if (result == NULL) {
+        goto exit;
+    }
+
+    FTPY_FACE_LOCK(self);
+    Py_BEGIN_ALLOW_THREADS
+    error = ftpy_charmap_cache_get_char_indices(
+        &self->charmap_cache, self->x, charcodes, n, ftpy_Array_DATA(result));
+    Py_END_ALLOW_THREADS
+    FTPY_FACE_UNLOCK(self);
+
+    if (ftpy_exc(error)) {
+        Py_DECREF(result);
+        result = NULL;
+    }
+
+ exit:
+
+    if (decoded_text != NULL) {
+        Py_DECREF(decoded_text);
+    } else {
+        free(charcodes);
+    }
+
+    return result;
+}
+
+
 static PyObject*
 Py_Face_get_char_name(Py_Face *self, PyObject *args, PyObject *kwds)
 {
     unsigned long charcode;
     unsigned int glyph_index;
     char glyph_name[80];
+    int has_name = 0;
 
     static char *kwlist[] = {"charcode", NULL};
 
@@ -619,10 +916,15 @@ Py_Face_get_char_name(Py_Face *self, PyObject *args, PyObject *kwds)
         return NULL;
     }
 
+    FTPY_FACE_LOCK(self);
     glyph_index = FT_Get_Char_Index(self->x, charcode);
-
     if (glyph_index != 0 &&
         !FT_Get_Glyph_Name(self->x, glyph_index, glyph_name, 80)) {
+        has_name = 1;
+    }
+    FTPY_FACE_UNLOCK(self);
+
+    if (has_name) {
         return PyUnicode_FromString(glyph_name);
     }
 
@@ -645,7 +947,9 @@ Py_Face_get_char_variant_index(Py_Face *self, PyObject *args, PyObject *kwds)
         return NULL;
     }
 
+    FTPY_FACE_LOCK(self);
     glyph_index = FT_Face_GetCharVariantIndex(self->x, charcode, variantSelector);
+    FTPY_FACE_UNLOCK(self);
 
     return PyLong_FromUnsignedLong(glyph_index);
 }
@@ -667,6 +971,7 @@ Py_Face_get_glyph_name(Py_Face *self, PyObject *args, PyObject *kwds)
 {
     unsigned int glyph_index;
     char glyph_name[80];
+    FT_Error error;
 
     static char *kwlist[] = {"glyph_index", NULL};
 
@@ -676,8 +981,11 @@ Py_Face_get_glyph_name(Py_Face *self, PyObject *args, PyObject *kwds)
         return NULL;
     }
 
-    if (ftpy_exc(
-            FT_Get_Glyph_Name(self->x, glyph_index, glyph_name, 80))) {
+    FTPY_FACE_LOCK(self);
+    error = FT_Get_Glyph_Name(self->x, glyph_index, glyph_name, 80);
+    FTPY_FACE_UNLOCK(self);
+
+    if (ftpy_exc(error)) {
         return NULL;
     }
 
@@ -692,6 +1000,7 @@ Py_Face_get_kerning(Py_Face *self, PyObject *args, PyObject *kwds)
     unsigned int right_glyph;
     unsigned int kern_mode = FT_KERNING_DEFAULT;
     FT_Vector akerning;
+    FT_Error error;
 
     static char *kwlist[] = {"left_glyph", "right_glyph", "kern_mode", NULL};
 
@@ -701,9 +1010,12 @@ Py_Face_get_kerning(Py_Face *self, PyObject *args, PyObject *kwds)
         return NULL;
     }
 
-    if (ftpy_exc(
-            FT_Get_Kerning(self->x, left_glyph, right_glyph, kern_mode,
-                           &akerning))) {
+    FTPY_FACE_LOCK(self);
+    error = FT_Get_Kerning(self->x, left_glyph, right_glyph, kern_mode,
+                           &akerning);
+    FTPY_FACE_UNLOCK(self);
+
+    if (ftpy_exc(error)) {
         return NULL;
     }
 
@@ -711,6 +1023,80 @@ Py_Face_get_kerning(Py_Face *self, PyObject *args, PyObject *kwds)
 }
 
 
+static PyObject*
+Py_Face_get_kerning_batch(Py_Face *self, PyObject *args, PyObject *kwds)
+{
+    PyObject *left_obj;
+    PyObject *right_obj;
+    unsigned int kern_mode = FT_KERNING_DEFAULT;
+    uint32_t *left_glyphs = NULL;
+    uint32_t *right_glyphs = NULL;
+    Py_ssize_t left_size;
+    Py_ssize_t right_size;
+    Py_ssize_t i;
+    ftpy_Kerning_Table *table;
+    FT_Vector akerning;
+    double *kerning;
+    PyObject *result = NULL;
+    FT_Error error;
+
+    const char* keywords[] = {"left_glyphs", "right_glyphs", "kern_mode", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "OO|I:get_kerning_batch", (char **)keywords,
+            &left_obj, &right_obj, &kern_mode)) {
+        goto exit;
+    }
+
+    if (ftpy_PyObject_AsUInt32Array(left_obj, &left_glyphs, &left_size) ||
+        ftpy_PyObject_AsUInt32Array(right_obj, &right_glyphs, &right_size)) {
+        goto exit;
+    }
+
+    if (left_size != right_size) {
+        PyErr_SetString(
+            PyExc_ValueError,
+            "left_glyphs and right_glyphs must be the same length");
+        goto exit;
+    }
+
+    result = ftpy_Array_cnew("d", sizeof(double), 2, left_size, 2);
+    if (result == NULL) {
+        goto exit;
+    }
+    kerning = ftpy_Array_DATA(result);
+
+    FTPY_FACE_LOCK(self);
+    Py_BEGIN_ALLOW_THREADS
+    error = ftpy_kerning_cache_get_table(
+        &self->kerning_cache, self->x, kern_mode, &table);
+    for (i = 0; i < left_size && !error; ++i) {
+        error = ftpy_kerning_cache_get(
+            &self->kerning_cache, self->x, table,
+            left_glyphs[i], right_glyphs[i], &akerning);
+        if (error) {
+            break;
+        }
+        kerning[i * 2] = (double)akerning.x / (double)(1 << 6);
+        kerning[i * 2 + 1] = (double)akerning.y / (double)(1 << 6);
+    }
+    Py_END_ALLOW_THREADS
+    FTPY_FACE_UNLOCK(self);
+
+    if (ftpy_exc(error)) {
+        Py_DECREF(result);
+        result = NULL;
+    }
+
+ exit:
+
+    free(left_glyphs);
+    free(right_glyphs);
+
+    return result;
+}
+
+
 static PyObject*
 Py_Face_get_name_index(Py_Face *self, PyObject *args, PyObject *kwds)
 {
@@ -725,7 +1111,10 @@ Py_Face_get_name_index(Py_Face *self, PyObject *args, PyObject *kwds)
         return NULL;
     }
 
+    FTPY_FACE_LOCK(self);
     glyph_index = FT_Get_Name_Index(self->x, name);
+    FTPY_FACE_UNLOCK(self);
+    PyMem_Free(name);
 
     return PyLong_FromUnsignedLong(glyph_index);
 }
@@ -754,6 +1143,7 @@ Py_Face_get_track_kerning(Py_Face *self, PyObject *args, PyObject *kwds)
     int degree;
     FT_Fixed akerning;
     double kerning;
+    FT_Error error;
 
     static char *kwlist[] = {"point_size", "degree", NULL};
 
@@ -763,10 +1153,12 @@ Py_Face_get_track_kerning(Py_Face *self, PyObject *args, PyObject *kwds)
         return NULL;
     }
 
+    FTPY_FACE_LOCK(self);
+    error = FT_Get_Track_Kerning(self->x, TO_FT_FIXED(point_size), degree,
+                                 &akerning);
+    FTPY_FACE_UNLOCK(self);
 
-    if (ftpy_exc(
-            FT_Get_Track_Kerning(self->x, TO_FT_FIXED(point_size), degree,
-                                 &akerning))) {
+    if (ftpy_exc(error)) {
         return NULL;
     }
 
@@ -786,10 +1178,164 @@ Py_Face_has_ps_glyph_names(Py_Face* self, PyObject* args, PyObject* kwds)
 }
 
 
+static PyObject*
+Py_Face_layout_many(Py_Face* self, PyObject* args, PyObject* kwds) {
+    PyObject *strings_obj;
+    int load_flags = FT_LOAD_DEFAULT;
+    PyObject *strings = NULL;
+    PyObject *decoded_text;
+    uint32_t *string_text;
+    Py_ssize_t string_size;
+    uint32_t *text = NULL;
+    uint32_t *new_text;
+    size_t size = 0;
+    size_t capacity = 0;
+    Py_ssize_t count;
+    Py_ssize_t i;
+    size_t *offsets;
+    FT_BBox *bboxes = NULL;
+    double *layout_data;
+    double *ink_data;
+    PyObject *offsets_obj = NULL;
+    PyObject *glyph_indices_obj = NULL;
+    PyObject *xys_obj = NULL;
+    PyObject *layout_bboxes_obj = NULL;
+    PyObject *ink_bboxes_obj = NULL;
+    PyObject *result = NULL;
+    FT_Error error;
+
+    const char* keywords[] = {"strings", "load_flags", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "O|i:layout_many", (char **)keywords,
+            &strings_obj, &load_flags)) {
+        return NULL;
+    }
+
+    if (self->x->charmap == NULL ||
+        self->x->charmap->encoding != FT_ENCODING_UNICODE) {
+        PyErr_SetString(
+            PyExc_ValueError, "layout_many only supports Unicode character map");
+        return NULL;
+    }
+
+    strings = PySequence_Fast(strings_obj, "strings must be a sequence");
+    if (strings == NULL) {
+        return NULL;
+    }
+    count = PySequence_Fast_GET_SIZE(strings);
+
+    offsets_obj = ftpy_Array_cnew("N", sizeof(size_t), 1, count + 1, 0);
+    if (offsets_obj == NULL) {
+        goto exit;
+    }
+    offsets = ftpy_Array_DATA(offsets_obj);
+
+    /* Pack all of the text together, so it can be laid out in one
+       pass without the GIL */
+    for (i = 0; i < count; ++i) {
+        decoded_text = ftpy_PyUnicode_AsUTF32(
+            PySequence_Fast_GET_ITEM(strings, i), &string_text, &string_size);
+        if (decoded_text == NULL) {
+            goto exit;
+        }
+
+        if (size + string_size > capacity) {
+            capacity = (size + string_size) * 2;
+            new_text = realloc(text, sizeof(uint32_t) * capacity);
+            if (new_text == NULL) {
+                Py_DECREF(decoded_text);
+                PyErr_NoMemory();
+                goto exit;
+            }
+            text = new_text;
+        }
+
+        memcpy(text + size, string_text, sizeof(uint32_t) * string_size);
+        size += string_size;
+        offsets[i + 1] = size;
+
+        Py_DECREF(decoded_text);
+    }
+
+    glyph_indices_obj = ftpy_Array_cnew("L", sizeof(FT_ULong), 1, size, 0);
+    if (glyph_indices_obj == NULL) {
+        goto exit;
+    }
+
+    xys_obj = ftpy_Array_cnew("d", sizeof(double), 2, size, 2);
+    if (xys_obj == NULL) {
+        goto exit;
+    }
+
+    layout_bboxes_obj = ftpy_Array_cnew("d", sizeof(double), 2, count, 4);
+    if (layout_bboxes_obj == NULL) {
+        goto exit;
+    }
+
+    ink_bboxes_obj = ftpy_Array_cnew("d", sizeof(double), 2, count, 4);
+    if (ink_bboxes_obj == NULL) {
+        goto exit;
+    }
+
+    bboxes = malloc(sizeof(FT_BBox) * 2 * (count ? count : 1));
+    if (bboxes == NULL) {
+        PyErr_NoMemory();
+        goto exit;
+    }
+
+    FTPY_FACE_LOCK(self);
+    Py_BEGIN_ALLOW_THREADS
+    error = ftpy_calculate_simple_layouts(
+        self->x, &self->metrics_cache, &self->kerning_cache, load_flags,
+        text, offsets, count,
+        ftpy_Array_DATA(glyph_indices_obj), ftpy_Array_DATA(xys_obj),
+        bboxes, bboxes + count);
+    Py_END_ALLOW_THREADS
+    FTPY_FACE_UNLOCK(self);
+
+    if (ftpy_exc(error)) {
+        goto exit;
+    }
+
+    layout_data = ftpy_Array_DATA(layout_bboxes_obj);
+    ink_data = ftpy_Array_DATA(ink_bboxes_obj);
+    for (i = 0; i < count; ++i) {
+        layout_data[i * 4] = (double)bboxes[i].xMin / (double)(1 << 6);
+        layout_data[i * 4 + 1] = (double)bboxes[i].yMin / (double)(1 << 6);
+        layout_data[i * 4 + 2] = (double)bboxes[i].xMax / (double)(1 << 6);
+        layout_data[i * 4 + 3] = (double)bboxes[i].yMax / (double)(1 << 6);
+        ink_data[i * 4] = (double)bboxes[count + i].xMin / (double)(1 << 6);
+        ink_data[i * 4 + 1] = (double)bboxes[count + i].yMin / (double)(1 << 6);
+        ink_data[i * 4 + 2] = (double)bboxes[count + i].xMax / (double)(1 << 6);
+        ink_data[i * 4 + 3] = (double)bboxes[count + i].yMax / (double)(1 << 6);
+    }
+
+    result = Py_BuildValue(
+        "(OOOOO)", offsets_obj, glyph_indices_obj, xys_obj,
+        layout_bboxes_obj, ink_bboxes_obj);
+
+ exit:
+
+    Py_DECREF(strings);
+    Py_XDECREF(offsets_obj);
+    Py_XDECREF(glyph_indices_obj);
+    Py_XDECREF(xys_obj);
+    Py_XDECREF(layout_bboxes_obj);
+    Py_XDECREF(ink_bboxes_obj);
+    free(text);
+    free(bboxes);
+
+    return result;
+}
+
+
 static PyObject*
 Py_Face_load_char(Py_Face* self, PyObject* args, PyObject* kwds) {
     unsigned long charcode = 0;
     int load_flags = FT_LOAD_DEFAULT;
+    FT_Error error;
+    PyObject *result = NULL;
 
     const char* keywords[] = {"charcode", "load_flags", NULL};
 
@@ -799,14 +1345,20 @@ Py_Face_load_char(Py_Face* self, PyObject* args, PyObject* kwds) {
         return NULL;
     }
 
-    if (ftpy_exc(
-            FT_Load_Char(self->x, charcode, load_flags))) {
-        return NULL;
+    FTPY_FACE_LOCK(self);
+
+    Py_BEGIN_ALLOW_THREADS
+    error = FT_Load_Char(self->x, charcode, load_flags);
+    Py_END_ALLOW_THREADS
+
+    if (!ftpy_exc(error)) {
+        self->load_flags = load_flags;
+        result = Py_Glyph_cnew(self->x->glyph, (PyObject *)self, load_flags);
     }
 
-    self->load_flags = load_flags;
+    FTPY_FACE_UNLOCK(self);
 
-    return Py_Glyph_cnew(self->x->glyph, (PyObject *)self, load_flags);
+    return result;
 }
 
 
@@ -815,6 +1367,8 @@ Py_Face_load_char_unicode(Py_Face* self, PyObject* args, PyObject* kwds) {
     PyObject *py_unicode = NULL;
     int load_flags = FT_LOAD_DEFAULT;
     unsigned long charcode = 0;
+    FT_Error error;
+    PyObject *result = NULL;
 
     const char* keywords[] = {"charcode", "load_flags", NULL};
 
@@ -832,14 +1386,20 @@ Py_Face_load_char_unicode(Py_Face* self, PyObject* args, PyObject* kwds) {
         return NULL;
     }
 
-    if (ftpy_exc(
-            FT_Load_Char(self->x, charcode, load_flags))) {
-        return NULL;
+    FTPY_FACE_LOCK(self);
+
+    Py_BEGIN_ALLOW_THREADS
+    error = FT_Load_Char(self->x, charcode, load_flags);
+    Py_END_ALLOW_THREADS
+
+    if (!ftpy_exc(error)) {
+        self->load_flags = load_flags;
+        result = Py_Glyph_cnew(self->x->glyph, (PyObject *)self, load_flags);
     }
 
-    self->load_flags = load_flags;
+    FTPY_FACE_UNLOCK(self);
 
-    return Py_Glyph_cnew(self->x->glyph, (PyObject *)self, load_flags);
+    return result;
 }
 
 
@@ -847,6 +1407,8 @@ static PyObject*
 Py_Face_load_glyph(Py_Face* self, PyObject* args, PyObject* kwds) {
     unsigned int glyph_index = 0;
     int load_flags = FT_LOAD_DEFAULT;
+    FT_Error error;
+    PyObject *result = NULL;
 
     const char* keywords[] = {"glyph_index", "load_flags", NULL};
 
@@ -856,14 +1418,157 @@ Py_Face_load_glyph(Py_Face* self, PyObject* args, PyObject* kwds) {
         return NULL;
     }
 
-    if (ftpy_exc(
-            FT_Load_Glyph(self->x, glyph_index, load_flags))) {
+    FTPY_FACE_LOCK(self);
+
+    Py_BEGIN_ALLOW_THREADS
+    error = FT_Load_Glyph(self->x, glyph_index, load_flags);
+    Py_END_ALLOW_THREADS
+
+    if (!ftpy_exc(error)) {
+        self->load_flags = load_flags;
+        result = Py_Glyph_cnew(self->x->glyph, (PyObject *)self, load_flags);
+    }
+
+    FTPY_FACE_UNLOCK(self);
+
+    return result;
+}
+
+
+static PyObject*
+Py_Face_measure_text(Py_Face* self, PyObject* args, PyObject* kwds) {
+    PyObject *text_obj;
+    int load_flags = FT_LOAD_DEFAULT;
+    int ink = 1;
+    PyObject *decoded_text;
+    uint32_t *text;
+    Py_ssize_t text_size;
+    FT_BBox layout_bbox;
+    FT_BBox ink_bbox;
+    FT_BBox *ink_bbox_ptr = &ink_bbox;
+    PyObject *layout_bbox_obj;
+    PyObject *ink_bbox_obj;
+    FT_Error error;
+
+    const char* keywords[] = {"text", "load_flags", "ink", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "O|ii:measure_text", (char **)keywords,
+            &text_obj, &load_flags, &ink)) {
         return NULL;
     }
 
-    self->load_flags = load_flags;
+    if (self->x->charmap == NULL ||
+        self->x->charmap->encoding != FT_ENCODING_UNICODE) {
+        PyErr_SetString(
+            PyExc_ValueError, "measure_text only supports Unicode character map");
+        return NULL;
+    }
 
-    return Py_Glyph_cnew(self->x->glyph, (PyObject *)self, load_flags);
+    /* The advances in the font's metrics tables aren't transformed */
+    if (!ink &&
+        self->transform.xx == 0x10000 && self->transform.yy == 0x10000 &&
+        self->transform.xy == 0 && self->transform.yx == 0) {
+        ink_bbox_ptr = NULL;
+    }
+
+    decoded_text = ftpy_PyUnicode_AsUTF32(text_obj, &text, &text_size);
+    if (decoded_text == NULL) {
+        return NULL;
+    }
+
+    FTPY_FACE_LOCK(self);
+    Py_BEGIN_ALLOW_THREADS
+    error = ftpy_measure_simple_layout(
+        self->x, &self->metrics_cache, &self->kerning_cache, load_flags,
+        text, text_size,
+        &layout_bbox, ink_bbox_ptr);
+    Py_END_ALLOW_THREADS
+    FTPY_FACE_UNLOCK(self);
+
+    Py_DECREF(decoded_text);
+
+    if (ftpy_exc(error)) {
+        return NULL;
+    }
+
+    layout_bbox_obj = Py_BBox_cnew(&layout_bbox, 1.0 / (double)(1 << 6));
+    if (layout_bbox_obj == NULL) {
+        return NULL;
+    }
+
+    if (ink) {
+        ink_bbox_obj = Py_BBox_cnew(&ink_bbox, 1.0 / (double)(1 << 6));
+        if (ink_bbox_obj == NULL) {
+            Py_DECREF(layout_bbox_obj);
+            return NULL;
+        }
+    } else {
+        Py_INCREF(Py_None);
+        ink_bbox_obj = Py_None;
+    }
+
+    return Py_BuildValue("(NN)", layout_bbox_obj, ink_bbox_obj);
+}
+
+
+static PyObject*
+Py_Face_render_glyphs(Py_Face* self, PyObject* args, PyObject* kwds) {
+    PyObject *glyph_indices_obj;
+    int render_mode = FT_RENDER_MODE_NORMAL;
+    int load_flags = 0;
+    uint32_t *glyph_indices;
+    Py_ssize_t n;
+    ftpy_Atlas atlas;
+    PyObject *buffer = NULL;
+    PyObject *metrics = NULL;
+    FT_Error error;
+
+    const char* keywords[] = {"glyph_indices", "render_mode", "load_flags", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "O|ii:render_glyphs", (char **)keywords,
+            &glyph_indices_obj, &render_mode, &load_flags)) {
+        return NULL;
+    }
+
+    /* The atlas has one byte per pixel */
+    if (render_mode == FT_RENDER_MODE_LCD ||
+        render_mode == FT_RENDER_MODE_LCD_V) {
+        PyErr_SetString(
+            PyExc_ValueError, "LCD render modes are not supported by render_glyphs");
+        return NULL;
+    }
+
+    if (ftpy_PyObject_AsUInt32Array(glyph_indices_obj, &glyph_indices, &n)) {
+        return NULL;
+    }
+
+    FTPY_FACE_LOCK(self);
+    Py_BEGIN_ALLOW_THREADS
+    error = ftpy_render_atlas(
+        self->x, self->library, load_flags, render_mode,
+        glyph_indices, n, &atlas);
+    Py_END_ALLOW_THREADS
+    FTPY_FACE_UNLOCK(self);
+
+    free(glyph_indices);
+
+    if (ftpy_exc(error)) {
+        return NULL;
+    }
+
+    buffer = ftpy_Array_cnew_from_data(
+        atlas.buffer, "B", 1, 2, atlas.height, atlas.width);
+    metrics = ftpy_Array_cnew_from_data(
+        atlas.metrics, "i", sizeof(int), 2, n, FTPY_ATLAS_NCOLUMNS);
+    if (buffer == NULL || metrics == NULL) {
+        Py_XDECREF(buffer);
+        Py_XDECREF(metrics);
+        return NULL;
+    }
+
+    return Py_BuildValue("(NN)", buffer, metrics);
 }
 
 
@@ -877,6 +1582,7 @@ Py_Face_request_size(Py_Face* self, PyObject* args, PyObject* kwds) {
     long width_fixed;
     long height_fixed;
     FT_Size_RequestRec request;
+    FT_Error error;
 
     const char* keywords[] = {"type", "width", "height", "horiResolution",
                               "vertResolution"};
@@ -905,8 +1611,11 @@ Py_Face_request_size(Py_Face* self, PyObject* args, PyObject* kwds) {
     request.horiResolution = horiResolution;
     request.vertResolution = vertResolution;
 
-    if (ftpy_exc(
-            FT_Request_Size(self->x, &request))) {
+    FTPY_FACE_LOCK(self);
+    error = FT_Request_Size(self->x, &request);
+    FTPY_FACE_UNLOCK(self);
+
+    if (ftpy_exc(error)) {
         return NULL;
     }
 
@@ -917,6 +1626,7 @@ Py_Face_request_size(Py_Face* self, PyObject* args, PyObject* kwds) {
 static PyObject*
 Py_Face_select_charmap(Py_Face* self, PyObject* args, PyObject* kwds) {
     int encoding = 0;
+    FT_Error error;
 
     const char* keywords[] = {"encoding", NULL};
 
@@ -926,8 +1636,11 @@ Py_Face_select_charmap(Py_Face* self, PyObject* args, PyObject* kwds) {
         return NULL;
     }
 
-    if (ftpy_exc(
-            FT_Select_Charmap(self->x, encoding))) {
+    FTPY_FACE_LOCK(self);
+    error = FT_Select_Charmap(self->x, encoding);
+    FTPY_FACE_UNLOCK(self);
+
+    if (ftpy_exc(error)) {
         return NULL;
     }
 
@@ -938,6 +1651,7 @@ Py_Face_select_charmap(Py_Face* self, PyObject* args, PyObject* kwds) {
 static PyObject*
 Py_Face_select_size(Py_Face* self, PyObject* args, PyObject* kwds) {
     int strike_index = 0;
+    FT_Error error;
 
     const char* keywords[] = {"strike_index", NULL};
 
@@ -947,8 +1661,11 @@ Py_Face_select_size(Py_Face* self, PyObject* args, PyObject* kwds) {
         return NULL;
     }
 
-    if (ftpy_exc(
-            FT_Select_Size(self->x, strike_index))) {
+    FTPY_FACE_LOCK(self);
+    error = FT_Select_Size(self->x, strike_index);
+    FTPY_FACE_UNLOCK(self);
+
+    if (ftpy_exc(error)) {
         return NULL;
     }
 
@@ -960,6 +1677,7 @@ static PyObject*
 Py_Face_set_charmap(Py_Face* self, PyObject* args, PyObject* kwds) {
 
     unsigned long map = 0;
+    FT_Error error;
 
     const char* keywords[] = {"charmap", NULL};
 
@@ -977,8 +1695,11 @@ Py_Face_set_charmap(Py_Face* self, PyObject* args, PyObject* kwds) {
         return NULL;
     }
 
-    if (ftpy_exc(
-            FT_Set_Charmap(self->x, self->x->charmaps[map]))) {
+    FTPY_FACE_LOCK(self);
+    error = FT_Set_Charmap(self->x, self->x->charmaps[map]);
+    FTPY_FACE_UNLOCK(self);
+
+    if (ftpy_exc(error)) {
         return NULL;
     }
 
@@ -992,6 +1713,7 @@ Py_Face_set_char_size(Py_Face* self, PyObject* args, PyObject* kwds) {
     double char_height = 0;
     unsigned int horz_resolution = 0;
     unsigned int vert_resolution = 0;
+    FT_Error error;
 
     const char* keywords[] = {"char_width", "char_height", "horz_resolution",
                               "vert_resolution", NULL};
@@ -1007,10 +1729,13 @@ Py_Face_set_char_size(Py_Face* self, PyObject* args, PyObject* kwds) {
         char_width = 12.0;
     }
 
-    if (ftpy_exc(
-            FT_Set_Char_Size(
-                self->x, TO_F26DOT6(char_width), TO_F26DOT6(char_height),
-                horz_resolution, vert_resolution))) {
+    FTPY_FACE_LOCK(self);
+    error = FT_Set_Char_Size(
+        self->x, TO_F26DOT6(char_width), TO_F26DOT6(char_height),
+        horz_resolution, vert_resolution);
+    FTPY_FACE_UNLOCK(self);
+
+    if (ftpy_exc(error)) {
         return NULL;
     }
 
@@ -1043,9 +1768,64 @@ Py_Face_set_transform(Py_Face* self, PyObject* args, PyObject* kwds) {
     matrix.yx = TO_FT_FIXED(yx);
     matrix.yy = TO_FT_FIXED(yy);
     delta.x = TO_FT_FIXED(x);
-    delta.x = TO_FT_FIXED(x);
+    delta.y = TO_FT_FIXED(y);
 
+    FTPY_FACE_LOCK(self);
     FT_Set_Transform(self->x, &matrix, &delta);
+    self->transform = matrix;
+    self->delta = delta;
+    /* The cached advances are transformed */
+    ftpy_LRU_clear(&self->metrics_cache);
+    FTPY_FACE_UNLOCK(self);
+
+    Py_RETURN_NONE;
+}
+
+
+static PyObject*
+Py_Face_set_lcd_filter(Py_Face* self, PyObject* args, PyObject* kwds) {
+    int filter;
+    FT_Error error;
+
+    const char* keywords[] = {"filter", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "i:set_lcd_filter", (char **)keywords,
+            &filter)) {
+        return NULL;
+    }
+
+    FTPY_FACE_LOCK(self);
+    error = ftpy_set_lcd_filter(self->library, filter);
+    FTPY_FACE_UNLOCK(self);
+
+    if (ftpy_exc(error)) {
+        return NULL;
+    }
+
+    Py_RETURN_NONE;
+}
+
+
+static PyObject*
+Py_Face_set_lcd_filter_weights(Py_Face* self, PyObject* args, PyObject* kwds) {
+    unsigned char filters[5];
+    FT_Error error;
+
+    if (!PyArg_ParseTuple(
+            args, "bbbbb:set_lcd_filter_weights",
+            &filters[0], &filters[1], &filters[2],
+            &filters[3], &filters[4])) {
+        return NULL;
+    }
+
+    FTPY_FACE_LOCK(self);
+    error = ftpy_set_lcd_filter_weights(self->library, filters);
+    FTPY_FACE_UNLOCK(self);
+
+    if (ftpy_exc(error)) {
+        return NULL;
+    }
 
     Py_RETURN_NONE;
 }
@@ -1053,26 +1833,35 @@ Py_Face_set_transform(Py_Face* self, PyObject* args, PyObject* kwds) {
 
 static PyMethodDef Py_Face_methods[] = {
     FACE_METHOD(attach),
+    FACE_METHOD_NOARGS(coverage),
     FACE_METHOD(get_char_index),
     FACE_METHOD(get_char_index_unicode),
+    FACE_METHOD(get_char_indices),
+    FACE_METHOD_NOARGS(get_char_map_arrays),
     FACE_METHOD(get_char_name),
     FACE_METHOD(get_char_variant_index),
     FACE_METHOD_NOARGS(get_chars),
     FACE_METHOD_NOARGS(get_fstype_flags),
     FACE_METHOD(get_glyph_name),
     FACE_METHOD(get_kerning),
+    FACE_METHOD(get_kerning_batch),
     FACE_METHOD(get_name_index),
     FACE_METHOD_NOARGS(get_postscript_name),
     FACE_METHOD(get_track_kerning),
     FACE_METHOD_NOARGS(has_ps_glyph_names),
+    FACE_METHOD(layout_many),
     FACE_METHOD(load_char),
     FACE_METHOD(load_char_unicode),
     FACE_METHOD(load_glyph),
+    FACE_METHOD(measure_text),
+    FACE_METHOD(render_glyphs),
     FACE_METHOD(request_size),
     FACE_METHOD(select_charmap),
     FACE_METHOD(select_size),
     FACE_METHOD(set_charmap),
     FACE_METHOD(set_char_size),
+    FACE_METHOD(set_lcd_filter),
+    FACE_METHOD(set_lcd_filter_weights),
     FACE_METHOD(set_transform),
     {NULL}  /* Sentinel */
 };
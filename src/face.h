@@ -31,8 +31,14 @@ either expressed or implied, of the FreeBSD Project.
 #define __FACE_H__
 
 #include "freetypy.h"
+#include "charmap_cache.h"
 #include "constants.h"
 #include "file.h"
+#include "font_blob.h"
+#include "kerning_cache.h"
+#include "lru.h"
+
+#include "pythread.h"
 
 
 typedef struct {
@@ -43,20 +49,83 @@ typedef struct {
     ftpy_offset_t offset;
     void *mem;
     size_t mem_size;
+    ftpy_Font_Blob *blob;
+    /* Held for the lifetime of the face when it reads directly from
+       an object's buffer */
+    Py_buffer view;
+    int has_view;
 } Py_Face_Stream_Meta;
 
 
 typedef struct {
     ftpy_Object base;
     FT_Face x;
+    FT_Library library;
+    int owns_library;
     int load_flags;
     PyObject *filename;
 
+    /* The last transform passed to FT_Set_Transform, which FreeType
+       does not otherwise expose.  Needed for cache keys. */
+    FT_Matrix transform;
+    FT_Vector delta;
+
     Py_Face_Stream_Meta main;
     Py_Face_Stream_Meta attach;
+
+    PyThread_type_lock lock;
+
+    /* Glyph metrics for layout, protected by the lock.  See
+       metrics_cache.h */
+    ftpy_LRU metrics_cache;
+
+    /* Glyph outlines for transformed layouts, protected by the lock.
+       See outline_cache.h */
+    ftpy_LRU outline_cache;
+
+    /* Kerning pairs for layout, protected by the lock.  See
+       kerning_cache.h */
+    ftpy_Kerning_Cache kerning_cache;
+
+    /* Character to glyph lookup tables, protected by the lock.  See
+       charmap_cache.h */
+    ftpy_Charmap_Cache charmap_cache;
+
+    /* The Coverage object, built on first use by Face.coverage() */
+    PyObject *coverage;
 } Py_Face;
 
 
+/*
+   FreeType allows different FT_Face objects to be used from different
+   threads at the same time, but any single FT_Face may only be used
+   by one thread at a time.  Each Face therefore carries its own lock,
+   which must be held around any FreeType call that reads or modifies
+   the face, so that the GIL can be released during the expensive
+   parts (loading, hinting and rasterizing glyphs).
+
+   The lock is acquired with the GIL held.  If it is contended, the
+   GIL is released while waiting, so that the thread holding the face
+   lock can reacquire the GIL and finish.
+*/
+#define FTPY_FACE_LOCK(face)                                    \
+    do {                                                        \
+        if (!PyThread_acquire_lock((face)->lock, NOWAIT_LOCK)) { \
+            Py_BEGIN_ALLOW_THREADS                              \
+            PyThread_acquire_lock((face)->lock, WAIT_LOCK);     \
+            Py_END_ALLOW_THREADS                                \
+        }                                                       \
+    } while (0)
+
+
+#define FTPY_FACE_UNLOCK(face) PyThread_release_lock((face)->lock)
+
+
+/* Returns a new reference to the face's Coverage object, which is
+   built the first time it is needed. */
+PyObject *Py_Face_get_coverage(Py_Face *self);
+
+
 int setup_Face(PyObject *m);
 
 
@@ -64,6 +133,8 @@ extern PyTypeObject Py_Face_Type;
 
 
 extern ftpy_ConstantType Py_FT_FSTYPE_BitflagType;
+extern ftpy_BitflagType Py_FT_FACE_FLAG_BitflagType;
+extern ftpy_BitflagType Py_FT_STYLE_FLAG_BitflagType;
 
 
 #endif
@@ -0,0 +1,525 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#include "fallback_layout.h"
+#include "doc/fallback_layout.h"
+
+#include "array.h"
+#include "bbox.h"
+#include "coverage.h"
+#include "face.h"
+#include "layout.h"
+#include "pyutil.h"
+
+
+#define DEF_FALLBACK_LAYOUT_GETTER(name) \
+    DEF_GETTER(name, doc_FallbackLayout_ ## name)
+#define FALLBACK_LAYOUT_METHOD(name) DEF_METHOD(name, FallbackLayout)
+
+
+/****************************************************************************
+ Object basics
+*/
+
+
+static void
+Py_FallbackLayout_dealloc(Py_FallbackLayout* self)
+{
+    free(self->x.glyph_indices);
+    free(self->x.xys);
+    free(self->runs);
+    Py_TYPE(self)->tp_clear((PyObject*)self);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+
+static PyObject *
+Py_FallbackLayout_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    Py_FallbackLayout *self;
+
+    self = (Py_FallbackLayout *)ftpy_Object_new(type, args, kwds);
+    if (self == NULL) {
+        return NULL;
+    }
+    self->base.owner = NULL;
+    self->x.xys = NULL;
+    self->x.glyph_indices = NULL;
+    self->x.size = 0;
+    self->runs = NULL;
+    self->nruns = 0;
+    self->load_flags = 0;
+    return (PyObject *)self;
+}
+
+
+/* Splits the text into runs, giving each character to the first face
+   that covers it.  Characters that no face covers go to the first
+   face, which will draw them as its missing glyph. */
+static int
+split_runs(
+    const uint32_t *text, size_t text_length,
+    const ftpy_Coverage **coverages, size_t nfaces,
+    ftpy_Layout_Run **runs, size_t *nruns)
+{
+    size_t i, j;
+    size_t face_id;
+    size_t capacity = 0;
+    ftpy_Layout_Run *new_runs;
+
+    *runs = NULL;
+    *nruns = 0;
+
+    for (i = 0; i < text_length; ++i) {
+        face_id = 0;
+        for (j = 0; j < nfaces; ++j) {
+            if (ftpy_coverage_has_char(
+                    coverages[j]->leaves, coverages[j]->nleaves, text[i])) {
+                face_id = j;
+                break;
+            }
+        }
+
+        if (*nruns && (*runs)[*nruns - 1].face_id == face_id) {
+            (*runs)[*nruns - 1].length++;
+            continue;
+        }
+
+        if (*nruns == capacity) {
+            capacity = capacity ? capacity * 2 : 8;
+            new_runs = realloc(*runs, sizeof(ftpy_Layout_Run) * capacity);
+            if (new_runs == NULL) {
+                free(*runs);
+                *runs = NULL;
+                *nruns = 0;
+                return -1;
+            }
+            *runs = new_runs;
+        }
+
+        (*runs)[*nruns].start = i;
+        (*runs)[*nruns].length = 1;
+        (*runs)[*nruns].face_id = face_id;
+        (*nruns)++;
+    }
+
+    return 0;
+}
+
+
+static int
+Py_FallbackLayout_init(Py_FallbackLayout *self, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"faces", "text", "load_flags", NULL};
+    PyObject *faces_obj;
+    PyObject *faces = NULL;
+    PyObject *text_obj;
+    int load_flags = FT_LOAD_DEFAULT;
+    PyObject *decoded_text = NULL;
+    uint32_t *text;
+    Py_ssize_t text_size;
+    Py_ssize_t nfaces = 0;
+    PyObject **coverage_objs = NULL;
+    const ftpy_Coverage **coverages = NULL;
+    ftpy_Layout_Run *run;
+    Py_Face *face;
+    FT_Vector pen = {0, 0};
+    FT_BBox run_bbox;
+    Py_ssize_t i;
+    FT_Error error;
+    int result = -1;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OO|i:FallbackLayout.__init__",
+                                     kwlist, &faces_obj, &text_obj,
+                                     &load_flags)) {
+        goto exit;
+    }
+
+    faces = PySequence_Tuple(faces_obj);
+    if (faces == NULL) {
+        goto exit;
+    }
+
+    nfaces = PyTuple_GET_SIZE(faces);
+    if (nfaces == 0) {
+        PyErr_SetString(PyExc_ValueError, "At least one face is required");
+        goto exit;
+    }
+
+    coverage_objs = calloc(nfaces, sizeof(PyObject *));
+    coverages = calloc(nfaces, sizeof(ftpy_Coverage *));
+    if (coverage_objs == NULL || coverages == NULL) {
+        PyErr_NoMemory();
+        goto exit;
+    }
+
+    for (i = 0; i < nfaces; ++i) {
+        if (!PyObject_TypeCheck(PyTuple_GET_ITEM(faces, i), &Py_Face_Type)) {
+            PyErr_SetString(PyExc_TypeError, "faces must be a sequence of Face");
+            goto exit;
+        }
+
+        face = (Py_Face *)PyTuple_GET_ITEM(faces, i);
+        if (face->x->charmap == NULL ||
+            face->x->charmap->encoding != FT_ENCODING_UNICODE) {
+            PyErr_SetString(
+                PyExc_ValueError,
+                "The layout only supports Unicode character map");
+            goto exit;
+        }
+
+        coverage_objs[i] = Py_Face_get_coverage(face);
+        if (coverage_objs[i] == NULL) {
+            goto exit;
+        }
+        coverages[i] = &((Py_Coverage *)coverage_objs[i])->x;
+    }
+
+    decoded_text = ftpy_PyUnicode_AsUTF32(text_obj, &text, &text_size);
+    if (decoded_text == NULL) {
+        goto exit;
+    }
+
+    free(self->x.glyph_indices);
+    free(self->x.xys);
+    free(self->runs);
+    self->runs = NULL;
+    self->nruns = 0;
+    self->x.size = 0;
+    self->x.glyph_indices = calloc(text_size ? text_size : 1, sizeof(FT_ULong));
+    self->x.xys = calloc(text_size ? text_size : 1, sizeof(ftpy_Layout_Vector));
+    if (self->x.glyph_indices == NULL || self->x.xys == NULL ||
+        split_runs(text, text_size, coverages, nfaces,
+                   &self->runs, &self->nruns)) {
+        PyErr_NoMemory();
+        goto exit;
+    }
+    self->x.size = text_size;
+
+    ftpy_bbox_set_empty(&self->x.ink_bbox);
+
+    for (i = 0; i < (Py_ssize_t)self->nruns; ++i) {
+        run = &self->runs[i];
+        face = (Py_Face *)PyTuple_GET_ITEM(faces, run->face_id);
+
+        FTPY_FACE_LOCK(face);
+        Py_BEGIN_ALLOW_THREADS
+        error = ftpy_simple_layout_run(
+            face->x, &face->metrics_cache, &face->kerning_cache, load_flags,
+            text + run->start, run->length, &pen,
+            self->x.glyph_indices + run->start, self->x.xys + run->start,
+            &self->x.ink_bbox);
+        Py_END_ALLOW_THREADS
+        FTPY_FACE_UNLOCK(face);
+
+        if (ftpy_exc(error)) {
+            goto exit;
+        }
+
+    }
+
+    /* The line is big enough for each face that was used, or the first
+       face if there is no text */
+    for (i = 0; i < (Py_ssize_t)self->nruns || i == 0; ++i) {
+        face = (Py_Face *)PyTuple_GET_ITEM(
+            faces, self->nruns ? self->runs[i].face_id : 0);
+        ftpy_simple_layout_bbox(face->x, load_flags, &pen, &run_bbox);
+        if (i == 0) {
+            self->x.layout_bbox = run_bbox;
+            continue;
+        }
+        if (run_bbox.xMin < self->x.layout_bbox.xMin)
+            self->x.layout_bbox.xMin = run_bbox.xMin;
+        if (run_bbox.yMin < self->x.layout_bbox.yMin)
+            self->x.layout_bbox.yMin = run_bbox.yMin;
+        if (run_bbox.xMax > self->x.layout_bbox.xMax)
+            self->x.layout_bbox.xMax = run_bbox.xMax;
+        if (run_bbox.yMax > self->x.layout_bbox.yMax)
+            self->x.layout_bbox.yMax = run_bbox.yMax;
+    }
+
+    Py_XDECREF(self->base.owner);
+    self->base.owner = faces;
+    faces = NULL;
+    self->load_flags = load_flags;
+
+    result = 0;
+
+ exit:
+
+    if (result != 0) {
+        free(self->x.glyph_indices);
+        self->x.glyph_indices = NULL;
+        free(self->x.xys);
+        self->x.xys = NULL;
+        free(self->runs);
+        self->runs = NULL;
+        self->nruns = 0;
+        self->x.size = 0;
+    }
+
+    if (coverage_objs != NULL) {
+        for (i = 0; i < nfaces; ++i) {
+            Py_XDECREF(coverage_objs[i]);
+        }
+    }
+    free(coverage_objs);
+    free(coverages);
+    Py_XDECREF(decoded_text);
+    Py_XDECREF(faces);
+
+    return result;
+}
+
+
+/****************************************************************************
+ Getters
+*/
+
+
+static PyObject *ink_bbox_get(Py_FallbackLayout *self, PyObject *closure)
+{
+    return Py_BBox_cnew(&self->x.ink_bbox, 1.0 / (double)(1 << 6));
+}
+
+static PyObject *layout_bbox_get(Py_FallbackLayout *self, PyObject *closure)
+{
+    return Py_BBox_cnew(&self->x.layout_bbox, 1.0 / (double)(1 << 6));
+}
+
+static PyObject *faces_get(Py_FallbackLayout *self, PyObject *closure)
+{
+    if (self->base.owner == NULL) {
+        return PyTuple_New(0);
+    }
+
+    Py_INCREF(self->base.owner);
+    return self->base.owner;
+}
+
+static PyObject *face_ids_get(Py_FallbackLayout *self, PyObject *closure)
+{
+    PyObject *result;
+    uint32_t *face_ids;
+    size_t i, j;
+
+    result = ftpy_Array_cnew("I", sizeof(uint32_t), 1, self->x.size, 0);
+    if (result == NULL) {
+        return NULL;
+    }
+
+    face_ids = ftpy_Array_DATA(result);
+    for (i = 0; i < self->nruns; ++i) {
+        for (j = 0; j < self->runs[i].length; ++j) {
+            face_ids[self->runs[i].start + j] = (uint32_t)self->runs[i].face_id;
+        }
+    }
+
+    return result;
+}
+
+static PyObject *layout_get(Py_FallbackLayout *self, PyObject *closure)
+{
+    PyObject *result;
+    PyObject *subresult;
+    PyObject *face;
+    ftpy_Layout *layout;
+    size_t i, j;
+
+    layout = &self->x;
+
+    result = PyList_New(layout->size);
+
+    if (result == NULL) {
+        return NULL;
+    }
+
+    for (i = 0; i < self->nruns; ++i) {
+        face = PyTuple_GET_ITEM(self->base.owner, self->runs[i].face_id);
+        for (j = self->runs[i].start;
+             j < self->runs[i].start + self->runs[i].length;
+             ++j) {
+            subresult = Py_BuildValue(
+                "(Ok(dd))",
+                face,
+                layout->glyph_indices[j],
+                layout->xys[j].x,
+                layout->xys[j].y);
+            if (subresult == NULL) {
+                Py_DECREF(result);
+                return NULL;
+            }
+            if (PyList_SetItem(result, j, subresult)) {
+                Py_DECREF(subresult);
+                Py_DECREF(result);
+                return NULL;
+            }
+        }
+    }
+
+    return result;
+}
+
+static PyObject *runs_get(Py_FallbackLayout *self, PyObject *closure)
+{
+    PyObject *result;
+    PyObject *subresult;
+    size_t i;
+
+    result = PyList_New(self->nruns);
+
+    if (result == NULL) {
+        return NULL;
+    }
+
+    for (i = 0; i < self->nruns; ++i) {
+        subresult = Py_BuildValue(
+            "(nnn)",
+            (Py_ssize_t)self->runs[i].face_id,
+            (Py_ssize_t)self->runs[i].start,
+            (Py_ssize_t)(self->runs[i].start + self->runs[i].length));
+        if (subresult == NULL) {
+            Py_DECREF(result);
+            return NULL;
+        }
+        if (PyList_SetItem(result, i, subresult)) {
+            Py_DECREF(subresult);
+            Py_DECREF(result);
+            return NULL;
+        }
+    }
+
+    return result;
+}
+
+static PyGetSetDef Py_FallbackLayout_getset[] = {
+    DEF_FALLBACK_LAYOUT_GETTER(face_ids),
+    DEF_FALLBACK_LAYOUT_GETTER(faces),
+    DEF_FALLBACK_LAYOUT_GETTER(ink_bbox),
+    DEF_FALLBACK_LAYOUT_GETTER(layout_bbox),
+    DEF_FALLBACK_LAYOUT_GETTER(layout),
+    DEF_FALLBACK_LAYOUT_GETTER(runs),
+    {NULL}
+};
+
+
+/****************************************************************************
+ Methods
+*/
+
+
+static PyObject*
+Py_FallbackLayout_draw(Py_FallbackLayout* self, PyObject* args, PyObject* kwds) {
+    PyObject *buffer_obj;
+    double x = 0.0;
+    double y = 0.0;
+    int render_mode = FT_RENDER_MODE_NORMAL;
+    Py_Face *face;
+    Py_buffer view;
+    ftpy_Image image;
+    ftpy_Layout run_layout;
+    ftpy_Layout_Run *run;
+    size_t i;
+    FT_Error error = 0;
+
+    const char* keywords[] = {"buffer", "x", "y", "render_mode", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "O|ddi:draw", (char **)keywords,
+            &buffer_obj, &x, &y, &render_mode)) {
+        return NULL;
+    }
+
+    if (self->base.owner == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "Layout is not initialized");
+        return NULL;
+    }
+
+    if (ftpy_Layout_get_image(buffer_obj, render_mode, &view, &image)) {
+        return NULL;
+    }
+
+    for (i = 0; i < self->nruns && !error; ++i) {
+        run = &self->runs[i];
+        face = (Py_Face *)PyTuple_GET_ITEM(self->base.owner, run->face_id);
+
+        run_layout.size = run->length;
+        run_layout.glyph_indices = self->x.glyph_indices + run->start;
+        run_layout.xys = self->x.xys + run->start;
+
+        FTPY_FACE_LOCK(face);
+        Py_BEGIN_ALLOW_THREADS
+        error = ftpy_draw_layout(
+            face->x, self->load_flags, render_mode, &run_layout, x, y, &image);
+        Py_END_ALLOW_THREADS
+        FTPY_FACE_UNLOCK(face);
+    }
+
+    PyBuffer_Release(&view);
+
+    if (ftpy_exc(error)) {
+        return NULL;
+    }
+
+    Py_RETURN_NONE;
+}
+
+
+static PyMethodDef Py_FallbackLayout_methods[] = {
+    FALLBACK_LAYOUT_METHOD(draw),
+    {NULL}  /* Sentinel */
+};
+
+
+/****************************************************************************
+ Setup
+*/
+
+
+static PyTypeObject Py_FallbackLayout_Type;
+
+
+int setup_FallbackLayout(PyObject *m)
+{
+    memset(&Py_FallbackLayout_Type, 0, sizeof(PyTypeObject));
+    Py_FallbackLayout_Type = (PyTypeObject) {
+        .tp_name = "freetypy.FallbackLayout",
+        .tp_basicsize = sizeof(Py_FallbackLayout),
+        .tp_dealloc = (destructor)Py_FallbackLayout_dealloc,
+        .tp_doc = doc_FallbackLayout__init__,
+        .tp_getset = Py_FallbackLayout_getset,
+        .tp_methods = Py_FallbackLayout_methods,
+        .tp_init = (initproc)Py_FallbackLayout_init,
+        .tp_new = Py_FallbackLayout_new
+    };
+
+    ftpy_setup_type(m, &Py_FallbackLayout_Type);
+
+    return 0;
+}
@@ -29,6 +29,13 @@ either expressed or implied, of the FreeBSD Project.
 
 #include "file.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 /****************************************************************************
  This file contains a bunch of functionality to handle Python
  file-like objects in a way that is consistent between Python 2.x and
@@ -214,3 +221,58 @@ int ftpy_PyFile_CloseFile(PyObject *file)
     Py_DECREF(ret);
     return 0;
 }
+
+
+/*
+ * Memory-mapping of files by path
+ *
+ * Unlike a stream, a mapping sees the file change underneath it: if
+ * it is rewritten in place the new bytes are read, and if it is
+ * truncated, touching the missing pages raises SIGBUS.  This is
+ * documented on Face.
+ */
+#ifndef _WIN32
+
+int ftpy_map_file(const char *filename, void **data, size_t *size)
+{
+    int fd;
+    struct stat st;
+    void *map = MAP_FAILED;
+
+    fd = open(filename, O_RDONLY);
+    if (fd != -1) {
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        }
+        /* The mapping keeps its own reference to the file */
+        close(fd);
+    }
+
+    if (map == MAP_FAILED) {
+        return -1;
+    }
+
+    *data = map;
+    *size = (size_t)st.st_size;
+    return 0;
+}
+
+void ftpy_unmap_file(void *data, size_t size)
+{
+    if (data != NULL) {
+        munmap(data, size);
+    }
+}
+
+#else
+
+int ftpy_map_file(const char *filename, void **data, size_t *size)
+{
+    return -1;
+}
+
+void ftpy_unmap_file(void *data, size_t size)
+{
+}
+
+#endif
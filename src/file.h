@@ -78,4 +78,11 @@ int ftpy_PyFile_Check(PyObject *file);
 PyObject* ftpy_PyFile_OpenFile(PyObject *filename, const char *mode);
 int ftpy_PyFile_CloseFile(PyObject *file);
 
+/* Maps the file at the given path read-only into memory.  Returns -1
+   if the file can not be mapped, in which case the caller should fall
+   back to reading it.  These don't use the Python API, so they may be
+   called without the GIL. */
+int ftpy_map_file(const char *filename, void **data, size_t *size);
+void ftpy_unmap_file(void *data, size_t size);
+
 #endif
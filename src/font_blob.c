@@ -0,0 +1,198 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#include "font_blob.h"
+#include "file.h"
+
+
+static ftpy_Font_Blob *blobs = NULL;
+
+
+/* The sub-second part of the modification time, so that a file
+   rewritten within the same second is still noticed */
+#if defined(__APPLE__)
+#define ST_MTIME_NSEC(st) ((long)(st)->st_mtimespec.tv_nsec)
+#elif defined(_WIN32)
+#define ST_MTIME_NSEC(st) 0L
+#else
+#define ST_MTIME_NSEC(st) ((long)(st)->st_mtim.tv_nsec)
+#endif
+
+
+static ftpy_Font_Blob *
+find_blob(const char *path, const struct stat *st)
+{
+    ftpy_Font_Blob *blob;
+
+    for (blob = blobs; blob != NULL; blob = blob->next) {
+        if (blob->device == st->st_dev &&
+            blob->inode == st->st_ino &&
+            blob->mtime == st->st_mtime &&
+            blob->mtime_nsec == ST_MTIME_NSEC(st) &&
+            blob->file_size == st->st_size &&
+            strcmp(blob->path, path) == 0) {
+            return blob;
+        }
+    }
+
+    return NULL;
+}
+
+
+int
+ftpy_font_blob_acquire(PyObject *filename, ftpy_Font_Blob **blob)
+{
+    PyObject *bytes = NULL;
+    const char *path;
+    struct stat st;
+    int stat_result;
+    int map_result;
+    ftpy_Font_Blob *result = NULL;
+    void *data;
+    size_t size;
+
+    #if PY3K
+    if (!PyUnicode_FSConverter(filename, &bytes)) {
+        PyErr_Clear();
+        return -1;
+    }
+    #else
+    if (!PyBytes_Check(filename)) {
+        return -1;
+    }
+    Py_INCREF(filename);
+    bytes = filename;
+    #endif
+
+    path = PyBytes_AS_STRING(bytes);
+
+    Py_BEGIN_ALLOW_THREADS
+    stat_result = stat(path, &st);
+    Py_END_ALLOW_THREADS
+
+    if (stat_result != 0) {
+        goto exit;
+    }
+
+    result = find_blob(path, &st);
+    if (result != NULL) {
+        result->refcount++;
+        goto exit;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    map_result = ftpy_map_file(path, &data, &size);
+    Py_END_ALLOW_THREADS
+
+    if (map_result) {
+        goto exit;
+    }
+
+    /* Another thread may have mapped the same file while the GIL was
+       released */
+    result = find_blob(path, &st);
+    if (result != NULL) {
+        ftpy_unmap_file(data, size);
+        result->refcount++;
+        goto exit;
+    }
+
+    result = malloc(sizeof(ftpy_Font_Blob));
+    if (result == NULL) {
+        ftpy_unmap_file(data, size);
+        goto exit;
+    }
+
+    result->path = malloc(strlen(path) + 1);
+    if (result->path == NULL) {
+        ftpy_unmap_file(data, size);
+        free(result);
+        result = NULL;
+        goto exit;
+    }
+    strcpy(result->path, path);
+
+    result->device = st.st_dev;
+    result->inode = st.st_ino;
+    result->mtime = st.st_mtime;
+    result->mtime_nsec = ST_MTIME_NSEC(&st);
+    result->file_size = st.st_size;
+    result->data = data;
+    result->size = size;
+    result->refcount = 1;
+    result->next = blobs;
+    blobs = result;
+
+ exit:
+
+    Py_DECREF(bytes);
+
+    if (result == NULL) {
+        return -1;
+    }
+
+    *blob = result;
+    return 0;
+}
+
+
+void
+ftpy_font_blob_release(ftpy_Font_Blob *blob)
+{
+    ftpy_Font_Blob **link;
+
+    if (blob == NULL || --blob->refcount > 0) {
+        return;
+    }
+
+    for (link = &blobs; *link != NULL; link = &(*link)->next) {
+        if (*link == blob) {
+            *link = blob->next;
+            break;
+        }
+    }
+
+    ftpy_unmap_file(blob->data, blob->size);
+    free(blob->path);
+    free(blob);
+}
+
+
+void
+ftpy_font_blob_usage(size_t *count, size_t *nbytes)
+{
+    ftpy_Font_Blob *blob;
+
+    *count = 0;
+    *nbytes = 0;
+    for (blob = blobs; blob != NULL; blob = blob->next) {
+        (*count)++;
+        *nbytes += blob->size;
+    }
+}
@@ -0,0 +1,85 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#ifndef __FONT_BLOB_H__
+#define __FONT_BLOB_H__
+
+#include "freetypy.h"
+
+#include <sys/stat.h>
+
+
+/*
+   A process-wide registry of the font files opened by path, so that
+   any number of Faces of the same file (at different sizes, or
+   different faces of a collection) share a single mapping of it.
+
+   Blobs are keyed by path, device, inode, modification time (to the
+   nanosecond, where the platform has it) and size, so a file that
+   changes on disk is mapped again for new faces.  Existing faces keep
+   the old contents only if the file was replaced by renaming a new
+   file over it: since the mapping is shared with the file, a rewrite
+   in place is seen by existing faces too.  Each blob is
+   reference-counted, and unmapped when the last face using it is
+   freed.
+
+   The registry is protected by the GIL.
+*/
+
+
+typedef struct ftpy_Font_Blob {
+    struct ftpy_Font_Blob *next;
+    char *path;
+    dev_t device;
+    ino_t inode;
+    time_t mtime;
+    long mtime_nsec;
+    off_t file_size;
+    void *data;
+    size_t size;
+    Py_ssize_t refcount;
+} ftpy_Font_Blob;
+
+
+/* Gets a new reference to the blob for the file at the given path,
+   mapping it if it isn't already in the registry.  Returns -1,
+   without setting a Python exception, if the file can not be mapped,
+   in which case the caller should fall back to reading it. */
+int ftpy_font_blob_acquire(PyObject *filename, ftpy_Font_Blob **blob);
+
+
+void ftpy_font_blob_release(ftpy_Font_Blob *blob);
+
+
+/* Gets the number of blobs in the registry and the total number of
+   bytes they hold. */
+void ftpy_font_blob_usage(size_t *count, size_t *nbytes);
+
+
+#endif
@@ -30,19 +30,27 @@ either expressed or implied, of the FreeBSD Project.
 #include "freetypy.h"
 #include "doc/freetypy.h"
 
+#include "array.h"
 #include "bbox.h"
 #include "bitmap.h"
+#include "bitmap_cache.h"
 #include "bitmap_size.h"
 #include "chariter.h"
 #include "charmap.h"
 #include "constants.h"
+#include "coverage.h"
 #include "face.h"
+#include "fallback_layout.h"
+#include "font_blob.h"
 #include "glyph.h"
+#include "glyph_cache.h"
 #include "glyph_metrics.h"
 #include "layout.h"
 #include "lcd.h"
 #include "matrix.h"
 #include "outline.h"
+#include "paragraph_layout.h"
+#include "scan.h"
 #include "sfntname.h"
 #include "sfntnames.h"
 #include "size.h"
@@ -59,18 +67,79 @@ either expressed or implied, of the FreeBSD Project.
 #include "vector.h"
 #include "version.h"
 
+#include "doc/font_blob.h"
 #include "doc/lcd.h"
+#include "doc/scan.h"
 
 #include FT_LCD_FILTER_H
 
 static FT_Library ft_library;
 
+
+/* The LCD filter settings of the shared library, which are inherited
+   by any private libraries created afterward */
+static int ft_library_lcd_filter = FT_LCD_FILTER_NONE;
+static unsigned char ft_library_lcd_filter_weights[5];
+static int ft_library_has_lcd_filter_weights = 0;
+
+
 FT_Library get_ft_library()
 {
     return ft_library;
 }
 
 
+FT_Error ftpy_new_library(FT_Library *library)
+{
+    FT_Error error;
+
+    error = FT_Init_FreeType(library);
+    if (error) {
+        return error;
+    }
+
+    /* Errors are ignored here: the settings were already accepted
+       by the shared library, so they can only fail the same way */
+    if (ft_library_lcd_filter != FT_LCD_FILTER_NONE) {
+        FT_Library_SetLcdFilter(*library, ft_library_lcd_filter);
+    }
+
+    if (ft_library_has_lcd_filter_weights) {
+        FT_Library_SetLcdFilterWeights(*library, ft_library_lcd_filter_weights);
+    }
+
+    return 0;
+}
+
+
+FT_Error ftpy_set_lcd_filter(FT_Library library, int filter)
+{
+    FT_Error error;
+
+    error = FT_Library_SetLcdFilter(library, filter);
+    if (!error && library == ft_library) {
+        ft_library_lcd_filter = filter;
+        ft_library_has_lcd_filter_weights = 0;
+    }
+
+    return error;
+}
+
+
+FT_Error ftpy_set_lcd_filter_weights(FT_Library library, unsigned char *weights)
+{
+    FT_Error error;
+
+    error = FT_Library_SetLcdFilterWeights(library, weights);
+    if (!error && library == ft_library) {
+        memcpy(ft_library_lcd_filter_weights, weights, 5);
+        ft_library_has_lcd_filter_weights = 1;
+    }
+
+    return error;
+}
+
+
 PyObject *
 py_set_lcd_filter(PyObject *self, PyObject *args, PyObject *kwargs)
 {
@@ -83,7 +152,7 @@ py_set_lcd_filter(PyObject *self, PyObject *args, PyObject *kwargs)
         return NULL;
     }
 
-    if (ftpy_exc(FT_Library_SetLcdFilter(get_ft_library(), filter))) {
+    if (ftpy_exc(ftpy_set_lcd_filter(get_ft_library(), filter))) {
         return NULL;
     }
 
@@ -104,7 +173,7 @@ py_set_lcd_filter_weights(PyObject *self, PyObject *args, PyObject *kwargs)
         return NULL;
     }
 
-    if (ftpy_exc(FT_Library_SetLcdFilterWeights(get_ft_library(), filters))) {
+    if (ftpy_exc(ftpy_set_lcd_filter_weights(get_ft_library(), filters))) {
         return NULL;
     }
 
@@ -112,7 +181,21 @@ py_set_lcd_filter_weights(PyObject *self, PyObject *args, PyObject *kwargs)
 }
 
 
+PyObject *
+py_font_blob_usage(PyObject *self, PyObject *args)
+{
+    size_t count;
+    size_t nbytes;
+
+    ftpy_font_blob_usage(&count, &nbytes);
+
+    return Py_BuildValue("(nn)", (Py_ssize_t)count, (Py_ssize_t)nbytes);
+}
+
+
 static PyMethodDef module_methods[] = {
+    {"font_blob_usage", (PyCFunction)py_font_blob_usage, METH_NOARGS, doc_font_blob_usage},
+    {"scan_fonts", (PyCFunction)py_scan_fonts, METH_VARARGS|METH_KEYWORDS, doc_scan_fonts},
     {"set_lcd_filter", (PyCFunction)py_set_lcd_filter, METH_VARARGS|METH_KEYWORDS, doc_set_lcd_filter},
     {"set_lcd_filter_weights", (PyCFunction)py_set_lcd_filter_weights, METH_VARARGS|METH_KEYWORDS, doc_set_lcd_filter_weights},
     {NULL}  /* Sentinel */
@@ -186,18 +269,24 @@ PyObject *freetypy_module;
         setup_constants(freetypy_module) ||
         setup_version(freetypy_module) ||
         setup_errors() ||
+        setup_Array(freetypy_module) ||
         setup_BBox(freetypy_module) ||
         setup_Bitmap(freetypy_module) ||
+        setup_BitmapCache(freetypy_module) ||
         setup_Bitmap_Size(freetypy_module) ||
         setup_CharIter(freetypy_module) ||
         setup_CharMap(freetypy_module) ||
+        setup_Coverage(freetypy_module) ||
         setup_Face(freetypy_module) ||
+        setup_FallbackLayout(freetypy_module) ||
         setup_Glyph(freetypy_module) ||
+        setup_GlyphCache(freetypy_module) ||
         setup_Glyph_Metrics(freetypy_module) ||
         setup_Layout(freetypy_module) ||
         setup_Lcd(freetypy_module) ||
         setup_Matrix(freetypy_module) ||
         setup_Outline(freetypy_module) ||
+        setup_ParagraphLayout(freetypy_module) ||
         setup_SfntName(freetypy_module) ||
         setup_SfntNames(freetypy_module) ||
         setup_Size(freetypy_module) ||
@@ -50,6 +50,17 @@ either expressed or implied, of the FreeBSD Project.
 FT_Library get_ft_library(void);
 
 
+/* Create a new, private FT_Library.  Library-level settings made on
+   the shared library (such as the LCD filter) are copied to it. */
+FT_Error ftpy_new_library(FT_Library *library);
+
+
+FT_Error ftpy_set_lcd_filter(FT_Library library, int filter);
+
+
+FT_Error ftpy_set_lcd_filter_weights(FT_Library library, unsigned char *weights);
+
+
 extern PyObject *freetypy_module;
 
 
@@ -33,6 +33,7 @@ either expressed or implied, of the FreeBSD Project.
 #include "bbox.h"
 #include "bitmap.h"
 #include "constants.h"
+#include "face.h"
 #include "glyph_metrics.h"
 #include "outline.h"
 #include "subglyphs.h"
@@ -60,7 +61,7 @@ static PyTypeObject Py_Glyph_Type;
 static void
 Py_Glyph_dealloc(Py_Glyph* self)
 {
-    free(self->x);
+    PyMem_Free(self->x);
     if (self->glyph) {
         FT_Done_Glyph(self->glyph);
     }
@@ -69,39 +70,31 @@ Py_Glyph_dealloc(Py_Glyph* self)
 }
 
 
-PyObject *
-Py_Glyph_cnew(FT_GlyphSlot glyph_slot, PyObject *owner, int load_flags)
+/* Creates a new Glyph, taking ownership of the given FT_Glyph */
+static PyObject *
+glyph_new(FT_GlyphSlot glyph_slot, FT_Glyph glyph, PyObject *owner, int load_flags)
 {
     Py_Glyph *self;
     FT_GlyphSlot glyph_slot_copy;
-    FT_Glyph glyph;
-
-    if (ftpy_exc(FT_Get_Glyph(glyph_slot, &glyph))) {
-        return NULL;
-    }
 
     self = (Py_Glyph *)(&Py_Glyph_Type)->tp_alloc(&Py_Glyph_Type, 0);
     if (self == NULL) {
+        FT_Done_Glyph(glyph);
         return NULL;
     }
 
     self->x = NULL;
-    self->glyph = NULL;
+    self->glyph = glyph;
+    self->load_flags = load_flags;
 
     glyph_slot_copy = PyMem_Malloc(sizeof(FT_GlyphSlotRec));
     if (glyph_slot_copy == NULL) {
         Py_DECREF(self);
-        return NULL;
+        return PyErr_NoMemory();
     }
     memcpy(glyph_slot_copy, glyph_slot, sizeof(FT_GlyphSlotRec));
     self->x = glyph_slot_copy;
 
-    if (ftpy_exc(FT_Glyph_Copy(glyph, &self->glyph))) {
-        Py_DECREF(self);
-        return NULL;
-    }
-    FT_Done_Glyph(glyph);
-
     Py_INCREF(owner);
     self->base.owner = owner;
 
@@ -109,6 +102,35 @@ Py_Glyph_cnew(FT_GlyphSlot glyph_slot, PyObject *owner, int load_flags)
 }
 
 
+PyObject *
+Py_Glyph_cnew(FT_GlyphSlot glyph_slot, PyObject *owner, int load_flags)
+{
+    FT_Glyph glyph;
+
+    /* FT_Get_Glyph already returns an independent copy, so we can
+       just take ownership of it */
+    if (ftpy_exc(FT_Get_Glyph(glyph_slot, &glyph))) {
+        return NULL;
+    }
+
+    return glyph_new(glyph_slot, glyph, owner, load_flags);
+}
+
+
+PyObject *
+Py_Glyph_cnew_copy(
+    FT_GlyphSlot glyph_slot, FT_Glyph glyph, PyObject *owner, int load_flags)
+{
+    FT_Glyph glyph_copy;
+
+    if (ftpy_exc(FT_Glyph_Copy(glyph, &glyph_copy))) {
+        return NULL;
+    }
+
+    return glyph_new(glyph_slot, glyph_copy, owner, load_flags);
+}
+
+
 static PyObject *
 Py_Glyph_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
@@ -268,6 +290,9 @@ Py_Glyph_render(Py_Glyph* self, PyObject* args, PyObject* kwds) {
     double x = 0;
     double y = 0;
     FT_Vector origin;
+    FT_Error error;
+    Py_Face *face = (Py_Face *)self->base.owner;
+    PyObject *result = NULL;
 
     const char* keywords[] = {"render_mode", "origin", NULL};
 
@@ -280,13 +305,22 @@ Py_Glyph_render(Py_Glyph* self, PyObject* args, PyObject* kwds) {
     origin.x = TO_F26DOT6(x);
     origin.y = TO_F26DOT6(y);
 
-    if (ftpy_exc(
-            FT_Glyph_To_Bitmap(&self->glyph, render_mode, &origin, 1))) {
-        return NULL;
+    /* The glyph is an independent copy, but it is still rasterized
+       with the face's library, so it shares the face's lock */
+    FTPY_FACE_LOCK(face);
+
+    Py_BEGIN_ALLOW_THREADS
+    error = FT_Glyph_To_Bitmap(&self->glyph, render_mode, &origin, 1);
+    Py_END_ALLOW_THREADS
+
+    if (!ftpy_exc(error)) {
+        result = Py_Bitmap_cnew(
+            &((FT_BitmapGlyph)self->glyph)->bitmap);
     }
 
-    return Py_Bitmap_cnew(
-        &((FT_BitmapGlyph)self->glyph)->bitmap);
+    FTPY_FACE_UNLOCK(face);
+
+    return result;
 }
 
 
@@ -47,6 +47,13 @@ PyObject *
 Py_Glyph_cnew(FT_GlyphSlot glyph, PyObject *owner, int load_flags);
 
 
+/* Creates a Glyph from a copy of an existing FT_Glyph, for glyphs
+   that did not come directly from a face's glyph slot. */
+PyObject *
+Py_Glyph_cnew_copy(
+    FT_GlyphSlot glyph_slot, FT_Glyph glyph, PyObject *owner, int load_flags);
+
+
 int setup_Glyph(PyObject *m);
 
 #endif
@@ -0,0 +1,368 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#include "glyph_cache.h"
+#include "doc/glyph_cache.h"
+
+#include "glyph.h"
+
+
+#define DEFAULT_MAX_BYTES (1 << 24)
+
+
+#define DEF_GLYPH_CACHE_GETTER(name) DEF_GETTER(name, doc_GlyphCache_ ## name)
+#define GLYPH_CACHE_METHOD(name) DEF_METHOD(name, GlyphCache)
+
+
+/****************************************************************************
+ Cache entries
+*/
+
+
+static size_t
+glyph_nbytes(FT_Glyph glyph)
+{
+    FT_Outline *outline;
+    FT_Bitmap *bitmap;
+
+    switch (glyph->format) {
+    case FT_GLYPH_FORMAT_OUTLINE:
+        outline = &((FT_OutlineGlyph)glyph)->outline;
+        return (sizeof(FT_OutlineGlyphRec) +
+                outline->n_points * (sizeof(FT_Vector) + sizeof(char)) +
+                outline->n_contours * sizeof(short));
+    case FT_GLYPH_FORMAT_BITMAP:
+        bitmap = &((FT_BitmapGlyph)glyph)->bitmap;
+        return (sizeof(FT_BitmapGlyphRec) +
+                (size_t)abs(bitmap->pitch) * bitmap->rows);
+    default:
+        return sizeof(FT_GlyphRec);
+    }
+}
+
+
+static void
+glyph_cache_entry_destroy(ftpy_LRU_Entry *base)
+{
+    ftpy_GlyphCache_Entry *entry = (ftpy_GlyphCache_Entry *)base;
+
+    /* The glyph must go before the face, since it may have been
+       allocated by the face's own FT_Library */
+    FT_Done_Glyph(entry->glyph);
+    Py_DECREF(entry->key.face);
+    free(entry);
+}
+
+
+void
+ftpy_GlyphCache_make_key(
+    ftpy_GlyphCache_Key *key, Py_Face *face, FT_UInt glyph_index,
+    FT_Int32 load_flags)
+{
+    memset(key, 0, sizeof(ftpy_GlyphCache_Key));
+    key->face = face;
+    if (face->x->size != NULL) {
+        key->x_ppem = face->x->size->metrics.x_ppem;
+        key->y_ppem = face->x->size->metrics.y_ppem;
+        key->x_scale = face->x->size->metrics.x_scale;
+        key->y_scale = face->x->size->metrics.y_scale;
+    }
+    key->transform = face->transform;
+    key->delta = face->delta;
+    key->load_flags = load_flags;
+    key->glyph_index = glyph_index;
+}
+
+
+ftpy_GlyphCache_Entry *
+ftpy_GlyphCache_get(
+    Py_GlyphCache *cache, Py_Face *face, FT_UInt glyph_index,
+    FT_Int32 load_flags)
+{
+    ftpy_GlyphCache_Key key;
+    ftpy_GlyphCache_Entry *entry;
+    FT_Glyph glyph;
+    FT_Error error;
+
+    ftpy_GlyphCache_make_key(&key, face, glyph_index, load_flags);
+
+    entry = (ftpy_GlyphCache_Entry *)ftpy_LRU_lookup(&cache->lru, &key);
+    if (entry != NULL) {
+        return entry;
+    }
+
+    FTPY_FACE_LOCK(face);
+
+    /* Another thread may have loaded the glyph while we were waiting
+       for the face */
+    entry = (ftpy_GlyphCache_Entry *)ftpy_LRU_find(&cache->lru, &key);
+    if (entry != NULL) {
+        goto exit;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    error = FT_Load_Glyph(face->x, glyph_index, load_flags);
+    if (!error) {
+        error = FT_Get_Glyph(face->x->glyph, &glyph);
+    }
+    Py_END_ALLOW_THREADS
+
+    if (ftpy_exc(error)) {
+        goto exit;
+    }
+
+    face->load_flags = load_flags;
+
+    entry = malloc(sizeof(ftpy_GlyphCache_Entry));
+    if (entry == NULL) {
+        FT_Done_Glyph(glyph);
+        PyErr_NoMemory();
+        goto exit;
+    }
+
+    entry->key = key;
+    memcpy(&entry->slot, face->x->glyph, sizeof(FT_GlyphSlotRec));
+    /* The subglyphs belong to the face's glyph slot, and will be
+       overwritten by the next load */
+    entry->slot.subglyphs = NULL;
+    entry->slot.num_subglyphs = 0;
+    entry->glyph = glyph;
+    entry->base.nbytes = sizeof(ftpy_GlyphCache_Entry) + glyph_nbytes(glyph);
+    Py_INCREF(face);
+
+    if (ftpy_LRU_insert(&cache->lru, &entry->base)) {
+        glyph_cache_entry_destroy(&entry->base);
+        entry = NULL;
+        PyErr_NoMemory();
+    }
+
+ exit:
+
+    FTPY_FACE_UNLOCK(face);
+
+    return entry;
+}
+
+
+/****************************************************************************
+ Object basics
+*/
+
+
+static void
+Py_GlyphCache_dealloc(Py_GlyphCache* self)
+{
+    ftpy_LRU_done(&self->lru);
+    Py_TYPE(self)->tp_clear((PyObject*)self);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+
+static PyObject *
+Py_GlyphCache_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    Py_GlyphCache *self;
+
+    self = (Py_GlyphCache *)ftpy_Object_new(type, args, kwds);
+    if (self == NULL) {
+        return NULL;
+    }
+    if (ftpy_LRU_init(
+            &self->lru, DEFAULT_MAX_BYTES,
+            offsetof(ftpy_GlyphCache_Entry, key), sizeof(ftpy_GlyphCache_Key),
+            glyph_cache_entry_destroy)) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+    return (PyObject *)self;
+}
+
+
+static int
+Py_GlyphCache_init(Py_GlyphCache *self, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"max_bytes", NULL};
+    Py_ssize_t max_bytes = DEFAULT_MAX_BYTES;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|n:GlyphCache.__init__", kwlist,
+                                     &max_bytes)) {
+        return -1;
+    }
+
+    if (max_bytes < 0) {
+        PyErr_SetString(PyExc_ValueError, "max_bytes must be non-negative");
+        return -1;
+    }
+
+    ftpy_LRU_set_max_bytes(&self->lru, (size_t)max_bytes);
+
+    return 0;
+}
+
+
+/****************************************************************************
+ Getters
+*/
+
+
+static PyObject *hits_get(Py_GlyphCache *self, PyObject *closure)
+{
+    return PyLong_FromUnsignedLongLong(self->lru.hits);
+}
+
+
+static PyObject *misses_get(Py_GlyphCache *self, PyObject *closure)
+{
+    return PyLong_FromUnsignedLongLong(self->lru.misses);
+}
+
+
+static PyObject *count_get(Py_GlyphCache *self, PyObject *closure)
+{
+    return PyLong_FromSize_t(self->lru.count);
+}
+
+
+static PyObject *nbytes_get(Py_GlyphCache *self, PyObject *closure)
+{
+    return PyLong_FromSize_t(self->lru.nbytes);
+}
+
+
+static PyObject *max_bytes_get(Py_GlyphCache *self, PyObject *closure)
+{
+    return PyLong_FromSize_t(self->lru.max_bytes);
+}
+
+
+static int max_bytes_set(Py_GlyphCache *self, PyObject *value, PyObject *closure)
+{
+    Py_ssize_t max_bytes;
+
+    if (value == NULL) {
+        PyErr_SetString(PyExc_AttributeError, "Can not delete max_bytes");
+        return -1;
+    }
+
+    max_bytes = PyNumber_AsSsize_t(value, PyExc_OverflowError);
+    if (max_bytes == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+
+    if (max_bytes < 0) {
+        PyErr_SetString(PyExc_ValueError, "max_bytes must be non-negative");
+        return -1;
+    }
+
+    ftpy_LRU_set_max_bytes(&self->lru, (size_t)max_bytes);
+
+    return 0;
+}
+
+
+static PyGetSetDef Py_GlyphCache_getset[] = {
+    DEF_GLYPH_CACHE_GETTER(hits),
+    DEF_GLYPH_CACHE_GETTER(misses),
+    DEF_GLYPH_CACHE_GETTER(count),
+    DEF_GLYPH_CACHE_GETTER(nbytes),
+    {"max_bytes", (getter)max_bytes_get, (setter)max_bytes_set,
+     doc_GlyphCache_max_bytes},
+    {NULL}
+};
+
+
+/****************************************************************************
+ Methods
+*/
+
+
+static PyObject*
+Py_GlyphCache_load_glyph(Py_GlyphCache* self, PyObject* args, PyObject* kwds) {
+    PyObject *face_obj;
+    unsigned int glyph_index;
+    int load_flags = 0;
+    ftpy_GlyphCache_Entry *entry;
+
+    const char* keywords[] = {"face", "glyph_index", "load_flags", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "O!I|i:load_glyph", (char **)keywords,
+            &Py_Face_Type, &face_obj, &glyph_index, &load_flags)) {
+        return NULL;
+    }
+
+    entry = ftpy_GlyphCache_get(self, (Py_Face *)face_obj, glyph_index, load_flags);
+    if (entry == NULL) {
+        return NULL;
+    }
+
+    return Py_Glyph_cnew_copy(&entry->slot, entry->glyph, face_obj, load_flags);
+}
+
+
+static PyObject*
+Py_GlyphCache_clear(Py_GlyphCache* self, PyObject* args, PyObject* kwds) {
+    ftpy_LRU_clear(&self->lru);
+    Py_RETURN_NONE;
+}
+
+
+static PyMethodDef Py_GlyphCache_methods[] = {
+    GLYPH_CACHE_METHOD(load_glyph),
+    DEF_METHOD_NOARGS(clear, GlyphCache),
+    {NULL}  /* Sentinel */
+};
+
+
+/****************************************************************************
+ Setup
+*/
+
+
+PyTypeObject Py_GlyphCache_Type;
+
+
+int setup_GlyphCache(PyObject *m)
+{
+    memset(&Py_GlyphCache_Type, 0, sizeof(PyTypeObject));
+    Py_GlyphCache_Type = (PyTypeObject) {
+        .tp_name = "freetypy.GlyphCache",
+        .tp_basicsize = sizeof(Py_GlyphCache),
+        .tp_dealloc = (destructor)Py_GlyphCache_dealloc,
+        .tp_doc = doc_GlyphCache__init__,
+        .tp_methods = Py_GlyphCache_methods,
+        .tp_getset = Py_GlyphCache_getset,
+        .tp_init = (initproc)Py_GlyphCache_init,
+        .tp_new = Py_GlyphCache_new
+    };
+
+    ftpy_setup_type(m, &Py_GlyphCache_Type);
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#ifndef __GLYPH_CACHE_H__
+#define __GLYPH_CACHE_H__
+
+#include "freetypy.h"
+#include "face.h"
+#include "lru.h"
+
+#include FT_GLYPH_H
+
+
+typedef struct {
+    Py_Face *face;
+    FT_UShort x_ppem;
+    FT_UShort y_ppem;
+    FT_Fixed x_scale;
+    FT_Fixed y_scale;
+    FT_Matrix transform;
+    FT_Vector delta;
+    FT_Int32 load_flags;
+    FT_UInt glyph_index;
+} ftpy_GlyphCache_Key;
+
+
+typedef struct {
+    ftpy_LRU_Entry base;
+    ftpy_GlyphCache_Key key;
+    FT_GlyphSlotRec slot;
+    FT_Glyph glyph;
+} ftpy_GlyphCache_Entry;
+
+
+typedef struct {
+    ftpy_Object base;
+    ftpy_LRU lru;
+} Py_GlyphCache;
+
+
+/* Fills in a cache key for the given glyph, using the face's current
+   size and transform. */
+void ftpy_GlyphCache_make_key(
+    ftpy_GlyphCache_Key *key, Py_Face *face, FT_UInt glyph_index,
+    FT_Int32 load_flags);
+
+
+/* Returns the cached entry for the given glyph, loading it into the
+   cache if necessary.  Must be called with the GIL held, and without
+   holding the face lock.  The entry is only valid until the next call
+   into the cache. */
+ftpy_GlyphCache_Entry *ftpy_GlyphCache_get(
+    Py_GlyphCache *cache, Py_Face *face, FT_UInt glyph_index,
+    FT_Int32 load_flags);
+
+
+int setup_GlyphCache(PyObject *m);
+
+
+extern PyTypeObject Py_GlyphCache_Type;
+
+
+#endif
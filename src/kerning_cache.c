@@ -0,0 +1,294 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "kerning_cache.h"
+
+
+/* Each table for printable ASCII is around 75k */
+#define KERNING_TABLES_MAX_BYTES (1 << 20)
+#define KERNING_PAIRS_MAX_BYTES (1 << 18)
+
+#define TABLE_FIRST_CHAR 0x20
+#define TABLE_LAST_CHAR 0x7e
+
+
+typedef struct {
+    ftpy_LRU_Entry base;
+    ftpy_Kerning_Cache_Key key;
+    FT_Vector kerning;
+} ftpy_Kerning_Pair;
+
+
+static void
+kerning_cache_entry_destroy(ftpy_LRU_Entry *entry)
+{
+    free(entry);
+}
+
+
+int
+ftpy_kerning_cache_init(ftpy_Kerning_Cache *cache)
+{
+    if (ftpy_LRU_init(
+            &cache->tables, KERNING_TABLES_MAX_BYTES,
+            offsetof(ftpy_Kerning_Table, key), sizeof(ftpy_Kerning_Cache_Key),
+            kerning_cache_entry_destroy)) {
+        return -1;
+    }
+
+    if (ftpy_LRU_init(
+            &cache->pairs, KERNING_PAIRS_MAX_BYTES,
+            offsetof(ftpy_Kerning_Pair, key), sizeof(ftpy_Kerning_Cache_Key),
+            kerning_cache_entry_destroy)) {
+        ftpy_LRU_done(&cache->tables);
+        return -1;
+    }
+
+    return 0;
+}
+
+
+void
+ftpy_kerning_cache_done(ftpy_Kerning_Cache *cache)
+{
+    ftpy_LRU_done(&cache->tables);
+    ftpy_LRU_done(&cache->pairs);
+}
+
+
+static void
+make_key(
+    ftpy_Kerning_Cache_Key *key, FT_Face face, FT_UInt kern_mode,
+    FT_UInt left_glyph, FT_UInt right_glyph)
+{
+    memset(key, 0, sizeof(ftpy_Kerning_Cache_Key));
+    if (face->size != NULL) {
+        key->x_ppem = face->size->metrics.x_ppem;
+        key->y_ppem = face->size->metrics.y_ppem;
+        key->x_scale = face->size->metrics.x_scale;
+        key->y_scale = face->size->metrics.y_scale;
+    }
+    key->kern_mode = kern_mode;
+    key->left_glyph = left_glyph;
+    key->right_glyph = right_glyph;
+}
+
+
+static size_t
+table_hash(FT_UInt glyph_index)
+{
+    return ((glyph_index * 2654435761u) >> 16) & (FTPY_KERNING_TABLE_HASH_SIZE - 1);
+}
+
+
+/* Returns the row of the given glyph in the table, or -1 if it isn't
+   in it */
+static int
+table_find_row(const ftpy_Kerning_Table *table, FT_UInt glyph_index)
+{
+    size_t i;
+
+    if (glyph_index == 0) {
+        return -1;
+    }
+
+    for (i = table_hash(glyph_index);
+         table->glyphs[i] != 0;
+         i = (i + 1) & (FTPY_KERNING_TABLE_HASH_SIZE - 1)) {
+        if (table->glyphs[i] == glyph_index) {
+            return table->rows[i];
+        }
+    }
+
+    return -1;
+}
+
+
+static FT_Error
+build_table(
+    FT_Face face, ftpy_Kerning_Cache_Key *key, ftpy_Kerning_Table **table)
+{
+    FT_UInt glyphs[TABLE_LAST_CHAR - TABLE_FIRST_CHAR + 1];
+    FT_UInt size = 0;
+    FT_UInt glyph_index;
+    FT_ULong charcode;
+    FT_UInt i, j;
+    size_t k;
+    size_t nbytes;
+    ftpy_Kerning_Table *result;
+    FT_Vector delta;
+    FT_Error error;
+
+    if (FT_HAS_KERNING(face)) {
+        for (charcode = TABLE_FIRST_CHAR; charcode <= TABLE_LAST_CHAR; ++charcode) {
+            glyph_index = FT_Get_Char_Index(face, charcode);
+            if (glyph_index == 0) {
+                continue;
+            }
+            for (i = 0; i < size; ++i) {
+                if (glyphs[i] == glyph_index) {
+                    break;
+                }
+            }
+            if (i == size) {
+                glyphs[size++] = glyph_index;
+            }
+        }
+    }
+
+    nbytes = offsetof(ftpy_Kerning_Table, kerning) +
+        sizeof(FT_Int32) * 2 * (size_t)(size > 0 ? size * size : 1);
+    result = calloc(1, nbytes);
+    if (result == NULL) {
+        return FT_Err_Out_Of_Memory;
+    }
+
+    result->key = *key;
+    result->size = size;
+
+    for (i = 0; i < size; ++i) {
+        for (k = table_hash(glyphs[i]);
+             result->glyphs[k] != 0;
+             k = (k + 1) & (FTPY_KERNING_TABLE_HASH_SIZE - 1))
+            ;
+        result->glyphs[k] = glyphs[i];
+        result->rows[k] = (unsigned char)i;
+    }
+
+    for (i = 0; i < size; ++i) {
+        for (j = 0; j < size; ++j) {
+            error = FT_Get_Kerning(
+                face, glyphs[i], glyphs[j], key->kern_mode, &delta);
+            if (error) {
+                free(result);
+                return error;
+            }
+            result->kerning[(i * size + j) * 2] = (FT_Int32)delta.x;
+            result->kerning[(i * size + j) * 2 + 1] = (FT_Int32)delta.y;
+        }
+    }
+
+    result->base.nbytes = nbytes;
+    *table = result;
+    return 0;
+}
+
+
+FT_Error
+ftpy_kerning_cache_get_table(
+    ftpy_Kerning_Cache *cache, FT_Face face, FT_UInt kern_mode,
+    ftpy_Kerning_Table **table)
+{
+    ftpy_Kerning_Cache_Key key;
+    ftpy_Kerning_Table *result;
+    FT_Error error;
+
+    make_key(&key, face, kern_mode, 0, 0);
+
+    result = (ftpy_Kerning_Table *)ftpy_LRU_lookup(&cache->tables, &key);
+    if (result == NULL) {
+        error = build_table(face, &key, &result);
+        if (error) {
+            return error;
+        }
+
+        if (ftpy_LRU_insert(&cache->tables, &result->base)) {
+            free(result);
+            return FT_Err_Out_Of_Memory;
+        }
+    }
+
+    *table = result;
+    return 0;
+}
+
+
+FT_Error
+ftpy_kerning_cache_get(
+    ftpy_Kerning_Cache *cache, FT_Face face, ftpy_Kerning_Table *table,
+    FT_UInt left_glyph, FT_UInt right_glyph, FT_Vector *kerning)
+{
+    ftpy_Kerning_Cache_Key key;
+    ftpy_Kerning_Pair *pair;
+    int left_row, right_row;
+    const FT_Int32 *value;
+    FT_Error error;
+
+    if (!FT_HAS_KERNING(face)) {
+        kerning->x = kerning->y = 0;
+        return 0;
+    }
+
+    left_row = table_find_row(table, left_glyph);
+    if (left_row >= 0) {
+        right_row = table_find_row(table, right_glyph);
+        if (right_row >= 0) {
+            value = &table->kerning[
+                ((size_t)left_row * table->size + (size_t)right_row) * 2];
+            kerning->x = value[0];
+            kerning->y = value[1];
+            return 0;
+        }
+    }
+
+    key = table->key;
+    key.left_glyph = left_glyph;
+    key.right_glyph = right_glyph;
+
+    pair = (ftpy_Kerning_Pair *)ftpy_LRU_lookup(&cache->pairs, &key);
+    if (pair != NULL) {
+        *kerning = pair->kerning;
+        return 0;
+    }
+
+    error = FT_Get_Kerning(
+        face, left_glyph, right_glyph, key.kern_mode, kerning);
+    if (error) {
+        return error;
+    }
+
+    pair = malloc(sizeof(ftpy_Kerning_Pair));
+    if (pair == NULL) {
+        return FT_Err_Out_Of_Memory;
+    }
+
+    pair->key = key;
+    pair->kerning = *kerning;
+    pair->base.nbytes = sizeof(ftpy_Kerning_Pair);
+
+    if (ftpy_LRU_insert(&cache->pairs, &pair->base)) {
+        free(pair);
+        return FT_Err_Out_Of_Memory;
+    }
+
+    return 0;
+}
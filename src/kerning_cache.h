@@ -0,0 +1,107 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#ifndef __KERNING_CACHE_H__
+#define __KERNING_CACHE_H__
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include "lru.h"
+
+
+/*
+   A cache of kerning pairs, so that layouts don't need to search the
+   font's kerning table for every pair of glyphs.  Each Face has one,
+   which is protected by the face lock, so it may be used without the
+   GIL.
+
+   For each size and kerning mode, the kerning between every pair of
+   glyphs for printable ASCII is computed up front into a dense table.
+   The kerning of any other pair is looked up lazily and kept in a
+   bounded hash table.
+*/
+
+
+#define FTPY_KERNING_TABLE_HASH_SIZE 256
+
+
+typedef struct {
+    FT_UShort x_ppem;
+    FT_UShort y_ppem;
+    FT_Fixed x_scale;
+    FT_Fixed y_scale;
+    FT_UInt kern_mode;
+    FT_UInt left_glyph;
+    FT_UInt right_glyph;
+} ftpy_Kerning_Cache_Key;
+
+
+typedef struct {
+    ftpy_LRU_Entry base;
+    /* left_glyph and right_glyph are always 0 */
+    ftpy_Kerning_Cache_Key key;
+    /* An open-addressed hash from glyph index to row in the table.
+       Empty slots have a glyph index of 0. */
+    FT_UInt glyphs[FTPY_KERNING_TABLE_HASH_SIZE];
+    unsigned char rows[FTPY_KERNING_TABLE_HASH_SIZE];
+    FT_UInt size;
+    /* size * size (x, y) pairs, in the units of FT_Get_Kerning */
+    FT_Int32 kerning[1];
+} ftpy_Kerning_Table;
+
+
+typedef struct {
+    ftpy_LRU tables;
+    ftpy_LRU pairs;
+} ftpy_Kerning_Cache;
+
+
+int ftpy_kerning_cache_init(ftpy_Kerning_Cache *cache);
+
+
+void ftpy_kerning_cache_done(ftpy_Kerning_Cache *cache);
+
+
+/* Gets the dense table for the face's current size, building it if
+   it isn't already in the cache.  The table remains valid until the
+   next call to this function. */
+FT_Error ftpy_kerning_cache_get_table(
+    ftpy_Kerning_Cache *cache, FT_Face face, FT_UInt kern_mode,
+    ftpy_Kerning_Table **table);
+
+
+/* Gets the kerning between two glyphs, using a table from
+   ftpy_kerning_cache_get_table. */
+FT_Error ftpy_kerning_cache_get(
+    ftpy_Kerning_Cache *cache, FT_Face face, ftpy_Kerning_Table *table,
+    FT_UInt left_glyph, FT_UInt right_glyph, FT_Vector *kerning);
+
+
+#endif
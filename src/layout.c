@@ -30,11 +30,22 @@ either expressed or implied, of the FreeBSD Project.
 #include "layout.h"
 #include "doc/layout.h"
 
+#include "array.h"
 #include "bbox.h"
 #include "face.h"
+#include "outline.h"
+#include "outline_cache.h"
 
 
 #define DEF_LAYOUT_GETTER(name) DEF_GETTER(name, doc_Layout_ ## name)
+#define LAYOUT_METHOD(name) DEF_METHOD(name, Layout)
+#define LAYOUT_METHOD_NOARGS(name) DEF_METHOD_NOARGS(name, Layout)
+
+
+static PyTypeObject Py_Layout_Glyph_Indices_Buffer_Type;
+static PyTypeObject Py_Layout_Xys_Buffer_Type;
+static PyObject *Py_Layout_Glyph_Indices_Buffer_cnew(PyObject *owner);
+static PyObject *Py_Layout_Xys_Buffer_cnew(PyObject *owner);
 
 
 
@@ -48,6 +59,10 @@ Py_Layout_dealloc(Py_Layout* self)
 {
     free(self->x.glyph_indices);
     free(self->x.xys);
+    free(self->text);
+    if (self->lock) {
+        PyThread_free_lock(self->lock);
+    }
     Py_TYPE(self)->tp_clear((PyObject*)self);
     Py_TYPE(self)->tp_free((PyObject*)self);
 }
@@ -65,6 +80,18 @@ Py_Layout_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     self->base.owner = NULL;
     self->x.xys = NULL;
     self->x.glyph_indices = NULL;
+    self->x.size = 0;
+    self->load_flags = 0;
+    self->text = NULL;
+    self->capacity = 0;
+    self->ink_bbox_stale = 0;
+    self->exports = 0;
+    self->lock = PyThread_allocate_lock();
+    if (self->lock == NULL) {
+        Py_DECREF(self);
+        PyErr_SetString(PyExc_MemoryError, "Unable to allocate lock");
+        return NULL;
+    }
     return (PyObject *)self;
 }
 
@@ -77,10 +104,13 @@ Py_Layout_init(Py_Layout *self, PyObject *args, PyObject *kwds)
     Py_Face *face = NULL;
     PyObject *text_obj;
     int load_flags = FT_LOAD_DEFAULT;
-    PyObject *text = NULL;
     PyObject *decoded_text = NULL;
-    char *decoded_text_buf;
-    Py_ssize_t decoded_text_size;
+    uint32_t *text;
+    Py_ssize_t text_size;
+    uint32_t *new_text = NULL;
+    ftpy_Layout layout;
+    PyObject *old_owner = NULL;
+    FT_Error error;
     int result = -1;
 
     if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!O|i:Layout.__init__", kwlist,
@@ -99,37 +129,65 @@ Py_Layout_init(Py_Layout *self, PyObject *args, PyObject *kwds)
         goto exit;
     }
 
-    text = PyUnicode_FromObject(text_obj);
-    if (text == NULL) {
+    decoded_text = ftpy_PyUnicode_AsUTF32(text_obj, &text, &text_size);
+    if (decoded_text == NULL) {
         goto exit;
     }
 
-    decoded_text = PyUnicode_AsUTF32String(text);
-    if (decoded_text == NULL) {
+    new_text = malloc(sizeof(uint32_t) * (text_size ? text_size : 1));
+    if (new_text == NULL) {
+        PyErr_NoMemory();
         goto exit;
     }
+    memcpy(new_text, text, sizeof(uint32_t) * text_size);
+
+    FTPY_LAYOUT_LOCK(self);
 
-    if (PyBytes_AsStringAndSize(decoded_text, &decoded_text_buf, &decoded_text_size)) {
+    if (self->exports) {
+        FTPY_LAYOUT_UNLOCK(self);
+        PyErr_SetString(
+            PyExc_BufferError, "Layout can not be changed while it is being viewed");
         goto exit;
     }
 
-    decoded_text_buf += 4;
-    decoded_text_size = (decoded_text_size - 4) >> 2;
+    /* The new layout is built on the side, so that the old one is
+       kept if this fails */
+    FTPY_FACE_LOCK(face);
+    Py_BEGIN_ALLOW_THREADS
+    error = ftpy_calculate_simple_layout(
+        face->x, &face->metrics_cache, &face->kerning_cache, load_flags,
+        new_text, text_size, &layout);
+    Py_END_ALLOW_THREADS
+    FTPY_FACE_UNLOCK(face);
+
+    if (!error) {
+        free(self->x.glyph_indices);
+        free(self->x.xys);
+        free(self->text);
+        self->x = layout;
+        self->text = new_text;
+        new_text = NULL;
+        self->capacity = text_size;
+        self->ink_bbox_stale = 0;
+
+        Py_INCREF(face_obj);
+        old_owner = self->base.owner;
+        self->base.owner = face_obj;
+        self->load_flags = load_flags;
+    }
+
+    FTPY_LAYOUT_UNLOCK(self);
 
-    if (ftpy_exc(ftpy_calculate_simple_layout(
-        face->x, load_flags,
-        (uint32_t *)decoded_text_buf, decoded_text_size, &self->x))) {
+    if (ftpy_exc(error)) {
         goto exit;
     }
 
-    Py_INCREF(face_obj);
-    self->base.owner = face_obj;
-
     result = 0;
 
  exit:
 
-    Py_XDECREF(text);
+    free(new_text);
+    Py_XDECREF(old_owner);
     Py_XDECREF(decoded_text);
 
     return result;
@@ -141,60 +199,736 @@ Py_Layout_init(Py_Layout *self, PyObject *args, PyObject *kwds)
 */
 
 
+static PyObject *glyph_indices_get(Py_Layout *self, PyObject *closure)
+{
+    return Py_Layout_Glyph_Indices_Buffer_cnew((PyObject *)self);
+}
+
 static PyObject *ink_bbox_get(Py_Layout *self, PyObject *closure)
 {
-    return Py_BBox_cnew(&self->x.ink_bbox, 1.0 / (double)(1 << 6));
+    Py_Face *face = (Py_Face *)self->base.owner;
+    FT_BBox ink_bbox;
+    FT_Error error = 0;
+
+    FTPY_LAYOUT_LOCK(self);
+
+    if (self->ink_bbox_stale) {
+        FTPY_FACE_LOCK(face);
+        Py_BEGIN_ALLOW_THREADS
+        error = ftpy_simple_layout_ink_bbox(
+            face->x, &face->metrics_cache, self->load_flags, &self->x);
+        Py_END_ALLOW_THREADS
+        FTPY_FACE_UNLOCK(face);
+
+        if (!error) {
+            self->ink_bbox_stale = 0;
+        }
+    }
+
+    ink_bbox = self->x.ink_bbox;
+
+    FTPY_LAYOUT_UNLOCK(self);
+
+    if (ftpy_exc(error)) {
+        return NULL;
+    }
+
+    return Py_BBox_cnew(&ink_bbox, 1.0 / (double)(1 << 6));
 }
 
 static PyObject *layout_bbox_get(Py_Layout *self, PyObject *closure)
 {
-    return Py_BBox_cnew(&self->x.layout_bbox, 1.0 / (double)(1 << 6));
+    FT_BBox layout_bbox;
+
+    FTPY_LAYOUT_LOCK(self);
+    layout_bbox = self->x.layout_bbox;
+    FTPY_LAYOUT_UNLOCK(self);
+
+    return Py_BBox_cnew(&layout_bbox, 1.0 / (double)(1 << 6));
 }
 
 static PyObject *layout_get(Py_Layout *self, PyObject *closure)
 {
-    PyObject *result;
+    PyObject *result = NULL;
     PyObject *subresult;
-    ftpy_Layout *layout;
+    PyObject *owner;
+    FT_ULong *glyph_indices;
+    ftpy_Layout_Vector *xys;
+    size_t size;
     size_t i;
 
-    layout = &self->x;
+    /* Copied, so that no Python code runs with the lock held */
+    FTPY_LAYOUT_LOCK(self);
+    owner = self->base.owner;
+    Py_XINCREF(owner);
+    size = self->x.size;
+    glyph_indices = malloc(sizeof(FT_ULong) * (size ? size : 1));
+    xys = malloc(sizeof(ftpy_Layout_Vector) * (size ? size : 1));
+    if (glyph_indices != NULL && xys != NULL) {
+        memcpy(glyph_indices, self->x.glyph_indices, sizeof(FT_ULong) * size);
+        memcpy(xys, self->x.xys, sizeof(ftpy_Layout_Vector) * size);
+    }
+    FTPY_LAYOUT_UNLOCK(self);
 
-    result = PyList_New(layout->size);
+    if (glyph_indices == NULL || xys == NULL) {
+        PyErr_NoMemory();
+        goto exit;
+    }
 
+    result = PyList_New(size);
     if (result == NULL) {
-        return NULL;
+        goto exit;
     }
 
-    for (i = 0; i < layout->size; ++i) {
+    for (i = 0; i < size; ++i) {
         subresult = Py_BuildValue(
                 "(Ok(dd))",
-                self->base.owner,
-                layout->glyph_indices[i],
-                layout->xys[i].x,
-                layout->xys[i].y);
+                owner,
+                glyph_indices[i],
+                xys[i].x,
+                xys[i].y);
         if (subresult == NULL) {
             Py_DECREF(result);
-            return NULL;
+            result = NULL;
+            goto exit;
         }
         if (PyList_SetItem(result, i, subresult)) {
             Py_DECREF(subresult);
             Py_DECREF(result);
-            return NULL;
+            result = NULL;
+            goto exit;
         }
     }
 
+ exit:
+
+    Py_XDECREF(owner);
+    free(glyph_indices);
+    free(xys);
+
+    return result;
+}
+
+static PyObject *text_get(Py_Layout *self, PyObject *closure)
+{
+    PyObject *result;
+    uint32_t *text;
+    size_t size;
+
+    FTPY_LAYOUT_LOCK(self);
+    size = self->x.size;
+    text = malloc(sizeof(uint32_t) * (size ? size : 1));
+    if (text != NULL) {
+        memcpy(text, self->text, sizeof(uint32_t) * size);
+    }
+    FTPY_LAYOUT_UNLOCK(self);
+
+    if (text == NULL) {
+        return PyErr_NoMemory();
+    }
+
+    result = ftpy_PyUnicode_FromUTF32(text, size);
+    free(text);
+
     return result;
 }
 
+static PyObject *xys_get(Py_Layout *self, PyObject *closure)
+{
+    return Py_Layout_Xys_Buffer_cnew((PyObject *)self);
+}
+
 static PyGetSetDef Py_Layout_getset[] = {
+    DEF_LAYOUT_GETTER(glyph_indices),
     DEF_LAYOUT_GETTER(ink_bbox),
     DEF_LAYOUT_GETTER(layout_bbox),
     DEF_LAYOUT_GETTER(layout),
+    DEF_LAYOUT_GETTER(text),
+    DEF_LAYOUT_GETTER(xys),
     {NULL}
 };
 
 
+/****************************************************************************
+ Path export
+*/
+
+
+/* Decomposes the outline of every glyph of the layout into one path,
+   with each glyph moved to its position in the layout.  Doesn't touch
+   any Python objects, so it may be called without the GIL. */
+static FT_Error
+layout_to_path(
+    FT_Face face, FT_Matrix *transform, FT_Vector *delta,
+    ftpy_LRU *outline_cache, FT_Int32 load_flags,
+    const ftpy_Layout *layout, ftpy_Path *path)
+{
+    ftpy_Outline_Cache_Entry *entry;
+    size_t i;
+    FT_Error error;
+
+    for (i = 0; i < layout->size; ++i) {
+        error = ftpy_outline_cache_get(
+            outline_cache, face, transform, delta, load_flags,
+            layout->glyph_indices[i], &entry);
+        if (error) {
+            return error;
+        }
+
+        if (entry->outline.n_points == 0) {
+            continue;
+        }
+
+        error = ftpy_outline_to_path(
+            &entry->outline, layout->xys[i].x, layout->xys[i].y, path);
+        if (error) {
+            return error;
+        }
+    }
+
+    return 0;
+}
+
+
+/****************************************************************************
+ Methods
+*/
+
+
+int
+ftpy_Layout_get_image(
+    PyObject *buffer_obj, int render_mode, Py_buffer *view, ftpy_Image *image)
+{
+    if (render_mode == FT_RENDER_MODE_LCD ||
+        render_mode == FT_RENDER_MODE_LCD_V) {
+        PyErr_SetString(
+            PyExc_ValueError, "LCD render modes are not supported by draw");
+        return -1;
+    }
+
+    if (PyObject_GetBuffer(buffer_obj, view, PyBUF_RECORDS)) {
+        return -1;
+    }
+
+    if (view->ndim != 2 || view->itemsize != 1 ||
+        (view->format != NULL && strcmp(view->format, "B") != 0)) {
+        PyErr_SetString(
+            PyExc_ValueError, "buffer must be a 2-dimensional array of uint8");
+        PyBuffer_Release(view);
+        return -1;
+    }
+
+    image->buffer = view->buf;
+    image->height = view->shape[0];
+    image->width = view->shape[1];
+    image->row_stride = view->strides[0];
+    image->col_stride = view->strides[1];
+
+    return 0;
+}
+
+
+static PyObject*
+Py_Layout_draw(Py_Layout* self, PyObject* args, PyObject* kwds) {
+    PyObject *buffer_obj;
+    double x = 0.0;
+    double y = 0.0;
+    int render_mode = FT_RENDER_MODE_NORMAL;
+    Py_Face *face;
+    Py_buffer view;
+    ftpy_Image image;
+    FT_Error error;
+
+    const char* keywords[] = {"buffer", "x", "y", "render_mode", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "O|ddi:draw", (char **)keywords,
+            &buffer_obj, &x, &y, &render_mode)) {
+        return NULL;
+    }
+
+    if (ftpy_Layout_get_image(buffer_obj, render_mode, &view, &image)) {
+        return NULL;
+    }
+
+    FTPY_LAYOUT_LOCK(self);
+
+    face = (Py_Face *)self->base.owner;
+    if (face == NULL) {
+        FTPY_LAYOUT_UNLOCK(self);
+        PyBuffer_Release(&view);
+        PyErr_SetString(PyExc_RuntimeError, "Layout is not initialized");
+        return NULL;
+    }
+
+    FTPY_FACE_LOCK(face);
+    Py_BEGIN_ALLOW_THREADS
+    error = ftpy_draw_layout(
+        face->x, self->load_flags, render_mode, &self->x, x, y, &image);
+    Py_END_ALLOW_THREADS
+    FTPY_FACE_UNLOCK(face);
+
+    FTPY_LAYOUT_UNLOCK(self);
+
+    PyBuffer_Release(&view);
+
+    if (ftpy_exc(error)) {
+        return NULL;
+    }
+
+    Py_RETURN_NONE;
+}
+
+
+static PyObject*
+Py_Layout_get_transformed(Py_Layout* self, PyObject* args, PyObject* kwds)
+{
+    double xx, xy, yx, yy;
+    ftpy_Layout_Vector offset = {0.0, 0.0};
+    Py_Face *face;
+    FT_Matrix matrix;
+    FT_BBox ink_bbox;
+    ftpy_Layout_Vector *xys_data;
+    size_t size;
+    PyObject *xys;
+    PyObject *bbox;
+    FT_Error error;
+
+    const char* keywords[] = {"matrix", "offset", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "((dd)(dd))|(dd):get_transformed", (char **)keywords,
+            &xx, &xy, &yx, &yy, &offset.x, &offset.y)) {
+        return NULL;
+    }
+
+    matrix.xx = TO_FT_FIXED(xx);
+    matrix.xy = TO_FT_FIXED(xy);
+    matrix.yx = TO_FT_FIXED(yx);
+    matrix.yy = TO_FT_FIXED(yy);
+
+    FTPY_LAYOUT_LOCK(self);
+
+    face = (Py_Face *)self->base.owner;
+    if (face == NULL) {
+        FTPY_LAYOUT_UNLOCK(self);
+        PyErr_SetString(PyExc_RuntimeError, "Layout is not initialized");
+        return NULL;
+    }
+
+    size = self->x.size;
+    xys_data = malloc(sizeof(ftpy_Layout_Vector) * (size ? size : 1));
+    if (xys_data == NULL) {
+        FTPY_LAYOUT_UNLOCK(self);
+        return PyErr_NoMemory();
+    }
+
+    FTPY_FACE_LOCK(face);
+    Py_BEGIN_ALLOW_THREADS
+    error = ftpy_transform_simple_layout(
+        face->x, &face->transform, &face->delta, &face->outline_cache,
+        self->load_flags, &self->x, &matrix, &offset, xys_data, &ink_bbox);
+    Py_END_ALLOW_THREADS
+    FTPY_FACE_UNLOCK(face);
+
+    FTPY_LAYOUT_UNLOCK(self);
+
+    if (ftpy_exc(error)) {
+        free(xys_data);
+        return NULL;
+    }
+
+    xys = ftpy_Array_cnew_from_data(xys_data, "d", sizeof(double), 2, size, 2);
+    if (xys == NULL) {
+        return NULL;
+    }
+
+    bbox = Py_BBox_cnew(&ink_bbox, 1.0 / (double)(1 << 6));
+    if (bbox == NULL) {
+        Py_DECREF(xys);
+        return NULL;
+    }
+
+    return Py_BuildValue("(NN)", xys, bbox);
+}
+
+
+/* Replaces self->text[start:end] with text_obj and updates the layout
+   to match.  If laying out the new text fails, the layout is left as
+   it was. */
+static PyObject*
+splice(Py_Layout *self, Py_ssize_t start, Py_ssize_t end, PyObject *text_obj)
+{
+    Py_Face *face;
+    PyObject *decoded_text = NULL;
+    uint32_t *text = NULL;
+    Py_ssize_t text_size = 0;
+    uint32_t *removed_text = NULL;
+    size_t old_size;
+    size_t size;
+    size_t capacity;
+    uint32_t *new_text;
+    FT_ULong *new_glyph_indices;
+    ftpy_Layout_Vector *new_xys;
+    FT_Error error;
+
+    if (text_obj != NULL) {
+        decoded_text = ftpy_PyUnicode_AsUTF32(text_obj, &text, &text_size);
+        if (decoded_text == NULL) {
+            return NULL;
+        }
+    }
+
+    /* Everything else reading the layout's arrays holds this lock, so
+       they may be moved */
+    FTPY_LAYOUT_LOCK(self);
+
+    face = (Py_Face *)self->base.owner;
+    if (face == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "Layout is not initialized");
+        goto fail;
+    }
+
+    if (self->exports) {
+        PyErr_SetString(
+            PyExc_BufferError, "Layout can not be changed while it is being viewed");
+        goto fail;
+    }
+
+    old_size = self->x.size;
+    if (start < 0 || end < start || (size_t)end > old_size) {
+        PyErr_SetString(PyExc_IndexError, "Text range out of range");
+        goto fail;
+    }
+
+    size = old_size - (end - start) + text_size;
+    if (size > self->capacity) {
+        capacity = self->capacity * 2;
+        if (capacity < size) {
+            capacity = size;
+        }
+
+        /* Arrays that are grown are still valid if another fails */
+        new_text = realloc(self->text, sizeof(uint32_t) * capacity);
+        if (new_text != NULL) {
+            self->text = new_text;
+        }
+        new_glyph_indices = realloc(
+            self->x.glyph_indices, sizeof(FT_ULong) * capacity);
+        if (new_glyph_indices != NULL) {
+            self->x.glyph_indices = new_glyph_indices;
+        }
+        new_xys = realloc(self->x.xys, sizeof(ftpy_Layout_Vector) * capacity);
+        if (new_xys != NULL) {
+            self->x.xys = new_xys;
+        }
+        if (new_text == NULL || new_glyph_indices == NULL || new_xys == NULL) {
+            PyErr_NoMemory();
+            goto fail;
+        }
+
+        self->capacity = capacity;
+    }
+
+    /* Kept, so the text can be put back if the layout fails */
+    removed_text = malloc(sizeof(uint32_t) * (end > start ? end - start : 1));
+    if (removed_text == NULL) {
+        PyErr_NoMemory();
+        goto fail;
+    }
+    memcpy(removed_text, self->text + start, sizeof(uint32_t) * (end - start));
+
+    memmove(self->text + start + text_size, self->text + end,
+            sizeof(uint32_t) * (old_size - end));
+    if (text_size) {
+        memcpy(self->text + start, text, sizeof(uint32_t) * text_size);
+    }
+
+    FTPY_FACE_LOCK(face);
+    Py_BEGIN_ALLOW_THREADS
+    error = ftpy_splice_simple_layout(
+        face->x, &face->metrics_cache, &face->kerning_cache, self->load_flags,
+        self->text, start, end, text_size, &self->x);
+    Py_END_ALLOW_THREADS
+    FTPY_FACE_UNLOCK(face);
+
+    if (error) {
+        memmove(self->text + end, self->text + start + text_size,
+                sizeof(uint32_t) * (old_size - end));
+        memcpy(self->text + start, removed_text, sizeof(uint32_t) * (end - start));
+    } else {
+        self->ink_bbox_stale = 1;
+    }
+
+    FTPY_LAYOUT_UNLOCK(self);
+
+    free(removed_text);
+    Py_XDECREF(decoded_text);
+
+    if (ftpy_exc(error)) {
+        return NULL;
+    }
+
+    Py_RETURN_NONE;
+
+ fail:
+
+    FTPY_LAYOUT_UNLOCK(self);
+
+    Py_XDECREF(decoded_text);
+
+    return NULL;
+}
+
+
+static PyObject*
+Py_Layout_delete(Py_Layout* self, PyObject* args, PyObject* kwds)
+{
+    Py_ssize_t start;
+    Py_ssize_t end;
+
+    const char* keywords[] = {"start", "end", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "nn:delete", (char **)keywords,
+            &start, &end)) {
+        return NULL;
+    }
+
+    return splice(self, start, end, NULL);
+}
+
+
+static PyObject*
+Py_Layout_insert(Py_Layout* self, PyObject* args, PyObject* kwds)
+{
+    Py_ssize_t index;
+    PyObject *text_obj;
+
+    const char* keywords[] = {"index", "text", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "nO:insert", (char **)keywords,
+            &index, &text_obj)) {
+        return NULL;
+    }
+
+    return splice(self, index, index, text_obj);
+}
+
+
+static PyObject*
+Py_Layout_replace(Py_Layout* self, PyObject* args, PyObject* kwds)
+{
+    Py_ssize_t start;
+    Py_ssize_t end;
+    PyObject *text_obj;
+
+    const char* keywords[] = {"start", "end", "text", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "nnO:replace", (char **)keywords,
+            &start, &end, &text_obj)) {
+        return NULL;
+    }
+
+    return splice(self, start, end, text_obj);
+}
+
+
+static PyObject*
+Py_Layout_to_points_and_codes(Py_Layout* self, PyObject* args, PyObject* kwds)
+{
+    Py_Face *face;
+    ftpy_Path path;
+    PyObject *points;
+    PyObject *codes;
+    FT_Error error;
+
+    FTPY_LAYOUT_LOCK(self);
+
+    face = (Py_Face *)self->base.owner;
+    if (face == NULL) {
+        FTPY_LAYOUT_UNLOCK(self);
+        PyErr_SetString(PyExc_RuntimeError, "Layout is not initialized");
+        return NULL;
+    }
+
+    memset(&path, 0, sizeof(ftpy_Path));
+
+    FTPY_FACE_LOCK(face);
+    Py_BEGIN_ALLOW_THREADS
+    error = layout_to_path(
+        face->x, &face->transform, &face->delta, &face->outline_cache,
+        self->load_flags, &self->x, &path);
+    Py_END_ALLOW_THREADS
+    FTPY_FACE_UNLOCK(face);
+
+    FTPY_LAYOUT_UNLOCK(self);
+
+    if (error) {
+        free(path.points);
+        free(path.codes);
+        ftpy_exc(error);
+        return NULL;
+    }
+
+    if (path.size == 0) {
+        points = ftpy_Array_cnew("d", sizeof(double), 2, 0, 2);
+    } else {
+        points = ftpy_Array_cnew_from_data(
+            path.points, "d", sizeof(double), 2, path.size, 2);
+    }
+    if (points == NULL) {
+        free(path.codes);
+        return NULL;
+    }
+
+    if (path.size == 0) {
+        codes = ftpy_Array_cnew("B", sizeof(unsigned char), 1, 0, 0);
+    } else {
+        codes = ftpy_Array_cnew_from_data(
+            path.codes, "B", sizeof(unsigned char), 1, path.size, 0);
+    }
+    if (codes == NULL) {
+        Py_DECREF(points);
+        return NULL;
+    }
+
+    return Py_BuildValue("(NN)", points, codes);
+}
+
+
+static PyMethodDef Py_Layout_methods[] = {
+    LAYOUT_METHOD(delete),
+    LAYOUT_METHOD(draw),
+    LAYOUT_METHOD(get_transformed),
+    LAYOUT_METHOD(insert),
+    LAYOUT_METHOD(replace),
+    LAYOUT_METHOD_NOARGS(to_points_and_codes),
+    {NULL}  /* Sentinel */
+};
+
+
+/****************************************************************************
+ Ancillary buffers
+*/
+
+
+static PyObject *
+Py_Layout_Glyph_Indices_Buffer_cnew(PyObject *owner)
+{
+    ftpy_Buffer *self;
+    self = (ftpy_Buffer *)(&Py_Layout_Glyph_Indices_Buffer_Type)->tp_alloc(
+        &Py_Layout_Glyph_Indices_Buffer_Type, 0);
+    if (self == NULL) {
+        return NULL;
+    }
+    Py_INCREF(owner);
+    self->base.owner = owner;
+    return (PyObject *)self;
+}
+
+
+static int Py_Layout_Glyph_Indices_Buffer_get_buffer(
+    ftpy_Buffer *self, Py_buffer *view, int flags)
+{
+    Py_Layout *layout = (Py_Layout *)self->base.owner;
+    size_t itemsize = sizeof(FT_ULong);
+
+    if (flags & PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "Layout is read-only");
+        return -1;
+    }
+
+    FTPY_LAYOUT_LOCK(layout);
+
+    Py_INCREF(self);
+    view->obj = (PyObject *)self;
+    view->buf = layout->x.glyph_indices;
+    view->readonly = 1;
+    view->itemsize = itemsize;
+    view->format = "L";
+    view->len = layout->x.size * itemsize;
+    view->internal = NULL;
+    view->ndim = 1;
+    view->shape = self->shape;
+    self->shape[0] = layout->x.size;
+    view->strides = self->strides;
+    self->strides[0] = itemsize;
+    view->suboffsets = NULL;
+
+    layout->exports++;
+
+    FTPY_LAYOUT_UNLOCK(layout);
+
+    return 0;
+}
+
+
+static PyObject *
+Py_Layout_Xys_Buffer_cnew(PyObject *owner)
+{
+    ftpy_Buffer *self;
+    self = (ftpy_Buffer *)(&Py_Layout_Xys_Buffer_Type)->tp_alloc(
+        &Py_Layout_Xys_Buffer_Type, 0);
+    if (self == NULL) {
+        return NULL;
+    }
+    Py_INCREF(owner);
+    self->base.owner = owner;
+    return (PyObject *)self;
+}
+
+
+static int Py_Layout_Xys_Buffer_get_buffer(
+    ftpy_Buffer *self, Py_buffer *view, int flags)
+{
+    Py_Layout *layout = (Py_Layout *)self->base.owner;
+    size_t itemsize = sizeof(double);
+
+    if (flags & PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "Layout is read-only");
+        return -1;
+    }
+
+    FTPY_LAYOUT_LOCK(layout);
+
+    Py_INCREF(self);
+    view->obj = (PyObject *)self;
+    view->buf = layout->x.xys;
+    view->readonly = 1;
+    view->itemsize = itemsize;
+    view->format = "d";
+    view->len = layout->x.size * 2 * itemsize;
+    view->internal = NULL;
+    view->ndim = 2;
+    view->shape = self->shape;
+    self->shape[0] = layout->x.size;
+    self->shape[1] = 2;
+    view->strides = self->strides;
+    self->strides[0] = sizeof(ftpy_Layout_Vector);
+    self->strides[1] = itemsize;
+    view->suboffsets = NULL;
+
+    layout->exports++;
+
+    FTPY_LAYOUT_UNLOCK(layout);
+
+    return 0;
+}
+
+
+static void Py_Layout_Buffer_release_buffer(ftpy_Buffer *self, Py_buffer *view)
+{
+    ((Py_Layout *)self->base.owner)->exports--;
+}
+
+
+static PyBufferProcs Py_Layout_Glyph_Indices_Buffer_procs;
+static PyBufferProcs Py_Layout_Xys_Buffer_procs;
+
+
 /****************************************************************************
  Setup
 */
@@ -212,12 +946,34 @@ int setup_Layout(PyObject *m)
         .tp_dealloc = (destructor)Py_Layout_dealloc,
         .tp_doc = doc_Layout__init__,
         .tp_getset = Py_Layout_getset,
-        // .tp_methods = Py_Layout_methods,
+        .tp_methods = Py_Layout_methods,
         .tp_init = (initproc)Py_Layout_init,
         .tp_new = Py_Layout_new
     };
 
     ftpy_setup_type(m, &Py_Layout_Type);
 
+    if (ftpy_setup_buffer_type(
+            &Py_Layout_Glyph_Indices_Buffer_Type,
+            "freetypy.Layout.GlyphIndicesBuffer",
+            doc_Layout_glyph_indices,
+            &Py_Layout_Glyph_Indices_Buffer_procs,
+            (getbufferproc)Py_Layout_Glyph_Indices_Buffer_get_buffer)) {
+        return -1;
+    }
+    Py_Layout_Glyph_Indices_Buffer_procs.bf_releasebuffer =
+        (releasebufferproc)Py_Layout_Buffer_release_buffer;
+
+    if (ftpy_setup_buffer_type(
+            &Py_Layout_Xys_Buffer_Type,
+            "freetypy.Layout.XysBuffer",
+            doc_Layout_xys,
+            &Py_Layout_Xys_Buffer_procs,
+            (getbufferproc)Py_Layout_Xys_Buffer_get_buffer)) {
+        return -1;
+    }
+    Py_Layout_Xys_Buffer_procs.bf_releasebuffer =
+        (releasebufferproc)Py_Layout_Buffer_release_buffer;
+
     return 0;
 }
@@ -31,15 +31,53 @@ either expressed or implied, of the FreeBSD Project.
 #define __LAYOUT_H__
 
 #include "freetypy.h"
+#include "render.h"
 #include "simple_layout.h"
 
+#include "pythread.h"
+
 
 typedef struct {
     ftpy_Object base;
     ftpy_Layout x;
+    int load_flags;
+    /* The text, kept so that edits can be laid out against their
+       neighbors.  It and the layout's arrays have room for capacity
+       characters. */
+    uint32_t *text;
+    size_t capacity;
+    /* Set when an edit has made x.ink_bbox out of date */
+    int ink_bbox_stale;
+    /* The number of buffer views onto the layout's arrays.  The
+       layout can't be edited while there are any. */
+    Py_ssize_t exports;
+    /* Protects all of the above from edits made by another thread
+       while the GIL is released.  When both are needed, it is taken
+       before the face lock. */
+    PyThread_type_lock lock;
 } Py_Layout;
 
 
+#define FTPY_LAYOUT_LOCK(layout)                                    \
+    do {                                                            \
+        if (!PyThread_acquire_lock((layout)->lock, NOWAIT_LOCK)) {  \
+            Py_BEGIN_ALLOW_THREADS                                  \
+            PyThread_acquire_lock((layout)->lock, WAIT_LOCK);       \
+            Py_END_ALLOW_THREADS                                    \
+        }                                                           \
+    } while (0)
+
+
+#define FTPY_LAYOUT_UNLOCK(layout) PyThread_release_lock((layout)->lock)
+
+
+/* Gets a writable image from the buffer passed to a draw method, and
+   checks that render_mode can be drawn into it.  On success, view
+   must be released when the image is no longer needed. */
+int ftpy_Layout_get_image(
+    PyObject *buffer_obj, int render_mode, Py_buffer *view, ftpy_Image *image);
+
+
 int setup_Layout(PyObject *m);
 
 
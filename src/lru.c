@@ -0,0 +1,243 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "lru.h"
+
+
+#define INITIAL_BUCKETS 64
+
+
+#define ENTRY_KEY(lru, entry) (((const char *)(entry)) + (lru)->key_offset)
+
+
+static void
+lru_unlink(ftpy_LRU_Entry *entry)
+{
+    entry->lru_prev->lru_next = entry->lru_next;
+    entry->lru_next->lru_prev = entry->lru_prev;
+}
+
+
+static void
+lru_push_front(ftpy_LRU *lru, ftpy_LRU_Entry *entry)
+{
+    entry->lru_next = lru->lru.lru_next;
+    entry->lru_prev = &lru->lru;
+    lru->lru.lru_next->lru_prev = entry;
+    lru->lru.lru_next = entry;
+}
+
+
+static void
+lru_remove(ftpy_LRU *lru, ftpy_LRU_Entry *entry)
+{
+    ftpy_LRU_Entry **p = &lru->buckets[entry->hash % lru->nbuckets];
+
+    while (*p != entry) {
+        p = &(*p)->hash_next;
+    }
+    *p = entry->hash_next;
+
+    lru_unlink(entry);
+    lru->count--;
+    lru->nbytes -= entry->nbytes;
+    lru->destroy(entry);
+}
+
+
+static void
+lru_evict(ftpy_LRU *lru, const ftpy_LRU_Entry *keep)
+{
+    while (lru->nbytes > lru->max_bytes) {
+        ftpy_LRU_Entry *oldest = lru->lru.lru_prev;
+        if (oldest == &lru->lru || oldest == keep) {
+            break;
+        }
+        lru_remove(lru, oldest);
+    }
+}
+
+
+static int
+lru_grow(ftpy_LRU *lru)
+{
+    size_t nbuckets = lru->nbuckets * 2;
+    ftpy_LRU_Entry **buckets;
+    size_t i;
+
+    buckets = calloc(nbuckets, sizeof(ftpy_LRU_Entry *));
+    if (buckets == NULL) {
+        return -1;
+    }
+
+    for (i = 0; i < lru->nbuckets; ++i) {
+        ftpy_LRU_Entry *entry = lru->buckets[i];
+        while (entry != NULL) {
+            ftpy_LRU_Entry *next = entry->hash_next;
+            size_t j = entry->hash % nbuckets;
+            entry->hash_next = buckets[j];
+            buckets[j] = entry;
+            entry = next;
+        }
+    }
+
+    free(lru->buckets);
+    lru->buckets = buckets;
+    lru->nbuckets = nbuckets;
+    return 0;
+}
+
+
+int
+ftpy_LRU_init(
+    ftpy_LRU *lru, size_t max_bytes, size_t key_offset, size_t key_size,
+    ftpy_LRU_destroy_func destroy)
+{
+    memset(lru, 0, sizeof(ftpy_LRU));
+
+    lru->buckets = calloc(INITIAL_BUCKETS, sizeof(ftpy_LRU_Entry *));
+    if (lru->buckets == NULL) {
+        return -1;
+    }
+
+    lru->nbuckets = INITIAL_BUCKETS;
+    lru->max_bytes = max_bytes;
+    lru->key_offset = key_offset;
+    lru->key_size = key_size;
+    lru->destroy = destroy;
+    lru->lru.lru_next = lru->lru.lru_prev = &lru->lru;
+    return 0;
+}
+
+
+void
+ftpy_LRU_done(ftpy_LRU *lru)
+{
+    if (lru->buckets != NULL) {
+        ftpy_LRU_clear(lru);
+        free(lru->buckets);
+        lru->buckets = NULL;
+    }
+}
+
+
+size_t
+ftpy_LRU_hash(const ftpy_LRU *lru, const void *key)
+{
+    /* FNV-1a */
+    const unsigned char *p = key;
+    size_t hash = (size_t)2166136261U;
+    size_t i;
+
+    for (i = 0; i < lru->key_size; ++i) {
+        hash ^= p[i];
+        hash *= (size_t)16777619U;
+    }
+
+    return hash;
+}
+
+
+ftpy_LRU_Entry *
+ftpy_LRU_find(ftpy_LRU *lru, const void *key)
+{
+    size_t hash = ftpy_LRU_hash(lru, key);
+    ftpy_LRU_Entry *entry = lru->buckets[hash % lru->nbuckets];
+
+    while (entry != NULL) {
+        if (entry->hash == hash &&
+            memcmp(ENTRY_KEY(lru, entry), key, lru->key_size) == 0) {
+            return entry;
+        }
+        entry = entry->hash_next;
+    }
+
+    return NULL;
+}
+
+
+ftpy_LRU_Entry *
+ftpy_LRU_lookup(ftpy_LRU *lru, const void *key)
+{
+    ftpy_LRU_Entry *entry = ftpy_LRU_find(lru, key);
+
+    if (entry == NULL) {
+        lru->misses++;
+        return NULL;
+    }
+
+    lru_unlink(entry);
+    lru_push_front(lru, entry);
+    lru->hits++;
+    return entry;
+}
+
+
+int
+ftpy_LRU_insert(ftpy_LRU *lru, ftpy_LRU_Entry *entry)
+{
+    size_t i;
+
+    if (lru->count >= lru->nbuckets) {
+        if (lru_grow(lru)) {
+            return -1;
+        }
+    }
+
+    entry->hash = ftpy_LRU_hash(lru, ENTRY_KEY(lru, entry));
+    i = entry->hash % lru->nbuckets;
+    entry->hash_next = lru->buckets[i];
+    lru->buckets[i] = entry;
+    lru_push_front(lru, entry);
+    lru->count++;
+    lru->nbytes += entry->nbytes;
+
+    lru_evict(lru, entry);
+    return 0;
+}
+
+
+void
+ftpy_LRU_set_max_bytes(ftpy_LRU *lru, size_t max_bytes)
+{
+    lru->max_bytes = max_bytes;
+    lru_evict(lru, NULL);
+}
+
+
+void
+ftpy_LRU_clear(ftpy_LRU *lru)
+{
+    while (lru->lru.lru_next != &lru->lru) {
+        lru_remove(lru, lru->lru.lru_next);
+    }
+}
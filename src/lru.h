@@ -0,0 +1,112 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#ifndef __LRU_H__
+#define __LRU_H__
+
+#include <stddef.h>
+
+
+/*
+   A generic hash table with least-recently-used eviction and a byte
+   budget.  It is used as the storage for the various caches.
+
+   Users embed ftpy_LRU_Entry as the first member of their own entry
+   structure, followed by a fixed-size key.  Keys are compared and
+   hashed bytewise, so they must be memset to zero before they are
+   filled in, to clear any padding.
+
+   None of this is thread-safe: callers must provide their own locking
+   (usually, by holding the GIL).
+*/
+
+
+typedef struct ftpy_LRU_Entry {
+    struct ftpy_LRU_Entry *hash_next;
+    struct ftpy_LRU_Entry *lru_prev;
+    struct ftpy_LRU_Entry *lru_next;
+    size_t hash;
+    size_t nbytes;
+} ftpy_LRU_Entry;
+
+
+typedef void (*ftpy_LRU_destroy_func)(ftpy_LRU_Entry *entry);
+
+
+typedef struct {
+    ftpy_LRU_Entry **buckets;
+    size_t nbuckets;
+    size_t count;
+    size_t nbytes;
+    size_t max_bytes;
+    size_t key_offset;
+    size_t key_size;
+    unsigned long long hits;
+    unsigned long long misses;
+    ftpy_LRU_Entry lru;
+    ftpy_LRU_destroy_func destroy;
+} ftpy_LRU;
+
+
+int ftpy_LRU_init(
+    ftpy_LRU *lru, size_t max_bytes, size_t key_offset, size_t key_size,
+    ftpy_LRU_destroy_func destroy);
+
+
+void ftpy_LRU_done(ftpy_LRU *lru);
+
+
+size_t ftpy_LRU_hash(const ftpy_LRU *lru, const void *key);
+
+
+/* Returns the entry for the given key, or NULL if there isn't one,
+   without affecting the eviction order or the counters. */
+ftpy_LRU_Entry *ftpy_LRU_find(ftpy_LRU *lru, const void *key);
+
+
+/* Returns the entry for the given key and marks it as the most
+   recently used, or NULL if there isn't one.  Updates the hit and
+   miss counters. */
+ftpy_LRU_Entry *ftpy_LRU_lookup(ftpy_LRU *lru, const void *key);
+
+
+/* Adds an entry, whose key and nbytes must already be filled in.  The
+   cache takes ownership of the entry.  Least-recently used entries
+   are evicted until the cache is back within its budget, but the new
+   entry itself is always kept. */
+int ftpy_LRU_insert(ftpy_LRU *lru, ftpy_LRU_Entry *entry);
+
+
+void ftpy_LRU_set_max_bytes(ftpy_LRU *lru, size_t max_bytes);
+
+
+void ftpy_LRU_clear(ftpy_LRU *lru);
+
+
+#endif
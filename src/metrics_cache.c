@@ -0,0 +1,144 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "metrics_cache.h"
+
+#include FT_BBOX_H
+#include FT_OUTLINE_H
+
+
+/* Each entry is less than 200 bytes, so this holds several thousand
+   glyphs */
+#define METRICS_CACHE_MAX_BYTES (1 << 20)
+
+
+static void
+metrics_cache_entry_destroy(ftpy_LRU_Entry *entry)
+{
+    free(entry);
+}
+
+
+int
+ftpy_metrics_cache_init(ftpy_LRU *cache)
+{
+    return ftpy_LRU_init(
+        cache, METRICS_CACHE_MAX_BYTES,
+        offsetof(ftpy_Metrics_Cache_Entry, key), sizeof(ftpy_Metrics_Cache_Key),
+        metrics_cache_entry_destroy);
+}
+
+
+void
+ftpy_metrics_cache_make_key(
+    ftpy_Metrics_Cache_Key *key, FT_Face face, FT_Int32 load_flags,
+    FT_UInt glyph_index)
+{
+    memset(key, 0, sizeof(ftpy_Metrics_Cache_Key));
+    if (face->size != NULL) {
+        key->x_ppem = face->size->metrics.x_ppem;
+        key->y_ppem = face->size->metrics.y_ppem;
+        key->x_scale = face->size->metrics.x_scale;
+        key->y_scale = face->size->metrics.y_scale;
+    }
+    key->load_flags = load_flags;
+    key->glyph_index = glyph_index;
+}
+
+
+ftpy_Metrics_Cache_Entry *
+ftpy_metrics_cache_find(
+    ftpy_LRU *cache, FT_Face face, FT_Int32 load_flags, FT_UInt glyph_index)
+{
+    ftpy_Metrics_Cache_Key key;
+
+    ftpy_metrics_cache_make_key(&key, face, load_flags, glyph_index);
+    return (ftpy_Metrics_Cache_Entry *)ftpy_LRU_find(cache, &key);
+}
+
+
+FT_Error
+ftpy_metrics_cache_get(
+    ftpy_LRU *cache, FT_Face face, FT_Int32 load_flags, FT_UInt glyph_index,
+    ftpy_Metrics_Cache_Entry **entry)
+{
+    ftpy_Metrics_Cache_Key key;
+    ftpy_Metrics_Cache_Entry *result;
+    FT_GlyphSlot slot;
+    FT_Error error;
+
+    ftpy_metrics_cache_make_key(&key, face, load_flags, glyph_index);
+
+    result = (ftpy_Metrics_Cache_Entry *)ftpy_LRU_lookup(cache, &key);
+    if (result != NULL) {
+        *entry = result;
+        return 0;
+    }
+
+    error = FT_Load_Glyph(face, glyph_index, load_flags);
+    if (error) {
+        return error;
+    }
+
+    result = malloc(sizeof(ftpy_Metrics_Cache_Entry));
+    if (result == NULL) {
+        return FT_Err_Out_Of_Memory;
+    }
+
+    slot = face->glyph;
+    result->key = key;
+    result->metrics = slot->metrics;
+    result->advance = slot->advance;
+
+    if (slot->format == FT_GLYPH_FORMAT_OUTLINE) {
+        error = FT_Outline_Get_BBox(&slot->outline, &result->bbox);
+        if (error) {
+            free(result);
+            return error;
+        }
+    } else {
+        result->bbox.xMin = (FT_Pos)slot->bitmap_left * 64;
+        result->bbox.yMax = (FT_Pos)slot->bitmap_top * 64;
+        result->bbox.xMax = result->bbox.xMin + (FT_Pos)slot->bitmap.width * 64;
+        result->bbox.yMin = result->bbox.yMax - (FT_Pos)slot->bitmap.rows * 64;
+    }
+
+    result->base.nbytes = sizeof(ftpy_Metrics_Cache_Entry);
+
+    if (ftpy_LRU_insert(cache, &result->base)) {
+        free(result);
+        return FT_Err_Out_Of_Memory;
+    }
+
+    *entry = result;
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#ifndef __METRICS_CACHE_H__
+#define __METRICS_CACHE_H__
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include "lru.h"
+
+
+/*
+   A cache of the metrics of loaded glyphs, so that layouts don't need
+   to load each glyph every time.  Each Face has one, which is
+   protected by the face lock, so it may be used without the GIL.
+*/
+
+
+typedef struct {
+    FT_UShort x_ppem;
+    FT_UShort y_ppem;
+    FT_Fixed x_scale;
+    FT_Fixed y_scale;
+    FT_Int32 load_flags;
+    FT_UInt glyph_index;
+} ftpy_Metrics_Cache_Key;
+
+
+typedef struct {
+    ftpy_LRU_Entry base;
+    ftpy_Metrics_Cache_Key key;
+    /* The glyph's metrics, in 26.6 */
+    FT_Glyph_Metrics metrics;
+    /* The (transformed) advance, in 26.6 */
+    FT_Vector advance;
+    /* The exact bounding box of the ink, in 26.6 */
+    FT_BBox bbox;
+} ftpy_Metrics_Cache_Entry;
+
+
+int ftpy_metrics_cache_init(ftpy_LRU *cache);
+
+
+/* Fills in the key for a glyph at the face's current size.  Also used
+   by the outline cache. */
+void ftpy_metrics_cache_make_key(
+    ftpy_Metrics_Cache_Key *key, FT_Face face, FT_Int32 load_flags,
+    FT_UInt glyph_index);
+
+
+/* Returns the cached metrics for the given glyph, or NULL if they
+   aren't in the cache. */
+ftpy_Metrics_Cache_Entry *ftpy_metrics_cache_find(
+    ftpy_LRU *cache, FT_Face face, FT_Int32 load_flags, FT_UInt glyph_index);
+
+
+/* Gets the metrics for the given glyph, loading it into the face's
+   glyph slot if it isn't already in the cache.  The entry is only
+   valid until the next call into the cache. */
+FT_Error ftpy_metrics_cache_get(
+    ftpy_LRU *cache, FT_Face face, FT_Int32 load_flags, FT_UInt glyph_index,
+    ftpy_Metrics_Cache_Entry **entry);
+
+
+#endif
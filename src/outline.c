@@ -361,55 +361,40 @@ Py_Outline_to_string_cubicto_func(
 
 
 typedef struct {
-    double last_x;
-    double last_y;
-    double *points;
-    char *codes;
-    size_t buffer_size;
-    size_t cursor;
-} DecomposeToPointsAndCodesData;
+    ftpy_Path *path;
+    double x;
+    double y;
+} DecomposeToPathData;
 
 
 static int
-to_points_and_codes_expand_buffer(
-    DecomposeToPointsAndCodesData *data, size_t len)
+append_points_and_codes(
+    DecomposeToPathData *data, const FT_Vector *points, size_t npoints,
+    unsigned char code)
 {
-    size_t new_len = len + data->cursor;
+    ftpy_Path *path = data->path;
+    double *new_points;
+    unsigned char *new_codes;
+    size_t i;
 
-    if (new_len > data->buffer_size) {
-        data->buffer_size = (((new_len / BUFFER_CHUNK_SIZE) + 1) *
-                             BUFFER_CHUNK_SIZE);
-        data->points = PyMem_Realloc(
-            data->points, data->buffer_size * sizeof(double) * 2);
-        if (data->points == NULL) {
+    if (path->size + npoints > path->capacity) {
+        path->capacity = (path->size + npoints) * 2;
+        new_points = realloc(path->points, path->capacity * sizeof(double) * 2);
+        if (new_points == NULL) {
             return -1;
         }
-        data->codes = PyMem_Realloc(
-            data->codes, data->buffer_size);
-        if (data->codes == NULL) {
+        path->points = new_points;
+        new_codes = realloc(path->codes, path->capacity);
+        if (new_codes == NULL) {
             return -1;
         }
+        path->codes = new_codes;
     }
 
-    return 0;
-}
-
-
-static int
-append_points_and_codes(
-    DecomposeToPointsAndCodesData *data, const FT_Vector *points,
-    size_t npoints, char code)
-{
-    size_t i;
-
-    if (to_points_and_codes_expand_buffer(data, npoints)) {
-        return -1;
-    }
-
-    for (i = 0; i < npoints; ++i, ++data->cursor) {
-        data->points[data->cursor * 2] = FROM_F26DOT6(points[i].x);
-        data->points[data->cursor * 2 + 1] = FROM_F26DOT6(points[i].y);
-        data->codes[data->cursor] = code;
+    for (i = 0; i < npoints; ++i, ++path->size) {
+        path->points[path->size * 2] = data->x + FROM_F26DOT6(points[i].x);
+        path->points[path->size * 2 + 1] = data->y + FROM_F26DOT6(points[i].y);
+        path->codes[path->size] = code;
     }
 
     return 0;
@@ -419,49 +404,38 @@ append_points_and_codes(
 static int
 Py_Outline_to_points_and_codes_moveto_func(const FT_Vector *to, void *user)
 {
-    DecomposeToPointsAndCodesData *data = (DecomposeToPointsAndCodesData *)user;
-
-    if (append_points_and_codes(data, to, 1, CODE_MOVETO)) {
-        return 0x6;
+    if (append_points_and_codes(
+            (DecomposeToPathData *)user, to, 1, CODE_MOVETO)) {
+        return FT_Err_Out_Of_Memory;
     }
 
-    data->last_x = to->x;
-    data->last_y = to->y;
-
     return 0;
 }
 
 static int
 Py_Outline_to_points_and_codes_lineto_func(const FT_Vector *to, void *user)
 {
-    DecomposeToPointsAndCodesData *data = (DecomposeToPointsAndCodesData *)user;
-
-    if (append_points_and_codes(data, to, 1, CODE_LINETO)) {
-        return 0x6;
+    if (append_points_and_codes(
+            (DecomposeToPathData *)user, to, 1, CODE_LINETO)) {
+        return FT_Err_Out_Of_Memory;
     }
 
-    data->last_x = to->x;
-    data->last_y = to->y;
-
     return 0;
 }
 
 static int
 Py_Outline_to_points_and_codes_conicto_func(const FT_Vector *control, const FT_Vector *to, void *user)
 {
-    DecomposeToPointsAndCodesData *data = (DecomposeToPointsAndCodesData *)user;
     FT_Vector v[2];
 
     v[0] = *control;
     v[1] = *to;
 
-    if (append_points_and_codes(data, v, 2, CODE_CONIC)) {
-        return 0x6;
+    if (append_points_and_codes(
+            (DecomposeToPathData *)user, v, 2, CODE_CONIC)) {
+        return FT_Err_Out_Of_Memory;
     }
 
-    data->last_x = to->x;
-    data->last_y = to->y;
-
     return 0;
 }
 
@@ -470,24 +444,43 @@ Py_Outline_to_points_and_codes_cubicto_func(
     const FT_Vector *control1, const FT_Vector *control2,
     const FT_Vector *to, void *user)
 {
-    DecomposeToPointsAndCodesData *data = (DecomposeToPointsAndCodesData *)user;
     FT_Vector v[3];
 
     v[0] = *control1;
     v[1] = *control2;
     v[2] = *to;
 
-    if (append_points_and_codes(data, v, 3, CODE_CUBIC)) {
-        return 0x6;
+    if (append_points_and_codes(
+            (DecomposeToPathData *)user, v, 3, CODE_CUBIC)) {
+        return FT_Err_Out_Of_Memory;
     }
 
-    data->last_x = to->x;
-    data->last_y = to->y;
-
     return 0;
 }
 
 
+FT_Error
+ftpy_outline_to_path(FT_Outline *outline, double x, double y, ftpy_Path *path)
+{
+    const FT_Outline_Funcs funcs = {
+        .move_to = Py_Outline_to_points_and_codes_moveto_func,
+        .line_to = Py_Outline_to_points_and_codes_lineto_func,
+        .conic_to = Py_Outline_to_points_and_codes_conicto_func,
+        .cubic_to = Py_Outline_to_points_and_codes_cubicto_func,
+
+        .shift = 0,
+        .delta = 0
+    };
+    DecomposeToPathData data;
+
+    data.path = path;
+    data.x = x;
+    data.y = y;
+
+    return FT_Outline_Decompose(outline, &funcs, &data);
+}
+
+
 /****************************************************************************
  Object basics
 */
@@ -498,7 +491,7 @@ typedef struct {
     FT_Outline x;
     int inited;
     double *points;
-    char *codes;
+    unsigned char *codes;
     size_t n_points;
 } Py_Outline;
 
@@ -524,8 +517,8 @@ Py_Outline_dealloc(Py_Outline* self)
     if (self->inited) {
         FT_Outline_Done(get_ft_library(), &self->x);
     }
-    PyMem_Free(self->points);
-    PyMem_Free(self->codes);
+    free(self->points);
+    free(self->codes);
     Py_TYPE(self)->tp_clear((PyObject*)self);
     Py_TYPE(self)->tp_free((PyObject*)self);
 }
@@ -763,7 +756,7 @@ Py_Outline_transform(Py_Outline* self, PyObject* args, PyObject* kwds)
     double xx, xy, yx, yy;
     FT_Matrix matrix;
 
-    const char* keywords[] = {"xOffset", "yOffset", NULL};
+    const char* keywords[] = {"matrix", NULL};
 
     if (!PyArg_ParseTupleAndKeywords(
             args, kwds, "((dd)(dd)):transform", (char **)keywords,
@@ -788,35 +781,22 @@ Py_Outline_to_points_and_codes(Py_Outline* self, PyObject* args, PyObject* kwds)
     PyObject *result = NULL;
     PyObject *points = NULL;
     PyObject *codes = NULL;
-    DecomposeToPointsAndCodesData data;
-    const FT_Outline_Funcs funcs = {
-        .move_to = Py_Outline_to_points_and_codes_moveto_func,
-        .line_to = Py_Outline_to_points_and_codes_lineto_func,
-        .conic_to = Py_Outline_to_points_and_codes_conicto_func,
-        .cubic_to = Py_Outline_to_points_and_codes_cubicto_func,
-
-        .shift = 0,
-        .delta = 0
-    };
-    int error;
+    ftpy_Path path;
+    FT_Error error;
 
     if (!self->points || !self->codes) {
-        memset(&data, 0, sizeof(DecomposeToPointsAndCodesData));
+        memset(&path, 0, sizeof(ftpy_Path));
 
-        error = FT_Outline_Decompose(&self->x, &funcs, &data);
-        if (PyErr_Occurred()) {
-            PyMem_Free(data.points);
-            PyMem_Free(data.codes);
-            goto exit;
-        } else if (ftpy_exc(error)) {
-            PyMem_Free(data.points);
-            PyMem_Free(data.codes);
+        error = ftpy_outline_to_path(&self->x, 0.0, 0.0, &path);
+        if (ftpy_exc(error)) {
+            free(path.points);
+            free(path.codes);
             goto exit;
         }
 
-        self->points = data.points;
-        self->codes = data.codes;
-        self->n_points = data.cursor;
+        self->points = path.points;
+        self->codes = path.codes;
+        self->n_points = path.size;
     }
 
     points = Py_Outline_Decomposed_Points_Buffer_cnew((PyObject *)self);
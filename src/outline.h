@@ -42,6 +42,23 @@ typedef enum {
 } e_codes;
 
 
+/* Points (in pixels) and CODES built by decomposing outlines.  The
+   arrays are allocated with malloc, so that outlines can be decomposed
+   without the GIL. */
+typedef struct {
+    double *points;
+    unsigned char *codes;
+    size_t size;
+    size_t capacity;
+} ftpy_Path;
+
+
+/* Appends the decomposed outline to path, moved by (x, y) pixels.  On
+   error, the arrays of path must still be freed. */
+FT_Error
+ftpy_outline_to_path(FT_Outline *outline, double x, double y, ftpy_Path *path);
+
+
 PyObject *
 Py_Outline_cnew(FT_Outline *Outline);
 
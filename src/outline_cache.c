@@ -0,0 +1,149 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "outline_cache.h"
+
+#include FT_BBOX_H
+#include FT_OUTLINE_H
+
+
+/* Outlines are typically a few hundred bytes to a few kilobytes, so
+   this holds several hundred glyphs */
+#define OUTLINE_CACHE_MAX_BYTES (1 << 20)
+
+
+static void
+outline_cache_entry_destroy(ftpy_LRU_Entry *entry)
+{
+    free(entry);
+}
+
+
+int
+ftpy_outline_cache_init(ftpy_LRU *cache)
+{
+    return ftpy_LRU_init(
+        cache, OUTLINE_CACHE_MAX_BYTES,
+        offsetof(ftpy_Outline_Cache_Entry, key), sizeof(ftpy_Metrics_Cache_Key),
+        outline_cache_entry_destroy);
+}
+
+
+FT_Error
+ftpy_outline_cache_get(
+    ftpy_LRU *cache, FT_Face face, FT_Matrix *transform, FT_Vector *delta,
+    FT_Int32 load_flags, FT_UInt glyph_index,
+    ftpy_Outline_Cache_Entry **entry)
+{
+    ftpy_Metrics_Cache_Key key;
+    ftpy_Outline_Cache_Entry *result;
+    FT_GlyphSlot slot;
+    FT_Outline *source;
+    size_t n_points = 0;
+    size_t n_contours = 0;
+    size_t nbytes;
+    char *data;
+    FT_Error error;
+
+    ftpy_metrics_cache_make_key(&key, face, load_flags, glyph_index);
+
+    result = (ftpy_Outline_Cache_Entry *)ftpy_LRU_lookup(cache, &key);
+    if (result != NULL) {
+        *entry = result;
+        return 0;
+    }
+
+    FT_Set_Transform(face, NULL, NULL);
+    error = FT_Load_Glyph(face, glyph_index, load_flags);
+    FT_Set_Transform(face, transform, delta);
+    if (error) {
+        return error;
+    }
+
+    slot = face->glyph;
+    source = &slot->outline;
+    if (slot->format == FT_GLYPH_FORMAT_OUTLINE) {
+        n_points = source->n_points;
+        n_contours = source->n_contours;
+    }
+
+    /* The points come first, since they have the strictest
+       alignment */
+    nbytes = (sizeof(ftpy_Outline_Cache_Entry) +
+              sizeof(FT_Vector) * n_points +
+              sizeof(*source->contours) * n_contours +
+              n_points);
+    result = malloc(nbytes);
+    if (result == NULL) {
+        return FT_Err_Out_Of_Memory;
+    }
+
+    data = (char *)(result + 1);
+    result->key = key;
+    result->outline.n_points = n_points;
+    result->outline.n_contours = n_contours;
+    result->outline.points = (FT_Vector *)data;
+    data += sizeof(FT_Vector) * n_points;
+    result->outline.contours = (void *)data;
+    data += sizeof(*source->contours) * n_contours;
+    result->outline.tags = data;
+    result->outline.flags = 0;
+
+    if (slot->format == FT_GLYPH_FORMAT_OUTLINE) {
+        memcpy(result->outline.points, source->points,
+               sizeof(FT_Vector) * n_points);
+        memcpy(result->outline.contours, source->contours,
+               sizeof(*source->contours) * n_contours);
+        memcpy(result->outline.tags, source->tags, n_points);
+        result->outline.flags = source->flags & ~FT_OUTLINE_OWNER;
+        error = FT_Outline_Get_BBox(&result->outline, &result->bbox);
+        if (error) {
+            free(result);
+            return error;
+        }
+    } else {
+        result->bbox.xMin = (FT_Pos)slot->bitmap_left * 64;
+        result->bbox.yMax = (FT_Pos)slot->bitmap_top * 64;
+        result->bbox.xMax = result->bbox.xMin + (FT_Pos)slot->bitmap.width * 64;
+        result->bbox.yMin = result->bbox.yMax - (FT_Pos)slot->bitmap.rows * 64;
+    }
+
+    result->base.nbytes = nbytes;
+
+    if (ftpy_LRU_insert(cache, &result->base)) {
+        free(result);
+        return FT_Err_Out_Of_Memory;
+    }
+
+    *entry = result;
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#ifndef __OUTLINE_CACHE_H__
+#define __OUTLINE_CACHE_H__
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include "lru.h"
+#include "metrics_cache.h"
+
+
+/*
+   A cache of the outlines of loaded glyphs, so that transformed
+   layouts can find the exact extent of each glyph without loading it
+   again.  Like the metrics cache, each Face has one, which is
+   protected by the face lock.
+
+   The outlines are untransformed: the transform set on the face with
+   FT_Set_Transform is not applied to them, so that it doesn't
+   compound with the transform of the layout.
+*/
+
+
+typedef struct {
+    ftpy_LRU_Entry base;
+    ftpy_Metrics_Cache_Key key;
+    /* The glyph's outline, in 26.6.  The arrays are stored after the
+       entry, in the same allocation.  Glyphs that aren't outlines
+       have no points. */
+    FT_Outline outline;
+    /* The exact bounding box of the ink, in 26.6 */
+    FT_BBox bbox;
+} ftpy_Outline_Cache_Entry;
+
+
+int ftpy_outline_cache_init(ftpy_LRU *cache);
+
+
+/* Gets the outline of the given glyph, loading it into the face's
+   glyph slot if it isn't already in the cache.  The glyph is loaded
+   without a transform, after which the face's transform is set back
+   to transform and delta, which must be the last ones passed to
+   FT_Set_Transform.  The entry is only valid until the next call into
+   the cache. */
+FT_Error ftpy_outline_cache_get(
+    ftpy_LRU *cache, FT_Face face, FT_Matrix *transform, FT_Vector *delta,
+    FT_Int32 load_flags, FT_UInt glyph_index,
+    ftpy_Outline_Cache_Entry **entry);
+
+
+#endif
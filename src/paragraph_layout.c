@@ -0,0 +1,339 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#include "paragraph_layout.h"
+#include "doc/paragraph_layout.h"
+
+#include "bbox.h"
+#include "face.h"
+#include "layout.h"
+#include "pyutil.h"
+
+
+#define DEF_PARAGRAPH_LAYOUT_GETTER(name) \
+    DEF_GETTER(name, doc_ParagraphLayout_ ## name)
+#define PARAGRAPH_LAYOUT_METHOD(name) DEF_METHOD(name, ParagraphLayout)
+
+
+/****************************************************************************
+ Object basics
+*/
+
+
+static void
+Py_ParagraphLayout_dealloc(Py_ParagraphLayout* self)
+{
+    free(self->x.glyph_indices);
+    free(self->x.xys);
+    free(self->lines);
+    Py_TYPE(self)->tp_clear((PyObject*)self);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+
+static PyObject *
+Py_ParagraphLayout_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    Py_ParagraphLayout *self;
+
+    self = (Py_ParagraphLayout *)ftpy_Object_new(type, args, kwds);
+    if (self == NULL) {
+        return NULL;
+    }
+    self->base.owner = NULL;
+    self->x.xys = NULL;
+    self->x.glyph_indices = NULL;
+    self->x.size = 0;
+    self->lines = NULL;
+    self->nlines = 0;
+    self->load_flags = 0;
+    return (PyObject *)self;
+}
+
+
+static int
+Py_ParagraphLayout_init(Py_ParagraphLayout *self, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {
+        "face", "text", "width", "line_spacing", "load_flags", NULL};
+    PyObject *face_obj = NULL;
+    Py_Face *face = NULL;
+    PyObject *text_obj;
+    double width;
+    double line_spacing = 1.0;
+    int load_flags = FT_LOAD_DEFAULT;
+    PyObject *decoded_text = NULL;
+    uint32_t *text;
+    Py_ssize_t text_size;
+    FT_Pos line_height;
+    FT_Error error;
+    int result = -1;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!Od|di:ParagraphLayout.__init__",
+                                     kwlist,
+                                     &Py_Face_Type, &face_obj,
+                                     &text_obj,
+                                     &width,
+                                     &line_spacing,
+                                     &load_flags)) {
+        goto exit;
+    }
+
+    face = (Py_Face *)face_obj;
+
+    if (load_flags & FT_LOAD_VERTICAL_LAYOUT) {
+        PyErr_SetString(
+            PyExc_ValueError, "Paragraphs only support horizontal layout");
+        goto exit;
+    }
+
+    if (face->x->charmap == NULL ||
+        face->x->charmap->encoding != FT_ENCODING_UNICODE) {
+        PyErr_SetString(
+            PyExc_ValueError, "The layout only supports Unicode character map");
+        goto exit;
+    }
+
+    decoded_text = ftpy_PyUnicode_AsUTF32(text_obj, &text, &text_size);
+    if (decoded_text == NULL) {
+        goto exit;
+    }
+
+    free(self->x.glyph_indices);
+    free(self->x.xys);
+    free(self->lines);
+    self->x.size = 0;
+
+    FTPY_FACE_LOCK(face);
+    Py_BEGIN_ALLOW_THREADS
+    line_height = (FT_Pos)(face->x->size->metrics.height * line_spacing);
+    error = ftpy_calculate_paragraph_layout(
+        face->x, &face->metrics_cache, &face->kerning_cache, load_flags,
+        text, text_size, TO_F26DOT6(width), line_height,
+        &self->x, &self->lines, &self->nlines);
+    Py_END_ALLOW_THREADS
+    FTPY_FACE_UNLOCK(face);
+
+    if (ftpy_exc(error)) {
+        goto exit;
+    }
+
+    Py_INCREF(face_obj);
+    Py_XDECREF(self->base.owner);
+    self->base.owner = face_obj;
+    self->load_flags = load_flags;
+
+    result = 0;
+
+ exit:
+
+    Py_XDECREF(decoded_text);
+
+    return result;
+}
+
+
+/****************************************************************************
+ Getters
+*/
+
+
+static PyObject *ink_bbox_get(Py_ParagraphLayout *self, PyObject *closure)
+{
+    return Py_BBox_cnew(&self->x.ink_bbox, 1.0 / (double)(1 << 6));
+}
+
+static PyObject *layout_bbox_get(Py_ParagraphLayout *self, PyObject *closure)
+{
+    return Py_BBox_cnew(&self->x.layout_bbox, 1.0 / (double)(1 << 6));
+}
+
+static PyObject *layout_get(Py_ParagraphLayout *self, PyObject *closure)
+{
+    PyObject *result;
+    PyObject *subresult;
+    ftpy_Layout *layout;
+    size_t i;
+
+    layout = &self->x;
+
+    result = PyList_New(layout->size);
+
+    if (result == NULL) {
+        return NULL;
+    }
+
+    for (i = 0; i < layout->size; ++i) {
+        subresult = Py_BuildValue(
+                "(Ok(dd))",
+                self->base.owner,
+                layout->glyph_indices[i],
+                layout->xys[i].x,
+                layout->xys[i].y);
+        if (subresult == NULL) {
+            Py_DECREF(result);
+            return NULL;
+        }
+        if (PyList_SetItem(result, i, subresult)) {
+            Py_DECREF(subresult);
+            Py_DECREF(result);
+            return NULL;
+        }
+    }
+
+    return result;
+}
+
+static PyObject *lines_get(Py_ParagraphLayout *self, PyObject *closure)
+{
+    PyObject *result;
+    PyObject *subresult;
+    ftpy_Layout_Line *line;
+    size_t i;
+
+    result = PyList_New(self->nlines);
+
+    if (result == NULL) {
+        return NULL;
+    }
+
+    for (i = 0; i < self->nlines; ++i) {
+        line = &self->lines[i];
+        subresult = Py_BuildValue(
+            "(nndNN)",
+            (Py_ssize_t)line->start,
+            (Py_ssize_t)line->end,
+            (double)line->baseline / (double)(1 << 6),
+            Py_BBox_cnew(&line->layout_bbox, 1.0 / (double)(1 << 6)),
+            Py_BBox_cnew(&line->ink_bbox, 1.0 / (double)(1 << 6)));
+        if (subresult == NULL) {
+            Py_DECREF(result);
+            return NULL;
+        }
+        if (PyList_SetItem(result, i, subresult)) {
+            Py_DECREF(subresult);
+            Py_DECREF(result);
+            return NULL;
+        }
+    }
+
+    return result;
+}
+
+static PyGetSetDef Py_ParagraphLayout_getset[] = {
+    DEF_PARAGRAPH_LAYOUT_GETTER(ink_bbox),
+    DEF_PARAGRAPH_LAYOUT_GETTER(layout_bbox),
+    DEF_PARAGRAPH_LAYOUT_GETTER(layout),
+    DEF_PARAGRAPH_LAYOUT_GETTER(lines),
+    {NULL}
+};
+
+
+/****************************************************************************
+ Methods
+*/
+
+
+static PyObject*
+Py_ParagraphLayout_draw(Py_ParagraphLayout* self, PyObject* args, PyObject* kwds) {
+    PyObject *buffer_obj;
+    double x = 0.0;
+    double y = 0.0;
+    int render_mode = FT_RENDER_MODE_NORMAL;
+    Py_Face *face = (Py_Face *)self->base.owner;
+    Py_buffer view;
+    ftpy_Image image;
+    FT_Error error;
+
+    const char* keywords[] = {"buffer", "x", "y", "render_mode", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "O|ddi:draw", (char **)keywords,
+            &buffer_obj, &x, &y, &render_mode)) {
+        return NULL;
+    }
+
+    if (face == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "Layout is not initialized");
+        return NULL;
+    }
+
+    if (ftpy_Layout_get_image(buffer_obj, render_mode, &view, &image)) {
+        return NULL;
+    }
+
+    FTPY_FACE_LOCK(face);
+    Py_BEGIN_ALLOW_THREADS
+    error = ftpy_draw_layout(
+        face->x, self->load_flags, render_mode, &self->x, x, y, &image);
+    Py_END_ALLOW_THREADS
+    FTPY_FACE_UNLOCK(face);
+
+    PyBuffer_Release(&view);
+
+    if (ftpy_exc(error)) {
+        return NULL;
+    }
+
+    Py_RETURN_NONE;
+}
+
+
+static PyMethodDef Py_ParagraphLayout_methods[] = {
+    PARAGRAPH_LAYOUT_METHOD(draw),
+    {NULL}  /* Sentinel */
+};
+
+
+/****************************************************************************
+ Setup
+*/
+
+
+static PyTypeObject Py_ParagraphLayout_Type;
+
+
+int setup_ParagraphLayout(PyObject *m)
+{
+    memset(&Py_ParagraphLayout_Type, 0, sizeof(PyTypeObject));
+    Py_ParagraphLayout_Type = (PyTypeObject) {
+        .tp_name = "freetypy.ParagraphLayout",
+        .tp_basicsize = sizeof(Py_ParagraphLayout),
+        .tp_dealloc = (destructor)Py_ParagraphLayout_dealloc,
+        .tp_doc = doc_ParagraphLayout__init__,
+        .tp_getset = Py_ParagraphLayout_getset,
+        .tp_methods = Py_ParagraphLayout_methods,
+        .tp_init = (initproc)Py_ParagraphLayout_init,
+        .tp_new = Py_ParagraphLayout_new
+    };
+
+    ftpy_setup_type(m, &Py_ParagraphLayout_Type);
+
+    return 0;
+}
@@ -148,6 +148,12 @@ static PyObject *convert_int(unsigned char *p)
 }
 
 
+static PyObject *convert_unsignedint(unsigned char *p)
+{
+    return PyLong_FromUnsignedLong(*((unsigned int *)p));
+}
+
+
 static PyObject *convert_longlong(unsigned char *p)
 {
     return PyLong_FromLongLong(*((long long *)p));
@@ -204,6 +210,10 @@ PyObject *ftpy_PyBuffer_ToList(PyObject *obj)
         converter = convert_int;
         break;
 
+    case 'I':
+        converter = convert_unsignedint;
+        break;
+
     case 'q':
         converter = convert_longlong;
         break;
@@ -295,6 +305,193 @@ PyObject *ftpy_PyBuffer_ToList(PyObject *obj)
 }
 
 
+PyObject *ftpy_PyUnicode_AsUTF32(PyObject *obj, uint32_t **text, Py_ssize_t *size)
+{
+    PyObject *unicode;
+    PyObject *decoded;
+    char *buf;
+    Py_ssize_t len;
+
+    unicode = PyUnicode_FromObject(obj);
+    if (unicode == NULL) {
+        return NULL;
+    }
+
+    decoded = PyUnicode_AsUTF32String(unicode);
+    Py_DECREF(unicode);
+    if (decoded == NULL) {
+        return NULL;
+    }
+
+    if (PyBytes_AsStringAndSize(decoded, &buf, &len)) {
+        Py_DECREF(decoded);
+        return NULL;
+    }
+
+    /* Skip the byte order mark */
+    *text = (uint32_t *)(buf + 4);
+    *size = (len - 4) >> 2;
+
+    return decoded;
+}
+
+
+PyObject *ftpy_PyUnicode_FromUTF32(const uint32_t *text, Py_ssize_t size)
+{
+    #if PY3K
+    return PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND, text, size);
+    #else
+    /* An explicit byte order, so that a leading U+FEFF is kept */
+    const uint32_t one = 1;
+    int byteorder = *(const char *)&one ? -1 : 1;
+
+    return PyUnicode_DecodeUTF32(
+        (const char *)text, size * 4, "strict", &byteorder);
+    #endif
+}
+
+
+static int
+buffer_as_uint32_array(Py_buffer *view, uint32_t *array)
+{
+    const char *format = view->format;
+    const char *p = view->buf;
+    int is_signed;
+    Py_ssize_t i;
+    long long value;
+
+    if (view->ndim != 1) {
+        PyErr_SetString(PyExc_ValueError, "Expected a 1-dimensional buffer");
+        return -1;
+    }
+
+    if (format[0] == '@' || format[0] == '=') {
+        ++format;
+    }
+
+    switch (format[0]) {
+    case 'b': case 'h': case 'i': case 'l': case 'q':
+        is_signed = 1;
+        break;
+    case 'B': case 'H': case 'I': case 'L': case 'Q':
+        is_signed = 0;
+        break;
+    default:
+        PyErr_Format(
+            PyExc_TypeError, "Expected a buffer of integers, got '%s'",
+            view->format);
+        return -1;
+    }
+
+    for (i = 0; i < view->shape[0]; ++i, p += view->strides[0]) {
+        switch (view->itemsize) {
+        case 1:
+            value = is_signed ? (long long)*(int8_t *)p : (long long)*(uint8_t *)p;
+            break;
+        case 2:
+            value = is_signed ? (long long)*(int16_t *)p : (long long)*(uint16_t *)p;
+            break;
+        case 4:
+            value = is_signed ? (long long)*(int32_t *)p : (long long)*(uint32_t *)p;
+            break;
+        case 8:
+            if (!is_signed && *(uint64_t *)p > UINT32_MAX) {
+                value = -1;
+            } else {
+                value = *(int64_t *)p;
+            }
+            break;
+        default:
+            PyErr_SetString(PyExc_TypeError, "Unsupported integer size");
+            return -1;
+        }
+
+        if (value < 0 || value > UINT32_MAX) {
+            PyErr_SetString(
+                PyExc_OverflowError, "Value out of range for uint32");
+            return -1;
+        }
+
+        array[i] = (uint32_t)value;
+    }
+
+    return 0;
+}
+
+
+int ftpy_PyObject_AsUInt32Array(PyObject *obj, uint32_t **array, Py_ssize_t *size)
+{
+    Py_buffer view;
+    PyObject *seq;
+    PyObject *item;
+    unsigned long value;
+    Py_ssize_t i;
+    int result = -1;
+
+    *array = NULL;
+    *size = 0;
+
+    if (PyObject_CheckBuffer(obj)) {
+        if (PyObject_GetBuffer(obj, &view, PyBUF_RECORDS_RO)) {
+            return -1;
+        }
+
+        *array = malloc(
+            sizeof(uint32_t) *
+            ((view.ndim == 1 && view.shape[0]) ? view.shape[0] : 1));
+        if (*array == NULL) {
+            PyErr_NoMemory();
+        } else if (buffer_as_uint32_array(&view, *array) == 0) {
+            *size = view.shape[0];
+            result = 0;
+        }
+
+        PyBuffer_Release(&view);
+    } else {
+        seq = PySequence_Fast(obj, "Expected a sequence of integers");
+        if (seq == NULL) {
+            return -1;
+        }
+
+        *size = PySequence_Fast_GET_SIZE(seq);
+        *array = malloc(sizeof(uint32_t) * (*size ? *size : 1));
+        if (*array == NULL) {
+            PyErr_NoMemory();
+            Py_DECREF(seq);
+            return -1;
+        }
+
+        for (i = 0; i < *size; ++i) {
+            item = PySequence_Fast_GET_ITEM(seq, i);
+            value = PyLong_AsUnsignedLong(item);
+            if (PyErr_Occurred()) {
+                break;
+            }
+            if (value > UINT32_MAX) {
+                PyErr_SetString(
+                    PyExc_OverflowError, "Value out of range for uint32");
+                break;
+            }
+            (*array)[i] = (uint32_t)value;
+        }
+
+        if (i == *size) {
+            result = 0;
+        }
+
+        Py_DECREF(seq);
+    }
+
+    if (result) {
+        free(*array);
+        *array = NULL;
+        *size = 0;
+    }
+
+    return result;
+}
+
+
 static PyMethodDef Py_Buffer_methods[] = {
     {"to_list", (PyCFunction)ftpy_PyBuffer_ToList, METH_NOARGS, NULL},
     {NULL}  /* Sentinel */
@@ -30,6 +30,8 @@ either expressed or implied, of the FreeBSD Project.
 #ifndef __PYUTIL_H__
 #define __PYUTIL_H__
 
+#include <stdint.h>
+
 #include "freetypy.h"
 
 
@@ -125,4 +127,20 @@ PyObject *ftpy_PyDateTime_FromTTDateTime(long *date);
 PyObject *ftpy_PyBuffer_ToList(PyObject *obj);
 
 
+/* Decodes a string to native-endian UTF-32.  Returns a new reference
+   to the object holding the decoded data, which must be kept alive
+   while text is in use, or NULL on error. */
+PyObject *ftpy_PyUnicode_AsUTF32(PyObject *obj, uint32_t **text, Py_ssize_t *size);
+
+
+/* Creates a string from native-endian UTF-32. */
+PyObject *ftpy_PyUnicode_FromUTF32(const uint32_t *text, Py_ssize_t size);
+
+
+/* Converts a 1-dimensional buffer of integers, or a sequence of
+   Python ints, to a new array of uint32_t.  The caller must free the
+   result with free(). */
+int ftpy_PyObject_AsUInt32Array(PyObject *obj, uint32_t **array, Py_ssize_t *size);
+
+
 #endif
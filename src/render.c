@@ -0,0 +1,406 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "render.h"
+
+#include FT_BITMAP_H
+#include FT_OUTLINE_H
+
+
+typedef struct {
+    FT_UInt glyph_index;
+    unsigned char *buffer;
+    int width;
+    int rows;
+    int left;
+    int top;
+    size_t x;
+    size_t y;
+} ftpy_Rendered_Glyph;
+
+
+/* Copies the rendered bitmap into a new, tightly-packed top-down
+   8-bit buffer */
+static FT_Error
+copy_bitmap(FT_Library library, const FT_Bitmap *bitmap, unsigned char **out)
+{
+    FT_Bitmap converted;
+    const FT_Bitmap *src = bitmap;
+    unsigned char *dst;
+    const unsigned char *row;
+    unsigned int scale = 1;
+    unsigned int i, j;
+    size_t size;
+    FT_Error error = 0;
+
+    FT_Bitmap_New(&converted);
+
+    if (bitmap->pixel_mode != FT_PIXEL_MODE_GRAY &&
+        bitmap->pixel_mode != FT_PIXEL_MODE_LCD &&
+        bitmap->pixel_mode != FT_PIXEL_MODE_LCD_V) {
+        error = FT_Bitmap_Convert(library, bitmap, &converted, 1);
+        if (error) {
+            goto exit;
+        }
+        src = &converted;
+        if (converted.num_grays > 1) {
+            scale = 255 / (converted.num_grays - 1);
+        }
+    }
+
+    size = (size_t)src->rows * src->width;
+    dst = malloc(size ? size : 1);
+    if (dst == NULL) {
+        error = FT_Err_Out_Of_Memory;
+        goto exit;
+    }
+    *out = dst;
+
+    for (i = 0; i < src->rows; ++i) {
+        if (src->pitch >= 0) {
+            row = src->buffer + i * src->pitch;
+        } else {
+            row = src->buffer + (src->rows - 1 - i) * -src->pitch;
+        }
+
+        if (scale == 1) {
+            memcpy(dst, row, src->width);
+        } else {
+            for (j = 0; j < src->width; ++j) {
+                dst[j] = (unsigned char)(row[j] * scale);
+            }
+        }
+        dst += src->width;
+    }
+
+ exit:
+
+    FT_Bitmap_Done(library, &converted);
+
+    return error;
+}
+
+
+static int
+compare_height(const void *a, const void *b)
+{
+    const ftpy_Rendered_Glyph *ga = *(const ftpy_Rendered_Glyph **)a;
+    const ftpy_Rendered_Glyph *gb = *(const ftpy_Rendered_Glyph **)b;
+
+    if (ga->rows != gb->rows) {
+        return gb->rows - ga->rows;
+    }
+    /* Keep the order stable */
+    return (ga < gb) ? -1 : (ga > gb);
+}
+
+
+/* Packs the glyphs into shelves, tallest first, in an atlas about as
+   wide as it is tall */
+static void
+pack_glyphs(
+    ftpy_Rendered_Glyph *glyphs, ftpy_Rendered_Glyph **order, size_t n,
+    size_t *width, size_t *height)
+{
+    size_t area = 0;
+    size_t max_width = 0;
+    size_t atlas_width;
+    size_t x = 0, y = 0, shelf_height = 0;
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        order[i] = &glyphs[i];
+        area += (size_t)glyphs[i].width * glyphs[i].rows;
+        if ((size_t)glyphs[i].width > max_width) {
+            max_width = glyphs[i].width;
+        }
+    }
+
+    qsort(order, n, sizeof(ftpy_Rendered_Glyph *), compare_height);
+
+    atlas_width = (size_t)ceil(sqrt((double)area));
+    if (atlas_width < max_width) {
+        atlas_width = max_width;
+    }
+
+    for (i = 0; i < n; ++i) {
+        ftpy_Rendered_Glyph *glyph = order[i];
+
+        if (glyph->width == 0 || glyph->rows == 0) {
+            glyph->x = glyph->y = 0;
+            continue;
+        }
+
+        if (x + glyph->width > atlas_width) {
+            y += shelf_height;
+            x = 0;
+            shelf_height = 0;
+        }
+
+        glyph->x = x;
+        glyph->y = y;
+        x += glyph->width;
+        if ((size_t)glyph->rows > shelf_height) {
+            shelf_height = glyph->rows;
+        }
+    }
+
+    *width = atlas_width;
+    *height = y + shelf_height;
+}
+
+
+FT_Error ftpy_render_atlas(
+    FT_Face face, FT_Library library, FT_Int32 load_flags,
+    FT_Render_Mode render_mode, const uint32_t *glyph_indices, size_t n,
+    ftpy_Atlas *atlas)
+{
+    long *unique_of = NULL;
+    long *unique_index = NULL;
+    ftpy_Rendered_Glyph *glyphs = NULL;
+    ftpy_Rendered_Glyph **order = NULL;
+    size_t nunique = 0;
+    size_t size;
+    size_t i;
+    int j;
+    FT_Error error = FT_Err_Out_Of_Memory;
+
+    atlas->buffer = NULL;
+    atlas->metrics = NULL;
+    atlas->width = atlas->height = 0;
+
+    /* Map each distinct glyph index to a single rendering */
+    unique_of = malloc(sizeof(long) * (face->num_glyphs ? face->num_glyphs : 1));
+    unique_index = malloc(sizeof(long) * (n ? n : 1));
+    glyphs = calloc(n ? n : 1, sizeof(ftpy_Rendered_Glyph));
+    order = malloc(sizeof(ftpy_Rendered_Glyph *) * (n ? n : 1));
+    atlas->metrics = malloc(sizeof(int) * FTPY_ATLAS_NCOLUMNS * (n ? n : 1));
+    if (unique_of == NULL || unique_index == NULL || glyphs == NULL ||
+        order == NULL || atlas->metrics == NULL) {
+        goto exit;
+    }
+
+    for (i = 0; i < (size_t)face->num_glyphs; ++i) {
+        unique_of[i] = -1;
+    }
+
+    for (i = 0; i < n; ++i) {
+        FT_UInt glyph_index = glyph_indices[i];
+
+        if (glyph_index >= (FT_UInt)face->num_glyphs) {
+            error = FT_Err_Invalid_Glyph_Index;
+            goto exit;
+        }
+
+        if (unique_of[glyph_index] < 0) {
+            unique_of[glyph_index] = nunique;
+            glyphs[nunique++].glyph_index = glyph_index;
+        }
+        unique_index[i] = unique_of[glyph_index];
+    }
+
+    for (i = 0; i < nunique; ++i) {
+        ftpy_Rendered_Glyph *glyph = &glyphs[i];
+
+        error = FT_Load_Glyph(face, glyph->glyph_index, load_flags);
+        if (error) {
+            goto exit;
+        }
+
+        error = FT_Render_Glyph(face->glyph, render_mode);
+        if (error) {
+            goto exit;
+        }
+
+        error = copy_bitmap(library, &face->glyph->bitmap, &glyph->buffer);
+        if (error) {
+            goto exit;
+        }
+
+        glyph->width = face->glyph->bitmap.width;
+        glyph->rows = face->glyph->bitmap.rows;
+        glyph->left = face->glyph->bitmap_left;
+        glyph->top = face->glyph->bitmap_top;
+    }
+
+    pack_glyphs(glyphs, order, nunique, &atlas->width, &atlas->height);
+
+    size = atlas->width * atlas->height;
+    atlas->buffer = calloc(size ? size : 1, 1);
+    if (atlas->buffer == NULL) {
+        error = FT_Err_Out_Of_Memory;
+        goto exit;
+    }
+
+    for (i = 0; i < nunique; ++i) {
+        ftpy_Rendered_Glyph *glyph = &glyphs[i];
+        unsigned char *dst = atlas->buffer + glyph->y * atlas->width + glyph->x;
+        unsigned char *src = glyph->buffer;
+
+        for (j = 0; j < glyph->rows; ++j) {
+            memcpy(dst, src, glyph->width);
+            dst += atlas->width;
+            src += glyph->width;
+        }
+    }
+
+    for (i = 0; i < n; ++i) {
+        ftpy_Rendered_Glyph *glyph = &glyphs[unique_index[i]];
+        int *row = atlas->metrics + i * FTPY_ATLAS_NCOLUMNS;
+
+        row[FTPY_ATLAS_X] = (int)glyph->x;
+        row[FTPY_ATLAS_Y] = (int)glyph->y;
+        row[FTPY_ATLAS_WIDTH] = glyph->width;
+        row[FTPY_ATLAS_ROWS] = glyph->rows;
+        row[FTPY_ATLAS_LEFT] = glyph->left;
+        row[FTPY_ATLAS_TOP] = glyph->top;
+    }
+
+    error = 0;
+
+ exit:
+
+    if (glyphs != NULL) {
+        for (i = 0; i < nunique; ++i) {
+            free(glyphs[i].buffer);
+        }
+    }
+    free(glyphs);
+    free(order);
+    free(unique_of);
+    free(unique_index);
+
+    if (error) {
+        free(atlas->buffer);
+        atlas->buffer = NULL;
+        free(atlas->metrics);
+        atlas->metrics = NULL;
+    }
+
+    return error;
+}
+
+
+static void
+composite(
+    ftpy_Image *image, const unsigned char *src, long src_pitch,
+    long width, long rows, long x0, long y0)
+{
+    long x_start = x0 < 0 ? -x0 : 0;
+    long y_start = y0 < 0 ? -y0 : 0;
+    long x_end = x0 + width > image->width ? image->width - x0 : width;
+    long y_end = y0 + rows > image->height ? image->height - y0 : rows;
+    long i, j;
+
+    for (i = y_start; i < y_end; ++i) {
+        const unsigned char *s = src + i * src_pitch;
+        unsigned char *d = (image->buffer + (y0 + i) * image->row_stride +
+                            (x0 + x_start) * image->col_stride);
+        for (j = x_start; j < x_end; ++j, d += image->col_stride) {
+            if (s[j] > *d) {
+                *d = s[j];
+            }
+        }
+    }
+}
+
+
+/* Splits a pixel coordinate into whole pixels and a 26.6 fraction */
+static long
+split_position(double v, FT_Pos *frac)
+{
+    double whole = floor(v);
+    FT_Pos f = (FT_Pos)floor((v - whole) * 64.0 + 0.5);
+
+    if (f == 64) {
+        f = 0;
+        whole += 1.0;
+    }
+    *frac = f;
+    return (long)whole;
+}
+
+
+FT_Error ftpy_draw_layout(
+    FT_Face face, FT_Int32 load_flags, FT_Render_Mode render_mode,
+    const ftpy_Layout *layout, double x, double y, ftpy_Image *image)
+{
+    FT_GlyphSlot slot = face->glyph;
+    FT_Bitmap *bitmap = &slot->bitmap;
+    unsigned char *converted;
+    FT_Pos frac_x, frac_y;
+    long pen_x, pen_y;
+    size_t i;
+    FT_Error error;
+
+    for (i = 0; i < layout->size; ++i) {
+        pen_x = split_position(x + layout->xys[i].x, &frac_x);
+        /* The image is top-down, but FreeType is bottom-up */
+        pen_y = split_position(y - layout->xys[i].y, &frac_y);
+
+        error = FT_Load_Glyph(face, layout->glyph_indices[i], load_flags);
+        if (error) {
+            return error;
+        }
+
+        if (slot->format == FT_GLYPH_FORMAT_OUTLINE) {
+            FT_Outline_Translate(&slot->outline, frac_x, -frac_y);
+        }
+
+        error = FT_Render_Glyph(slot, render_mode);
+        if (error) {
+            return error;
+        }
+
+        if (bitmap->rows == 0 || bitmap->width == 0) {
+            continue;
+        }
+
+        if (bitmap->pixel_mode == FT_PIXEL_MODE_GRAY && bitmap->pitch > 0) {
+            composite(image, bitmap->buffer, bitmap->pitch,
+                      bitmap->width, bitmap->rows,
+                      pen_x + slot->bitmap_left, pen_y - slot->bitmap_top);
+        } else {
+            error = copy_bitmap(slot->library, bitmap, &converted);
+            if (error) {
+                return error;
+            }
+            composite(image, converted, bitmap->width,
+                      bitmap->width, bitmap->rows,
+                      pen_x + slot->bitmap_left, pen_y - slot->bitmap_top);
+            free(converted);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#ifndef __RENDER_H__
+#define __RENDER_H__
+
+#include <stdint.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include "simple_layout.h"
+
+
+/* The columns of each row of ftpy_Atlas.metrics */
+enum {
+    FTPY_ATLAS_X,
+    FTPY_ATLAS_Y,
+    FTPY_ATLAS_WIDTH,
+    FTPY_ATLAS_ROWS,
+    FTPY_ATLAS_LEFT,
+    FTPY_ATLAS_TOP,
+    FTPY_ATLAS_NCOLUMNS
+};
+
+
+typedef struct {
+    unsigned char *buffer;
+    size_t width;
+    size_t height;
+    int *metrics;
+} ftpy_Atlas;
+
+
+/* Renders the given glyphs and packs them into a single 8-bit atlas.
+   Each glyph is only rendered once, no matter how many times it
+   appears in glyph_indices.  On success, the caller owns the buffer
+   and metrics arrays, and must free them with free(). */
+FT_Error ftpy_render_atlas(
+    FT_Face face, FT_Library library, FT_Int32 load_flags,
+    FT_Render_Mode render_mode, const uint32_t *glyph_indices, size_t n,
+    ftpy_Atlas *atlas);
+
+
+/* An 8-bit grayscale destination image, top-down */
+typedef struct {
+    unsigned char *buffer;
+    long width;
+    long height;
+    long row_stride;
+    long col_stride;
+} ftpy_Image;
+
+
+/* Renders every glyph in the layout and composites it into the image
+   (by taking the maximum of the source and destination), with the
+   layout's origin at (x, y) in the image.  Glyphs are clipped to the
+   image. */
+FT_Error ftpy_draw_layout(
+    FT_Face face, FT_Int32 load_flags, FT_Render_Mode render_mode,
+    const ftpy_Layout *layout, double x, double y, ftpy_Image *image);
+
+
+#endif
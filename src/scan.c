@@ -0,0 +1,730 @@
+/*
+Copyright (c) 2015, Michael Droettboom
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+*/
+
+#include "scan.h"
+#include "doc/scan.h"
+
+#include "constants.h"
+#include "coverage.h"
+#include "face.h"
+#include "file.h"
+
+#include "pythread.h"
+
+#include FT_SFNT_NAMES_H
+#include FT_TRUETYPE_TABLES_H
+
+
+enum {
+    FIELD_PATH,
+    FIELD_FACE_INDEX,
+    FIELD_FAMILY_NAME,
+    FIELD_STYLE_NAME,
+    FIELD_POSTSCRIPT_NAME,
+    FIELD_FACE_FLAGS,
+    FIELD_STYLE_FLAGS,
+    FIELD_NUM_GLYPHS,
+    FIELD_WEIGHT_CLASS,
+    FIELD_WIDTH_CLASS,
+    FIELD_SFNT_NAMES,
+    FIELD_COVERAGE,
+    NUM_FIELDS
+};
+
+
+static const char *field_names[NUM_FIELDS] = {
+    "path",
+    "face_index",
+    "family_name",
+    "style_name",
+    "postscript_name",
+    "face_flags",
+    "style_flags",
+    "num_glyphs",
+    "weight_class",
+    "width_class",
+    "sfnt_names",
+    "coverage"
+};
+
+
+static const int default_fields[] = {
+    FIELD_PATH,
+    FIELD_FACE_INDEX,
+    FIELD_FAMILY_NAME,
+    FIELD_STYLE_NAME,
+    FIELD_FACE_FLAGS,
+    FIELD_STYLE_FLAGS,
+    FIELD_WEIGHT_CLASS,
+    FIELD_WIDTH_CLASS
+};
+
+
+typedef struct {
+    FT_UShort platform_id;
+    FT_UShort encoding_id;
+    FT_UShort language_id;
+    FT_UShort name_id;
+    FT_Byte *string;
+    FT_UInt string_len;
+} scan_name;
+
+
+typedef struct {
+    FT_Long face_index;
+    char *family_name;
+    char *style_name;
+    char *postscript_name;
+    FT_Long face_flags;
+    FT_Long style_flags;
+    FT_Long num_glyphs;
+    int has_os2;
+    FT_UShort weight_class;
+    FT_UShort width_class;
+    scan_name *names;
+    FT_UInt num_names;
+    ftpy_Coverage coverage;
+} scan_record;
+
+
+typedef struct {
+    scan_record *records;
+    FT_Long num_records;
+} scan_file;
+
+
+typedef struct {
+    const char **paths;
+    Py_ssize_t npaths;
+    scan_file *files;
+    int want_postscript_name;
+    int want_names;
+    int want_coverage;
+
+    /* Protects next and running */
+    PyThread_type_lock lock;
+    Py_ssize_t next;
+    int running;
+    /* Held until the last worker finishes */
+    PyThread_type_lock done;
+} scan_state;
+
+
+static char *
+copy_string(const char *s)
+{
+    char *result;
+
+    if (s == NULL) {
+        return NULL;
+    }
+
+    result = malloc(strlen(s) + 1);
+    if (result != NULL) {
+        strcpy(result, s);
+    }
+    return result;
+}
+
+
+static void
+read_record(
+    FT_Face face, const scan_state *state, scan_record *record)
+{
+    TT_OS2 *os2;
+    FT_SfntName name;
+    FT_UInt i;
+
+    memset(record, 0, sizeof(scan_record));
+
+    record->face_index = face->face_index;
+    record->family_name = copy_string(face->family_name);
+    record->style_name = copy_string(face->style_name);
+    if (state->want_postscript_name) {
+        record->postscript_name = copy_string(FT_Get_Postscript_Name(face));
+    }
+    record->face_flags = face->face_flags;
+    record->style_flags = face->style_flags;
+    record->num_glyphs = face->num_glyphs;
+
+    os2 = (TT_OS2 *)FT_Get_Sfnt_Table(face, FT_SFNT_OS2);
+    if (os2 != NULL && os2->version != 0xffff) {
+        record->has_os2 = 1;
+        record->weight_class = os2->usWeightClass;
+        record->width_class = os2->usWidthClass;
+    }
+
+    if (state->want_names && FT_IS_SFNT(face)) {
+        record->num_names = FT_Get_Sfnt_Name_Count(face);
+        record->names = calloc(record->num_names, sizeof(scan_name));
+        if (record->names == NULL) {
+            record->num_names = 0;
+            return;
+        }
+
+        for (i = 0; i < record->num_names; ++i) {
+            if (FT_Get_Sfnt_Name(face, i, &name)) {
+                continue;
+            }
+            record->names[i].platform_id = name.platform_id;
+            record->names[i].encoding_id = name.encoding_id;
+            record->names[i].language_id = name.language_id;
+            record->names[i].name_id = name.name_id;
+            record->names[i].string = malloc(name.string_len ? name.string_len : 1);
+            if (record->names[i].string != NULL) {
+                memcpy(record->names[i].string, name.string, name.string_len);
+                record->names[i].string_len = name.string_len;
+            }
+        }
+    }
+
+    /* This changes the charmap, so must come last */
+    if (state->want_coverage) {
+        ftpy_coverage_build(face, &record->coverage);
+    }
+}
+
+
+static void
+free_record(scan_record *record)
+{
+    FT_UInt i;
+
+    free(record->family_name);
+    free(record->style_name);
+    free(record->postscript_name);
+    for (i = 0; i < record->num_names; ++i) {
+        free(record->names[i].string);
+    }
+    free(record->names);
+    ftpy_coverage_done(&record->coverage);
+}
+
+
+static FT_Error
+open_face(
+    FT_Library library, const char *path, void *data, size_t size,
+    FT_Long face_index, FT_Face *face)
+{
+    if (data != NULL) {
+        return FT_New_Memory_Face(
+            library, (const FT_Byte *)data, (FT_Long)size, face_index, face);
+    } else {
+        return FT_New_Face(library, path, face_index, face);
+    }
+}
+
+
+/* Reads every face in a file.  Files or faces that can't be opened
+   are skipped. */
+static void
+scan_one_file(
+    FT_Library library, const scan_state *state, const char *path,
+    scan_file *file)
+{
+    void *data = NULL;
+    size_t size = 0;
+    FT_Face face;
+    FT_Long num_faces;
+    FT_Long i;
+
+    file->records = NULL;
+    file->num_records = 0;
+
+    /* The file is read once, and each face is opened from memory */
+    if (ftpy_map_file(path, &data, &size)) {
+        data = NULL;
+    }
+
+    if (open_face(library, path, data, size, 0, &face)) {
+        goto exit;
+    }
+
+    num_faces = face->num_faces;
+    if (num_faces < 1) {
+        num_faces = 1;
+    }
+
+    file->records = malloc(sizeof(scan_record) * num_faces);
+    if (file->records == NULL) {
+        FT_Done_Face(face);
+        goto exit;
+    }
+
+    read_record(face, state, &file->records[file->num_records++]);
+    FT_Done_Face(face);
+
+    for (i = 1; i < num_faces; ++i) {
+        if (open_face(library, path, data, size, i, &face)) {
+            continue;
+        }
+        read_record(face, state, &file->records[file->num_records++]);
+        FT_Done_Face(face);
+    }
+
+ exit:
+
+    ftpy_unmap_file(data, size);
+}
+
+
+static void
+scan_worker(void *arg)
+{
+    scan_state *state = (scan_state *)arg;
+    FT_Library library;
+    Py_ssize_t i;
+    int last;
+
+    if (!FT_Init_FreeType(&library)) {
+        while (1) {
+            PyThread_acquire_lock(state->lock, WAIT_LOCK);
+            i = state->next++;
+            PyThread_release_lock(state->lock);
+
+            if (i >= state->npaths) {
+                break;
+            }
+
+            scan_one_file(
+                library, state, state->paths[i], &state->files[i]);
+        }
+
+        FT_Done_FreeType(library);
+    }
+
+    PyThread_acquire_lock(state->lock, WAIT_LOCK);
+    last = (--state->running == 0);
+    PyThread_release_lock(state->lock);
+
+    /* The state may be freed as soon as this is released, so it must
+       be the last thing to touch it */
+    if (last) {
+        PyThread_release_lock(state->done);
+    }
+}
+
+
+/* Runs the scan over the given number of threads, including the
+   calling one.  Must be called with the GIL released. */
+static void
+run_scan(scan_state *state, int nthreads)
+{
+    int i;
+
+    PyThread_acquire_lock(state->done, WAIT_LOCK);
+    state->running = nthreads;
+
+    for (i = 1; i < nthreads; ++i) {
+        if (PyThread_start_new_thread(scan_worker, state) == (unsigned long)-1) {
+            /* Fewer threads will do */
+            PyThread_acquire_lock(state->lock, WAIT_LOCK);
+            state->running--;
+            PyThread_release_lock(state->lock);
+        }
+    }
+
+    scan_worker(state);
+
+    PyThread_acquire_lock(state->done, WAIT_LOCK);
+    PyThread_release_lock(state->done);
+}
+
+
+static PyObject *
+string_to_python(const char *s)
+{
+    if (s == NULL) {
+        Py_RETURN_NONE;
+    }
+    /* Font names aren't always valid UTF-8 */
+    return PyUnicode_DecodeUTF8(s, strlen(s), "replace");
+}
+
+
+static PyObject *
+field_to_python(PyObject *path, scan_record *record, int field)
+{
+    PyObject *names;
+    PyObject *name;
+    FT_UInt i;
+
+    switch (field) {
+    case FIELD_PATH:
+        Py_INCREF(path);
+        return path;
+    case FIELD_FACE_INDEX:
+        return PyLong_FromLong(record->face_index);
+    case FIELD_FAMILY_NAME:
+        return string_to_python(record->family_name);
+    case FIELD_STYLE_NAME:
+        return string_to_python(record->style_name);
+    case FIELD_POSTSCRIPT_NAME:
+        return string_to_python(record->postscript_name);
+    case FIELD_FACE_FLAGS:
+        return Py_Constant_cnew(
+            &Py_FT_FACE_FLAG_BitflagType, record->face_flags);
+    case FIELD_STYLE_FLAGS:
+        return Py_Constant_cnew(
+            &Py_FT_STYLE_FLAG_BitflagType, record->style_flags);
+    case FIELD_NUM_GLYPHS:
+        return PyLong_FromLong(record->num_glyphs);
+    case FIELD_WEIGHT_CLASS:
+        if (!record->has_os2) {
+            Py_RETURN_NONE;
+        }
+        return PyLong_FromLong(record->weight_class);
+    case FIELD_WIDTH_CLASS:
+        if (!record->has_os2) {
+            Py_RETURN_NONE;
+        }
+        return PyLong_FromLong(record->width_class);
+    case FIELD_SFNT_NAMES:
+        names = PyList_New(record->num_names);
+        if (names == NULL) {
+            return NULL;
+        }
+        for (i = 0; i < record->num_names; ++i) {
+            name = Py_BuildValue(
+                "(HHHHN)",
+                record->names[i].platform_id,
+                record->names[i].encoding_id,
+                record->names[i].language_id,
+                record->names[i].name_id,
+                PyBytes_FromStringAndSize(
+                    (const char *)record->names[i].string,
+                    record->names[i].string_len));
+            if (name == NULL) {
+                Py_DECREF(names);
+                return NULL;
+            }
+            PyList_SET_ITEM(names, i, name);
+        }
+        return names;
+    case FIELD_COVERAGE:
+        return PyBytes_FromStringAndSize(
+            (const char *)record->coverage.leaves,
+            (Py_ssize_t)(record->coverage.nleaves *
+                         FTPY_COVERAGE_LEAF_WORDS * sizeof(uint32_t)));
+    }
+
+    PyErr_SetString(PyExc_RuntimeError, "Unknown field");
+    return NULL;
+}
+
+
+/* Gets a new reference to a field name as ASCII bytes, or NULL if it
+   isn't a string.  On Python 2, a plain str is accepted as well as
+   unicode. */
+static PyObject *
+field_name_as_bytes(PyObject *item)
+{
+    if (PyUnicode_Check(item)) {
+        return PyUnicode_AsASCIIString(item);
+    }
+    #if !PY3K
+    if (PyBytes_Check(item)) {
+        Py_INCREF(item);
+        return item;
+    }
+    #endif
+    return NULL;
+}
+
+
+static int
+parse_fields(PyObject *fields_obj, int **fields, Py_ssize_t *nfields)
+{
+    PyObject *seq;
+    PyObject *item;
+    PyObject *name_bytes;
+    const char *name;
+    Py_ssize_t i;
+    int j;
+
+    if (fields_obj == NULL || fields_obj == Py_None) {
+        *nfields = sizeof(default_fields) / sizeof(int);
+        *fields = malloc(sizeof(default_fields));
+        if (*fields == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        memcpy(*fields, default_fields, sizeof(default_fields));
+        return 0;
+    }
+
+    seq = PySequence_Fast(fields_obj, "fields must be a sequence of str");
+    if (seq == NULL) {
+        return -1;
+    }
+
+    *nfields = PySequence_Fast_GET_SIZE(seq);
+    *fields = malloc(sizeof(int) * (*nfields ? *nfields : 1));
+    if (*fields == NULL) {
+        Py_DECREF(seq);
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    for (i = 0; i < *nfields; ++i) {
+        item = PySequence_Fast_GET_ITEM(seq, i);
+        name_bytes = field_name_as_bytes(item);
+        if (name_bytes == NULL) {
+            if (!PyErr_Occurred()) {
+                PyErr_SetString(
+                    PyExc_TypeError, "fields must be a sequence of str");
+            }
+            goto fail;
+        }
+        name = PyBytes_AS_STRING(name_bytes);
+        for (j = 0; j < NUM_FIELDS; ++j) {
+            if (strcmp(name, field_names[j]) == 0) {
+                break;
+            }
+        }
+        if (j == NUM_FIELDS) {
+            PyErr_Format(PyExc_ValueError, "Unknown field '%s'", name);
+            Py_DECREF(name_bytes);
+            goto fail;
+        }
+        Py_DECREF(name_bytes);
+        (*fields)[i] = j;
+    }
+
+    Py_DECREF(seq);
+    return 0;
+
+ fail:
+
+    Py_DECREF(seq);
+    free(*fields);
+    *fields = NULL;
+    return -1;
+}
+
+
+/* Encodes a path for the file system, as a new reference to a bytes
+   object.  Returns 0 on failure, like PyUnicode_FSConverter. */
+static int
+path_as_bytes(PyObject *path, PyObject **bytes)
+{
+    #if PY3K
+    return PyUnicode_FSConverter(path, bytes);
+    #else
+    if (PyUnicode_Check(path)) {
+        *bytes = PyUnicode_AsEncodedString(
+            path,
+            Py_FileSystemDefaultEncoding ? Py_FileSystemDefaultEncoding : "utf-8",
+            "strict");
+        return *bytes != NULL;
+    } else if (PyBytes_Check(path)) {
+        Py_INCREF(path);
+        *bytes = path;
+        return 1;
+    }
+    PyErr_SetString(PyExc_TypeError, "paths must be str or bytes");
+    return 0;
+    #endif
+}
+
+
+static int
+get_cpu_count(void)
+{
+    PyObject *os;
+    PyObject *count;
+    long result = 1;
+
+    os = PyImport_ImportModule("os");
+    if (os == NULL) {
+        PyErr_Clear();
+        return 1;
+    }
+
+    count = PyObject_CallMethod(os, "cpu_count", NULL);
+    Py_DECREF(os);
+    if (count == NULL) {
+        PyErr_Clear();
+        return 1;
+    }
+
+    if (PyLong_Check(count)) {
+        result = PyLong_AsLong(count);
+    }
+    Py_DECREF(count);
+
+    return result > 0 ? (int)result : 1;
+}
+
+
+PyObject *
+py_scan_fonts(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    PyObject *paths_obj;
+    PyObject *fields_obj = NULL;
+    int nthreads = 0;
+    PyObject *paths_seq = NULL;
+    PyObject **encoded_paths = NULL;
+    int *fields = NULL;
+    Py_ssize_t nfields;
+    scan_state state;
+    PyObject *result = NULL;
+    PyObject *record;
+    PyObject *value;
+    Py_ssize_t i, j;
+    FT_Long k;
+
+    const char* keywords[] = {"paths", "fields", "threads", NULL};
+
+    memset(&state, 0, sizeof(scan_state));
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "O|Oi:scan_fonts", (char **)keywords,
+            &paths_obj, &fields_obj, &nthreads)) {
+        goto exit;
+    }
+
+    if (parse_fields(fields_obj, &fields, &nfields)) {
+        goto exit;
+    }
+
+    for (i = 0; i < nfields; ++i) {
+        if (fields[i] == FIELD_POSTSCRIPT_NAME) {
+            state.want_postscript_name = 1;
+        } else if (fields[i] == FIELD_SFNT_NAMES) {
+            state.want_names = 1;
+        } else if (fields[i] == FIELD_COVERAGE) {
+            state.want_coverage = 1;
+        }
+    }
+
+    paths_seq = PySequence_Fast(paths_obj, "paths must be a sequence");
+    if (paths_seq == NULL) {
+        goto exit;
+    }
+
+    state.npaths = PySequence_Fast_GET_SIZE(paths_seq);
+    encoded_paths = calloc(state.npaths ? state.npaths : 1, sizeof(PyObject *));
+    state.paths = calloc(state.npaths ? state.npaths : 1, sizeof(char *));
+    state.files = calloc(state.npaths ? state.npaths : 1, sizeof(scan_file));
+    if (encoded_paths == NULL || state.paths == NULL || state.files == NULL) {
+        PyErr_NoMemory();
+        goto exit;
+    }
+
+    for (i = 0; i < state.npaths; ++i) {
+        if (!path_as_bytes(
+                PySequence_Fast_GET_ITEM(paths_seq, i), &encoded_paths[i])) {
+            goto exit;
+        }
+        state.paths[i] = PyBytes_AS_STRING(encoded_paths[i]);
+    }
+
+    if (nthreads <= 0) {
+        nthreads = get_cpu_count();
+    }
+    if (nthreads > state.npaths) {
+        nthreads = state.npaths > 0 ? (int)state.npaths : 1;
+    }
+
+    state.lock = PyThread_allocate_lock();
+    state.done = PyThread_allocate_lock();
+    if (state.lock == NULL || state.done == NULL) {
+        PyErr_SetString(PyExc_MemoryError, "Unable to allocate lock");
+        goto exit;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    run_scan(&state, nthreads);
+    Py_END_ALLOW_THREADS
+
+    result = PyList_New(0);
+    if (result == NULL) {
+        goto exit;
+    }
+
+    for (i = 0; i < state.npaths; ++i) {
+        for (k = 0; k < state.files[i].num_records; ++k) {
+            record = PyTuple_New(nfields);
+            if (record == NULL) {
+                goto fail;
+            }
+            for (j = 0; j < nfields; ++j) {
+                value = field_to_python(
+                    PySequence_Fast_GET_ITEM(paths_seq, i),
+                    &state.files[i].records[k], fields[j]);
+                if (value == NULL) {
+                    Py_DECREF(record);
+                    goto fail;
+                }
+                PyTuple_SET_ITEM(record, j, value);
+            }
+            if (PyList_Append(result, record)) {
+                Py_DECREF(record);
+                goto fail;
+            }
+            Py_DECREF(record);
+        }
+    }
+
+    goto exit;
+
+ fail:
+
+    Py_CLEAR(result);
+
+ exit:
+
+    if (state.files != NULL) {
+        for (i = 0; i < state.npaths; ++i) {
+            for (k = 0; k < state.files[i].num_records; ++k) {
+                free_record(&state.files[i].records[k]);
+            }
+            free(state.files[i].records);
+        }
+        free(state.files);
+    }
+    if (encoded_paths != NULL) {
+        for (i = 0; i < state.npaths; ++i) {
+            Py_XDECREF(encoded_paths[i]);
+        }
+        free(encoded_paths);
+    }
+    free(state.paths);
+    if (state.lock != NULL) {
+        PyThread_free_lock(state.lock);
+    }
+    if (state.done != NULL) {
+        PyThread_free_lock(state.done);
+    }
+    Py_XDECREF(paths_seq);
+    free(fields);
+
+    return result;
+}
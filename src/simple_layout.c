@@ -28,26 +28,253 @@ either expressed or implied, of the FreeBSD Project.
 */
 
 #include <limits.h>
+#include <string.h>
 
 #include "simple_layout.h"
+#include "metrics_cache.h"
+#include "outline_cache.h"
+
+#include FT_ADVANCES_H
 
 #define FROM_FT_FIXED(v) (((double)(v) / (double)(1 << 16)))
+/* The positions are exact multiples of 1/65536, so this is lossless */
+#define TO_PEN(v) ((FT_Pos)((v) * (double)(1 << 16)))
 
 
-FT_Error ftpy_calculate_simple_layout(
-    FT_Face face, FT_Int32 load_flags, const uint32_t *text, size_t text_length,
-    ftpy_Layout *layout)
+void
+ftpy_bbox_set_empty(FT_BBox *bbox)
+{
+    bbox->xMin = bbox->yMin = LONG_MAX;
+    bbox->xMax = bbox->yMax = LONG_MIN;
+}
+
+
+/* Gets just the advance of a glyph, in 26.6.  This avoids loading the
+   glyph if it isn't already cached and FreeType can get the advance
+   directly from the font's metrics tables. */
+static FT_Error
+get_advance(
+    FT_Face face, ftpy_LRU *metrics_cache, FT_Int32 load_flags,
+    FT_UInt glyph_index, FT_Pos *advance)
+{
+    ftpy_Metrics_Cache_Entry *metrics;
+    FT_Fixed fixed_advance;
+    FT_Error error;
+
+    metrics = ftpy_metrics_cache_find(metrics_cache, face, load_flags, glyph_index);
+    if (metrics != NULL) {
+        *advance = metrics->advance.x;
+        return 0;
+    }
+
+    /* Hinting may change the advance, so the font's metrics can only
+       be used directly for unhinted glyphs */
+    if ((load_flags & FT_LOAD_NO_HINTING) && !(load_flags & FT_LOAD_NO_SCALE)) {
+        error = FT_Get_Advance(
+            face, glyph_index, load_flags | FT_ADVANCE_FLAG_FAST_ONLY,
+            &fixed_advance);
+        if (!error) {
+            /* Round from 16.16 to 26.6, as FT_Load_Glyph does */
+            *advance = (fixed_advance + (1 << 9)) >> 10;
+            return 0;
+        }
+    }
+
+    error = ftpy_metrics_cache_get(
+        metrics_cache, face, load_flags, glyph_index, &metrics);
+    if (error) {
+        return error;
+    }
+
+    *advance = metrics->advance.x;
+    return 0;
+}
+
+
+FT_Error
+ftpy_simple_layout_run(
+    FT_Face face, ftpy_LRU *metrics_cache, ftpy_Kerning_Cache *kerning_cache,
+    FT_Int32 load_flags,
+    const uint32_t *text, size_t text_length, FT_Vector *pen,
+    FT_ULong *glyph_indices, ftpy_Layout_Vector *xys, FT_BBox *ink_bbox)
 {
     FT_ULong charcode;
     FT_UInt glyph_index, previous_glyph_index;
+    int vertical = (load_flags & FT_LOAD_VERTICAL_LAYOUT) != 0;
     int use_kerning = 1;
     unsigned int kerning_mode;
-    FT_Vector pen;
+    ftpy_Kerning_Table *kerning_table = NULL;
+    FT_Vector origin;
     FT_Vector delta;
-    FT_Glyph glyph;
+    ftpy_Metrics_Cache_Entry *metrics;
     FT_BBox glyph_bbox;
+    FT_Vector advance;
     size_t i;
-    FT_Error status = 1;
+    FT_Error status;
+
+    /* Fonts only have kerning for horizontal text */
+    use_kerning = FT_HAS_KERNING(face) && !vertical;
+    if (load_flags & FT_LOAD_NO_SCALE) {
+        kerning_mode = FT_KERNING_UNSCALED;
+    } else if (load_flags & FT_LOAD_NO_HINTING) {
+        kerning_mode = FT_KERNING_UNFITTED;
+    } else {
+        kerning_mode = FT_KERNING_DEFAULT;
+    }
+
+    if (use_kerning) {
+        status = ftpy_kerning_cache_get_table(
+            kerning_cache, face, kerning_mode, &kerning_table);
+        if (status) {
+            return status;
+        }
+    }
+
+    previous_glyph_index = 0;
+
+    for (i = 0; i < text_length; ++i) {
+        /* This assumes the font encoding is Unicode */
+        charcode = text[i];
+
+        glyph_index = FT_Get_Char_Index(face, charcode);
+        if (use_kerning && previous_glyph_index && glyph_index) {
+            status = ftpy_kerning_cache_get(
+                kerning_cache, face, kerning_table,
+                previous_glyph_index, glyph_index, &delta);
+            if (status) {
+                return status;
+            }
+            /* The kerning is in 26.6, but the pen is in 16.16 */
+            pen->x += delta.x << 10;
+        }
+
+        if (glyph_indices != NULL) {
+            glyph_indices[i] = glyph_index;
+        }
+
+        origin = *pen;
+
+        if (ink_bbox != NULL || vertical) {
+            status = ftpy_metrics_cache_get(
+                metrics_cache, face, load_flags, glyph_index, &metrics);
+            if (status) {
+                return status;
+            }
+
+            if (vertical) {
+                /* The pen is on the glyph's vertical origin, at the
+                   top center, but glyphs are positioned by their
+                   horizontal origin */
+                origin.x += (metrics->metrics.vertBearingX -
+                             metrics->metrics.horiBearingX) << 10;
+                origin.y -= (metrics->metrics.vertBearingY +
+                             metrics->metrics.horiBearingY) << 10;
+            }
+
+            if (ink_bbox != NULL) {
+                glyph_bbox = metrics->bbox;
+                glyph_bbox.xMin += origin.x >> 10;
+                glyph_bbox.yMin += origin.y >> 10;
+                glyph_bbox.xMax += origin.x >> 10;
+                glyph_bbox.yMax += origin.y >> 10;
+                if (glyph_bbox.xMin < ink_bbox->xMin)
+                    ink_bbox->xMin = glyph_bbox.xMin;
+                if (glyph_bbox.yMin < ink_bbox->yMin)
+                    ink_bbox->yMin = glyph_bbox.yMin;
+                if (glyph_bbox.xMax > ink_bbox->xMax)
+                    ink_bbox->xMax = glyph_bbox.xMax;
+                if (glyph_bbox.yMax > ink_bbox->yMax)
+                    ink_bbox->yMax = glyph_bbox.yMax;
+            }
+
+            advance = metrics->advance;
+        } else {
+            status = get_advance(
+                face, metrics_cache, load_flags, glyph_index, &advance.x);
+            if (status) {
+                return status;
+            }
+            advance.y = 0;
+        }
+
+        if (xys != NULL) {
+            xys[i].x = FROM_FT_FIXED(origin.x);
+            xys[i].y = FROM_FT_FIXED(origin.y);
+        }
+
+        /* The pen is in 16.16, like FT_Glyph's advance.  With
+           FT_LOAD_VERTICAL_LAYOUT, the advance points up, but the
+           text runs down. */
+        if (vertical) {
+            pen->x -= advance.x << 10;
+            pen->y -= advance.y << 10;
+        } else {
+            pen->x += advance.x << 10;
+        }
+
+        previous_glyph_index = glyph_index;
+    }
+
+    return 0;
+}
+
+
+void
+ftpy_simple_layout_bbox(
+    FT_Face face, FT_Int32 load_flags, const FT_Vector *pen, FT_BBox *bbox)
+{
+    FT_Pos line_height;
+
+    if (load_flags & FT_LOAD_VERTICAL_LAYOUT) {
+        /* The line is as wide as the face's horizontal lines are
+           high, centered on the vertical origins */
+        line_height = face->size->metrics.ascender - face->size->metrics.descender;
+        bbox->xMin = -line_height / 2;
+        bbox->xMax = line_height - line_height / 2;
+        bbox->yMax = 0;
+        bbox->yMin = pen->y >> 10;
+    } else {
+        bbox->xMin = 0;
+        bbox->xMax = pen->x >> 10;
+        bbox->yMax = face->size->metrics.ascender;
+        bbox->yMin = face->size->metrics.descender;
+    }
+}
+
+
+/* Lays out the whole text as a single run.  glyph_indices, xys and
+   ink_bbox may be NULL if they aren't needed. */
+static FT_Error
+simple_layout(
+    FT_Face face, ftpy_LRU *metrics_cache, ftpy_Kerning_Cache *kerning_cache,
+    FT_Int32 load_flags,
+    const uint32_t *text, size_t text_length,
+    FT_ULong *glyph_indices, ftpy_Layout_Vector *xys,
+    FT_BBox *layout_bbox, FT_BBox *ink_bbox)
+{
+    FT_Vector pen = {0, 0};
+    FT_Error status;
+
+    if (ink_bbox != NULL) {
+        ftpy_bbox_set_empty(ink_bbox);
+    }
+
+    status = ftpy_simple_layout_run(
+        face, metrics_cache, kerning_cache, load_flags, text, text_length,
+        &pen, glyph_indices, xys, ink_bbox);
+
+    ftpy_simple_layout_bbox(face, load_flags, &pen, layout_bbox);
+
+    return status;
+}
+
+
+FT_Error ftpy_calculate_simple_layout(
+    FT_Face face, ftpy_LRU *metrics_cache, ftpy_Kerning_Cache *kerning_cache,
+    FT_Int32 load_flags,
+    const uint32_t *text, size_t text_length, ftpy_Layout *layout)
+{
+    FT_Error status = FT_Err_Out_Of_Memory;
 
     layout->glyph_indices = NULL;
     layout->xys = NULL;
@@ -64,83 +291,617 @@ FT_Error ftpy_calculate_simple_layout(
 
     layout->size = text_length;
 
-    layout->layout_bbox.xMin = 0;
-    layout->layout_bbox.xMax = 0;
-    layout->layout_bbox.yMax = face->size->metrics.ascender;
-    layout->layout_bbox.yMin = face->size->metrics.descender;
+    status = simple_layout(
+        face, metrics_cache, kerning_cache, load_flags, text, text_length,
+        layout->glyph_indices, layout->xys,
+        &layout->layout_bbox, &layout->ink_bbox);
 
-    layout->ink_bbox.xMin = layout->ink_bbox.yMin = LONG_MAX;
-    layout->ink_bbox.xMax = layout->ink_bbox.yMax = LONG_MIN;
+ exit:
 
-    use_kerning = FT_HAS_KERNING(face);
-    if (load_flags & FT_LOAD_NO_SCALE) {
-        kerning_mode = FT_KERNING_UNSCALED;
-    } else if (load_flags & FT_LOAD_NO_HINTING) {
-        kerning_mode = FT_KERNING_UNFITTED;
+    if (status != 0) {
+        free(layout->glyph_indices);
+        layout->glyph_indices = NULL;
+        free(layout->xys);
+        layout->xys = NULL;
+    }
+
+    return status;
+}
+
+
+FT_Error ftpy_measure_simple_layout(
+    FT_Face face, ftpy_LRU *metrics_cache, ftpy_Kerning_Cache *kerning_cache,
+    FT_Int32 load_flags,
+    const uint32_t *text, size_t text_length,
+    FT_BBox *layout_bbox, FT_BBox *ink_bbox)
+{
+    return simple_layout(
+        face, metrics_cache, kerning_cache, load_flags, text, text_length,
+        NULL, NULL, layout_bbox, ink_bbox);
+}
+
+
+FT_Error ftpy_calculate_simple_layouts(
+    FT_Face face, ftpy_LRU *metrics_cache, ftpy_Kerning_Cache *kerning_cache,
+    FT_Int32 load_flags,
+    const uint32_t *text, const size_t *offsets, size_t count,
+    FT_ULong *glyph_indices, ftpy_Layout_Vector *xys,
+    FT_BBox *layout_bboxes, FT_BBox *ink_bboxes)
+{
+    size_t i;
+    size_t start;
+    FT_Error status = 0;
+
+    for (i = 0; i < count && !status; ++i) {
+        start = offsets[i];
+        status = simple_layout(
+            face, metrics_cache, kerning_cache, load_flags,
+            text + start, offsets[i + 1] - start,
+            glyph_indices + start, xys + start,
+            &layout_bboxes[i], &ink_bboxes[i]);
+    }
+
+    return status;
+}
+
+
+/* Gets the pen position before a glyph that has already been laid
+   out at xy, or after it if after is set */
+static FT_Error
+get_glyph_pen(
+    FT_Face face, ftpy_LRU *metrics_cache, FT_Int32 load_flags,
+    FT_UInt glyph_index, const ftpy_Layout_Vector *xy, int after,
+    FT_Vector *pen)
+{
+    int vertical = (load_flags & FT_LOAD_VERTICAL_LAYOUT) != 0;
+    ftpy_Metrics_Cache_Entry *metrics;
+    FT_Error status;
+
+    pen->x = TO_PEN(xy->x);
+    pen->y = TO_PEN(xy->y);
+
+    if (!vertical && !after) {
+        return 0;
+    }
+
+    status = ftpy_metrics_cache_get(
+        metrics_cache, face, load_flags, glyph_index, &metrics);
+    if (status) {
+        return status;
+    }
+
+    if (vertical) {
+        pen->x -= (metrics->metrics.vertBearingX -
+                   metrics->metrics.horiBearingX) << 10;
+        pen->y += (metrics->metrics.vertBearingY +
+                   metrics->metrics.horiBearingY) << 10;
+        if (after) {
+            pen->x -= metrics->advance.x << 10;
+            pen->y -= metrics->advance.y << 10;
+        }
     } else {
-        kerning_mode = FT_KERNING_DEFAULT;
+        pen->x += metrics->advance.x << 10;
     }
 
-    pen.x = 0;
-    pen.y = 0;
-    previous_glyph_index = 0;
+    return 0;
+}
 
-    for (i = 0; i < text_length; ++i) {
-        /* This assumes the font encoding is Unicode */
-        charcode = text[i];
 
-        glyph_index = FT_Get_Char_Index(face, charcode);
-        if (use_kerning && previous_glyph_index && glyph_index) {
-            FT_Get_Kerning(
-                face, previous_glyph_index, glyph_index,
-                kerning_mode, &delta);
-            pen.x += delta.x;
+FT_Error ftpy_splice_simple_layout(
+    FT_Face face, ftpy_LRU *metrics_cache, ftpy_Kerning_Cache *kerning_cache,
+    FT_Int32 load_flags,
+    const uint32_t *text, size_t start, size_t end, size_t new_length,
+    ftpy_Layout *layout)
+{
+    size_t old_size = layout->size;
+    size_t size = old_size - (end - start) + new_length;
+    size_t first, last, length, i;
+    int has_tail = end < old_size;
+    FT_Vector old_tail;
+    FT_Vector pen = {0, 0};
+    FT_Vector delta = {0, 0};
+    ftpy_Layout_Vector last_xy;
+    FT_ULong *run_glyph_indices;
+    ftpy_Layout_Vector *run_xys;
+    FT_BBox ink_bbox;
+    FT_Error status;
+
+    /* The glyphs on either side of the edit are laid out again, since
+       their kerning with the new text may differ.  Everything after
+       that only moves. */
+    first = start > 0 ? start - 1 : 0;
+    last = start + new_length + (has_tail ? 1 : 0);
+    length = last - first;
+
+    /* Everything that can fail is done into these, before the layout
+       is touched, so that it is left as it was on error */
+    run_glyph_indices = malloc(sizeof(FT_ULong) * (length ? length : 1));
+    run_xys = malloc(sizeof(ftpy_Layout_Vector) * (length ? length : 1));
+    if (run_glyph_indices == NULL || run_xys == NULL) {
+        status = FT_Err_Out_Of_Memory;
+        goto exit;
+    }
+
+    if (first < start) {
+        status = get_glyph_pen(
+            face, metrics_cache, load_flags, layout->glyph_indices[first],
+            &layout->xys[first], 0, &pen);
+        if (status) {
+            goto exit;
         }
+    }
+
+    /* The ink box is recomputed as a whole later.  Passing one here
+       gets the (possibly transformed) advances from the metrics
+       cache, like the original layout. */
+    ftpy_bbox_set_empty(&ink_bbox);
+    status = ftpy_simple_layout_run(
+        face, metrics_cache, kerning_cache, load_flags,
+        text + first, length, &pen, run_glyph_indices, run_xys, &ink_bbox);
+    if (status) {
+        goto exit;
+    }
 
-        layout->glyph_indices[i] = glyph_index;
+    if (has_tail) {
+        old_tail.x = TO_PEN(layout->xys[end].x);
+        old_tail.y = TO_PEN(layout->xys[end].y);
+        delta.x = TO_PEN(run_xys[length - 1].x) - old_tail.x;
+        delta.y = TO_PEN(run_xys[length - 1].y) - old_tail.y;
 
-        status = FT_Load_Glyph(face, glyph_index, load_flags);
+        last_xy.x = FROM_FT_FIXED(TO_PEN(layout->xys[old_size - 1].x) + delta.x);
+        last_xy.y = FROM_FT_FIXED(TO_PEN(layout->xys[old_size - 1].y) + delta.y);
+        status = get_glyph_pen(
+            face, metrics_cache, load_flags, layout->glyph_indices[old_size - 1],
+            &last_xy, 1, &pen);
         if (status) {
             goto exit;
         }
 
-        status = FT_Get_Glyph(face->glyph, &glyph);
+        memmove(layout->glyph_indices + start + new_length,
+                layout->glyph_indices + end,
+                sizeof(FT_ULong) * (old_size - end));
+        memmove(layout->xys + start + new_length,
+                layout->xys + end,
+                sizeof(ftpy_Layout_Vector) * (old_size - end));
+
+        if (delta.x != 0 || delta.y != 0) {
+            for (i = last; i < size; ++i) {
+                layout->xys[i].x = FROM_FT_FIXED(TO_PEN(layout->xys[i].x) + delta.x);
+                layout->xys[i].y = FROM_FT_FIXED(TO_PEN(layout->xys[i].y) + delta.y);
+            }
+        }
+    }
+
+    memcpy(layout->glyph_indices + first, run_glyph_indices,
+           sizeof(FT_ULong) * length);
+    memcpy(layout->xys + first, run_xys, sizeof(ftpy_Layout_Vector) * length);
+    layout->size = size;
+
+    ftpy_simple_layout_bbox(face, load_flags, &pen, &layout->layout_bbox);
+
+ exit:
+
+    free(run_glyph_indices);
+    free(run_xys);
+
+    return status;
+}
+
+
+FT_Error ftpy_simple_layout_ink_bbox(
+    FT_Face face, ftpy_LRU *metrics_cache, FT_Int32 load_flags,
+    ftpy_Layout *layout)
+{
+    ftpy_Metrics_Cache_Entry *metrics;
+    FT_Pos x, y;
+    size_t i;
+    FT_Error status;
+
+    ftpy_bbox_set_empty(&layout->ink_bbox);
+
+    for (i = 0; i < layout->size; ++i) {
+        status = ftpy_metrics_cache_get(
+            metrics_cache, face, load_flags, layout->glyph_indices[i], &metrics);
+        if (status) {
+            return status;
+        }
+
+        x = TO_PEN(layout->xys[i].x) >> 10;
+        y = TO_PEN(layout->xys[i].y) >> 10;
+        if (metrics->bbox.xMin + x < layout->ink_bbox.xMin)
+            layout->ink_bbox.xMin = metrics->bbox.xMin + x;
+        if (metrics->bbox.yMin + y < layout->ink_bbox.yMin)
+            layout->ink_bbox.yMin = metrics->bbox.yMin + y;
+        if (metrics->bbox.xMax + x > layout->ink_bbox.xMax)
+            layout->ink_bbox.xMax = metrics->bbox.xMax + x;
+        if (metrics->bbox.yMax + y > layout->ink_bbox.yMax)
+            layout->ink_bbox.yMax = metrics->bbox.yMax + y;
+    }
+
+    return 0;
+}
+
+
+static void
+add_to_bbox(FT_BBox *bbox, FT_Pos x, FT_Pos y)
+{
+    if (x < bbox->xMin) bbox->xMin = x;
+    if (y < bbox->yMin) bbox->yMin = y;
+    if (x > bbox->xMax) bbox->xMax = x;
+    if (y > bbox->yMax) bbox->yMax = y;
+}
+
+
+FT_Error ftpy_transform_simple_layout(
+    FT_Face face, FT_Matrix *transform, FT_Vector *delta,
+    ftpy_LRU *outline_cache, FT_Int32 load_flags,
+    const ftpy_Layout *layout, const FT_Matrix *matrix,
+    const ftpy_Layout_Vector *offset,
+    ftpy_Layout_Vector *xys, FT_BBox *ink_bbox)
+{
+    double xx = FROM_FT_FIXED(matrix->xx);
+    double xy = FROM_FT_FIXED(matrix->xy);
+    double yx = FROM_FT_FIXED(matrix->yx);
+    double yy = FROM_FT_FIXED(matrix->yy);
+    ftpy_Outline_Cache_Entry *entry;
+    FT_Outline outline;
+    FT_Vector *points = NULL;
+    FT_Vector *new_points;
+    size_t points_capacity = 0;
+    FT_Vector corner;
+    FT_BBox glyph_bbox;
+    FT_Pos x, y;
+    size_t i;
+    int j;
+    FT_Error status = 0;
+
+    ftpy_bbox_set_empty(ink_bbox);
+
+    for (i = 0; i < layout->size; ++i) {
+        xys[i].x = xx * layout->xys[i].x + xy * layout->xys[i].y + offset->x;
+        xys[i].y = yx * layout->xys[i].x + yy * layout->xys[i].y + offset->y;
+
+        status = ftpy_outline_cache_get(
+            outline_cache, face, transform, delta, load_flags,
+            layout->glyph_indices[i], &entry);
+        if (status) {
+            break;
+        }
+
+        /* The bounding box of the transformed outline is exact, where
+           that of the transformed bounding box would not be */
+        if (entry->outline.n_points > 0) {
+            if ((size_t)entry->outline.n_points > points_capacity) {
+                points_capacity = entry->outline.n_points * 2;
+                new_points = realloc(points, sizeof(FT_Vector) * points_capacity);
+                if (new_points == NULL) {
+                    status = FT_Err_Out_Of_Memory;
+                    break;
+                }
+                points = new_points;
+            }
+
+            outline = entry->outline;
+            outline.points = points;
+            for (j = 0; j < outline.n_points; ++j) {
+                points[j] = entry->outline.points[j];
+                FT_Vector_Transform(&points[j], matrix);
+            }
+
+            status = FT_Outline_Get_BBox(&outline, &glyph_bbox);
+            if (status) {
+                break;
+            }
+        } else {
+            ftpy_bbox_set_empty(&glyph_bbox);
+            for (j = 0; j < 4; ++j) {
+                corner.x = (j & 1) ? entry->bbox.xMax : entry->bbox.xMin;
+                corner.y = (j & 2) ? entry->bbox.yMax : entry->bbox.yMin;
+                FT_Vector_Transform(&corner, matrix);
+                add_to_bbox(&glyph_bbox, corner.x, corner.y);
+            }
+        }
+
+        /* Truncated to 26.6, as in the untransformed layout */
+        x = TO_PEN(xys[i].x) >> 10;
+        y = TO_PEN(xys[i].y) >> 10;
+        add_to_bbox(ink_bbox, glyph_bbox.xMin + x, glyph_bbox.yMin + y);
+        add_to_bbox(ink_bbox, glyph_bbox.xMax + x, glyph_bbox.yMax + y);
+    }
+
+    free(points);
+
+    return status;
+}
+
+
+/****************************************************************************
+ Paragraphs
+*/
+
+
+/* Breaking spaces, which hang at the end of a line */
+static int
+is_space(uint32_t c)
+{
+    return (c == 0x20 || c == 0x09 || c == 0x1680 ||
+            (c >= 0x2000 && c <= 0x2006) || (c >= 0x2008 && c <= 0x200a) ||
+            c == 0x205f || c == 0x3000);
+}
+
+
+static int
+is_mandatory_break(uint32_t c)
+{
+    return ((c >= 0x0a && c <= 0x0d) || c == 0x85 || c == 0x2028 || c == 0x2029);
+}
+
+
+/* Ideographs and syllables that may be broken between (UAX #14 class
+   ID, and the Hangul classes) */
+static int
+is_ideographic(uint32_t c)
+{
+    return ((c >= 0x2e80 && c <= 0x2fff) || (c >= 0x3040 && c <= 0x31ff) ||
+            (c >= 0x3400 && c <= 0x4dbf) || (c >= 0x4e00 && c <= 0x9fff) ||
+            (c >= 0xa000 && c <= 0xa4cf) || (c >= 0xac00 && c <= 0xd7af) ||
+            (c >= 0xf900 && c <= 0xfaff) || (c >= 0x20000 && c <= 0x3fffd));
+}
+
+
+/* Closing punctuation, which must stay with what precedes it */
+static int
+is_closing(uint32_t c)
+{
+    switch (c) {
+    case ')': case ']': case '}': case '!': case '?': case ',': case '.':
+    case ':': case ';': case 0x3001: case 0x3002: case 0x3009: case 0x300b:
+    case 0x300d: case 0x300f: case 0x3011: case 0xff01: case 0xff09:
+    case 0xff0c: case 0xff0e: case 0xff1a: case 0xff1b: case 0xff1f:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+
+/* Opening punctuation, which must stay with what follows it */
+static int
+is_opening(uint32_t c)
+{
+    switch (c) {
+    case '(': case '[': case '{': case 0x3008: case 0x300a: case 0x300c:
+    case 0x300e: case 0x3010: case 0xff08:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+
+/* Whether a line may be broken between the characters a and b */
+static int
+can_break_between(uint32_t a, uint32_t b)
+{
+    if (is_space(b) || is_mandatory_break(b) || is_closing(b)) {
+        return 0;
+    }
+    if (is_space(a) || a == 0x200b) {
+        return 1;
+    }
+    if (is_opening(a)) {
+        return 0;
+    }
+    if ((a == '-' || a == 0x2010 || a == 0x2013) && !(b >= '0' && b <= '9')) {
+        return 1;
+    }
+    return is_ideographic(a) || is_ideographic(b);
+}
+
+
+typedef struct {
+    /* The pen position (in 16.16) after the glyph */
+    FT_Pos end;
+    /* The ink of the glyph, relative to its origin, in 26.6 */
+    FT_BBox bbox;
+} paragraph_glyph;
+
+
+static int
+add_line(
+    const uint32_t *text, ftpy_Layout *layout, const paragraph_glyph *glyphs,
+    size_t start, size_t end, FT_Pos baseline,
+    FT_Pos ascender, FT_Pos descender,
+    ftpy_Layout_Line **lines, size_t *nlines, size_t *capacity)
+{
+    ftpy_Layout_Line *line;
+    ftpy_Layout_Line *new_lines;
+    size_t content_end = end;
+    FT_Pos offset = 0;
+    FT_Pos x;
+    size_t i;
+
+    if (*nlines == *capacity) {
+        *capacity = *capacity ? *capacity * 2 : 8;
+        new_lines = realloc(*lines, sizeof(ftpy_Layout_Line) * *capacity);
+        if (new_lines == NULL) {
+            return -1;
+        }
+        *lines = new_lines;
+    }
+
+    line = &(*lines)[(*nlines)++];
+    line->start = start;
+    line->end = end;
+    line->baseline = baseline;
+
+    while (content_end > start &&
+           (is_space(text[content_end - 1]) ||
+            is_mandatory_break(text[content_end - 1]))) {
+        --content_end;
+    }
+
+    if (start < end) {
+        offset = TO_PEN(layout->xys[start].x);
+    }
+
+    line->layout_bbox.xMin = 0;
+    line->layout_bbox.xMax =
+        content_end > start ? (glyphs[content_end - 1].end - offset) >> 10 : 0;
+    line->layout_bbox.yMax = baseline + ascender;
+    line->layout_bbox.yMin = baseline + descender;
+
+    ftpy_bbox_set_empty(&line->ink_bbox);
+
+    for (i = start; i < end; ++i) {
+        x = TO_PEN(layout->xys[i].x) - offset;
+        layout->xys[i].x = FROM_FT_FIXED(x);
+        layout->xys[i].y = (double)baseline / (double)(1 << 6);
+
+        x >>= 10;
+        if (glyphs[i].bbox.xMin + x < line->ink_bbox.xMin)
+            line->ink_bbox.xMin = glyphs[i].bbox.xMin + x;
+        if (glyphs[i].bbox.yMin + baseline < line->ink_bbox.yMin)
+            line->ink_bbox.yMin = glyphs[i].bbox.yMin + baseline;
+        if (glyphs[i].bbox.xMax + x > line->ink_bbox.xMax)
+            line->ink_bbox.xMax = glyphs[i].bbox.xMax + x;
+        if (glyphs[i].bbox.yMax + baseline > line->ink_bbox.yMax)
+            line->ink_bbox.yMax = glyphs[i].bbox.yMax + baseline;
+    }
+
+    return 0;
+}
+
+
+FT_Error ftpy_calculate_paragraph_layout(
+    FT_Face face, ftpy_LRU *metrics_cache, ftpy_Kerning_Cache *kerning_cache,
+    FT_Int32 load_flags,
+    const uint32_t *text, size_t text_length, FT_Pos width, FT_Pos line_height,
+    ftpy_Layout *layout, ftpy_Layout_Line **lines, size_t *nlines)
+{
+    uint32_t *spaced_text = NULL;
+    paragraph_glyph *glyphs = NULL;
+    ftpy_Metrics_Cache_Entry *metrics;
+    FT_Pos ascender = face->size->metrics.ascender;
+    FT_Pos descender = face->size->metrics.descender;
+    size_t capacity = 0;
+    size_t start = 0;
+    size_t break_at = 0;
+    size_t i;
+    ftpy_Layout_Line *line;
+    FT_Error status = FT_Err_Out_Of_Memory;
+
+    *lines = NULL;
+    *nlines = 0;
+    layout->glyph_indices = NULL;
+    layout->xys = NULL;
+
+    /* Newlines are laid out as spaces, rather than as the missing
+       glyph most fonts map them to */
+    spaced_text = calloc(text_length ? text_length : 1, sizeof(uint32_t));
+    glyphs = malloc(sizeof(paragraph_glyph) * (text_length ? text_length : 1));
+    if (spaced_text == NULL || glyphs == NULL) {
+        goto exit;
+    }
+
+    for (i = 0; i < text_length; ++i) {
+        spaced_text[i] = is_mandatory_break(text[i]) ? 0x20 : text[i];
+    }
+
+    /* First lay out the whole paragraph as one line, and then move each
+       line's glyphs into place */
+    status = ftpy_calculate_simple_layout(
+        face, metrics_cache, kerning_cache, load_flags,
+        spaced_text, text_length, layout);
+    if (status) {
+        goto exit;
+    }
+
+    for (i = 0; i < text_length; ++i) {
+        status = ftpy_metrics_cache_get(
+            metrics_cache, face, load_flags, layout->glyph_indices[i], &metrics);
         if (status) {
             goto exit;
         }
+        glyphs[i].end = TO_PEN(layout->xys[i].x) + (metrics->advance.x << 10);
+        glyphs[i].bbox = metrics->bbox;
+    }
 
-        layout->xys[i].x = FROM_FT_FIXED(pen.x);
-        layout->xys[i].y = FROM_FT_FIXED(pen.y);
+    status = FT_Err_Out_Of_Memory;
 
-        FT_Outline_Get_BBox(&((FT_OutlineGlyph)glyph)->outline, &glyph_bbox);
-        glyph_bbox.xMin += pen.x >> 10;
-        glyph_bbox.yMin += pen.y >> 10;
-        glyph_bbox.xMax += pen.x >> 10;
-        glyph_bbox.yMax += pen.y >> 10;
-        if (glyph_bbox.xMin < layout->ink_bbox.xMin)
-            layout->ink_bbox.xMin = glyph_bbox.xMin;
-        if (glyph_bbox.yMin < layout->ink_bbox.yMin)
-            layout->ink_bbox.yMin = glyph_bbox.yMin;
-        if (glyph_bbox.xMax > layout->ink_bbox.xMax)
-            layout->ink_bbox.xMax = glyph_bbox.xMax;
-        if (glyph_bbox.yMax > layout->ink_bbox.yMax)
-            layout->ink_bbox.yMax = glyph_bbox.yMax;
+    for (i = 0; i < text_length; ++i) {
+        if (break_at > start && !is_space(text[i]) &&
+            !is_mandatory_break(text[i]) &&
+            glyphs[i].end - TO_PEN(layout->xys[start].x) > width << 10) {
+            if (add_line(text, layout, glyphs, start, break_at,
+                         -(FT_Pos)*nlines * line_height, ascender, descender,
+                         lines, nlines, &capacity)) {
+                goto exit;
+            }
+            start = break_at;
+        }
 
-        pen.x += glyph->advance.x;
-        layout->layout_bbox.xMax = pen.x >> 10;
+        if (is_mandatory_break(text[i])) {
+            /* CR LF is a single break */
+            if (text[i] == 0x0d && i + 1 < text_length && text[i + 1] == 0x0a) {
+                continue;
+            }
+            if (add_line(text, layout, glyphs, start, i + 1,
+                         -(FT_Pos)*nlines * line_height, ascender, descender,
+                         lines, nlines, &capacity)) {
+                goto exit;
+            }
+            start = break_at = i + 1;
+            continue;
+        }
 
-        previous_glyph_index = glyph_index;
+        if (i + 1 < text_length && can_break_between(text[i], text[i + 1])) {
+            break_at = i + 1;
+        }
+    }
+
+    if (start < text_length || *nlines == 0) {
+        if (add_line(text, layout, glyphs, start, text_length,
+                     -(FT_Pos)*nlines * line_height, ascender, descender,
+                     lines, nlines, &capacity)) {
+            goto exit;
+        }
+    }
+
+    layout->layout_bbox = (*lines)[0].layout_bbox;
+    ftpy_bbox_set_empty(&layout->ink_bbox);
+    for (i = 0; i < *nlines; ++i) {
+        line = &(*lines)[i];
+        if (line->layout_bbox.xMax > layout->layout_bbox.xMax)
+            layout->layout_bbox.xMax = line->layout_bbox.xMax;
+        if (line->layout_bbox.yMin < layout->layout_bbox.yMin)
+            layout->layout_bbox.yMin = line->layout_bbox.yMin;
+        if (line->ink_bbox.xMin < layout->ink_bbox.xMin)
+            layout->ink_bbox.xMin = line->ink_bbox.xMin;
+        if (line->ink_bbox.yMin < layout->ink_bbox.yMin)
+            layout->ink_bbox.yMin = line->ink_bbox.yMin;
+        if (line->ink_bbox.xMax > layout->ink_bbox.xMax)
+            layout->ink_bbox.xMax = line->ink_bbox.xMax;
+        if (line->ink_bbox.yMax > layout->ink_bbox.yMax)
+            layout->ink_bbox.yMax = line->ink_bbox.yMax;
     }
 
     status = 0;
 
  exit:
 
+    free(spaced_text);
+    free(glyphs);
+
     if (status != 0) {
+        free(*lines);
+        *lines = NULL;
+        *nlines = 0;
         free(layout->glyph_indices);
         layout->glyph_indices = NULL;
         free(layout->xys);
         layout->xys = NULL;
+        layout->size = 0;
     }
 
     return status;
@@ -38,6 +38,9 @@ either expressed or implied, of the FreeBSD Project.
 #include FT_BBOX_H
 #include FT_OUTLINE_H
 
+#include "kerning_cache.h"
+#include "lru.h"
+
 
 typedef struct {
     double x;
@@ -54,9 +57,123 @@ typedef struct {
 } ftpy_Layout;
 
 
+/* One line of a paragraph layout.  The glyphs from start to end
+   (exclusive) are on the line, including any trailing spaces, which
+   are not counted in the layout_bbox. */
+typedef struct {
+    size_t start;
+    size_t end;
+    /* The y position of the baseline, in 26.6.  The first line's is
+       0, and later lines are below it, at negative y. */
+    FT_Pos baseline;
+    FT_BBox layout_bbox;
+    FT_BBox ink_bbox;
+} ftpy_Layout_Line;
+
+
 FT_Error ftpy_calculate_simple_layout(
-    FT_Face face, FT_Int32 load_flags, const uint32_t *text, size_t text_length,
+    FT_Face face, ftpy_LRU *metrics_cache, ftpy_Kerning_Cache *kerning_cache,
+    FT_Int32 load_flags,
+    const uint32_t *text, size_t text_length, ftpy_Layout *layout);
+
+
+/* Lays out one run of text in a single face, starting with the pen at
+   *pen (in 16.16) and leaving it after the last glyph.  Each glyph's
+   ink is added to ink_bbox, which should start out empty or hold the
+   ink of earlier runs.  glyph_indices, xys and ink_bbox may be NULL if
+   they aren't needed.
+
+   If load_flags has FT_LOAD_VERTICAL_LAYOUT, the text runs downward,
+   using the glyphs' vertical metrics, and without kerning.  The pen
+   is then on the glyphs' vertical origins, but xys are still the
+   horizontal origins that the glyphs are drawn from. */
+FT_Error ftpy_simple_layout_run(
+    FT_Face face, ftpy_LRU *metrics_cache, ftpy_Kerning_Cache *kerning_cache,
+    FT_Int32 load_flags,
+    const uint32_t *text, size_t text_length, FT_Vector *pen,
+    FT_ULong *glyph_indices, ftpy_Layout_Vector *xys, FT_BBox *ink_bbox);
+
+
+/* Gets the logical bounding box of a line laid out from (0, 0) to
+   pen, in 26.6.  A horizontal line spans the face's ascender and
+   descender.  A vertical line is as wide as that, centered on x = 0. */
+void ftpy_simple_layout_bbox(
+    FT_Face face, FT_Int32 load_flags, const FT_Vector *pen, FT_BBox *bbox);
+
+
+/* Sets bbox to an empty box, that any other box will replace when
+   combined with it. */
+void ftpy_bbox_set_empty(FT_BBox *bbox);
+
+
+/* Computes only the bounding boxes of the layout.  If ink_bbox is
+   NULL, only the advances are needed, and glyphs that are not already
+   cached are not loaded if it can be avoided.  Since the advances
+   read from the font aren't transformed, ink_bbox must be given if
+   the face has a transform. */
+FT_Error ftpy_measure_simple_layout(
+    FT_Face face, ftpy_LRU *metrics_cache, ftpy_Kerning_Cache *kerning_cache,
+    FT_Int32 load_flags,
+    const uint32_t *text, size_t text_length,
+    FT_BBox *layout_bbox, FT_BBox *ink_bbox);
+
+
+/* Lays out count strings, packed end to end in text.  String i is
+   text[offsets[i]:offsets[i + 1]], and its glyphs are written to the
+   same range of glyph_indices and xys.  Each string starts at (0, 0),
+   and its bounding boxes are written to layout_bboxes[i] and
+   ink_bboxes[i]. */
+FT_Error ftpy_calculate_simple_layouts(
+    FT_Face face, ftpy_LRU *metrics_cache, ftpy_Kerning_Cache *kerning_cache,
+    FT_Int32 load_flags,
+    const uint32_t *text, const size_t *offsets, size_t count,
+    FT_ULong *glyph_indices, ftpy_Layout_Vector *xys,
+    FT_BBox *layout_bboxes, FT_BBox *ink_bboxes);
+
+
+/* Replaces the glyphs for text[start:end] of the layout with ones for
+   new_length characters.  text is the whole of the new text.  Only the
+   new glyphs and their neighbors are laid out again, and the glyphs
+   after them are moved.  The layout's arrays must already have room
+   for the new size.  On error, the layout is left unchanged.  The
+   ink_bbox is left stale; see ftpy_simple_layout_ink_bbox. */
+FT_Error ftpy_splice_simple_layout(
+    FT_Face face, ftpy_LRU *metrics_cache, ftpy_Kerning_Cache *kerning_cache,
+    FT_Int32 load_flags,
+    const uint32_t *text, size_t start, size_t end, size_t new_length,
     ftpy_Layout *layout);
 
 
+/* Recomputes the layout's ink_bbox from its glyphs' cached metrics. */
+FT_Error ftpy_simple_layout_ink_bbox(
+    FT_Face face, ftpy_LRU *metrics_cache, FT_Int32 load_flags,
+    ftpy_Layout *layout);
+
+
+/* Transforms the glyph positions of the layout by matrix, and then
+   moves them by offset (in pixels), writing them to xys.  ink_bbox is
+   set to the exact bounding box of the transformed glyphs, from their
+   cached outlines.  transform and delta are the face's own transform,
+   which is not applied.  See outline_cache.h */
+FT_Error ftpy_transform_simple_layout(
+    FT_Face face, FT_Matrix *transform, FT_Vector *delta,
+    ftpy_LRU *outline_cache, FT_Int32 load_flags,
+    const ftpy_Layout *layout, const FT_Matrix *matrix,
+    const ftpy_Layout_Vector *offset,
+    ftpy_Layout_Vector *xys, FT_BBox *ink_bbox);
+
+
+/* Lays out the text as a paragraph, breaking it into lines no wider
+   than width (in 26.6) where possible, with line_height (in 26.6)
+   between baselines.  Lines are broken at spaces, after hyphens,
+   around ideographs and at newlines, roughly following UAX #14.  A
+   word wider than width is left to overflow its line.  The lines are
+   returned in a new array in *lines, which the caller must free. */
+FT_Error ftpy_calculate_paragraph_layout(
+    FT_Face face, ftpy_LRU *metrics_cache, ftpy_Kerning_Cache *kerning_cache,
+    FT_Int32 load_flags,
+    const uint32_t *text, size_t text_length, FT_Pos width, FT_Pos line_height,
+    ftpy_Layout *layout, ftpy_Layout_Line **lines, size_t *nlines);
+
+
 #endif